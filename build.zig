@@ -53,6 +53,25 @@ pub fn build(b: *std.Build) void {
     c_lib.root_module.addImport("simd_json_parser", simd_json_mod);
     b.installArtifact(c_lib);
 
+    // Same C API as a static, position-independent archive for linking
+    // straight into the Python extension (DHI_STATIC=1 in setup.py): calls
+    // become direct instead of going through the PLT and there is no
+    // runtime rpath dependency on libdhi.
+    const c_lib_static = b.addLibrary(.{
+        .name = "dhi_static",
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/c_api.zig"),
+            .target = target,
+            .optimize = optimize,
+            .pic = true,
+        }),
+        .linkage = .static,
+    });
+    c_lib_static.bundle_compiler_rt = true;
+    c_lib_static.root_module.addImport("validator", validator_mod);
+    c_lib_static.root_module.addImport("simd_json_parser", simd_json_mod);
+    b.installArtifact(c_lib_static);
+
     // Build WASM library for JavaScript bindings
     const wasm_lib = b.addExecutable(.{
         .name = "dhi",
@@ -256,6 +275,18 @@ pub fn build(b: *std.Build) void {
 
     const run_simd_json_tests = b.addRunArtifact(simd_json_tests);
 
+    // Tests for the Envoy filter's streaming body scanner (native target;
+    // proxy-wasm host calls are stubbed under builtin.is_test)
+    const envoy_filter_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/envoy_wasm_filter.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+
+    const run_envoy_filter_tests = b.addRunArtifact(envoy_filter_tests);
+
     // Test step runs all tests
     const test_step = b.step("test", "Run unit tests");
     test_step.dependOn(&run_validator_tests.step);
@@ -263,6 +294,7 @@ pub fn build(b: *std.Build) void {
     test_step.dependOn(&run_json_validator_tests.step);
     test_step.dependOn(&run_model_tests.step);
     test_step.dependOn(&run_simd_json_tests.step);
+    test_step.dependOn(&run_envoy_filter_tests.step);
 
     // Additional modules for comprehensive benchmarks
     const batch_validator_mod = b.addModule("batch_validator", .{
@@ -0,0 +1,314 @@
+/*
+ * C-level benchmarks for the _native.c hot paths
+ *
+ * Compiles _native.c into an embedded interpreter and times its internal
+ * entry points (init_model_core, DhiStruct_fill, decoder_parse_json_internal,
+ * unpack_struct, py_dump_json_compiled) directly on the fixed corpora of
+ * corpora.py - no Python call frames or argument parsing in the loop.
+ * Each case runs in a forked child so its peak RSS is its own, and prints
+ * one JSON line:
+ *   {"case": ..., "ns_per_op": ..., "allocs_per_op": ..., "peak_rss_kb": ...}
+ * Driven (built, compared against baseline.json) by run.py.
+ */
+
+#include "../../dhi/_native.c"
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_REPS 7                 // timed repetitions; the median is reported
+#define BENCH_TARGET_NS 20000000.0   // calibrate each repetition to ~20 ms
+
+enum { KIND_INIT_MODEL_CORE, KIND_STRUCT_FILL, KIND_JSON_DECODE, KIND_MSGPACK_DECODE, KIND_DUMP_JSON };
+
+typedef struct {
+    int kind;
+    PyTypeObject *type;          // model / Struct class (NULL for dump_json)
+    CompiledModelSpecs *ms;
+    int extra_mode;
+    PyObject *payload;           // kwargs dict, encoded bytes or dump args
+    const char *data;            // payload bytes (decode kinds)
+    size_t len;
+} BenchCase;
+
+// =============================================================================
+// ALLOCATION COUNTING - pass-through PyMem allocators for all three domains
+// =============================================================================
+
+static uint64_t g_allocs = 0;
+static PyMemAllocatorEx g_base[3];
+
+static void* count_malloc(void *ctx, size_t n) {
+    PyMemAllocatorEx *base = (PyMemAllocatorEx*)ctx;
+    g_allocs++;
+    return base->malloc(base->ctx, n);
+}
+
+static void* count_calloc(void *ctx, size_t nelem, size_t elsize) {
+    PyMemAllocatorEx *base = (PyMemAllocatorEx*)ctx;
+    g_allocs++;
+    return base->calloc(base->ctx, nelem, elsize);
+}
+
+static void* count_realloc(void *ctx, void *ptr, size_t n) {
+    PyMemAllocatorEx *base = (PyMemAllocatorEx*)ctx;
+    g_allocs++;
+    return base->realloc(base->ctx, ptr, n);
+}
+
+static void count_free(void *ctx, void *ptr) {
+    PyMemAllocatorEx *base = (PyMemAllocatorEx*)ctx;
+    base->free(base->ctx, ptr);
+}
+
+static void install_alloc_hooks(void) {
+    const PyMemAllocatorDomain domains[3] = {PYMEM_DOMAIN_RAW, PYMEM_DOMAIN_MEM, PYMEM_DOMAIN_OBJ};
+    for (int i = 0; i < 3; i++) {
+        PyMem_GetAllocator(domains[i], &g_base[i]);
+        PyMemAllocatorEx hook = {&g_base[i], count_malloc, count_calloc, count_realloc, count_free};
+        PyMem_SetAllocator(domains[i], &hook);
+    }
+}
+
+// =============================================================================
+// CASES
+// =============================================================================
+
+static CompiledModelSpecs* specs_of(PyTypeObject *type) {
+    PyObject *capsule = PyDict_GetItemString(type->tp_dict, "__dhi_compiled_specs__");
+    if (!capsule) {
+        PyErr_Format(PyExc_ValueError, "%s has no compiled specs", type->tp_name);
+        return NULL;
+    }
+    return (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
+}
+
+// Resolve corpora.build(name) into a BenchCase. 0 or -1.
+static int case_load(PyObject *corpora, const char *name, BenchCase *c) {
+    static const char *const kinds[] = {
+        "init_model_core", "struct_fill", "json_decode", "msgpack_decode", "dump_json",
+    };
+    PyObject *spec = PyObject_CallMethod(corpora, "build", "s", name);
+    if (!spec) return -1;
+    PyObject *kind, *target;
+    if (!PyArg_ParseTuple(spec, "UOO", &kind, &target, &c->payload)) {
+        Py_DECREF(spec);
+        return -1;
+    }
+    Py_INCREF(c->payload);  // the corpora module keeps kind and target alive
+    Py_DECREF(spec);
+
+    c->kind = -1;
+    for (int k = 0; k < (int)(sizeof(kinds) / sizeof(kinds[0])); k++) {
+        if (PyUnicode_CompareWithASCIIString(kind, kinds[k]) == 0) c->kind = k;
+    }
+    if (c->kind < 0) {
+        PyErr_Format(PyExc_ValueError, "%s: unknown kind %R", name, kind);
+        return -1;
+    }
+    if (c->kind == KIND_DUMP_JSON) return 0;
+
+    if (!PyType_Check(target)) {
+        PyErr_Format(PyExc_TypeError, "%s: target must be a class", name);
+        return -1;
+    }
+    c->type = (PyTypeObject*)target;
+    if (!(c->ms = specs_of(c->type))) return -1;
+    if (c->kind == KIND_INIT_MODEL_CORE) {
+        PyObject *mode = PyObject_GetAttrString(target, "__dhi_extra_mode_int__");
+        if (!mode) return -1;
+        c->extra_mode = (int)PyLong_AsLong(mode);
+        Py_DECREF(mode);
+        if (PyErr_Occurred()) return -1;
+    }
+    if (c->kind == KIND_JSON_DECODE || c->kind == KIND_MSGPACK_DECODE) {
+        if (!PyBytes_Check(c->payload)) {
+            PyErr_Format(PyExc_TypeError, "%s: payload must be bytes", name);
+            return -1;
+        }
+        c->data = PyBytes_AS_STRING(c->payload);
+        c->len = (size_t)PyBytes_GET_SIZE(c->payload);
+    }
+    return 0;
+}
+
+// One operation. 0, or -1 with an exception set.
+static int case_run(BenchCase *c) {
+    switch (c->kind) {
+        case KIND_INIT_MODEL_CORE: {
+            PyObject *self = c->type->tp_alloc(c->type, 0);
+            if (!self) return -1;
+            PyObject *errors = init_model_core(self, c->ms, c->extra_mode, c->payload);
+            Py_DECREF(self);
+            if (!errors) return -1;
+            int failed = errors != Py_None;
+            if (failed) PyErr_Format(PyExc_ValueError, "corpus failed validation: %R", errors);
+            Py_DECREF(errors);
+            return failed ? -1 : 0;
+        }
+        case KIND_STRUCT_FILL: {
+            DhiStructObject *obj = DhiStruct_alloc(c->type, c->ms->n_fields);
+            if (!obj) return -1;
+            int r = DhiStruct_fill(obj, c->ms, c->payload, NULL, 0);
+            Py_DECREF(obj);
+            return r;
+        }
+        case KIND_JSON_DECODE: {
+            DhiStructObject *obj = DhiStruct_alloc(c->type, c->ms->n_fields);
+            if (!obj) return -1;
+            int r = decoder_parse_json_internal(obj, c->data, c->len, c->ms, NULL, NULL);
+            Py_DECREF(obj);
+            return r;
+        }
+        case KIND_MSGPACK_DECODE: {
+            DhiStructObject *obj = DhiStruct_alloc(c->type, c->ms->n_fields);
+            if (!obj) return -1;
+            size_t pos = 0;
+            PyObject *errors = NULL;
+            int r = unpack_struct(obj, (const unsigned char*)c->data, &pos, c->len, c->ms, &errors);
+            if (r == 0 && errors) r = decoder_raise_errors(errors);
+            Py_DECREF(obj);
+            return r;
+        }
+        case KIND_DUMP_JSON: {
+            PyObject *out = py_dump_json_compiled(NULL, c->payload);
+            if (!out) return -1;
+            Py_DECREF(out);
+            return 0;
+        }
+    }
+    return -1;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static long peak_rss_kb(void) {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef __APPLE__
+    return ru.ru_maxrss / 1024;  // bytes on macOS
+#else
+    return ru.ru_maxrss;
+#endif
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Load, calibrate and time one case, printing its JSON line. 0 or -1.
+static int bench_case(PyObject *corpora, const char *name) {
+    BenchCase c = {0};
+    if (case_load(corpora, name, &c) < 0) return -1;
+
+    // Warm up (free lists, caches) and size a repetition to ~BENCH_TARGET_NS
+    long iters = 1;
+    for (;;) {
+        double t0 = now_ns();
+        for (long i = 0; i < iters; i++) {
+            if (case_run(&c) < 0) return -1;
+        }
+        double dt = now_ns() - t0;
+        if (dt >= BENCH_TARGET_NS / 4 || iters >= (1L << 26)) {
+            iters = (long)(iters * (BENCH_TARGET_NS / (dt > 1 ? dt : 1))) + 1;
+            break;
+        }
+        iters *= 4;
+    }
+
+    double per_op[BENCH_REPS];
+    uint64_t allocs = 0;
+    for (int rep = 0; rep < BENCH_REPS; rep++) {
+        uint64_t a0 = g_allocs;
+        double t0 = now_ns();
+        for (long i = 0; i < iters; i++) {
+            if (case_run(&c) < 0) return -1;
+        }
+        per_op[rep] = (now_ns() - t0) / (double)iters;
+        if (rep == 0) allocs = g_allocs - a0;
+    }
+    qsort(per_op, BENCH_REPS, sizeof(double), cmp_double);
+
+    printf("{\"case\": \"%s\", \"ns_per_op\": %.1f, \"min_ns_per_op\": %.1f, "
+           "\"allocs_per_op\": %.2f, \"peak_rss_kb\": %ld, \"iterations\": %ld}\n",
+           name, per_op[BENCH_REPS / 2], per_op[0], (double)allocs / (double)iters,
+           peak_rss_kb(), iters);
+    fflush(stdout);
+    Py_DECREF(c.payload);
+    return 0;
+}
+
+// Run one case in a child process. 0 when it succeeded.
+static int bench_forked(PyObject *corpora, const char *name) {
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        return -1;
+    }
+    if (pid == 0) {
+        PyOS_AfterFork_Child();
+        int r = bench_case(corpora, name);
+        if (r < 0) {
+            fprintf(stderr, "%s: ", name);
+            PyErr_Print();
+        }
+        fflush(stdout);
+        fflush(stderr);
+        _exit(r < 0 ? 1 : 0);
+    }
+    int status;
+    if (waitpid(pid, &status, 0) < 0) return -1;
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0 ? 0 : -1;
+}
+
+int main(int argc, char **argv) {
+    Py_Initialize();
+    install_alloc_hooks();
+
+    // Serve `from . import _dhi_native` with the copy compiled in here, so
+    // the corpora's classes and the functions timed share one set of types
+    PyObject *native = PyInit__dhi_native();
+    PyObject *modules = PyImport_GetModuleDict();
+    if (!native || PyDict_SetItemString(modules, "dhi._dhi_native", native) < 0) {
+        PyErr_Print();
+        return 2;
+    }
+    Py_DECREF(native);
+
+    PyObject *corpora = PyImport_ImportModule("corpora");
+    if (!corpora) {
+        PyErr_Print();
+        return 2;
+    }
+
+    int failures = 0;
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++) failures += bench_forked(corpora, argv[i]) < 0;
+    } else {
+        PyObject *cases = PyObject_GetAttrString(corpora, "CASES");
+        if (!cases || !PyTuple_Check(cases)) {
+            PyErr_Print();
+            return 2;
+        }
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(cases); i++) {
+            const char *name = PyUnicode_AsUTF8(PyTuple_GET_ITEM(cases, i));
+            if (!name) {
+                PyErr_Print();
+                return 2;
+            }
+            failures += bench_forked(corpora, name) < 0;
+        }
+        Py_DECREF(cases);
+    }
+
+    Py_DECREF(corpora);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,171 @@
+"""
+Fixed corpora for the C-level benchmarks (bench_native.c)
+
+Every case is deterministic - no clock, no unseeded randomness - so
+allocations/op are comparable across runs and ns/op only moves when the C
+code does. build(name) returns the (kind, target, payload) the harness runs:
+
+  init_model_core  target: model class,  payload: kwargs dict
+  struct_fill      target: Struct class, payload: kwargs dict
+  json_decode      target: Struct class, payload: JSON bytes
+  msgpack_decode   target: Struct class, payload: MessagePack bytes
+  dump_json        target: None,         payload: dump_json_compiled args
+"""
+
+import json
+import random
+from typing import Annotated, List, Optional
+
+from dhi import BaseModel, Struct, Field, _dhi_native
+
+# ---------------------------------------------------------------------------
+# Schemas
+# ---------------------------------------------------------------------------
+
+WIDE_FIELDS = 32
+
+
+def _wide_annotations():
+    # 32 fields cycling int / float / str / bool, every other one constrained
+    kinds = [
+        (int, Field(ge=0, lt=1_000_000)),
+        (float, Field(ge=-1e9, le=1e9)),
+        (str, Field(min_length=1, max_length=64)),
+        (bool, None),
+    ]
+    annotations = {}
+    for i in range(WIDE_FIELDS):
+        tp, constraint = kinds[i % len(kinds)]
+        annotations[f"field_{i:02d}"] = Annotated[tp, constraint] if constraint and i % 2 == 0 else tp
+    return annotations
+
+
+WideModel = type(BaseModel)("WideModel", (BaseModel,), {"__annotations__": _wide_annotations()})
+WideStruct = type(Struct)("WideStruct", (Struct,), {"__annotations__": _wide_annotations()})
+
+
+class Address(BaseModel):
+    street: Annotated[str, Field(min_length=1)]
+    city: str
+    zip_code: Annotated[str, Field(min_length=5, max_length=10)]
+
+
+class Customer(BaseModel):
+    id: Annotated[int, Field(gt=0)]
+    name: str
+    address: Address
+    previous: List[Address]
+    note: Optional[str] = None
+
+
+class LineItem(Struct):
+    sku: Annotated[str, Field(min_length=3)]
+    qty: Annotated[int, Field(gt=0)]
+    price: Annotated[float, Field(ge=0.0)]
+
+
+class Order(Struct):
+    id: int
+    customer: str
+    items: List[LineItem]
+    shipping: Optional[LineItem] = None
+
+
+class Message(Struct):
+    author: str
+    subject: str
+    body: str
+    signature: str
+
+
+TELEMETRY_FIELDS = 24
+Telemetry = type(Struct)("Telemetry", (Struct,), {
+    "__annotations__": {f"m{i:02d}": float for i in range(TELEMETRY_FIELDS)},
+})
+
+# ---------------------------------------------------------------------------
+# Data
+# ---------------------------------------------------------------------------
+
+_rng = random.Random(20240601)
+
+
+def _wide_values():
+    values = {}
+    for i in range(WIDE_FIELDS):
+        kind = i % 4
+        if kind == 0:
+            values[f"field_{i:02d}"] = _rng.randrange(1_000_000)
+        elif kind == 1:
+            values[f"field_{i:02d}"] = round(_rng.uniform(-1e6, 1e6), 6)
+        elif kind == 2:
+            values[f"field_{i:02d}"] = "value-%d-%s" % (i, "x" * _rng.randrange(1, 24))
+        else:
+            values[f"field_{i:02d}"] = bool(_rng.randrange(2))
+    return values
+
+
+WIDE = _wide_values()
+
+ADDRESSES = [
+    {"street": "%d Market Street" % (100 + i), "city": "San Francisco", "zip_code": "9410%d" % i}
+    for i in range(8)
+]
+CUSTOMER = {"id": 42, "name": "Ada Lovelace", "address": ADDRESSES[0], "previous": ADDRESSES[1:]}
+
+ORDER = {
+    "id": 1001,
+    "customer": "ada@example.com",
+    "items": [{"sku": "SKU-%04d" % i, "qty": 1 + i % 5, "price": round(9.99 + i * 1.25, 2)}
+              for i in range(16)],
+    "shipping": {"sku": "SHIP", "qty": 1, "price": 4.5},
+}
+
+# Escape-heavy strings: quotes, backslashes, control characters, \u escapes
+# (BMP and surrogate pairs) - every value takes the unescape path
+_ESCAPED = 'He said "hi"\\n\ttab \\ slash \u00e9\u4e2d \U0001F600 ' * 4
+MESSAGE_JSON = json.dumps({
+    "author": "J\u00fcrgen \"JJ\" M\u00fcller",
+    "subject": "Re: " + _ESCAPED[:60],
+    "body": _ESCAPED * 2,
+    "signature": "--\n" + _ESCAPED[:40],
+}, ensure_ascii=True).encode()
+
+# Float-heavy telemetry: full-precision doubles, exponents, negatives
+TELEMETRY = {f"m{i:02d}": _rng.choice([-1.0, 1.0]) * _rng.random() * 10 ** _rng.randrange(-12, 12)
+             for i in range(TELEMETRY_FIELDS)}
+
+
+def _reversed_json(values):
+    # Keys in reverse field order: every key misses the ordered match
+    return json.dumps(dict(reversed(list(values.items())))).encode()
+
+
+# ---------------------------------------------------------------------------
+# Cases
+# ---------------------------------------------------------------------------
+
+def _dump_args(instance):
+    return (instance, type(instance).__dhi_dump_specs__, None, None, False, False, False, None, True)
+
+
+_BUILDERS = {
+    "init_model_core/wide": lambda: ("init_model_core", WideModel, dict(WIDE)),
+    "init_model_core/nested": lambda: ("init_model_core", Customer, dict(CUSTOMER)),
+    "struct_fill/wide": lambda: ("struct_fill", WideStruct, dict(WIDE)),
+    "json_decode/wide": lambda: ("json_decode", WideStruct, json.dumps(WIDE).encode()),
+    "json_decode/wide_out_of_order": lambda: ("json_decode", WideStruct, _reversed_json(WIDE)),
+    "json_decode/nested": lambda: ("json_decode", Order, json.dumps(ORDER).encode()),
+    "json_decode/escapes": lambda: ("json_decode", Message, MESSAGE_JSON),
+    "json_decode/telemetry": lambda: ("json_decode", Telemetry, json.dumps(TELEMETRY).encode()),
+    "msgpack_decode/wide": lambda: ("msgpack_decode", WideStruct, _dhi_native.dump_msgpack(WIDE)),
+    "dump_json/wide": lambda: ("dump_json", None, _dump_args(WideModel(**WIDE))),
+    "dump_json/nested": lambda: ("dump_json", None, _dump_args(Customer(**CUSTOMER))),
+}
+
+CASES = tuple(_BUILDERS)
+
+
+def build(name):
+    """Return (kind, target, payload) for one case."""
+    return _BUILDERS[name]()
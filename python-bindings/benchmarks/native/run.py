@@ -0,0 +1,131 @@
+"""
+Build and run the C-level benchmarks, and diff them against baseline.json
+
+    python benchmarks/native/run.py                 # build, run, compare
+    python benchmarks/native/run.py --update        # ... and store as the baseline
+    python benchmarks/native/run.py json_decode/escapes dump_json/wide
+
+bench_native.c compiles _native.c into an embedded interpreter (linked
+against libdhi from zig-out/lib or dhi/) and times the native entry points
+on the fixed corpora in corpora.py. A case regresses when its ns/op grows
+relative to the other cases by more than --tolerance (default 10%), or its
+allocations/op grow at all; the exit status is 1 if any case regressed.
+
+The stored ns/op numbers are machine-specific and are never compared as
+absolute timings: each case's ratio to its baseline is divided by the
+geometric mean ratio of the whole run, so a uniformly faster or slower
+machine shows no delta. Compare several cases at once (all, by default) for
+that to mean anything. allocations/op are machine-independent and compared
+as is. POSIX only (each case runs in a forked child).
+"""
+
+import argparse
+import json
+import math
+import os
+import platform
+import shlex
+import subprocess
+import sys
+import sysconfig
+from pathlib import Path
+
+HERE = Path(__file__).resolve().parent
+BINDINGS = HERE.parent.parent
+BASELINE = HERE / "baseline.json"
+LIB_DIRS = [BINDINGS.parent / "zig-out" / "lib", BINDINGS / "dhi"]
+NOTE = ("ns_per_op values are timings from the machine above; run.py only compares "
+        "them relative to each other, never as absolute pass/fail limits")
+
+
+def build(out, cflags):
+    """Compile the harness against this interpreter; returns the binary path."""
+    lib_dir = next((d for d in LIB_DIRS if any(d.glob("libdhi.*"))), None)
+    if lib_dir is None:
+        sys.exit(f"libdhi not found in {', '.join(map(str, LIB_DIRS))} - run `zig build` first")
+    cfg = sysconfig.get_config_vars()
+    version = cfg["LDVERSION"] or cfg["VERSION"]
+    cmd = [
+        os.environ.get("CC", "cc"), "-O2", *cflags,
+        f"-I{sysconfig.get_paths()['include']}",
+        str(HERE / "bench_native.c"), "-o", str(out),
+        f"-L{cfg['LIBDIR']}", f"-lpython{version}",
+        f"-L{lib_dir}", "-ldhi", f"-Wl,-rpath,{lib_dir}", f"-Wl,-rpath,{cfg['LIBDIR']}",
+        *shlex.split(cfg.get("LIBS") or ""), *shlex.split(cfg.get("SYSLIBS") or ""),
+    ]
+    subprocess.run(cmd, check=True)
+    return out
+
+
+def run(binary, cases):
+    """Run the harness; returns {case: result}."""
+    env = dict(os.environ)
+    env["PYTHONPATH"] = os.pathsep.join(filter(None, [str(HERE), str(BINDINGS), env.get("PYTHONPATH")]))
+    proc = subprocess.run([str(binary), *cases], env=env, stdout=subprocess.PIPE, text=True)
+    results = {}
+    for line in proc.stdout.splitlines():
+        result = json.loads(line)
+        results[result.pop("case")] = result
+    if proc.returncode != 0:
+        print("some cases failed (see stderr)", file=sys.stderr)
+    return results, proc.returncode
+
+
+def compare(results, baseline, tolerance):
+    """Print the diff table; returns the number of regressions.
+
+    delta is a case's ns/op change relative to the run's geometric mean
+    change, not its absolute change (see the module docstring).
+    """
+    ratios = [r["ns_per_op"] / baseline[name]["ns_per_op"] for name, r in results.items() if name in baseline]
+    scale = math.exp(sum(map(math.log, ratios)) / len(ratios)) if ratios else 1.0
+    if len(ratios) > 1:
+        print(f"whole run: {scale:.2f}x the baseline ns/op (machine speed; not a regression)")
+    regressions = 0
+    print(f"{'case':34} {'ns/op':>10} {'base':>10} {'delta':>8} {'allocs/op':>10} {'base':>8} {'peak RSS':>10}")
+    for name, r in results.items():
+        b = baseline.get(name)
+        flag = ""
+        if b:
+            delta = r["ns_per_op"] / b["ns_per_op"] / scale - 1.0
+            if delta > tolerance or r["allocs_per_op"] > b["allocs_per_op"] + 0.005:
+                flag = "  REGRESSION"
+                regressions += 1
+            print(f"{name:34} {r['ns_per_op']:10.1f} {b['ns_per_op']:10.1f} {delta:+8.1%} "
+                  f"{r['allocs_per_op']:10.2f} {b['allocs_per_op']:8.2f} {r['peak_rss_kb']:8d}kB{flag}")
+        else:
+            print(f"{name:34} {r['ns_per_op']:10.1f} {'-':>10} {'new':>8} "
+                  f"{r['allocs_per_op']:10.2f} {'-':>8} {r['peak_rss_kb']:8d}kB")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("cases", nargs="*", help="case names (default: all of corpora.CASES)")
+    parser.add_argument("--update", action="store_true", help="store the results as the baseline")
+    parser.add_argument("--tolerance", type=float, default=0.10, help="allowed ns/op growth (default 0.10)")
+    parser.add_argument("--binary", default=str(HERE / "bench_native"), help="harness output path")
+    parser.add_argument("--cflags", default="", help="extra compiler flags, e.g. -DDHI_STATS=1")
+    args = parser.parse_args()
+
+    binary = build(Path(args.binary), shlex.split(args.cflags))
+    results, status = run(binary, args.cases)
+
+    stored = json.loads(BASELINE.read_text()) if BASELINE.exists() else {}
+    regressions = compare(results, stored.get("cases", {}), args.tolerance)
+
+    if args.update:
+        cases = dict(stored.get("cases", {}))
+        cases.update(results)
+        BASELINE.write_text(json.dumps({
+            "machine": f"{platform.machine()} {platform.system()}, Python {platform.python_version()}",
+            "note": NOTE,
+            "cases": dict(sorted(cases.items())),
+        }, indent=2) + "\n")
+        print(f"baseline written to {BASELINE}")
+        regressions = 0
+    sys.exit(1 if status or regressions else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -37,6 +37,7 @@ from .batch import (
     validate_ints_batch,
     validate_strings_batch,
     validate_emails_batch,
+    validate_columns,
 )
 
 # --- Constraints (Pydantic v2 compatible) ---
@@ -130,6 +131,7 @@ __all__ = [
     "BatchValidationResult",
     "validate_users_batch", "validate_ints_batch",
     "validate_strings_batch", "validate_emails_batch",
+    "validate_columns",
 
     # Constraints
     "Gt", "Ge", "Lt", "Le", "MultipleOf",
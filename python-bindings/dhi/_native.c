@@ -5,11 +5,68 @@
 
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include <datetime.h>
+#if PY_VERSION_HEX < 0x030C0000
+#include <structmember.h>
+#define Py_T_OBJECT_EX T_OBJECT_EX
+#define Py_READONLY READONLY
+#endif
+#include <float.h>
 #include <math.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+// Parallel struct_from_json_batch(threads=N) needs a free-threaded build -
+// with a GIL the workers would just take turns. -DDHI_PARALLEL_BATCH=1 forces it.
+#ifndef DHI_PARALLEL_BATCH
+#if defined(Py_GIL_DISABLED) && !defined(_WIN32)
+#define DHI_PARALLEL_BATCH 1
+#else
+#define DHI_PARALLEL_BATCH 0
+#endif
+#endif
+#if DHI_PARALLEL_BATCH
+#include <pthread.h>
+#endif
+
+// Hot-path counters behind _dhi_native.stats() (see HOT-PATH STATS):
+// -DDHI_STATS=1 counts, -DDHI_STATS=2 also times. Off by default.
+#ifndef DHI_STATS
+#define DHI_STATS 0
+#endif
+#if DHI_STATS >= 2 && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#elif DHI_STATS >= 2 && !defined(__aarch64__)
+#include <time.h>
+#endif
+
+// Per-object locking on free-threaded builds (no-op blocks before 3.13)
+#if PY_VERSION_HEX >= 0x030D0000
+#define DHI_BEGIN_CRITICAL_SECTION(op) Py_BEGIN_CRITICAL_SECTION(op)
+#define DHI_END_CRITICAL_SECTION() Py_END_CRITICAL_SECTION()
+#else
+#define DHI_BEGIN_CRITICAL_SECTION(op) {
+#define DHI_END_CRITICAL_SECTION() }
+#endif
+
+// Strong-reference dict lookup on free-threaded builds, where another thread
+// may drop the value while we use it; with a GIL the borrowed ref is safe.
+// Returns a new reference (Py_GIL_DISABLED) or a borrowed one; release with
+// DHI_DICT_VALUE_RELEASE.
+#ifdef Py_GIL_DISABLED
+static inline PyObject* dhi_dict_get_value(PyObject *dict, PyObject *key) {
+    PyObject *value = NULL;
+    if (PyDict_GetItemRef(dict, key, &value) < 0) PyErr_Clear();
+    return value;
+}
+#define DHI_DICT_VALUE_RELEASE(v) Py_XDECREF(v)
+#else
+#define dhi_dict_get_value(dict, key) PyDict_GetItem((dict), (key))
+#define DHI_DICT_VALUE_RELEASE(v) ((void)0)
+#endif
+
 // =============================================================================
 // INLINE VALIDATORS - Avoid FFI overhead for simple checks
 // =============================================================================
@@ -34,66 +91,93 @@ static inline int inline_validate_email(const char* str) {
     return 1;
 }
 
+// Zig entry points. A DHI_STATIC=1 build (setup.py) links libdhi_static.a
+// into this module, so they are declared hidden there: the compiler then
+// emits direct calls instead of going through the PLT/GOT of a shared libdhi,
+// and the symbols aren't re-exported from _dhi_native.
+#if defined(DHI_STATIC_LIBDHI) && (defined(__GNUC__) || defined(__clang__)) && !defined(_WIN32)
+#define DHI_ZIG_API extern __attribute__((visibility("hidden")))
+#else
+#define DHI_ZIG_API extern
+#endif
+
 // External Zig functions from libdhi - COMPREHENSIVE VALIDATORS
 // Basic validators
-extern int dhi_validate_int(long value, long min, long max);
-extern int dhi_validate_string_length(const char* str, size_t min_len, size_t max_len);
-extern int dhi_validate_email(const char* str);
+DHI_ZIG_API int dhi_validate_int(long value, long min, long max);
+DHI_ZIG_API int dhi_validate_string_length(const char* str, size_t min_len, size_t max_len);
+DHI_ZIG_API int dhi_validate_email(const char* str);
 
 // String validators (Zod-style)
-extern int dhi_validate_url(const char* str);
-extern int dhi_validate_uuid(const char* str);
-extern int dhi_validate_ipv4(const char* str);
-extern int dhi_validate_base64(const char* str);
-extern int dhi_validate_iso_date(const char* str);
-extern int dhi_validate_iso_datetime(const char* str);
-extern int dhi_validate_contains(const char* str, const char* substring);
-extern int dhi_validate_starts_with(const char* str, const char* prefix);
-extern int dhi_validate_ends_with(const char* str, const char* suffix);
+DHI_ZIG_API int dhi_validate_url(const char* str);
+DHI_ZIG_API int dhi_validate_uuid(const char* str);
+DHI_ZIG_API int dhi_validate_ipv4(const char* str);
+DHI_ZIG_API int dhi_validate_base64(const char* str);
+DHI_ZIG_API int dhi_validate_iso_date(const char* str);
+DHI_ZIG_API int dhi_validate_iso_datetime(const char* str);
+DHI_ZIG_API int dhi_validate_contains(const char* str, const char* substring);
+DHI_ZIG_API int dhi_validate_starts_with(const char* str, const char* prefix);
+DHI_ZIG_API int dhi_validate_ends_with(const char* str, const char* suffix);
 
 // Number validators (Pydantic-style)
-extern int dhi_validate_int_gt(long value, long min);
-extern int dhi_validate_int_gte(long value, long min);
-extern int dhi_validate_int_lt(long value, long max);
-extern int dhi_validate_int_lte(long value, long max);
-extern int dhi_validate_int_positive(long value);
-extern int dhi_validate_int_non_negative(long value);
-extern int dhi_validate_int_negative(long value);
-extern int dhi_validate_int_non_positive(long value);
-extern int dhi_validate_int_multiple_of(long value, long divisor);
+DHI_ZIG_API int dhi_validate_int_gt(long value, long min);
+DHI_ZIG_API int dhi_validate_int_gte(long value, long min);
+DHI_ZIG_API int dhi_validate_int_lt(long value, long max);
+DHI_ZIG_API int dhi_validate_int_lte(long value, long max);
+DHI_ZIG_API int dhi_validate_int_positive(long value);
+DHI_ZIG_API int dhi_validate_int_non_negative(long value);
+DHI_ZIG_API int dhi_validate_int_negative(long value);
+DHI_ZIG_API int dhi_validate_int_non_positive(long value);
+DHI_ZIG_API int dhi_validate_int_multiple_of(long value, long divisor);
 
 // Float validators
-extern int dhi_validate_float_gt(double value, double min);
-extern int dhi_validate_float_gte(double value, double min);
-extern int dhi_validate_float_lt(double value, double max);
-extern int dhi_validate_float_lte(double value, double max);
-extern int dhi_validate_float_finite(double value);
+DHI_ZIG_API int dhi_validate_float_gt(double value, double min);
+DHI_ZIG_API int dhi_validate_float_gte(double value, double min);
+DHI_ZIG_API int dhi_validate_float_lt(double value, double max);
+DHI_ZIG_API int dhi_validate_float_lte(double value, double max);
+DHI_ZIG_API int dhi_validate_float_finite(double value);
 
 // IPv6 validator
-extern int dhi_validate_ipv6(const char* str);
+DHI_ZIG_API int dhi_validate_ipv6(const char* str);
+
+// Batch kernels (one result byte per value, returns the valid count)
+DHI_ZIG_API size_t dhi_validate_int_batch_simd(const int64_t* values, size_t count,
+                                               int64_t min, int64_t max, uint8_t* results);
 
 // =============================================================================
 // SIMD JSON PARSING FUNCTIONS FROM ZIG
 // =============================================================================
-extern size_t dhi_skip_whitespace(const char* json, size_t len, size_t start);
-extern int dhi_extract_json_string(
+DHI_ZIG_API size_t dhi_skip_whitespace(const char* json, size_t len, size_t start);
+DHI_ZIG_API int dhi_extract_json_string(
     const char* json, size_t len, size_t start,
     const char** out_str_ptr, size_t* out_str_len,
     int* out_has_escapes, size_t* out_end
 );
-extern int dhi_parse_json_int(
+DHI_ZIG_API int dhi_parse_json_int(
     const char* json, size_t len, size_t start,
     long* out_value, size_t* out_end
 );
-extern int dhi_parse_json_float(
+DHI_ZIG_API int dhi_parse_json_float(
     const char* json, size_t len, size_t start,
     double* out_value, size_t* out_end
 );
-extern int dhi_skip_json_value(
+DHI_ZIG_API int dhi_skip_json_value(
     const char* json, size_t len, size_t start,
     size_t* out_end
 );
-extern unsigned long long dhi_hash_field_name(const char* name, size_t len);
+DHI_ZIG_API unsigned long long dhi_hash_field_name(const char* name, size_t len);
+DHI_ZIG_API size_t dhi_find_newline(const char* json, size_t len, size_t start);
+
+// Stage-1 structural index (simd_json_parser.zig buildStructuralIndex)
+typedef struct {
+    size_t offset;
+    uint32_t in_string;
+    uint32_t escape_carry;
+    uint32_t string_escaped;
+} DhiStructuralIndexState;
+DHI_ZIG_API size_t dhi_json_structural_index(
+    const char* json, size_t len,
+    DhiStructuralIndexState* state, uint32_t* out, size_t out_cap
+);
 
 // =============================================================================
 // INLINE FAST VALIDATORS - avoid FFI overhead in batch hot paths
@@ -410,64 +494,51 @@ static enum ValidatorType parse_validator_type(const char* type_str) {
 }
 
 // Field spec with pre-parsed validator type AND cached PyObject
+// (read-only once built; mutable per-row state lives in DhiUtf8Cache)
 struct FieldSpec {
     PyObject* field_name_obj;  // Cached PyObject* for fast dict lookup
     const char* field_name;
     enum ValidatorType validator_type;
     long param1;
     long param2;
-    PyObject* last_utf8_obj;
-    const char* last_utf8;
-    Py_ssize_t last_utf8_len;
 };
 
-static inline const char* get_field_spec_utf8(
-    struct FieldSpec* spec,
+// Per-call, per-field memo of the last string's UTF-8 view. Repeated values
+// (enum-like columns, interned strings) skip PyUnicode_AsUTF8AndSize. The
+// cache owns a reference to `obj` so the identity check can never match a
+// freed-and-reused object, even if another thread mutates the input dicts.
+typedef struct {
+    PyObject* obj;
+    const char* utf8;
+    Py_ssize_t len;
+} DhiUtf8Cache;
+
+static inline const char* dhi_utf8_cache_get(
+    DhiUtf8Cache* cache,
     PyObject* obj,
     Py_ssize_t* len
 ) {
-    if (spec->last_utf8_obj == obj && spec->last_utf8_len >= 0) {
-        *len = spec->last_utf8_len;
-        return spec->last_utf8;
+    if (cache->obj == obj) {
+        *len = cache->len;
+        return cache->utf8;
     }
 
     const char* utf8 = PyUnicode_AsUTF8AndSize(obj, len);
     if (!utf8) {
         PyErr_Clear();
-        spec->last_utf8_obj = NULL;
-        spec->last_utf8 = NULL;
-        spec->last_utf8_len = 0;
         *len = 0;
         return NULL;
     }
 
-    spec->last_utf8_obj = obj;
-    spec->last_utf8 = utf8;
-    spec->last_utf8_len = *len;
+    Py_INCREF(obj);
+    Py_XSETREF(cache->obj, obj);
+    cache->utf8 = utf8;
+    cache->len = *len;
     return utf8;
 }
 
-static inline const char* get_field_spec_utf8_ptr(
-    struct FieldSpec* spec,
-    PyObject* obj
-) {
-    if (spec->last_utf8_obj == obj) {
-        return spec->last_utf8;
-    }
-
-    const char* utf8 = PyUnicode_AsUTF8(obj);
-    if (!utf8) {
-        PyErr_Clear();
-        spec->last_utf8_obj = NULL;
-        spec->last_utf8 = NULL;
-        spec->last_utf8_len = 0;
-        return NULL;
-    }
-
-    spec->last_utf8_obj = obj;
-    spec->last_utf8 = utf8;
-    spec->last_utf8_len = -1;
-    return utf8;
+static void dhi_utf8_cache_clear(DhiUtf8Cache* caches, Py_ssize_t n) {
+    for (Py_ssize_t i = 0; i < n; i++) Py_CLEAR(caches[i].obj);
 }
 
 // OPTIMIZED: validate_batch_direct with enum dispatch
@@ -492,6 +563,11 @@ static PyObject* py_validate_batch_direct(PyObject* self, PyObject* args) {
     if (!field_specs) {
         return PyErr_NoMemory();
     }
+    DhiUtf8Cache* utf8_caches = calloc(num_fields ? num_fields : 1, sizeof(DhiUtf8Cache));
+    if (!utf8_caches) {
+        free(field_specs);
+        return PyErr_NoMemory();
+    }
     
     PyObject *field_name, *spec;
     Py_ssize_t pos = 0;
@@ -500,9 +576,6 @@ static PyObject* py_validate_batch_direct(PyObject* self, PyObject* args) {
     while (PyDict_Next(field_specs_dict, &pos, &field_name, &spec)) {
         field_specs[field_idx].field_name_obj = field_name;  // Cache PyObject* (borrowed ref)
         field_specs[field_idx].field_name = PyUnicode_AsUTF8(field_name);
-        field_specs[field_idx].last_utf8_obj = NULL;
-        field_specs[field_idx].last_utf8 = NULL;
-        field_specs[field_idx].last_utf8_len = 0;
         
         if (PyTuple_Check(spec) && PyTuple_Size(spec) >= 1) {
             const char* type_str = PyUnicode_AsUTF8(PyTuple_GET_ITEM(spec, 0));
@@ -528,6 +601,7 @@ static PyObject* py_validate_batch_direct(PyObject* self, PyObject* args) {
     unsigned char* results = malloc(count * sizeof(unsigned char));
     if (!results) {
         free(field_specs);
+        free(utf8_caches);
         return PyErr_NoMemory();
     }
 
@@ -536,8 +610,15 @@ static PyObject* py_validate_batch_direct(PyObject* self, PyObject* args) {
         results[i] = 1;
     }
     
-    size_t valid_count = count;
-    
+    int bad_item = 0;
+    size_t valid_count;
+
+    // Hold the list's lock so concurrent mutation can't free items under us
+    // (free-threaded builds); other threads validating other lists run freely.
+    DHI_BEGIN_CRITICAL_SECTION(items_list);
+    if (PyList_GET_SIZE(items_list) < count) count = PyList_GET_SIZE(items_list);
+    valid_count = count;
+
     // Iterate through each item and validate all fields (OPTIMIZED with enum dispatch)
     for (Py_ssize_t i = 0; i < count; i++) {
         PyObject* item = PyList_GET_ITEM(items_list, i);  // Borrowed ref
@@ -549,16 +630,14 @@ static PyObject* py_validate_batch_direct(PyObject* self, PyObject* args) {
         
         // Fast dict check with branch prediction hint (usually true)
         if (__builtin_expect(!PyDict_Check(item), 0)) {
-            free(field_specs);
-            free(results);
-            PyErr_SetString(PyExc_TypeError, "Expected list of dicts");
-            return NULL;
+            bad_item = 1;
+            break;
         }
         
         // Iterate through pre-parsed field specs (ULTRA-FAST: use cached PyObject*)
         for (Py_ssize_t f = 0; f < num_fields; f++) {
-            // Use PyDict_GetItem with cached PyObject* - FASTEST (borrowed ref, no refcount overhead)
-            PyObject* field_value = PyDict_GetItem(item, field_specs[f].field_name_obj);
+            // Cached key PyObject* lookup (borrowed ref with a GIL, strong ref when free-threaded)
+            PyObject* field_value = dhi_dict_get_value(item, field_specs[f].field_name_obj);
             
             if (!field_value) {
                 // Missing field
@@ -642,12 +721,13 @@ static PyObject* py_validate_batch_direct(PyObject* self, PyObject* args) {
                 }
                 case VAL_UUID: {
                     Py_ssize_t slen = 0;
-                    const char* value = get_field_spec_utf8(&field_specs[f], field_value, &slen);
+                    const char* value = dhi_utf8_cache_get(&utf8_caches[f], field_value, &slen);
                     is_valid = inline_validate_uuid_len(value, slen);
                     break;
                 }
                 case VAL_IPV4: {
-                    const char* value = get_field_spec_utf8_ptr(&field_specs[f], field_value);
+                    Py_ssize_t slen = 0;
+                    const char* value = dhi_utf8_cache_get(&utf8_caches[f], field_value, &slen);
                     is_valid = inline_validate_ipv4(value);
                     break;
                 }
@@ -674,6 +754,7 @@ static PyObject* py_validate_batch_direct(PyObject* self, PyObject* args) {
                     is_valid = 1;  // Skip unknown validators
                     break;
             }
+            DHI_DICT_VALUE_RELEASE(field_value);
             
             // Update result if invalid (FAST: branch prediction - valid is common case)
             if (__builtin_expect(!is_valid, 0)) {  // Hint: validation usually succeeds
@@ -685,6 +766,16 @@ static PyObject* py_validate_batch_direct(PyObject* self, PyObject* args) {
             }
         }
     }
+    DHI_END_CRITICAL_SECTION();
+
+    dhi_utf8_cache_clear(utf8_caches, num_fields);
+    free(utf8_caches);
+    if (bad_item) {
+        free(field_specs);
+        free(results);
+        PyErr_SetString(PyExc_TypeError, "Expected list of dicts");
+        return NULL;
+    }
     
     // Convert results to Python list (FAST: use singleton bools, no allocations!)
     PyObject* result_list = PyList_New(count);
@@ -708,6 +799,370 @@ static PyObject* py_validate_batch_direct(PyObject* self, PyObject* args) {
     return Py_BuildValue("(Nn)", result_list, (Py_ssize_t)valid_count);
 }
 
+// =============================================================================
+// COLUMNAR BATCH VALIDATION - validate column buffers, no per-row PyObjects
+// =============================================================================
+// validate_columns(columns, field_specs, out=None, bitmap=False) -> (out, valid_count)
+//   columns:     {name: buffer} for int64/float64 columns (NumPy arrays, array.array,
+//                memoryview.cast('q'/'d'), ...), or {name: (offsets, data)} for
+//                Arrow-style string columns (n + 1 int32/int64 offsets into data)
+//   field_specs: same {name: (validator_type, param1, param2)} dict as
+//                validate_batch_direct
+//   out:         optional writable buffer; otherwise a new bytearray is returned
+//   bitmap:      write an Arrow-style LSB-first validity bitmap instead of one
+//                uint8 per row
+// Untyped byte buffers (format 'B', e.g. pyarrow Buffers) are read as int64
+// values / int32 offsets. Validation runs with the GIL released.
+
+#define DHI_COL_MISSING 0
+#define DHI_COL_INT64   1
+#define DHI_COL_FLOAT64 2
+#define DHI_COL_STRING  3
+
+#define DHI_COL_CHUNK 4096
+
+typedef struct {
+    enum ValidatorType validator_type;
+    long param1, param2;
+    int kind;               // DHI_COL_*
+    Py_buffer values;       // int64/float64 values, or string bytes
+    Py_buffer offsets;      // string offsets
+    int has_values, has_offsets;
+    int offset_width;       // 4 or 8
+    Py_ssize_t n_rows;
+} DhiColumnSpec;
+
+// Native-endian struct format code of a buffer ('B' when untyped).
+static char dhi_buffer_code(const Py_buffer *view) {
+    const char *fmt = view->format;
+    if (!fmt) return 'B';
+    if (*fmt == '@' || *fmt == '=') fmt++;
+#if PY_LITTLE_ENDIAN
+    else if (*fmt == '<') fmt++;
+#else
+    else if (*fmt == '>' || *fmt == '!') fmt++;
+#endif
+    if (!fmt[0] || fmt[1]) return 0;
+    return fmt[0];
+}
+
+static inline int dhi_is_numeric_validator(enum ValidatorType t) {
+    return t >= VAL_INT && t <= VAL_INT_MULTIPLE_OF;
+}
+
+static int dhi_column_get(PyObject *name, PyObject *column, DhiColumnSpec *col) {
+    if (PyTuple_Check(column)) {
+        if (PyTuple_GET_SIZE(column) != 2) {
+            PyErr_Format(PyExc_TypeError, "column %R: expected an (offsets, data) tuple", name);
+            return -1;
+        }
+        if (PyObject_GetBuffer(PyTuple_GET_ITEM(column, 0), &col->offsets,
+                               PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) return -1;
+        col->has_offsets = 1;
+        if (PyObject_GetBuffer(PyTuple_GET_ITEM(column, 1), &col->values, PyBUF_SIMPLE) < 0) return -1;
+        col->has_values = 1;
+
+        char code = dhi_buffer_code(&col->offsets);
+        Py_ssize_t itemsize = col->offsets.itemsize;
+        if ((code == 'i' || code == 'l') && itemsize == 4) col->offset_width = 4;
+        else if ((code == 'q' || code == 'l') && itemsize == 8) col->offset_width = 8;
+        else if (code == 'B' || code == 'b' || code == 'c') col->offset_width = 4;
+        else {
+            PyErr_Format(PyExc_TypeError, "column %R: offsets must be int32 or int64", name);
+            return -1;
+        }
+        if (col->offsets.len % col->offset_width != 0 ||
+            ((uintptr_t)col->offsets.buf % col->offset_width) != 0) {
+            PyErr_Format(PyExc_ValueError, "column %R: misaligned offsets buffer", name);
+            return -1;
+        }
+        Py_ssize_t n_offsets = col->offsets.len / col->offset_width;
+        col->n_rows = n_offsets > 0 ? n_offsets - 1 : 0;
+        col->kind = DHI_COL_STRING;
+        return 0;
+    }
+
+    if (PyObject_GetBuffer(column, &col->values, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) return -1;
+    col->has_values = 1;
+    char code = dhi_buffer_code(&col->values);
+    Py_ssize_t itemsize = col->values.itemsize;
+    if (code == 'd' && itemsize == 8) col->kind = DHI_COL_FLOAT64;
+    else if ((code == 'q' || code == 'l') && itemsize == 8) col->kind = DHI_COL_INT64;
+    else if (code == 'B' || code == 'b' || code == 'c') col->kind = DHI_COL_INT64;
+    else {
+        PyErr_Format(PyExc_TypeError, "column %R: expected an int64 or float64 buffer", name);
+        return -1;
+    }
+    if (col->values.len % 8 != 0 || ((uintptr_t)col->values.buf % 8) != 0) {
+        PyErr_Format(PyExc_ValueError, "column %R: misaligned values buffer", name);
+        return -1;
+    }
+    col->n_rows = col->values.len / 8;
+    return 0;
+}
+
+static inline int dhi_column_check_long(enum ValidatorType t, long p1, long p2, int64_t v) {
+    switch (t) {
+        case VAL_INT: return v >= p1 && v <= p2;
+        case VAL_INT_GT: return v > p1;
+        case VAL_INT_GTE: return v >= p1;
+        case VAL_INT_LT: return v < p1;
+        case VAL_INT_LTE: return v <= p1;
+        case VAL_INT_POSITIVE: return v > 0;
+        case VAL_INT_NON_NEGATIVE: return v >= 0;
+        case VAL_INT_MULTIPLE_OF: return p1 != 0 && v % p1 == 0;
+        default: return 1;
+    }
+}
+
+static inline int dhi_column_check_double(enum ValidatorType t, long p1, long p2, double v) {
+    switch (t) {
+        case VAL_INT: return v >= (double)p1 && v <= (double)p2;
+        case VAL_INT_GT: return v > (double)p1;
+        case VAL_INT_GTE: return v >= (double)p1;
+        case VAL_INT_LT: return v < (double)p1;
+        case VAL_INT_LTE: return v <= (double)p1;
+        case VAL_INT_POSITIVE: return v > 0.0;
+        case VAL_INT_NON_NEGATIVE: return v >= 0.0;
+        case VAL_INT_MULTIPLE_OF: return p1 != 0 && isfinite(v) && fmod(v, (double)p1) == 0.0;
+        default: return 1;
+    }
+}
+
+// Validate `s` (not NUL-terminated) against a string validator. `scratch`
+// holds a NUL-terminated copy for the C-string validators.
+static inline int dhi_column_check_string(enum ValidatorType t, long p1, long p2,
+                                          const char *s, size_t len,
+                                          char **scratch, size_t *scratch_cap, int *oom) {
+    if (t == VAL_STRING) return len >= (size_t)p1 && len <= (size_t)p2;
+    if (t == VAL_UUID) return inline_validate_uuid_len(s, (Py_ssize_t)len);
+    if (memchr(s, '\0', len)) return 0;
+    if (len + 1 > *scratch_cap) {
+        size_t cap = *scratch_cap ? *scratch_cap : 64;
+        while (cap < len + 1) cap *= 2;
+        char *grown = (char*)realloc(*scratch, cap);
+        if (!grown) { *oom = 1; return 0; }
+        *scratch = grown;
+        *scratch_cap = cap;
+    }
+    memcpy(*scratch, s, len);
+    (*scratch)[len] = '\0';
+    const char *z = *scratch;
+    switch (t) {
+        case VAL_EMAIL: return inline_validate_email(z);
+        case VAL_URL: return inline_validate_url(z);
+        case VAL_IPV4: return inline_validate_ipv4(z);
+        case VAL_BASE64: return dhi_validate_base64(z);
+        case VAL_ISO_DATE: return dhi_validate_iso_date(z);
+        case VAL_ISO_DATETIME: return dhi_validate_iso_datetime(z);
+        default: return 1;
+    }
+}
+
+// AND one column's validity into `valid`. Returns 0, or -1 on malformed
+// offsets / out of memory (reported through *bad_offsets / *oom).
+static int dhi_column_validate(const DhiColumnSpec *col, uint8_t *valid, Py_ssize_t n,
+                               char **scratch, size_t *scratch_cap,
+                               int *bad_offsets, int *oom) {
+    enum ValidatorType t = col->validator_type;
+    if (t == VAL_UNKNOWN) return 0;
+    if (col->kind == DHI_COL_MISSING) {
+        memset(valid, 0, (size_t)n);
+        return 0;
+    }
+
+    if (col->kind == DHI_COL_INT64) {
+        const int64_t *values = (const int64_t*)col->values.buf;
+        if (t == VAL_INT) {
+            // Zig batch kernel, chunked through a stack buffer
+            uint8_t chunk[DHI_COL_CHUNK];
+            for (Py_ssize_t base = 0; base < n; base += DHI_COL_CHUNK) {
+                size_t m = (size_t)(n - base < DHI_COL_CHUNK ? n - base : DHI_COL_CHUNK);
+                dhi_validate_int_batch_simd(values + base, m, col->param1, col->param2, chunk);
+                for (size_t i = 0; i < m; i++) valid[base + i] &= chunk[i];
+            }
+            return 0;
+        }
+        for (Py_ssize_t i = 0; i < n; i++) {
+            valid[i] &= (uint8_t)dhi_column_check_long(t, col->param1, col->param2, values[i]);
+        }
+        return 0;
+    }
+
+    if (col->kind == DHI_COL_FLOAT64) {
+        const double *values = (const double*)col->values.buf;
+        for (Py_ssize_t i = 0; i < n; i++) {
+            valid[i] &= (uint8_t)dhi_column_check_double(t, col->param1, col->param2, values[i]);
+        }
+        return 0;
+    }
+
+    const char *data = (const char*)col->values.buf;
+    int64_t data_len = (int64_t)col->values.len;
+    for (Py_ssize_t i = 0; i < n; i++) {
+        int64_t start, end;
+        if (col->offset_width == 4) {
+            start = ((const int32_t*)col->offsets.buf)[i];
+            end = ((const int32_t*)col->offsets.buf)[i + 1];
+        } else {
+            start = ((const int64_t*)col->offsets.buf)[i];
+            end = ((const int64_t*)col->offsets.buf)[i + 1];
+        }
+        if (__builtin_expect(start < 0 || end < start || end > data_len, 0)) {
+            *bad_offsets = 1;
+            return -1;
+        }
+        if (!valid[i]) continue;  // already invalid: skip the string work
+        valid[i] = (uint8_t)dhi_column_check_string(t, col->param1, col->param2,
+                                                    data + start, (size_t)(end - start),
+                                                    scratch, scratch_cap, oom);
+        if (*oom) return -1;
+    }
+    return 0;
+}
+
+static PyObject* py_validate_columns(PyObject* self, PyObject* args, PyObject* kwargs) {
+    static char *kwlist[] = {"columns", "field_specs", "out", "bitmap", NULL};
+    PyObject *columns, *field_specs_dict, *out_obj = Py_None;
+    int bitmap = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O!O!|Op", kwlist,
+                                     &PyDict_Type, &columns, &PyDict_Type, &field_specs_dict,
+                                     &out_obj, &bitmap)) {
+        return NULL;
+    }
+
+    Py_ssize_t num_fields = PyDict_Size(field_specs_dict);
+    DhiColumnSpec *cols = (DhiColumnSpec*)calloc(num_fields ? num_fields : 1, sizeof(DhiColumnSpec));
+    if (!cols) return PyErr_NoMemory();
+
+    PyObject *result = NULL;
+    uint8_t *valid = NULL;
+    Py_buffer out_view;
+    int has_out_view = 0;
+    Py_ssize_t n_rows = -1;
+
+    // Pre-process field specs and acquire column buffers (GIL held)
+    PyObject *field_name, *spec;
+    Py_ssize_t pos = 0, field_idx = 0;
+    while (PyDict_Next(field_specs_dict, &pos, &field_name, &spec)) {
+        DhiColumnSpec *col = &cols[field_idx++];
+        col->validator_type = VAL_UNKNOWN;
+        if (PyTuple_Check(spec) && PyTuple_GET_SIZE(spec) >= 1) {
+            const char *type_str = PyUnicode_AsUTF8(PyTuple_GET_ITEM(spec, 0));
+            if (!type_str) goto done;
+            col->validator_type = parse_validator_type(type_str);
+            if (PyTuple_GET_SIZE(spec) >= 2) col->param1 = PyLong_AsLong(PyTuple_GET_ITEM(spec, 1));
+            if (PyTuple_GET_SIZE(spec) >= 3) col->param2 = PyLong_AsLong(PyTuple_GET_ITEM(spec, 2));
+            if (PyErr_Occurred()) goto done;
+        }
+        if (col->validator_type == VAL_UNKNOWN) continue;
+
+        PyObject *column = PyDict_GetItemWithError(columns, field_name);
+        if (!column) {
+            if (PyErr_Occurred()) goto done;
+            continue;  // DHI_COL_MISSING: every row fails, like a missing dict key
+        }
+        if (dhi_column_get(field_name, column, col) < 0) goto done;
+
+        int numeric = dhi_is_numeric_validator(col->validator_type);
+        if (numeric != (col->kind != DHI_COL_STRING)) {
+            PyErr_Format(PyExc_TypeError, "column %R: %s validator needs a %s column",
+                         field_name, PyUnicode_AsUTF8(PyTuple_GET_ITEM(spec, 0)),
+                         numeric ? "numeric" : "string");
+            goto done;
+        }
+        if (n_rows >= 0 && col->n_rows != n_rows) {
+            PyErr_Format(PyExc_ValueError, "column %R has %zd rows, expected %zd",
+                         field_name, col->n_rows, n_rows);
+            goto done;
+        }
+        n_rows = col->n_rows;
+    }
+    if (n_rows < 0) {
+        // Only missing / unknown columns: take the row count from any column
+        PyObject *key, *column;
+        Py_ssize_t cpos = 0;
+        n_rows = 0;
+        if (PyDict_Next(columns, &cpos, &key, &column)) {
+            DhiColumnSpec probe;
+            memset(&probe, 0, sizeof(probe));
+            int r = dhi_column_get(key, column, &probe);
+            n_rows = probe.n_rows;
+            if (probe.has_values) PyBuffer_Release(&probe.values);
+            if (probe.has_offsets) PyBuffer_Release(&probe.offsets);
+            if (r < 0) goto done;
+        }
+    }
+
+    // Output buffer
+    Py_ssize_t out_size = bitmap ? (n_rows + 7) / 8 : n_rows;
+    if (out_obj == Py_None) {
+        out_obj = PyByteArray_FromStringAndSize(NULL, out_size);
+        if (!out_obj) goto done;
+    } else {
+        Py_INCREF(out_obj);
+    }
+    if (PyObject_GetBuffer(out_obj, &out_view, PyBUF_WRITABLE) < 0) { Py_DECREF(out_obj); goto done; }
+    has_out_view = 1;
+    if (out_view.len < out_size) {
+        PyErr_Format(PyExc_ValueError, "out buffer too small: %zd bytes, need %zd",
+                     out_view.len, out_size);
+        Py_DECREF(out_obj);
+        goto done;
+    }
+
+    valid = bitmap ? (uint8_t*)malloc(n_rows ? (size_t)n_rows : 1) : (uint8_t*)out_view.buf;
+    if (!valid) { PyErr_NoMemory(); Py_DECREF(out_obj); goto done; }
+
+    Py_ssize_t valid_count = 0;
+    int bad_offsets = 0, oom = 0;
+    char *scratch = NULL;
+    size_t scratch_cap = 0;
+
+    Py_BEGIN_ALLOW_THREADS
+    memset(valid, 1, (size_t)n_rows);
+    // Numeric columns first: cheap, and they let string checks skip dead rows
+    for (int pass = 0; pass < 2 && !bad_offsets && !oom; pass++) {
+        for (Py_ssize_t f = 0; f < num_fields; f++) {
+            if ((cols[f].kind == DHI_COL_STRING) != pass) continue;
+            if (dhi_column_validate(&cols[f], valid, n_rows, &scratch, &scratch_cap,
+                                    &bad_offsets, &oom) < 0) break;
+        }
+    }
+    for (Py_ssize_t i = 0; i < n_rows; i++) valid_count += valid[i];
+    if (bitmap) {
+        uint8_t *bits = (uint8_t*)out_view.buf;
+        for (Py_ssize_t b = 0; b < out_size; b++) {
+            uint8_t byte = 0;
+            Py_ssize_t base = b * 8;
+            for (int k = 0; k < 8 && base + k < n_rows; k++) byte |= (uint8_t)(valid[base + k] << k);
+            bits[b] = byte;
+        }
+    }
+    Py_END_ALLOW_THREADS
+
+    free(scratch);
+    if (bad_offsets) {
+        PyErr_SetString(PyExc_ValueError, "string column offsets out of range");
+        Py_DECREF(out_obj);
+    } else if (oom) {
+        PyErr_NoMemory();
+        Py_DECREF(out_obj);
+    } else {
+        result = Py_BuildValue("(Nn)", out_obj, valid_count);
+    }
+
+done:
+    if (bitmap) free(valid);
+    if (has_out_view) PyBuffer_Release(&out_view);
+    for (Py_ssize_t f = 0; f < num_fields; f++) {
+        if (cols[f].has_values) PyBuffer_Release(&cols[f].values);
+        if (cols[f].has_offsets) PyBuffer_Release(&cols[f].offsets);
+    }
+    free(cols);
+    return result;
+}
+
 // Helpers: safely extract numeric values from PyObject (handles int/float mix)
 static long as_long_coerce(PyObject* obj) {
     if (PyLong_Check(obj)) return PyLong_AsLong(obj);
@@ -730,3474 +1185,8344 @@ static inline int dhi_float_has_fraction(PyObject* f) {
 }
 
 // =============================================================================
-// PRE-COMPILED FIELD SPECS — eliminates per-call constraint tuple unpacking
+// PATTERN CONSTRAINTS - Field(pattern=...) compiled to a native matcher
 // =============================================================================
+// compile_pattern(p) parses the common subset of Python regex syntax once
+// (literals, ., classes with ranges and \d\w\s, groups, |, the greedy/lazy
+// quantifiers and {m,n}, ^ $ \A \Z \b \B) into a Thompson NFA that's run by a
+// Pike VM: no backtracking, linear in the string length. Semantics follow
+// re.match on str (anchored at the start, Unicode \d\w\s, no flags). Anything
+// outside that subset makes compile_pattern return None and the Python layer
+// passes the re.Pattern instead; the plan step then calls its .match().
+// The mandatory literal prefix of a pattern is compared with one memcmp
+// before the VM starts, and all-literal patterns never reach the VM.
+
+enum {
+    DHI_RE_CHAR,     // x = code point
+    DHI_RE_ANY,      // anything but '\n'
+    DHI_RE_CLASS,    // x = class index
+    DHI_RE_SPLIT,    // try x and y
+    DHI_RE_JMP,      // x
+    DHI_RE_BOL,      // ^ / \A: position 0
+    DHI_RE_EOL,      // $: end, or before a final '\n'
+    DHI_RE_EOS,      // \Z: end
+    DHI_RE_WORDB,    // \b
+    DHI_RE_NWORDB,   // \B
+    DHI_RE_MATCH,
+};
+
+#define DHI_RE_MAX_INST 4096
+#define DHI_RE_MAX_REPEAT 1000
 
 typedef struct {
-    PyObject *name_obj;     // borrowed ref (kept alive by class)
-    Py_hash_t name_hash;    // Pre-computed hash for fast dict operations
-    PyObject *alias_obj;    // borrowed ref or NULL (Py_None)
-    int required;
-    PyObject *default_val;  // borrowed ref
-    // Pre-parsed constraints (no per-call PyLong_AsLong/PyTuple_GET_ITEM):
-    int type_code, strict;
-    int has_gt, has_ge, has_lt, has_le, has_mul;
-    long gt_long, ge_long, lt_long, le_long, mul_long;
-    double gt_dbl, ge_dbl, lt_dbl, le_dbl, mul_dbl;
-    int has_minl, has_maxl;
-    Py_ssize_t min_len, max_len;
-    int allow_inf_nan, format_code;
-    int strip_ws, to_lower, to_upper;
-    // Nested model support (type_code=6 for nested models)
-    PyObject *nested_model_type;  // The nested BaseModel class (borrowed ref, or NULL)
-    // Union/list-of-models support (type_code=7 for list-of-models, 8 for union)
-    PyObject *union_types_tuple;  // Tuple of acceptable BaseModel types (borrowed ref, or NULL)
-    // Cached JSON parsing fields (computed once, used for fast field matching)
-    const char *name_ptr;   // Cached UTF-8 pointer to name
-    size_t name_len;        // Cached length of name
-    uint64_t name_hash_fnv; // FNV-1a hash for JSON field matching
-} CompiledFieldSpec;
+    uint8_t op;
+    uint32_t x, y;
+} DhiReInst;
+
+// Unicode class escapes a class may contain (beyond its ASCII bitmap)
+#define DHI_RE_UNI_DIGIT  0x01
+#define DHI_RE_UNI_NDIGIT 0x02
+#define DHI_RE_UNI_WORD   0x04
+#define DHI_RE_UNI_NWORD  0x08
+#define DHI_RE_UNI_SPACE  0x10
+#define DHI_RE_UNI_NSPACE 0x20
 
-// Global empty tuple for efficient PyObject_Call - reused across all calls
-static PyObject *g_empty_tuple = NULL;
+typedef struct {
+    uint64_t ascii[2];       // code points < 128
+    uint32_t (*ranges)[2];   // inclusive ranges reaching >= 128
+    int n_ranges;
+    uint8_t uni;             // DHI_RE_UNI_* escapes
+    uint8_t negate;
+} DhiReClass;
 
 typedef struct {
-    Py_ssize_t n_fields;
-    CompiledFieldSpec specs[];  // flexible array member
-} CompiledModelSpecs;
+    PyObject_HEAD
+    PyObject *pattern;       // source string
+    DhiReInst *prog;
+    int n_inst;
+    DhiReClass *classes;
+    int n_classes;
+    char *prefix;            // mandatory literal prefix (ASCII) or NULL
+    Py_ssize_t prefix_len;
+    int literal;             // the prefix is the whole pattern
+} DhiPatternObject;
+
+static PyTypeObject DhiPatternType;
+
+#define DhiPattern_Check(op) (Py_TYPE(op) == &DhiPatternType)
+
+static inline int dhi_re_is_word(Py_UCS4 c) {
+    if (c < 128) return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                        (c >= '0' && c <= '9') || c == '_';
+    return Py_UNICODE_ISALNUM(c);
+}
 
-static void compiled_specs_destructor(PyObject *capsule) {
-    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
-    if (ms) free(ms);
+static inline int dhi_re_is_digit(Py_UCS4 c) {
+    return c < 128 ? (c >= '0' && c <= '9') : Py_UNICODE_ISDECIMAL(c);
 }
 
-// compile_model_specs(field_specs_tuple) -> PyCapsule
-// Pre-parses all constraint values into C structs at class creation time
-// Each field spec is: (name, alias, required, default, constraints, [nested_model_type])
-// nested_model_type is optional - if present and not None, type_code is set to 6
-static PyObject* py_compile_model_specs(PyObject* self, PyObject* args) {
-    PyObject *field_specs;
-    if (!PyArg_ParseTuple(args, "O!", &PyTuple_Type, &field_specs)) return NULL;
+static inline int dhi_re_is_space(Py_UCS4 c) {
+    return c < 128 ? (c == ' ' || (c >= '\t' && c <= '\r') || (c >= 0x1c && c <= 0x1f))
+                   : Py_UNICODE_ISSPACE(c);
+}
 
-    Py_ssize_t n = PyTuple_GET_SIZE(field_specs);
-    CompiledModelSpecs *ms = (CompiledModelSpecs*)malloc(
-        sizeof(CompiledModelSpecs) + n * sizeof(CompiledFieldSpec));
-    if (!ms) return PyErr_NoMemory();
-    ms->n_fields = n;
+static int dhi_re_class_has(const DhiReClass *cls, Py_UCS4 c) {
+    int hit = 0;
+    if (c < 128) {
+        hit = (int)((cls->ascii[c >> 6] >> (c & 63)) & 1);
+    } else {
+        for (int i = 0; i < cls->n_ranges && !hit; i++) {
+            hit = c >= cls->ranges[i][0] && c <= cls->ranges[i][1];
+        }
+        uint8_t u = cls->uni;
+        if (!hit && u) {
+            hit = ((u & DHI_RE_UNI_DIGIT) && dhi_re_is_digit(c)) ||
+                  ((u & DHI_RE_UNI_NDIGIT) && !dhi_re_is_digit(c)) ||
+                  ((u & DHI_RE_UNI_WORD) && dhi_re_is_word(c)) ||
+                  ((u & DHI_RE_UNI_NWORD) && !dhi_re_is_word(c)) ||
+                  ((u & DHI_RE_UNI_SPACE) && dhi_re_is_space(c)) ||
+                  ((u & DHI_RE_UNI_NSPACE) && !dhi_re_is_space(c));
+        }
+    }
+    return hit != cls->negate;
+}
 
-    for (Py_ssize_t i = 0; i < n; i++) {
-        PyObject *spec = PyTuple_GET_ITEM(field_specs, i);
-        CompiledFieldSpec *fs = &ms->specs[i];
-        Py_ssize_t spec_len = PyTuple_GET_SIZE(spec);
+// --- Parser: pattern -> AST -> program ---
 
-        fs->name_obj    = PyTuple_GET_ITEM(spec, 0);
-        fs->name_hash   = PyObject_Hash(fs->name_obj);  // Pre-compute hash for fast dict ops
-        // Cache JSON parsing info (computed once, avoid strlen/hash per parse)
-        fs->name_ptr    = PyUnicode_AsUTF8(fs->name_obj);
-        fs->name_len    = fs->name_ptr ? strlen(fs->name_ptr) : 0;
-        fs->name_hash_fnv = fs->name_ptr ? fnv1a_hash_inline(fs->name_ptr, fs->name_len) : 0;
-        fs->alias_obj   = PyTuple_GET_ITEM(spec, 1);
-        fs->required    = PyObject_IsTrue(PyTuple_GET_ITEM(spec, 2));
-        fs->default_val = PyTuple_GET_ITEM(spec, 3);
-        PyObject *constraints = PyTuple_GET_ITEM(spec, 4);
+enum { DHI_RN_EMPTY, DHI_RN_CHAR, DHI_RN_ANY, DHI_RN_CLASS, DHI_RN_ASSERT,
+       DHI_RN_CAT, DHI_RN_ALT, DHI_RN_REPEAT };
 
-        // Check for nested model type or union types (6th element)
-        fs->nested_model_type = NULL;
-        fs->union_types_tuple = NULL;
-        if (spec_len >= 6) {
-            PyObject *sixth = PyTuple_GET_ITEM(spec, 5);
-            if (sixth != Py_None && PyType_Check(sixth)) {
-                fs->nested_model_type = sixth;  // borrowed ref, kept alive by class
-            } else if (sixth != Py_None && PyTuple_Check(sixth)) {
-                fs->union_types_tuple = sixth;  // tuple of acceptable types
-            }
-        }
+typedef struct {
+    int kind;
+    uint32_t x;              // CHAR code point / CLASS index / ASSERT op
+    int child, next;         // first child (CAT/ALT/REPEAT), next sibling
+    int min, max;            // REPEAT bounds (max -1 = unbounded)
+} DhiReNode;
 
-        // Pre-parse all constraint values ONCE (not per-call)
-        fs->type_code = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 0));
-        // Override type_code based on field kind
-        if (fs->nested_model_type != NULL) {
-            fs->type_code = 6;  // Nested model field
-        } else if (fs->union_types_tuple != NULL) {
-            // type_code from constraints tells us: 7=list-of-models, 8=union
-            // Keep the type_code from constraints (7 or 8)
-        }
-        fs->strict    = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 1));
-
-        PyObject *gt = PyTuple_GET_ITEM(constraints, 2);
-        PyObject *ge = PyTuple_GET_ITEM(constraints, 3);
-        PyObject *lt = PyTuple_GET_ITEM(constraints, 4);
-        PyObject *le = PyTuple_GET_ITEM(constraints, 5);
-        PyObject *mul = PyTuple_GET_ITEM(constraints, 6);
-        PyObject *minl = PyTuple_GET_ITEM(constraints, 7);
-        PyObject *maxl = PyTuple_GET_ITEM(constraints, 8);
-
-        fs->has_gt = (gt != Py_None); fs->has_ge = (ge != Py_None);
-        fs->has_lt = (lt != Py_None); fs->has_le = (le != Py_None);
-        fs->has_mul = (mul != Py_None);
-        fs->has_minl = (minl != Py_None); fs->has_maxl = (maxl != Py_None);
-
-        fs->gt_long = fs->has_gt ? as_long_coerce(gt) : 0;
-        fs->ge_long = fs->has_ge ? as_long_coerce(ge) : 0;
-        fs->lt_long = fs->has_lt ? as_long_coerce(lt) : 0;
-        fs->le_long = fs->has_le ? as_long_coerce(le) : 0;
-        fs->mul_long = fs->has_mul ? as_long_coerce(mul) : 0;
-        fs->gt_dbl = fs->has_gt ? as_double_coerce(gt) : 0.0;
-        fs->ge_dbl = fs->has_ge ? as_double_coerce(ge) : 0.0;
-        fs->lt_dbl = fs->has_lt ? as_double_coerce(lt) : 0.0;
-        fs->le_dbl = fs->has_le ? as_double_coerce(le) : 0.0;
-        fs->mul_dbl = fs->has_mul ? as_double_coerce(mul) : 0.0;
-        fs->min_len = fs->has_minl ? PyLong_AsSsize_t(minl) : 0;
-        fs->max_len = fs->has_maxl ? PyLong_AsSsize_t(maxl) : 0;
-
-        fs->allow_inf_nan = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 9));
-        fs->format_code   = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 10));
-        fs->strip_ws      = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 11));
-        fs->to_lower      = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 12));
-        fs->to_upper      = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 13));
-    }
-
-    return PyCapsule_New(ms, "dhi.compiled_specs", compiled_specs_destructor);
+typedef struct {
+    int kind;
+    const void *data;
+    Py_ssize_t len, pos;
+    DhiReNode *nodes;
+    int n_nodes, cap_nodes;
+    DhiReClass *classes;
+    int n_classes, cap_classes;
+    DhiReInst *prog;
+    int n_inst;
+    int unsupported;         // set on anything outside the subset (or invalid)
+    int depth;
+} DhiReParser;
+
+#define RE_PEEK(p) ((p)->pos < (p)->len ? PyUnicode_READ((p)->kind, (p)->data, (p)->pos) : (Py_UCS4)-1)
+#define RE_AT_END(p) ((p)->pos >= (p)->len)
+
+static int re_node(DhiReParser *p, int kind) {
+    if (p->n_nodes == p->cap_nodes) {
+        int cap = p->cap_nodes ? p->cap_nodes * 2 : 32;
+        DhiReNode *grown = (DhiReNode*)PyMem_Realloc(p->nodes, cap * sizeof(DhiReNode));
+        if (!grown) { PyErr_NoMemory(); return -1; }
+        p->nodes = grown;
+        p->cap_nodes = cap;
+    }
+    DhiReNode *n = &p->nodes[p->n_nodes];
+    n->kind = kind;
+    n->x = 0;
+    n->child = n->next = -1;
+    n->min = n->max = 0;
+    return p->n_nodes++;
 }
 
-// init_model_compiled: Ultra-fast path using pre-compiled C structs
-// No per-call PyTuple_GET_ITEM/PyLong_AsLong — reads C struct members directly
-static PyObject* py_init_model_compiled(PyObject* self_unused, PyObject* args) {
-    PyObject *model_self, *kwargs, *capsule;
-
-    if (!PyArg_ParseTuple(args, "OO!O", &model_self, &PyDict_Type, &kwargs, &capsule)) {
-        return NULL;
+static int re_new_class(DhiReParser *p) {
+    if (p->n_classes == p->cap_classes) {
+        int cap = p->cap_classes ? p->cap_classes * 2 : 4;
+        DhiReClass *grown = (DhiReClass*)PyMem_Realloc(p->classes, cap * sizeof(DhiReClass));
+        if (!grown) { PyErr_NoMemory(); return -1; }
+        p->classes = grown;
+        p->cap_classes = cap;
     }
+    memset(&p->classes[p->n_classes], 0, sizeof(DhiReClass));
+    return p->n_classes++;
+}
 
-    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
-    if (!ms) return NULL;
+static void re_class_set_ascii(DhiReClass *cls, Py_UCS4 lo, Py_UCS4 hi) {
+    for (Py_UCS4 c = lo; c <= hi && c < 128; c++) cls->ascii[c >> 6] |= (uint64_t)1 << (c & 63);
+}
 
-    PyObject *obj_dict = PyObject_GenericGetDict(model_self, NULL);
-    if (!obj_dict) return NULL;
+static int re_class_add_range(DhiReClass *cls, Py_UCS4 lo, Py_UCS4 hi) {
+    re_class_set_ascii(cls, lo, hi);
+    if (hi < 128) return 0;
+    uint32_t (*grown)[2] = (uint32_t(*)[2])PyMem_Realloc(cls->ranges,
+        (size_t)(cls->n_ranges + 1) * sizeof(*cls->ranges));
+    if (!grown) { PyErr_NoMemory(); return -1; }
+    cls->ranges = grown;
+    cls->ranges[cls->n_ranges][0] = lo < 128 ? 128 : lo;
+    cls->ranges[cls->n_ranges][1] = hi;
+    cls->n_ranges++;
+    return 0;
+}
 
-    PyObject *errors = NULL;
+// \d \D \w \W \s \S into cls
+static void re_class_add_escape(DhiReClass *cls, Py_UCS4 e) {
+    int neg = e == 'D' || e == 'W' || e == 'S';
+    Py_UCS4 base = neg ? e - 'A' + 'a' : e;
+    for (Py_UCS4 c = 0; c < 128; c++) {
+        int in = base == 'd' ? dhi_re_is_digit(c) : base == 'w' ? dhi_re_is_word(c) : dhi_re_is_space(c);
+        if (in != neg) cls->ascii[c >> 6] |= (uint64_t)1 << (c & 63);
+    }
+    cls->uni |= base == 'd' ? (neg ? DHI_RE_UNI_NDIGIT : DHI_RE_UNI_DIGIT)
+              : base == 'w' ? (neg ? DHI_RE_UNI_NWORD : DHI_RE_UNI_WORD)
+              : (neg ? DHI_RE_UNI_NSPACE : DHI_RE_UNI_SPACE);
+}
 
-    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
-        CompiledFieldSpec *fs = &ms->specs[i];
+// Hex digits of \x \u \U; -1 when malformed
+static long re_hex(DhiReParser *p, int n) {
+    long v = 0;
+    for (int i = 0; i < n; i++) {
+        Py_UCS4 c = RE_PEEK(p);
+        int d = c >= '0' && c <= '9' ? (int)(c - '0') : c >= 'a' && c <= 'f' ? (int)(c - 'a' + 10)
+              : c >= 'A' && c <= 'F' ? (int)(c - 'A' + 10) : -1;
+        if (d < 0) return -1;
+        v = v * 16 + d;
+        p->pos++;
+    }
+    return v > 0x10FFFF ? -1 : v;
+}
 
-        // --- Extract value from kwargs ---
-        PyObject *value = NULL;
-        if (fs->alias_obj != Py_None) {
-            value = PyDict_GetItem(kwargs, fs->alias_obj);
-        }
-        if (!value) {
-            value = _PyDict_GetItem_KnownHash(kwargs, fs->name_obj, fs->name_hash);
-        }
+// Literal escape after '\' (already consumed): the code point, or -1 when the
+// escape isn't a plain literal (classes/assertions are handled by callers)
+static long re_literal_escape(DhiReParser *p, Py_UCS4 e) {
+    switch (e) {
+        case 'n': return '\n';
+        case 't': return '\t';
+        case 'r': return '\r';
+        case 'f': return '\f';
+        case 'v': return '\v';
+        case 'a': return '\a';
+        case 'x': return re_hex(p, 2);
+        case 'u': return re_hex(p, 4);
+        case 'U': return re_hex(p, 8);
+    }
+    // Escaped punctuation is literal; letters and digits mean something else
+    if (e < 128 && !((e >= 'a' && e <= 'z') || (e >= 'A' && e <= 'Z') || (e >= '0' && e <= '9'))) {
+        return (long)e;
+    }
+    return -1;
+}
 
-        if (!value) {
-            if (!fs->required) {
-                PyDict_SetItem(obj_dict, fs->name_obj, fs->default_val);
+static int re_parse_class(DhiReParser *p) {
+    int ci = re_new_class(p);
+    if (ci < 0) return -1;
+    if (RE_PEEK(p) == '^') { p->classes[ci].negate = 1; p->pos++; }
+    int first = 1;
+    for (;;) {
+        if (RE_AT_END(p)) { p->unsupported = 1; return 0; }
+        Py_UCS4 c = RE_PEEK(p);
+        if (c == ']' && !first) { p->pos++; break; }
+        first = 0;
+        p->pos++;
+        long lo = c;
+        if (c == '\\') {
+            if (RE_AT_END(p)) { p->unsupported = 1; return 0; }
+            Py_UCS4 e = RE_PEEK(p);
+            p->pos++;
+            if (e == 'd' || e == 'D' || e == 'w' || e == 'W' || e == 's' || e == 'S') {
+                re_class_add_escape(&p->classes[ci], e);
                 continue;
             }
-            if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-            PyObject *err = Py_BuildValue("(Os)", fs->name_obj, "Field required");
-            PyList_Append(errors, err); Py_DECREF(err);
-            continue;
+            lo = e == 'b' ? '\b' : re_literal_escape(p, e);
+            if (lo < 0) { p->unsupported = 1; return 0; }
+        } else if (c == '[') {
+            // Possible future set syntax ([[:alpha:]], [a&&b] ...) - leave it to re
+            Py_UCS4 n = RE_PEEK(p);
+            if (n == ':' || n == '=' || n == '.') { p->unsupported = 1; return 0; }
         }
-
-        // --- TYPE CHECKING (using pre-parsed type_code) ---
-        PyObject *result = value;
-        Py_INCREF(result);
-        const char *field_name = NULL;  // lazy-extracted on error
-
-        if (fs->type_code == 1) { // int
-            if (fs->strict) {
-                if (!PyLong_CheckExact(result) || PyBool_Check(result)) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Expected exactly int, got %s", field_name, Py_TYPE(value)->tp_name);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                    PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
-            } else {
-                if (PyBool_Check(result)) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Expected int, got bool", field_name);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                    PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
-                if (!PyLong_Check(result)) {
-                    if (PyFloat_Check(result)) {
-                        if (dhi_float_has_fraction(result)) {
-                            Py_DECREF(result);
-                            field_name = PyUnicode_AsUTF8(fs->name_obj);
-                            if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-                            PyObject *fmsg = PyUnicode_FromFormat("%s: Expected int, got float with fractional part", field_name);
-                            PyObject *ferr = Py_BuildValue("(OO)", fs->name_obj, fmsg); Py_DECREF(fmsg);
-                            PyList_Append(errors, ferr); Py_DECREF(ferr); continue;
-                        }
-                        PyObject *new_val = PyNumber_Long(result);
-                        if (!new_val) { Py_DECREF(result); PyErr_Clear();
-                            field_name = PyUnicode_AsUTF8(fs->name_obj);
-                            if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-                            PyObject *msg = PyUnicode_FromFormat("%s: Cannot convert float to int", field_name);
-                            PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                            PyList_Append(errors, err); Py_DECREF(err); continue;
-                        }
-                        Py_DECREF(result); result = new_val;
-                    } else {
-                        Py_DECREF(result);
-                        field_name = PyUnicode_AsUTF8(fs->name_obj);
-                        if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-                        PyObject *msg = PyUnicode_FromFormat("%s: Expected int, got %s", field_name, Py_TYPE(value)->tp_name);
-                        PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                        PyList_Append(errors, err); Py_DECREF(err); continue;
-                    }
-                }
-            }
-        } else if (fs->type_code == 2) { // float
-            if (fs->strict) {
-                if (!PyFloat_CheckExact(result)) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Expected exactly float, got %s", field_name, Py_TYPE(value)->tp_name);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                    PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
+        long hi = lo;
+        if (RE_PEEK(p) == '-' && p->pos + 1 < p->len &&
+            PyUnicode_READ(p->kind, p->data, p->pos + 1) != ']') {
+            p->pos++;
+            Py_UCS4 h = RE_PEEK(p);
+            p->pos++;
+            if (h == '\\') {
+                if (RE_AT_END(p)) { p->unsupported = 1; return 0; }
+                Py_UCS4 e = RE_PEEK(p);
+                p->pos++;
+                hi = e == 'b' ? '\b' : re_literal_escape(p, e);
+            } else if (h == '[') {
+                p->unsupported = 1;
+                return 0;
             } else {
-                if (PyBool_Check(result)) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Expected float, got bool", field_name);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                    PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
-                if (!PyFloat_Check(result)) {
-                    if (PyLong_Check(result)) {
-                        PyObject *new_val = PyNumber_Float(result);
-                        if (!new_val) { Py_DECREF(result); PyErr_Clear();
-                            field_name = PyUnicode_AsUTF8(fs->name_obj);
-                            if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-                            PyObject *msg = PyUnicode_FromFormat("%s: Cannot convert int to float", field_name);
-                            PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                            PyList_Append(errors, err); Py_DECREF(err); continue;
-                        }
-                        Py_DECREF(result); result = new_val;
-                    } else {
-                        Py_DECREF(result);
-                        field_name = PyUnicode_AsUTF8(fs->name_obj);
-                        if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-                        PyObject *msg = PyUnicode_FromFormat("%s: Expected float, got %s", field_name, Py_TYPE(value)->tp_name);
-                        PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                        PyList_Append(errors, err); Py_DECREF(err); continue;
-                    }
-                }
-            }
-        } else if (fs->type_code == 3) { // str
-            if (!PyUnicode_Check(result)) {
-                Py_DECREF(result);
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-                PyObject *msg = PyUnicode_FromFormat("%s: Expected str, got %s", field_name, Py_TYPE(value)->tp_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); continue;
-            }
-        } else if (fs->type_code == 4) { // bool
-            if (!PyBool_Check(result)) {
-                Py_DECREF(result);
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-                PyObject *msg = PyUnicode_FromFormat("%s: Expected bool, got %s", field_name, Py_TYPE(value)->tp_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); continue;
-            }
-        } else if (fs->type_code == 5) { // bytes
-            if (!PyBytes_Check(result)) {
-                Py_DECREF(result);
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-                PyObject *msg = PyUnicode_FromFormat("%s: Expected bytes, got %s", field_name, Py_TYPE(value)->tp_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); continue;
+                hi = h;
             }
+            if (hi < lo) { p->unsupported = 1; return 0; }
         }
+        if (re_class_add_range(&p->classes[ci], (Py_UCS4)lo, (Py_UCS4)hi) < 0) return -1;
+    }
+    int n = re_node(p, DHI_RN_CLASS);
+    if (n >= 0) p->nodes[n].x = (uint32_t)ci;
+    return n;
+}
 
-        // --- STRING TRANSFORMS ---
-        if (PyUnicode_Check(result)) {
-            if (fs->strip_ws) {
-                PyObject *s = PyObject_CallMethod(result, "strip", NULL);
-                if (!s) { Py_DECREF(result); Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL; }
-                Py_DECREF(result); result = s;
-            }
-            if (fs->to_lower) {
-                PyObject *s = PyObject_CallMethod(result, "lower", NULL);
-                if (!s) { Py_DECREF(result); Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL; }
-                Py_DECREF(result); result = s;
-            }
-            if (fs->to_upper) {
-                PyObject *s = PyObject_CallMethod(result, "upper", NULL);
-                if (!s) { Py_DECREF(result); Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL; }
-                Py_DECREF(result); result = s;
-            }
+// {m}, {m,}, {,n}, {m,n} at p->pos (after '{'); 1 parsed, 0 = literal '{'
+static int re_parse_braces(DhiReParser *p, int *min, int *max) {
+    Py_ssize_t save = p->pos;
+    long lo = -1, hi = -1;
+    int seen_comma = 0;
+    for (;;) {
+        Py_UCS4 c = RE_PEEK(p);
+        if (c >= '0' && c <= '9') {
+            long *v = seen_comma ? &hi : &lo;
+            *v = (*v < 0 ? 0 : *v) * 10 + (long)(c - '0');
+            if (*v > DHI_RE_MAX_REPEAT) { p->unsupported = 1; return 0; }
+        } else if (c == ',' && !seen_comma) {
+            seen_comma = 1;
+        } else if (c == '}') {
+            p->pos++;
+            break;
+        } else {
+            p->pos = save;
+            return 0;
         }
+        p->pos++;
+    }
+    if (!seen_comma && lo < 0) { p->pos = save; return 0; }
+    *min = lo < 0 ? 0 : (int)lo;
+    *max = seen_comma ? (int)hi : (int)lo;
+    if (*max >= 0 && *max < *min) { p->unsupported = 1; return 0; }
+    return 1;
+}
 
-        // --- NUMERIC CONSTRAINTS (INLINED - no FFI overhead) ---
-        // OPTIMIZATION: Simple comparisons are inlined in C instead of calling Zig
-        int validation_failed = 0;
-        if (PyLong_Check(result) && !PyBool_Check(result)) {
-            long val = PyLong_AsLong(result);
-            // INLINED: val > gt_long
-            if (fs->has_gt && val <= fs->gt_long) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be > %ld, got %ld", field_name, fs->gt_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            // INLINED: val >= ge_long
-            if (fs->has_ge && val < fs->ge_long) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be >= %ld, got %ld", field_name, fs->ge_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            // INLINED: val < lt_long
-            if (fs->has_lt && val >= fs->lt_long) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be < %ld, got %ld", field_name, fs->lt_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            // INLINED: val <= le_long
-            if (fs->has_le && val > fs->le_long) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be <= %ld, got %ld", field_name, fs->le_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            // INLINED: val % mul_long == 0
-            if (fs->has_mul && (val % fs->mul_long) != 0) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be a multiple of %ld, got %ld", field_name, fs->mul_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-        } else if (PyFloat_Check(result)) {
-            double val = PyFloat_AsDouble(result);
-            // INLINED: isfinite check
-            if (!fs->allow_inf_nan && !isfinite(val)) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be finite", field_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            // INLINED: all float comparisons
-            if (fs->has_gt && val <= fs->gt_dbl) { validation_failed = 1; }
-            if (!validation_failed && fs->has_ge && val < fs->ge_dbl) { validation_failed = 2; }
-            if (!validation_failed && fs->has_lt && val >= fs->lt_dbl) { validation_failed = 3; }
-            if (!validation_failed && fs->has_le && val > fs->le_dbl) { validation_failed = 4; }
-            if (!validation_failed && fs->has_mul) {
-                double remainder = fmod(val, fs->mul_dbl);
-                if (remainder != 0.0 && fabs(remainder) > 1e-9) { validation_failed = 5; }
-            }
-            if (validation_failed) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                char buf[128];
-                switch (validation_failed) {
-                    case 1: snprintf(buf, sizeof(buf), "%s: Value must be > %g, got %g", field_name, fs->gt_dbl, val); break;
-                    case 2: snprintf(buf, sizeof(buf), "%s: Value must be >= %g, got %g", field_name, fs->ge_dbl, val); break;
-                    case 3: snprintf(buf, sizeof(buf), "%s: Value must be < %g, got %g", field_name, fs->lt_dbl, val); break;
-                    case 4: snprintf(buf, sizeof(buf), "%s: Value must be <= %g, got %g", field_name, fs->le_dbl, val); break;
-                    case 5: snprintf(buf, sizeof(buf), "%s: Value must be a multiple of %g, got %g", field_name, fs->mul_dbl, val); break;
-                }
-                PyObject *msg = PyUnicode_FromString(buf);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
+static int re_parse_alt(DhiReParser *p);
+
+static int re_parse_atom(DhiReParser *p) {
+    Py_UCS4 c = RE_PEEK(p);
+    p->pos++;
+    int n;
+    switch (c) {
+    case '(': {
+        if (RE_PEEK(p) == '?') {
+            p->pos++;
+            Py_UCS4 k = RE_PEEK(p);
+            if (k == ':') {
+                p->pos++;
+            } else if (k == 'P' && p->pos + 1 < p->len &&
+                       PyUnicode_READ(p->kind, p->data, p->pos + 1) == '<') {
+                // Named group: the name doesn't matter for matching
+                p->pos += 2;
+                while (!RE_AT_END(p) && RE_PEEK(p) != '>') p->pos++;
+                if (RE_AT_END(p)) { p->unsupported = 1; return 0; }
+                p->pos++;
+            } else {
+                p->unsupported = 1;  // flags, lookaround, backrefs, atomic groups
+                return 0;
             }
         }
-
-        // --- LENGTH CONSTRAINTS (pre-parsed min_len/max_len) ---
-        if (fs->has_minl || fs->has_maxl) {
-            Py_ssize_t length = PyObject_Length(result);
-            if (length == -1 && PyErr_Occurred()) { Py_DECREF(result); Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL; }
-            if (fs->has_minl && length < fs->min_len) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Length must be >= %zd, got %zd", field_name, fs->min_len, length);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            if (fs->has_maxl && length > fs->max_len) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Length must be <= %zd, got %zd", field_name, fs->max_len, length);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
+        if (++p->depth > 200) { p->unsupported = 1; return 0; }
+        n = re_parse_alt(p);
+        p->depth--;
+        if (n < 0 || p->unsupported) return n;
+        if (RE_PEEK(p) != ')') { p->unsupported = 1; return 0; }
+        p->pos++;
+        return n;
+    }
+    case '[':
+        return re_parse_class(p);
+    case '.':
+        return re_node(p, DHI_RN_ANY);
+    case '^':
+    case '$':
+        n = re_node(p, DHI_RN_ASSERT);
+        if (n >= 0) p->nodes[n].x = c == '^' ? DHI_RE_BOL : DHI_RE_EOL;
+        return n;
+    case '*': case '+': case '?': case ')': case '|':
+        p->unsupported = 1;  // nothing to repeat / unbalanced
+        return 0;
+    case '\\': {
+        if (RE_AT_END(p)) { p->unsupported = 1; return 0; }
+        Py_UCS4 e = RE_PEEK(p);
+        p->pos++;
+        if (e == 'A' || e == 'Z' || e == 'b' || e == 'B') {
+            n = re_node(p, DHI_RN_ASSERT);
+            if (n >= 0) p->nodes[n].x = e == 'A' ? DHI_RE_BOL : e == 'Z' ? DHI_RE_EOS
+                                      : e == 'b' ? DHI_RE_WORDB : DHI_RE_NWORDB;
+            return n;
+        }
+        if (e == 'd' || e == 'D' || e == 'w' || e == 'W' || e == 's' || e == 'S') {
+            int ci = re_new_class(p);
+            if (ci < 0) return -1;
+            re_class_add_escape(&p->classes[ci], e);
+            n = re_node(p, DHI_RN_CLASS);
+            if (n >= 0) p->nodes[n].x = (uint32_t)ci;
+            return n;
         }
+        long v = re_literal_escape(p, e);
+        if (v < 0) { p->unsupported = 1; return 0; }
+        c = (Py_UCS4)v;
+        break;
+    }
+    }
+    n = re_node(p, DHI_RN_CHAR);
+    if (n >= 0) p->nodes[n].x = c;
+    return n;
+}
 
-        // --- FORMAT VALIDATION ---
-        if (fs->format_code > 0 && PyUnicode_Check(result)) {
-            const char *str_val = PyUnicode_AsUTF8(result);
-            if (!str_val) { Py_DECREF(result); Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL; }
-            int valid = 1;
-            const char *fmt_name = "unknown";
-            switch (fs->format_code) {
-                case 1: valid = inline_validate_email(str_val); fmt_name = "email"; break;  // INLINED
-                case 2: valid = dhi_validate_url(str_val); fmt_name = "URL"; break;
-                case 3: valid = dhi_validate_uuid(str_val); fmt_name = "UUID"; break;
-                case 4: valid = dhi_validate_ipv4(str_val); fmt_name = "IPv4"; break;
-                case 5: valid = dhi_validate_ipv6(str_val); fmt_name = "IPv6"; break;
-                case 6: valid = dhi_validate_base64(str_val); fmt_name = "base64"; break;
-                case 7: valid = dhi_validate_iso_date(str_val); fmt_name = "ISO date"; break;
-                case 8: valid = dhi_validate_iso_datetime(str_val); fmt_name = "ISO datetime"; break;
-            }
-            if (!valid) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Invalid %s format", field_name, fmt_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
+static int re_parse_repeat(DhiReParser *p) {
+    int atom = re_parse_atom(p);
+    if (atom < 0 || p->unsupported) return atom;
+    int quantified = 0;
+    for (;;) {
+        Py_UCS4 c = RE_PEEK(p);
+        int min, max;
+        if (c == '*') { min = 0; max = -1; p->pos++; }
+        else if (c == '+') { min = 1; max = -1; p->pos++; }
+        else if (c == '?') { min = 0; max = 1; p->pos++; }
+        else if (c == '{') {
+            p->pos++;
+            if (!re_parse_braces(p, &min, &max)) {
+                p->pos--;
+                if (p->unsupported) return 0;
+                break;
             }
+        } else {
+            break;
         }
+        // Multiple repeats and quantified assertions are errors in re
+        if (quantified || p->nodes[atom].kind == DHI_RN_ASSERT) { p->unsupported = 1; return 0; }
+        quantified = 1;
+        if (RE_PEEK(p) == '?') p->pos++;                          // lazy: same language
+        else if (RE_PEEK(p) == '+') { p->unsupported = 1; return 0; }  // possessive
+        int n = re_node(p, DHI_RN_REPEAT);
+        if (n < 0) return -1;
+        p->nodes[n].child = atom;
+        p->nodes[n].min = min;
+        p->nodes[n].max = max;
+        atom = n;
+    }
+    return atom;
+}
 
-        // --- SUCCESS: set in __dict__ ---
-        PyDict_SetItem(obj_dict, fs->name_obj, result);
-        Py_DECREF(result);
-    }
-
-    Py_DECREF(obj_dict);
-    if (errors && PyList_GET_SIZE(errors) > 0) return errors;
-    Py_XDECREF(errors);
-    Py_RETURN_NONE;
+static int re_parse_cat(DhiReParser *p) {
+    int cat = re_node(p, DHI_RN_CAT);
+    if (cat < 0) return -1;
+    int last = -1;
+    while (!RE_AT_END(p) && RE_PEEK(p) != '|' && RE_PEEK(p) != ')') {
+        int n = re_parse_repeat(p);
+        if (n < 0 || p->unsupported) return n;
+        if (last < 0) p->nodes[cat].child = n;
+        else p->nodes[last].next = n;
+        last = n;
+    }
+    return cat;
 }
 
-// =============================================================================
-// validate_field: Single C call per field — type check + constraints + format
-// Constraints tuple format:
-//   (type_code, strict, gt, ge, lt, le, multiple_of, min_len, max_len,
-//    allow_inf_nan, format_code, strip_ws, to_lower, to_upper)
-//
-// type_code: 0=any, 1=int, 2=float, 3=str, 4=bool, 5=bytes
-// format_code: 0=none, 1=email, 2=url, 3=uuid, 4=ipv4, 5=ipv6,
-//              6=base64, 7=iso_date, 8=iso_datetime
-// =============================================================================
+static int re_parse_alt(DhiReParser *p) {
+    int first = re_parse_cat(p);
+    if (first < 0 || p->unsupported || RE_PEEK(p) != '|') return first;
+    int alt = re_node(p, DHI_RN_ALT);
+    if (alt < 0) return -1;
+    p->nodes[alt].child = first;
+    int last = first;
+    while (RE_PEEK(p) == '|') {
+        p->pos++;
+        int n = re_parse_cat(p);
+        if (n < 0 || p->unsupported) return n;
+        p->nodes[last].next = n;
+        last = n;
+    }
+    return alt;
+}
 
-// Core validation logic - no arg parsing overhead
-static PyObject* validate_field_core(PyObject *value, const char *field_name, PyObject *constraints) {
-    // Unpack constraints
-    int type_code    = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 0));
-    int strict       = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 1));
-    PyObject *gt_obj = PyTuple_GET_ITEM(constraints, 2);
-    PyObject *ge_obj = PyTuple_GET_ITEM(constraints, 3);
-    PyObject *lt_obj = PyTuple_GET_ITEM(constraints, 4);
-    PyObject *le_obj = PyTuple_GET_ITEM(constraints, 5);
-    PyObject *mul_obj = PyTuple_GET_ITEM(constraints, 6);
-    PyObject *minl_obj = PyTuple_GET_ITEM(constraints, 7);
-    PyObject *maxl_obj = PyTuple_GET_ITEM(constraints, 8);
-    int allow_inf_nan = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 9));
-    int format_code   = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 10));
-    int strip_ws     = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 11));
-    int to_lower     = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 12));
-    int to_upper     = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 13));
-
-    PyObject* result = value;
-    Py_INCREF(result);
+static int re_emit(DhiReParser *p, int op, uint32_t x, uint32_t y) {
+    if (p->n_inst >= DHI_RE_MAX_INST) { p->unsupported = 1; return -1; }
+    p->prog[p->n_inst] = (DhiReInst){(uint8_t)op, x, y};
+    return p->n_inst++;
+}
 
-    // --- TYPE CHECKING ---
-    if (type_code == 1) { // int
-        if (strict) {
-            if (!PyLong_CheckExact(result) || PyBool_Check(result)) {
-                Py_DECREF(result);
-                return PyErr_Format(PyExc_ValueError,
-                    "%s: Expected exactly int, got %s",
-                    field_name, Py_TYPE(value)->tp_name);
-            }
-        } else {
-            if (PyBool_Check(result)) {
-                Py_DECREF(result);
-                return PyErr_Format(PyExc_ValueError,
-                    "%s: Expected int, got bool", field_name);
-            }
-            if (!PyLong_Check(result)) {
-                if (PyFloat_Check(result)) {
-                    // Coerce float to int
-                    if (dhi_float_has_fraction(result)) {
-                        Py_DECREF(result);
-                        return PyErr_Format(PyExc_ValueError,
-                            "%s: Expected int, got float with fractional part", field_name);
-                    }
-                    PyObject* new_val = PyNumber_Long(result);
-                    if (!new_val) {
-                        Py_DECREF(result);
-                        return PyErr_Format(PyExc_ValueError,
-                            "%s: Cannot convert float to int", field_name);
-                    }
-                    Py_DECREF(result);
-                    result = new_val;
-                } else {
-                    Py_DECREF(result);
-                    return PyErr_Format(PyExc_ValueError,
-                        "%s: Expected int, got %s",
-                        field_name, Py_TYPE(value)->tp_name);
-                }
-            }
+// Emit node's code; 0 or -1 (program too large: p->unsupported)
+static int re_compile_node(DhiReParser *p, int ni) {
+    const DhiReNode *n = &p->nodes[ni];
+    switch (n->kind) {
+    case DHI_RN_CHAR: return re_emit(p, DHI_RE_CHAR, n->x, 0) < 0 ? -1 : 0;
+    case DHI_RN_ANY: return re_emit(p, DHI_RE_ANY, 0, 0) < 0 ? -1 : 0;
+    case DHI_RN_CLASS: return re_emit(p, DHI_RE_CLASS, n->x, 0) < 0 ? -1 : 0;
+    case DHI_RN_ASSERT: return re_emit(p, (int)n->x, 0, 0) < 0 ? -1 : 0;
+    case DHI_RN_CAT:
+        for (int c = n->child; c >= 0; c = p->nodes[c].next) {
+            if (re_compile_node(p, c) < 0) return -1;
         }
-    } else if (type_code == 2) { // float
-        if (strict) {
-            if (!PyFloat_CheckExact(result)) {
-                Py_DECREF(result);
-                return PyErr_Format(PyExc_ValueError,
-                    "%s: Expected exactly float, got %s",
-                    field_name, Py_TYPE(value)->tp_name);
-            }
-        } else {
-            if (PyBool_Check(result)) {
-                Py_DECREF(result);
-                return PyErr_Format(PyExc_ValueError,
-                    "%s: Expected float, got bool", field_name);
-            }
-            if (!PyFloat_Check(result)) {
-                if (PyLong_Check(result)) {
-                    PyObject* new_val = PyNumber_Float(result);
-                    if (!new_val) {
-                        Py_DECREF(result);
-                        return PyErr_Format(PyExc_ValueError,
-                            "%s: Cannot convert int to float", field_name);
-                    }
-                    Py_DECREF(result);
-                    result = new_val;
-                } else {
-                    Py_DECREF(result);
-                    return PyErr_Format(PyExc_ValueError,
-                        "%s: Expected float, got %s",
-                        field_name, Py_TYPE(value)->tp_name);
-                }
+        return 0;
+    case DHI_RN_ALT: {
+        // SPLIT a, next ; a ; JMP end ; next: SPLIT b, ... ; last
+        // Pending JMPs are chained through their unused y until end is known
+        uint32_t jumps = UINT32_MAX;
+        for (int c = n->child; c >= 0; c = p->nodes[c].next) {
+            int split = -1;
+            if (p->nodes[c].next >= 0 && (split = re_emit(p, DHI_RE_SPLIT, 0, 0)) < 0) return -1;
+            if (split >= 0) p->prog[split].x = (uint32_t)p->n_inst;
+            if (re_compile_node(p, c) < 0) return -1;
+            if (split >= 0) {
+                int j = re_emit(p, DHI_RE_JMP, 0, jumps);
+                if (j < 0) return -1;
+                jumps = (uint32_t)j;
+                p->prog[split].y = (uint32_t)p->n_inst;
             }
         }
-    } else if (type_code == 3) { // str
-        if (!PyUnicode_Check(result)) {
-            Py_DECREF(result);
-            return PyErr_Format(PyExc_ValueError,
-                "%s: Expected str, got %s",
-                field_name, Py_TYPE(value)->tp_name);
-        }
-    } else if (type_code == 4) { // bool
-        if (!PyBool_Check(result)) {
-            Py_DECREF(result);
-            return PyErr_Format(PyExc_ValueError,
-                "%s: Expected bool, got %s",
-                field_name, Py_TYPE(value)->tp_name);
-        }
-    } else if (type_code == 5) { // bytes
-        if (!PyBytes_Check(result)) {
-            Py_DECREF(result);
-            return PyErr_Format(PyExc_ValueError,
-                "%s: Expected bytes, got %s",
-                field_name, Py_TYPE(value)->tp_name);
+        while (jumps != UINT32_MAX) {
+            uint32_t next = p->prog[jumps].y;
+            p->prog[jumps].x = (uint32_t)p->n_inst;
+            p->prog[jumps].y = 0;
+            jumps = next;
         }
+        return 0;
     }
-
-    // --- STRING TRANSFORMS (before validation) ---
-    if (PyUnicode_Check(result)) {
-        if (strip_ws) {
-            PyObject* stripped = PyObject_CallMethod(result, "strip", NULL);
-            if (!stripped) { Py_DECREF(result); return NULL; }
-            Py_DECREF(result);
-            result = stripped;
+    case DHI_RN_REPEAT: {
+        for (int k = 0; k < n->min; k++) {
+            if (re_compile_node(p, n->child) < 0) return -1;
         }
-        if (to_lower) {
-            PyObject* lowered = PyObject_CallMethod(result, "lower", NULL);
-            if (!lowered) { Py_DECREF(result); return NULL; }
-            Py_DECREF(result);
-            result = lowered;
+        if (n->max < 0) {
+            // L: SPLIT body, end ; body ; JMP L
+            int split = re_emit(p, DHI_RE_SPLIT, 0, 0);
+            if (split < 0) return -1;
+            p->prog[split].x = (uint32_t)p->n_inst;
+            if (re_compile_node(p, n->child) < 0) return -1;
+            if (re_emit(p, DHI_RE_JMP, (uint32_t)split, 0) < 0) return -1;
+            p->prog[split].y = (uint32_t)p->n_inst;
+            return 0;
         }
-        if (to_upper) {
-            PyObject* uppered = PyObject_CallMethod(result, "upper", NULL);
-            if (!uppered) { Py_DECREF(result); return NULL; }
-            Py_DECREF(result);
-            result = uppered;
+        // Optional copies: SPLIT body, end ; body ; SPLIT body, end ; ...
+        uint32_t splits = UINT32_MAX;
+        for (int k = n->min; k < n->max; k++) {
+            int split = re_emit(p, DHI_RE_SPLIT, 0, splits);
+            if (split < 0) return -1;
+            p->prog[split].x = (uint32_t)p->n_inst;
+            splits = (uint32_t)split;
+            if (re_compile_node(p, n->child) < 0) return -1;
+        }
+        while (splits != UINT32_MAX) {
+            uint32_t next = p->prog[splits].y;
+            p->prog[splits].y = (uint32_t)p->n_inst;
+            splits = next;
         }
+        return 0;
+    }
     }
+    return 0;
+}
 
-    // --- NUMERIC CONSTRAINTS (use Zig validators) ---
-    if (PyLong_Check(result) && !PyBool_Check(result)) {
-        long val = PyLong_AsLong(result);
-        if (gt_obj != Py_None) {
-            long gt_val = as_long_coerce(gt_obj);
-            if (!dhi_validate_int_gt(val, gt_val)) {
-                Py_DECREF(result);
-                return PyErr_Format(PyExc_ValueError,
-                    "%s: Value must be > %ld, got %ld", field_name, gt_val, val);
-            }
-        }
-        if (ge_obj != Py_None) {
-            long ge_val = as_long_coerce(ge_obj);
-            if (!dhi_validate_int_gte(val, ge_val)) {
-                Py_DECREF(result);
-                return PyErr_Format(PyExc_ValueError,
-                    "%s: Value must be >= %ld, got %ld", field_name, ge_val, val);
-            }
-        }
-        if (lt_obj != Py_None) {
-            long lt_val = as_long_coerce(lt_obj);
-            if (!dhi_validate_int_lt(val, lt_val)) {
-                Py_DECREF(result);
-                return PyErr_Format(PyExc_ValueError,
-                    "%s: Value must be < %ld, got %ld", field_name, lt_val, val);
-            }
-        }
-        if (le_obj != Py_None) {
-            long le_val = as_long_coerce(le_obj);
-            if (!dhi_validate_int_lte(val, le_val)) {
-                Py_DECREF(result);
-                return PyErr_Format(PyExc_ValueError,
-                    "%s: Value must be <= %ld, got %ld", field_name, le_val, val);
-            }
-        }
-        if (mul_obj != Py_None) {
-            long mul_val = as_long_coerce(mul_obj);
-            if (!dhi_validate_int_multiple_of(val, mul_val)) {
-                Py_DECREF(result);
-                return PyErr_Format(PyExc_ValueError,
-                    "%s: Value must be a multiple of %ld, got %ld", field_name, mul_val, val);
-            }
-        }
-    } else if (PyFloat_Check(result)) {
-        double val = PyFloat_AsDouble(result);
-        if (!allow_inf_nan) {
-            if (!dhi_validate_float_finite(val)) {
-                Py_DECREF(result);
-                return PyErr_Format(PyExc_ValueError,
-                    "%s: Value must be finite", field_name);
-            }
-        }
-        if (gt_obj != Py_None) {
-            double gt_val = as_double_coerce(gt_obj);
-            if (!dhi_validate_float_gt(val, gt_val)) {
-                char buf[128];
-                snprintf(buf, sizeof(buf), "%s: Value must be > %g, got %g", field_name, gt_val, val);
-                Py_DECREF(result);
-                PyErr_SetString(PyExc_ValueError, buf);
-                return NULL;
-            }
-        }
-        if (ge_obj != Py_None) {
-            double ge_val = as_double_coerce(ge_obj);
-            if (!dhi_validate_float_gte(val, ge_val)) {
-                char buf[128];
-                snprintf(buf, sizeof(buf), "%s: Value must be >= %g, got %g", field_name, ge_val, val);
-                Py_DECREF(result);
-                PyErr_SetString(PyExc_ValueError, buf);
-                return NULL;
+static void dhi_pattern_free_classes(DhiReClass *classes, int n) {
+    for (int i = 0; i < n; i++) PyMem_Free(classes[i].ranges);
+    PyMem_Free(classes);
+}
+
+// Compile `pattern` into self. 1 compiled, 0 unsupported, -1 error.
+static int dhi_pattern_compile(DhiPatternObject *self, PyObject *pattern) {
+    DhiReParser p = {0};
+    p.kind = PyUnicode_KIND(pattern);
+    p.data = PyUnicode_DATA(pattern);
+    p.len = PyUnicode_GET_LENGTH(pattern);
+
+    int root = re_parse_alt(&p);
+    if (root >= 0 && !p.unsupported && !RE_AT_END(&p)) p.unsupported = 1;  // stray ')'
+    int rc = root < 0 ? -1 : !p.unsupported;
+    if (rc == 1) {
+        p.prog = (DhiReInst*)PyMem_Malloc(DHI_RE_MAX_INST * sizeof(DhiReInst));
+        if (!p.prog) { PyErr_NoMemory(); rc = -1; }
+    }
+    if (rc == 1 && (re_compile_node(&p, root) < 0 || re_emit(&p, DHI_RE_MATCH, 0, 0) < 0)) rc = 0;
+
+    // Mandatory ASCII literal prefix (leading CHARs, past a leading ^/\A)
+    Py_ssize_t plen = 0;
+    int start = rc == 1 && p.prog[0].op == DHI_RE_BOL;
+    while (rc == 1 && p.prog[start + plen].op == DHI_RE_CHAR && p.prog[start + plen].x < 128) plen++;
+    if (rc == 1 && plen > 0) {
+        self->prefix = (char*)PyMem_Malloc((size_t)plen);
+        if (!self->prefix) { PyErr_NoMemory(); rc = -1; }
+        for (Py_ssize_t i = 0; rc == 1 && i < plen; i++) self->prefix[i] = (char)p.prog[start + i].x;
+        self->prefix_len = plen;
+        self->literal = p.prog[start + plen].op == DHI_RE_MATCH;
+    }
+
+    PyMem_Free(p.nodes);
+    if (rc != 1) {
+        PyMem_Free(p.prog);
+        dhi_pattern_free_classes(p.classes, p.n_classes);
+        return rc;
+    }
+    self->prog = p.prog;
+    self->n_inst = p.n_inst;
+    self->classes = p.classes;
+    self->n_classes = p.n_classes;
+    return 1;
+}
+
+// --- Pike VM ---
+
+typedef struct {
+    int *list;
+    int n;
+} DhiReThreads;
+
+// Add pc and everything reachable through jumps/splits/assertions at i
+static void re_add_thread(const DhiPatternObject *re, DhiReThreads *t, uint32_t *mark,
+                          uint32_t gen, int *stack, int pc, const void *data, int kind,
+                          Py_ssize_t i, Py_ssize_t len) {
+    int sp = 0;
+    stack[sp++] = pc;
+    while (sp > 0) {
+        pc = stack[--sp];
+        if (mark[pc] == gen) continue;
+        mark[pc] = gen;
+        const DhiReInst *in = &re->prog[pc];
+        switch (in->op) {
+        case DHI_RE_JMP:
+            stack[sp++] = (int)in->x;
+            break;
+        case DHI_RE_SPLIT:
+            stack[sp++] = (int)in->y;
+            stack[sp++] = (int)in->x;
+            break;
+        case DHI_RE_BOL:
+            if (i == 0) stack[sp++] = pc + 1;
+            break;
+        case DHI_RE_EOS:
+            if (i == len) stack[sp++] = pc + 1;
+            break;
+        case DHI_RE_EOL:
+            if (i == len || (i == len - 1 && PyUnicode_READ(kind, data, i) == '\n')) {
+                stack[sp++] = pc + 1;
             }
+            break;
+        case DHI_RE_WORDB:
+        case DHI_RE_NWORDB: {
+            int before = i > 0 && dhi_re_is_word(PyUnicode_READ(kind, data, i - 1));
+            int after = i < len && dhi_re_is_word(PyUnicode_READ(kind, data, i));
+            if ((before != after) == (in->op == DHI_RE_WORDB)) stack[sp++] = pc + 1;
+            break;
         }
-        if (lt_obj != Py_None) {
-            double lt_val = as_double_coerce(lt_obj);
-            if (!dhi_validate_float_lt(val, lt_val)) {
-                char buf[128];
-                snprintf(buf, sizeof(buf), "%s: Value must be < %g, got %g", field_name, lt_val, val);
-                Py_DECREF(result);
-                PyErr_SetString(PyExc_ValueError, buf);
-                return NULL;
-            }
+        default:
+            t->list[t->n++] = pc;
+            break;
         }
-        if (le_obj != Py_None) {
-            double le_val = as_double_coerce(le_obj);
-            if (!dhi_validate_float_lte(val, le_val)) {
-                char buf[128];
-                snprintf(buf, sizeof(buf), "%s: Value must be <= %g, got %g", field_name, le_val, val);
-                Py_DECREF(result);
-                PyErr_SetString(PyExc_ValueError, buf);
-                return NULL;
+    }
+}
+
+#define DHI_RE_STACK_INST 256
+
+// re.match(pattern, s) is not None. 1 / 0, or -1 on memory error.
+static int dhi_pattern_match(const DhiPatternObject *re, PyObject *s) {
+    int kind = PyUnicode_KIND(s);
+    const void *data = PyUnicode_DATA(s);
+    Py_ssize_t len = PyUnicode_GET_LENGTH(s);
+
+    // Literal prefix: one memcmp on compact ASCII/latin-1 strings
+    if (re->prefix_len) {
+        if (len < re->prefix_len) return 0;
+        if (kind == PyUnicode_1BYTE_KIND) {
+            if (memcmp(data, re->prefix, (size_t)re->prefix_len) != 0) return 0;
+        } else {
+            for (Py_ssize_t i = 0; i < re->prefix_len; i++) {
+                if (PyUnicode_READ(kind, data, i) != (Py_UCS4)(unsigned char)re->prefix[i]) return 0;
             }
         }
-        if (mul_obj != Py_None) {
-            double mul_val = as_double_coerce(mul_obj);
-            double remainder = fmod(val, mul_val);
-            if (remainder != 0.0 && fabs(remainder) > 1e-9) {
-                char buf[128];
-                snprintf(buf, sizeof(buf), "%s: Value must be a multiple of %g, got %g", field_name, mul_val, val);
-                Py_DECREF(result);
-                PyErr_SetString(PyExc_ValueError, buf);
-                return NULL;
-            }
+        if (re->literal) return 1;
+    }
+
+    int n = re->n_inst;
+    int stack_buf[4 * DHI_RE_STACK_INST + 2];
+    uint32_t mark_buf[DHI_RE_STACK_INST];
+    int *buf = stack_buf;
+    uint32_t *mark = mark_buf;
+    if (n > DHI_RE_STACK_INST) {
+        buf = (int*)PyMem_Malloc(((size_t)n * 4 + 2) * sizeof(int));
+        mark = (uint32_t*)PyMem_Malloc((size_t)n * sizeof(uint32_t));
+        if (!buf || !mark) {
+            PyMem_Free(buf);
+            PyMem_Free(mark);
+            PyErr_NoMemory();
+            return -1;
         }
     }
-
-    // --- LENGTH CONSTRAINTS ---
-    if (minl_obj != Py_None || maxl_obj != Py_None) {
-        Py_ssize_t length = PyObject_Length(result);
-        if (length == -1 && PyErr_Occurred()) {
-            Py_DECREF(result);
-            return NULL;
-        }
-        if (minl_obj != Py_None) {
-            Py_ssize_t min_len = PyLong_AsSsize_t(minl_obj);
-            if (length < min_len) {
-                Py_DECREF(result);
-                return PyErr_Format(PyExc_ValueError,
-                    "%s: Length must be >= %zd, got %zd", field_name, min_len, length);
+    memset(mark, 0, (size_t)n * sizeof(uint32_t));
+    DhiReThreads cur = {buf, 0}, nxt = {buf + n, 0};
+    int *stack = buf + 2 * n;   // 2n + 2: each SPLIT pushes two
+    uint32_t gen = 1;
+    int matched = 0;
+
+    re_add_thread(re, &cur, mark, gen, stack, 0, data, kind, 0, len);
+    for (Py_ssize_t i = 0; cur.n > 0; i++) {
+        Py_UCS4 c = i < len ? PyUnicode_READ(kind, data, i) : 0;
+        gen++;
+        nxt.n = 0;
+        for (int t = 0; t < cur.n; t++) {
+            const DhiReInst *in = &re->prog[cur.list[t]];
+            int step;
+            switch (in->op) {
+            case DHI_RE_MATCH: matched = 1; goto done;
+            case DHI_RE_CHAR: step = i < len && c == in->x; break;
+            case DHI_RE_ANY: step = i < len && c != '\n'; break;
+            case DHI_RE_CLASS: step = i < len && dhi_re_class_has(&re->classes[in->x], c); break;
+            default: step = 0; break;
             }
-        }
-        if (maxl_obj != Py_None) {
-            Py_ssize_t max_len = PyLong_AsSsize_t(maxl_obj);
-            if (length > max_len) {
-                Py_DECREF(result);
-                return PyErr_Format(PyExc_ValueError,
-                    "%s: Length must be <= %zd, got %zd", field_name, max_len, length);
+            if (step) {
+                re_add_thread(re, &nxt, mark, gen, stack, cur.list[t] + 1, data, kind, i + 1, len);
             }
         }
+        DhiReThreads swap = cur;
+        cur = nxt;
+        nxt = swap;
+        if (i >= len) break;
     }
+    for (int t = 0; t < cur.n; t++) {
+        if (re->prog[cur.list[t]].op == DHI_RE_MATCH) { matched = 1; break; }
+    }
+done:
+    if (buf != stack_buf) {
+        PyMem_Free(buf);
+        PyMem_Free(mark);
+    }
+    return matched;
+}
 
-    // --- FORMAT VALIDATION (Zig-powered) ---
-    if (format_code > 0 && PyUnicode_Check(result)) {
-        const char* str_val = PyUnicode_AsUTF8(result);
-        if (!str_val) { Py_DECREF(result); return NULL; }
-        int valid = 1;
-        const char* fmt_name = "unknown format";
-
-        switch (format_code) {
-            case 1: valid = inline_validate_email(str_val); fmt_name = "email"; break;  // INLINED
-            case 2: valid = dhi_validate_url(str_val); fmt_name = "URL"; break;
-            case 3: valid = dhi_validate_uuid(str_val); fmt_name = "UUID"; break;
-            case 4: valid = dhi_validate_ipv4(str_val); fmt_name = "IPv4"; break;
-            case 5: valid = dhi_validate_ipv6(str_val); fmt_name = "IPv6"; break;
-            case 6: valid = dhi_validate_base64(str_val); fmt_name = "base64"; break;
-            case 7: valid = dhi_validate_iso_date(str_val); fmt_name = "ISO date"; break;
-            case 8: valid = dhi_validate_iso_datetime(str_val); fmt_name = "ISO datetime"; break;
-        }
+static void DhiPattern_dealloc(DhiPatternObject *self) {
+    Py_XDECREF(self->pattern);
+    PyMem_Free(self->prog);
+    dhi_pattern_free_classes(self->classes, self->n_classes);
+    PyMem_Free(self->prefix);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
 
-        if (!valid) {
-            Py_DECREF(result);
-            return PyErr_Format(PyExc_ValueError,
-                "%s: Invalid %s format", field_name, fmt_name);
-        }
+static PyObject* DhiPattern_match(DhiPatternObject *self, PyObject *s) {
+    if (!PyUnicode_Check(s)) {
+        PyErr_Format(PyExc_TypeError, "expected str, got %s", Py_TYPE(s)->tp_name);
+        return NULL;
     }
+    int r = dhi_pattern_match(self, s);
+    if (r < 0) return NULL;
+    return PyBool_FromLong(r);
+}
 
-    return result;  // Validated (possibly transformed) value
+static PyObject* DhiPattern_repr(DhiPatternObject *self) {
+    return PyUnicode_FromFormat("dhi.Pattern(%R)", self->pattern);
 }
 
-// Python wrapper for validate_field - thin wrapper around core
-static PyObject* py_validate_field(PyObject* self, PyObject* args) {
-    PyObject *value, *field_name_obj, *constraints;
-    if (!PyArg_ParseTuple(args, "OOO!", &value, &field_name_obj, &PyTuple_Type, &constraints)) {
+static PyMethodDef DhiPattern_methods[] = {
+    {"match", (PyCFunction)DhiPattern_match, METH_O,
+     "True when re.match(pattern, s) would match: (s) -> bool"},
+    {NULL, NULL, 0, NULL}
+};
+
+static PyMemberDef DhiPattern_members[] = {
+    {"pattern", Py_T_OBJECT_EX, offsetof(DhiPatternObject, pattern), Py_READONLY, "Source pattern"},
+    {NULL, 0, 0, 0, NULL}
+};
+
+static PyTypeObject DhiPatternType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "dhi._dhi_native.Pattern",
+    .tp_doc = "Field(pattern=...) compiled to a native matcher",
+    .tp_basicsize = sizeof(DhiPatternObject),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc = (destructor)DhiPattern_dealloc,
+    .tp_repr = (reprfunc)DhiPattern_repr,
+    .tp_methods = DhiPattern_methods,
+    .tp_members = DhiPattern_members,
+};
+
+// compile_pattern(pattern) -> Pattern, or None when the pattern needs re
+static PyObject* py_compile_pattern(PyObject *self_unused, PyObject *pattern) {
+    if (!PyUnicode_Check(pattern)) {
+        PyErr_Format(PyExc_TypeError, "pattern must be str, got %s", Py_TYPE(pattern)->tp_name);
         return NULL;
     }
-    const char* field_name = PyUnicode_AsUTF8(field_name_obj);
-    if (!field_name) return NULL;
-    return validate_field_core(value, field_name, constraints);
+    DhiPatternObject *self = PyObject_New(DhiPatternObject, &DhiPatternType);
+    if (!self) return NULL;
+    self->prog = NULL;
+    self->classes = NULL;
+    self->n_inst = self->n_classes = 0;
+    self->prefix = NULL;
+    self->prefix_len = 0;
+    self->literal = 0;
+    Py_INCREF(pattern);
+    self->pattern = pattern;
+
+    int r = dhi_pattern_compile(self, pattern);
+    if (r <= 0) {
+        Py_DECREF(self);
+        if (r < 0) return NULL;
+        Py_RETURN_NONE;
+    }
+    return (PyObject*)self;
 }
 
 // =============================================================================
-// init_model: Batch init — ONE Python→C call for the entire __init__
-// Validates all fields, sets attributes directly on self.__dict__
-//
-// init_model(self, kwargs_dict, field_specs)
-// field_specs: tuple of (field_name_str, alias_or_None, required_bool,
-//              default_obj, constraints_tuple)
-// Returns: None on success, or list of (field_name, error_msg) tuples on error
+// ISO DATE/DATETIME PARSING - date/datetime fields built without Python
 // =============================================================================
-static PyObject* py_init_model(PyObject* self_unused, PyObject* args) {
-    PyObject *model_self, *kwargs, *field_specs;
+// Fields typed date (type_code 9) or datetime (10) accept an instance as is
+// and, unless strict, an ISO 8601 string, which is parsed here and turned
+// into the object through the PyDateTime C API:
+//   YYYY-MM-DD[(T|t| )HH:MM[:SS[(.|,)f{1,6}]][Z|z|(+|-)HH[[:]MM]]]
+// (a datetime field also takes the bare date, as midnight). The fixed-width
+// head "YYYY-MM-DDTHH:MM" is checked in one 16-byte vector compare against
+// a digit/separator template; only the optional tail is walked bytewise.
 
-    if (!PyArg_ParseTuple(args, "OO!O!", &model_self, &PyDict_Type, &kwargs,
-                          &PyTuple_Type, &field_specs)) {
-        return NULL;
-    }
+typedef struct {
+    int year, month, day;
+    int hour, minute, second, usec;
+    int has_tz, tz_offset;   // tz_offset in seconds east of UTC
+} DhiIsoParts;
+
+// Template for "YYYY-MM-DDTHH:MM": digit lanes, and the literal byte of the
+// others (lane 10, the date/time separator, is checked by the caller)
+static const unsigned char dhi_iso_digit_lanes[16] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0, 0xFF, 0xFF, 0, 0xFF, 0xFF, 0, 0xFF, 0xFF, 0, 0xFF, 0xFF,
+};
+static const unsigned char dhi_iso_literals[16] = {
+    0, 0, 0, 0, '-', 0, 0, '-', 0, 0, 0, 0, 0, ':', 0, 0,
+};
 
-    // Get self.__dict__ for fast direct attribute setting
-    PyObject *obj_dict = PyObject_GenericGetDict(model_self, NULL);
-    if (!obj_dict) return NULL;
+#if defined(__clang__) || defined(__GNUC__)
+typedef unsigned char dhi_v16u8 __attribute__((vector_size(16)));
+typedef uint64_t dhi_v2u64 __attribute__((vector_size(16)));
+#endif
 
-    Py_ssize_t n_fields = PyTuple_GET_SIZE(field_specs);
-    PyObject *errors = NULL;  // Lazy-allocated list of (name, msg) tuples
+// Check the first n (10 or 16) bytes of s against the template; digit values
+// land in d[]. 1 when they match.
+static inline int dhi_iso_head(const char *s, Py_ssize_t n, unsigned char d[16]) {
+    unsigned char buf[16] = {0};
+    memcpy(buf, s, (size_t)n);
+#if defined(__clang__) || defined(__GNUC__)
+    static const dhi_v16u8 lane = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+    dhi_v16u8 v, digit_lanes, literals;
+    memcpy(&v, buf, 16);
+    memcpy(&digit_lanes, dhi_iso_digit_lanes, 16);
+    memcpy(&literals, dhi_iso_literals, 16);
+    const dhi_v16u8 digits = v - (unsigned char)'0';
+    const dhi_v16u8 ok = (digit_lanes & (dhi_v16u8)(digits <= 9))
+                       | (~digit_lanes & (dhi_v16u8)(v == literals))
+                       | (dhi_v16u8)(lane == 10)
+                       | (dhi_v16u8)(lane >= (unsigned char)n);
+    const dhi_v2u64 words = (dhi_v2u64)ok;
+    memcpy(d, &digits, 16);
+    return (words[0] & words[1]) == UINT64_MAX;
+#else
+    for (Py_ssize_t i = 0; i < n; i++) {
+        d[i] = (unsigned char)(buf[i] - '0');
+        if (i == 10) continue;
+        if (dhi_iso_digit_lanes[i] ? d[i] > 9 : buf[i] != dhi_iso_literals[i]) return 0;
+    }
+    return 1;
+#endif
+}
 
-    for (Py_ssize_t i = 0; i < n_fields; i++) {
-        PyObject *spec = PyTuple_GET_ITEM(field_specs, i);
-        PyObject *name_obj   = PyTuple_GET_ITEM(spec, 0);
-        PyObject *alias_obj  = PyTuple_GET_ITEM(spec, 1);
-        int required         = PyObject_IsTrue(PyTuple_GET_ITEM(spec, 2));
-        PyObject *default_val = PyTuple_GET_ITEM(spec, 3);
-        PyObject *constraints = PyTuple_GET_ITEM(spec, 4);
+static inline int dhi_iso_2digits(const char *s, Py_ssize_t i, Py_ssize_t len, int *out) {
+    if (i + 2 > len) return 0;
+    unsigned a = (unsigned char)s[i] - '0', b = (unsigned char)s[i + 1] - '0';
+    if (a > 9 || b > 9) return 0;
+    *out = (int)(a * 10 + b);
+    return 1;
+}
 
-        // --- Extract value from kwargs ---
-        PyObject *value = NULL;
-        if (alias_obj != Py_None) {
-            value = PyDict_GetItem(kwargs, alias_obj);  // borrowed ref
+// Parse s[0:len]. want_time: the field is a datetime (time and offset allowed).
+// 1 when s is a valid ISO date/datetime, else 0.
+static int dhi_iso_parse(const char *s, Py_ssize_t len, int want_time, DhiIsoParts *o) {
+    if (len != 10 && (!want_time || len < 16)) return 0;
+    unsigned char d[16];
+    if (!dhi_iso_head(s, len == 10 ? 10 : 16, d)) return 0;
+
+    memset(o, 0, sizeof(*o));
+    o->year = d[0] * 1000 + d[1] * 100 + d[2] * 10 + d[3];
+    o->month = d[5] * 10 + d[6];
+    o->day = d[8] * 10 + d[9];
+    static const unsigned char mdays[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (o->year < 1 || o->month < 1 || o->month > 12 || o->day < 1) return 0;
+    int leap = (o->year % 4 == 0 && o->year % 100 != 0) || o->year % 400 == 0;
+    if (o->day > mdays[o->month - 1] + (o->month == 2 && leap)) return 0;
+    if (len == 10) return 1;
+
+    if (s[10] != 'T' && s[10] != 't' && s[10] != ' ') return 0;
+    o->hour = d[11] * 10 + d[12];
+    o->minute = d[14] * 10 + d[15];
+    if (o->hour > 23 || o->minute > 59) return 0;
+
+    Py_ssize_t i = 16;
+    if (i < len && s[i] == ':') {
+        if (!dhi_iso_2digits(s, i + 1, len, &o->second) || o->second > 59) return 0;
+        i += 3;
+        if (i < len && (s[i] == '.' || s[i] == ',')) {
+            i++;
+            int n = 0;
+            while (i < len && n < 6 && (unsigned char)(s[i] - '0') <= 9) {
+                o->usec = o->usec * 10 + (s[i] - '0');
+                i++;
+                n++;
+            }
+            if (n == 0) return 0;
+            for (; n < 6; n++) o->usec *= 10;
         }
-        if (value == NULL) {
-            value = PyDict_GetItem(kwargs, name_obj);   // borrowed ref
+    }
+    if (i < len && (s[i] == 'Z' || s[i] == 'z')) {
+        o->has_tz = 1;
+        i++;
+    } else if (i < len && (s[i] == '+' || s[i] == '-')) {
+        int sign = s[i] == '-' ? -1 : 1, oh, om = 0;
+        if (!dhi_iso_2digits(s, i + 1, len, &oh)) return 0;
+        i += 3;
+        int colon = i < len && s[i] == ':';
+        if (colon || i < len) {
+            if (!dhi_iso_2digits(s, i + colon, len, &om)) return 0;
+            i += colon + 2;
         }
+        if (oh > 23 || om > 59) return 0;
+        o->has_tz = 1;
+        o->tz_offset = sign * (oh * 3600 + om * 60);
+    }
+    return i == len;
+}
 
-        if (value == NULL) {
-            if (!required) {
-                // Set default directly in __dict__
-                PyDict_SetItem(obj_dict, name_obj, default_val);
-                continue;
-            } else {
-                // Missing required field — collect error
-                if (!errors) {
-                    errors = PyList_New(0);
-                    if (!errors) { Py_DECREF(obj_dict); return NULL; }
-                }
-                PyObject *err = Py_BuildValue("(Os)", name_obj, "Field required");
-                PyList_Append(errors, err);
-                Py_DECREF(err);
-                continue;
-            }
+// Build the date (want_time 0) or datetime for s[0:len].
+// 1 with *out set, 0 when s isn't a valid ISO value, -1 with an exception set.
+static int dhi_iso_to_object(const char *s, Py_ssize_t len, int want_time, PyObject **out) {
+    DhiIsoParts p;
+    if (!dhi_iso_parse(s, len, want_time, &p)) return 0;
+    if (!want_time) {
+        *out = PyDate_FromDate(p.year, p.month, p.day);
+        return *out ? 1 : -1;
+    }
+    PyObject *tz = Py_None;
+    if (p.has_tz) {
+        if (p.tz_offset == 0) {
+            tz = PyDateTime_TimeZone_UTC;
+            Py_INCREF(tz);
+        } else {
+            PyObject *delta = PyDelta_FromDSU(0, p.tz_offset, 0);
+            if (!delta) return -1;
+            tz = PyTimeZone_FromOffset(delta);
+            Py_DECREF(delta);
+            if (!tz) return -1;
         }
+    }
+    *out = PyDateTimeAPI->DateTime_FromDateAndTime(p.year, p.month, p.day, p.hour, p.minute,
+                                                  p.second, p.usec, tz, PyDateTimeAPI->DateTimeType);
+    if (p.has_tz) Py_DECREF(tz);
+    return *out ? 1 : -1;
+}
 
-        // --- Validate field ---
-        const char *field_name = PyUnicode_AsUTF8(name_obj);
-        if (!field_name) { Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL; }
+// parse_iso(s, want_time) -> date/datetime, or None when s isn't valid in
+// the grammar above. The Python validation path parses through this too, so
+// every field accepts exactly the same strings.
+static PyObject* py_parse_iso(PyObject *self_unused, PyObject *args) {
+    PyObject *str;
+    int want_time;
+    if (!PyArg_ParseTuple(args, "Up", &str, &want_time)) return NULL;
+    Py_ssize_t n;
+    const char *s = PyUnicode_AsUTF8AndSize(str, &n);
+    if (!s) {
+        // Lone surrogates can't be ISO text either
+        if (!PyErr_ExceptionMatches(PyExc_UnicodeEncodeError)) return NULL;
+        PyErr_Clear();
+        Py_RETURN_NONE;
+    }
+    PyObject *out;
+    int r = dhi_iso_to_object(s, n, want_time, &out);
+    if (r < 0) return NULL;
+    if (r == 0) Py_RETURN_NONE;
+    return out;
+}
 
-        PyObject *validated = validate_field_core(value, field_name, constraints);
-        if (validated == NULL) {
-            // Validation failed — capture error message
-            if (!errors) {
-                errors = PyList_New(0);
-                if (!errors) { Py_DECREF(obj_dict); PyErr_Clear(); return NULL; }
-            }
-            PyObject *exc_type, *exc_value, *exc_tb;
-            PyErr_Fetch(&exc_type, &exc_value, &exc_tb);
-            PyObject *msg = exc_value ? PyObject_Str(exc_value) : PyUnicode_FromString("Validation failed");
-            PyObject *err = Py_BuildValue("(OO)", name_obj, msg);
-            PyList_Append(errors, err);
-            Py_DECREF(err);
-            Py_DECREF(msg);
-            Py_XDECREF(exc_type);
-            Py_XDECREF(exc_value);
-            Py_XDECREF(exc_tb);
-            continue;
-        }
+// =============================================================================
+// VALIDATION PLANS - each field's scalar checks lowered to a step array
+// =============================================================================
+// py_compile_model_specs turns a field's constraints into the few steps it
+// actually needs (type check/coercion, string transforms, bounds, length,
+// pattern, format), so validating a value is a tight loop over fs->plan instead of
+// re-walking type_code and every has_* flag. Model-typed fields (6/7/8) are
+// resolved by the callers; their plans only hold the generic checks.
+// init_model_core, init_model_compiled, Struct init, the Struct JSON decoder
+// and validate_field all run the same plans through dhi_plan_run().
+
+enum {
+    DHI_ERR_REQUIRED,        // Field required
+    DHI_ERR_EXTRA,           // detail = the extra key
+    DHI_ERR_EXPECTED,        // text = expected type, detail = got type
+    DHI_ERR_EXPECTED_MODEL,  // detail = got type
+    DHI_ERR_FRACTION,        // float with fractional part for an int field
+    DHI_ERR_CONVERT,         // text = "float to int" / "int to float"
+    DHI_ERR_NESTED,          // detail = nested exception value
+    DHI_ERR_LENGTH,          // op 0: >=, 1: <= ; bound.n / got.n
+    DHI_ERR_ITEM,            // got.n = list index
+    DHI_ERR_UNION,
+    DHI_ERR_BOUND_INT,       // op indexes dhi_bound_ops ; bound.l / got.l (or detail: big int)
+    DHI_ERR_BOUND_FLOAT,     // op indexes dhi_bound_ops ; bound.d / got.d
+    DHI_ERR_FINITE,
+    DHI_ERR_FORMAT,          // text = format name
+    DHI_ERR_PATTERN,         // fs->pattern didn't match
+};
 
-        // Set validated value directly in __dict__ (fastest path)
-        PyDict_SetItem(obj_dict, name_obj, validated);
-        Py_DECREF(validated);
-    }
+static const char *const dhi_bound_ops[] = {">", ">=", "<", "<=", "a multiple of"};
 
-    Py_DECREF(obj_dict);
+typedef union { long l; double d; Py_ssize_t n; } DhiErrorArg;
 
-    if (errors && PyList_GET_SIZE(errors) > 0) {
-        // Return errors list for Python to wrap in ValidationErrors
-        return errors;
-    }
-    Py_XDECREF(errors);
-    Py_RETURN_NONE;
-}
+typedef struct {
+    Py_ssize_t field;        // spec index (-1 for DHI_ERR_EXTRA)
+    int code, op;
+    const char *text;        // static string, or NULL
+    PyObject *detail;        // owned ref once recorded, or NULL
+    DhiErrorArg bound, got;
+} DhiFieldError;
+
+enum {
+    DHI_OP_INT_STRICT,       // exactly int
+    DHI_OP_INT,              // int, or a whole float coerced to int
+    DHI_OP_FLOAT_STRICT,     // exactly float
+    DHI_OP_FLOAT,            // float, or an int coerced to float
+    DHI_OP_STR,
+    DHI_OP_BOOL,
+    DHI_OP_BYTES,
+    DHI_OP_DATE,             // op bit 0: datetime, bit 1: strict (no ISO strings)
+    DHI_OP_IF_STR,           // skip the next `skip` steps unless the value is str
+    DHI_OP_STRIP,
+    DHI_OP_LOWER,
+    DHI_OP_UPPER,
+    DHI_OP_IF_INT,           // load the C long (skip the block unless int)
+    DHI_OP_INT_BOUND,        // op = bound kind (dhi_bound_ops), arg.l
+    DHI_OP_IF_FLOAT,         // load the C double (skip the block unless float)
+    DHI_OP_FINITE,
+    DHI_OP_FLOAT_BOUND,      // op = bound kind, arg.d
+    DHI_OP_LEN,              // load len(value)
+    DHI_OP_MIN_LEN,          // arg.n
+    DHI_OP_MAX_LEN,          // arg.n
+    DHI_OP_PATTERN,          // fs->pattern; str values only
+    DHI_OP_FORMAT,           // op = format_code; str values only
+};
+
+typedef struct {
+    uint8_t code, op, skip;
+    DhiErrorArg arg;
+} DhiStep;
+
+// type + str guard/3 transforms + int block (load + 5) + float block
+// (load + finite + 5) + length (load + 2) + pattern + format
+#define DHI_PLAN_MAX_STEPS 24
 
 // =============================================================================
-// dump_json_compiled: Ultra-fast JSON serialization using pre-compiled specs
-// Builds JSON string directly in C, no intermediate Python dict
+// PRE-COMPILED FIELD SPECS — eliminates per-call constraint tuple unpacking
 // =============================================================================
 
-// Helper: escape a string for JSON and append to buffer
-static int json_escape_string(char **buf, size_t *buf_size, size_t *pos, const char *str, Py_ssize_t len) {
-    // Worst case: every char needs escaping (\uXXXX = 6 chars) + quotes
-    size_t needed = *pos + len * 6 + 3;
-    if (needed > *buf_size) {
-        size_t new_size = needed * 2;
-        char *new_buf = realloc(*buf, new_size);
-        if (!new_buf) return -1;
-        *buf = new_buf;
-        *buf_size = new_size;
-    }
-
-    char *p = *buf + *pos;
-    *p++ = '"';
-
-    for (Py_ssize_t i = 0; i < len; i++) {
-        unsigned char c = (unsigned char)str[i];
-        switch (c) {
-            case '"':  *p++ = '\\'; *p++ = '"'; break;
-            case '\\': *p++ = '\\'; *p++ = '\\'; break;
-            case '\b': *p++ = '\\'; *p++ = 'b'; break;
-            case '\f': *p++ = '\\'; *p++ = 'f'; break;
-            case '\n': *p++ = '\\'; *p++ = 'n'; break;
-            case '\r': *p++ = '\\'; *p++ = 'r'; break;
-            case '\t': *p++ = '\\'; *p++ = 't'; break;
-            default:
-                if (c < 32) {
-                    p += sprintf(p, "\\u%04x", c);
-                } else {
-                    *p++ = c;
-                }
-        }
+typedef struct {
+    PyObject *name_obj;     // borrowed ref (kept alive by class)
+    Py_hash_t name_hash;    // Pre-computed hash for fast dict operations
+    PyObject *alias_obj;    // borrowed ref or NULL (Py_None)
+    int required;
+    PyObject *default_val;  // borrowed ref
+    // Pre-parsed constraints (no per-call PyLong_AsLong/PyTuple_GET_ITEM):
+    int type_code, strict;
+    int has_gt, has_ge, has_lt, has_le, has_mul;
+    long gt_long, ge_long, lt_long, le_long, mul_long;
+    double gt_dbl, ge_dbl, lt_dbl, le_dbl, mul_dbl;
+    int has_minl, has_maxl;
+    Py_ssize_t min_len, max_len;
+    int allow_inf_nan, format_code;
+    int strip_ws, to_lower, to_upper;
+    int cache_strings;      // Field(cache_strings=True): Decoder value cache opt-in
+    PyObject *pattern;      // Pattern or re.Pattern (borrowed ref, kept alive by class), or NULL
+    const DhiStep *plan;    // validation plan, in ms->plan_steps (see dhi_plan_build)
+    int n_steps;
+    int n_type_steps;       // leading type-check/coercion steps (0 or 1)
+    // Nested model support (type_code=6 for nested models)
+    PyObject *nested_model_type;  // The nested BaseModel class (borrowed ref, or NULL)
+    // Union/list-of-models support (type_code=7 for list-of-models, 8 for union)
+    PyObject *union_types_tuple;  // Tuple of acceptable BaseModel types (borrowed ref, or NULL)
+    // Cached JSON parsing fields (computed once, used for fast field matching)
+    const char *name_ptr;   // Cached UTF-8 pointer to name
+    size_t name_len;        // Cached length of name
+    uint64_t name_hash_fnv; // FNV-1a hash for JSON field matching
+    // Serialization plan: escaped `"name": ` / `"alias": ` fragments in
+    // ms->dump_keys (the alias variant is the name one when there's no alias).
+    // Compact output writes len - 1 bytes, dropping the trailing space.
+    const char *dump_key, *dump_alias_key;
+    uint32_t dump_key_len, dump_alias_key_len;
+    int dump_keys_ascii;    // both fragments ASCII: safe for an ASCII writer
+} CompiledFieldSpec;
+
+// =============================================================================
+// HOT-PATH STATS - compile-time-optional per-class counters
+// =============================================================================
+// Built with -DDHI_STATS=1, every CompiledModelSpecs carries a row of
+// counters bumped with relaxed atomics on the validation paths; =2 adds a
+// timestamp-counter reading around each validated object (inclusive of
+// nested objects). Specs compiled with a name (a model or Struct class) are
+// linked into a registry that _dhi_native.stats() sums per name. Without
+// DHI_STATS the macros compile to nothing and stats() reports enabled=False.
+
+enum {
+    DHI_STAT_VALIDATIONS,       // objects validated (init, from_row, JSON, MessagePack)
+    DHI_STAT_FAST_PATH,         // ... of those built by the vectorcall fast path
+    DHI_STAT_JSON_DECODES,      // objects decoded from JSON
+    DHI_STAT_KEY_ORDER_MISSES,  // JSON keys out of field order (dispatch-table probe)
+    DHI_STAT_UNKNOWN_KEYS,      // JSON / MessagePack keys matching no field
+    DHI_STAT_ERRORS,            // validations that failed
+    DHI_STAT_CYCLES,            // timestamp-counter ticks spent validating (=2)
+    DHI_STAT_COUNT
+};
+
+typedef struct DhiStatsEntry {
+    struct DhiStatsEntry *prev, *next;  // registry links (NULL: unnamed, not listed)
+    PyObject *name;                     // class qualname
+    PyObject *fallback;                 // why the class is off the fast path, or NULL
+    uint64_t counts[DHI_STAT_COUNT];
+} DhiStatsEntry;
+
+#if DHI_STATS
+#define DHI_STAT_ADD(ms, k, n) \
+    ((void)__atomic_fetch_add(&(ms)->stats.counts[k], (uint64_t)(n), __ATOMIC_RELAXED))
+#else
+#define DHI_STAT_ADD(ms, k, n) ((void)0)
+#endif
+#define DHI_STAT_INC(ms, k) DHI_STAT_ADD(ms, k, 1)
+
+#if DHI_STATS >= 2
+#if defined(__x86_64__) || defined(__i386__)
+#define DHI_STAT_CLOCK "rdtsc"
+static inline uint64_t dhi_stat_clock(void) { return __rdtsc(); }
+#elif defined(__aarch64__)
+#define DHI_STAT_CLOCK "cntvct"
+static inline uint64_t dhi_stat_clock(void) {
+    uint64_t v;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+}
+#else
+#define DHI_STAT_CLOCK "ns"
+static inline uint64_t dhi_stat_clock(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+#endif
+#define DHI_STAT_TIMER(t) uint64_t t = dhi_stat_clock()
+#define DHI_STAT_TIME(ms, t) DHI_STAT_ADD(ms, DHI_STAT_CYCLES, dhi_stat_clock() - (t))
+#else
+#define DHI_STAT_CLOCK NULL
+#define DHI_STAT_TIMER(t) ((void)0)
+#define DHI_STAT_TIME(ms, t) ((void)0)
+#endif
+
+#if DHI_STATS
+// Registry of named entries (circular, g_stats_head is the sentinel) and the
+// counters with no class to charge. g_stats_lock guards the links only; it is
+// never held across Python allocations, which may run capsule destructors.
+static DhiStatsEntry g_stats_head = {&g_stats_head, &g_stats_head, NULL, NULL, {0}};
+static PyThread_type_lock g_stats_lock = NULL;
+#endif
+static uint64_t g_stats_vectorcall_fallbacks = 0;  // classes missing their fast-construct info
+
+#if DHI_STATS
+#define DHI_STAT_GLOBAL_INC(v) ((void)__atomic_fetch_add(&(v), 1, __ATOMIC_RELAXED))
+
+static const char *const dhi_stat_names[DHI_STAT_COUNT] = {
+    "validations", "fast_path", "json_decodes", "key_order_misses", "unknown_keys",
+    "errors", "cycles",
+};
+
+static void dhi_stats_link(DhiStatsEntry *e, PyObject *name) {
+    Py_INCREF(name);
+    e->name = name;
+    PyThread_acquire_lock(g_stats_lock, WAIT_LOCK);
+    e->prev = g_stats_head.prev;
+    e->next = &g_stats_head;
+    g_stats_head.prev->next = e;
+    g_stats_head.prev = e;
+    PyThread_release_lock(g_stats_lock);
+}
+
+static void dhi_stats_unlink(DhiStatsEntry *e) {
+    if (e->next) {
+        PyThread_acquire_lock(g_stats_lock, WAIT_LOCK);
+        e->prev->next = e->next;
+        e->next->prev = e->prev;
+        PyThread_release_lock(g_stats_lock);
     }
+    Py_XDECREF(e->name);
+    Py_XDECREF(e->fallback);
+}
 
-    *p++ = '"';
-    *pos = p - *buf;
-    return 0;
+static void dhi_stats_set_fallback(DhiStatsEntry *e, PyObject *reason) {
+    Py_XINCREF(reason);
+    PyThread_acquire_lock(g_stats_lock, WAIT_LOCK);
+    PyObject *old = e->fallback;
+    e->fallback = reason;
+    PyThread_release_lock(g_stats_lock);
+    Py_XDECREF(old);
 }
 
-// Helper: append raw string to buffer
-static int json_append(char **buf, size_t *buf_size, size_t *pos, const char *str, size_t len) {
-    size_t needed = *pos + len + 1;
-    if (needed > *buf_size) {
-        size_t new_size = needed * 2;
-        char *new_buf = realloc(*buf, new_size);
-        if (!new_buf) return -1;
-        *buf = new_buf;
-        *buf_size = new_size;
+typedef struct {
+    PyObject *name, *fallback;  // strong refs
+    uint64_t counts[DHI_STAT_COUNT];
+} DhiStatsSnapshot;
+
+// Add one snapshot into classes[name] (entries sharing a name - a class
+// redefined, or two with the same qualname - are summed). 0 or -1.
+static int dhi_stats_merge(PyObject *classes, DhiStatsSnapshot *s) {
+    PyObject *entry = PyDict_GetItemWithError(classes, s->name);
+    if (!entry) {
+        if (PyErr_Occurred()) return -1;
+        entry = PyDict_New();
+        if (!entry) return -1;
+        int r = PyDict_SetItem(classes, s->name, entry);
+        Py_DECREF(entry);
+        if (r < 0) return -1;
+    }
+    for (int k = 0; k < DHI_STAT_COUNT; k++) {
+        uint64_t total = s->counts[k];
+        PyObject *prev = PyDict_GetItemString(entry, dhi_stat_names[k]);
+        if (prev) total += PyLong_AsUnsignedLongLong(prev);
+        PyObject *v = PyLong_FromUnsignedLongLong(total);
+        if (!v || PyDict_SetItemString(entry, dhi_stat_names[k], v) < 0) {
+            Py_XDECREF(v);
+            return -1;
+        }
+        Py_DECREF(v);
+    }
+    PyObject *fallback = PyDict_GetItemString(entry, "fallback");
+    if (!fallback || fallback == Py_None) {
+        if (PyDict_SetItemString(entry, "fallback", s->fallback ? s->fallback : Py_None) < 0) {
+            return -1;
+        }
     }
-    memcpy(*buf + *pos, str, len);
-    *pos += len;
     return 0;
 }
+#else
+#define DHI_STAT_GLOBAL_INC(v) ((void)0)
+#endif
 
-// =============================================================================
-// init_model_core: ULTRA-OPTIMIZED init that handles EVERYTHING in C
-// Eliminates consumed set tracking for better performance
-// Returns: None on success, list of (field, msg) tuples on error
-// Sets __pydantic_fields_set__, __pydantic_private__, __pydantic_extra__ in C
-//
-// Keyword arguments come from EITHER:
-//   - kwargs: a Python dict (the classic init_model_full path), OR
-//   - kwvalues + kwnames: a vectorcall-style array (no dict allocation at all)
-// Exactly one of kwargs / kwnames may be non-NULL.
-// =============================================================================
-
-// Look up a keyword by name in a vectorcall kwnames tuple.
-// Fast path: pointer identity (kwnames from compiled code are interned).
-// Slow path: unicode equality (handles non-interned keys from **dict unpacking).
-static inline PyObject* dhi_kwnames_lookup(PyObject *const *kwvalues, PyObject *kwnames, PyObject *name) {
-    Py_ssize_t n = PyTuple_GET_SIZE(kwnames);
-    for (Py_ssize_t i = 0; i < n; i++) {
-        if (PyTuple_GET_ITEM(kwnames, i) == name) return kwvalues[i];
+// stats() -> {"enabled", "clock", "vectorcall_fallbacks", "classes": {name: {...}}}
+static PyObject* py_stats(PyObject *self_unused, PyObject *noargs) {
+    PyObject *classes = PyDict_New();
+    if (!classes) return NULL;
+#if DHI_STATS
+    // Snapshot the registry under the lock, build the dicts without it
+    PyThread_acquire_lock(g_stats_lock, WAIT_LOCK);
+    size_t n = 0;
+    for (DhiStatsEntry *e = g_stats_head.next; e != &g_stats_head; e = e->next) n++;
+    DhiStatsSnapshot *snap = (DhiStatsSnapshot*)PyMem_RawMalloc((n ? n : 1) * sizeof(DhiStatsSnapshot));
+    if (snap) {
+        size_t i = 0;
+        for (DhiStatsEntry *e = g_stats_head.next; e != &g_stats_head; e = e->next, i++) {
+            snap[i].name = e->name;
+            snap[i].fallback = e->fallback;
+            Py_INCREF(e->name);
+            Py_XINCREF(e->fallback);
+            for (int k = 0; k < DHI_STAT_COUNT; k++) {
+                snap[i].counts[k] = __atomic_load_n(&e->counts[k], __ATOMIC_RELAXED);
+            }
+        }
     }
-    for (Py_ssize_t i = 0; i < n; i++) {
-        PyObject *k = PyTuple_GET_ITEM(kwnames, i);
-        if (k != name && PyUnicode_Check(k) && PyUnicode_Check(name) &&
-            PyUnicode_Compare(k, name) == 0) {
-            return kwvalues[i];
+    PyThread_release_lock(g_stats_lock);
+    if (!snap) {
+        Py_DECREF(classes);
+        return PyErr_NoMemory();
+    }
+    int failed = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (!failed && dhi_stats_merge(classes, &snap[i]) < 0) failed = 1;
+        Py_DECREF(snap[i].name);
+        Py_XDECREF(snap[i].fallback);
+    }
+    PyMem_RawFree(snap);
+    if (failed) {
+        Py_DECREF(classes);
+        return NULL;
+    }
+#endif
+    PyObject *result = Py_BuildValue(
+        "{s:O,s:z,s:K,s:N}",
+        "enabled", DHI_STATS ? Py_True : Py_False,
+        "clock", DHI_STAT_CLOCK,
+        "vectorcall_fallbacks",
+        (unsigned long long)__atomic_load_n(&g_stats_vectorcall_fallbacks, __ATOMIC_RELAXED),
+        "classes", classes);
+    return result;
+}
+
+// reset_stats() -> None
+static PyObject* py_reset_stats(PyObject *self_unused, PyObject *noargs) {
+#if DHI_STATS
+    PyThread_acquire_lock(g_stats_lock, WAIT_LOCK);
+    for (DhiStatsEntry *e = g_stats_head.next; e != &g_stats_head; e = e->next) {
+        for (int k = 0; k < DHI_STAT_COUNT; k++) {
+            __atomic_store_n(&e->counts[k], 0, __ATOMIC_RELAXED);
         }
     }
-    return NULL;
+    PyThread_release_lock(g_stats_lock);
+#endif
+    __atomic_store_n(&g_stats_vectorcall_fallbacks, 0, __ATOMIC_RELAXED);
+    Py_RETURN_NONE;
 }
 
-static PyObject* init_model_core(PyObject *model_self, CompiledModelSpecs *ms, int extra_mode,
-                                 PyObject *kwargs,
-                                 PyObject *const *kwvalues, PyObject *kwnames) {
-    PyObject *obj_dict = PyObject_GenericGetDict(model_self, NULL);
-    if (!obj_dict) return NULL;
+// Global empty tuple for efficient PyObject_Call - reused across all calls
+static PyObject *g_empty_tuple = NULL;
 
-    PyObject *errors = NULL;
+typedef struct {
+    Py_ssize_t n_fields;
+    // Field-name dispatch table (built once by py_compile_model_specs):
+    // slot = (name_hash_fnv * dispatch_seed) >> dispatch_shift, holding
+    // field index + 1 (0 = empty). The seed is searched so that every field
+    // lands in its own slot; linear probing only kicks in if none was found.
+    uint32_t *dispatch;
+    uint64_t dispatch_seed;
+    uint32_t dispatch_mask;
+    int dispatch_shift;
+    size_t dump_size_hint;  // running output-size estimate for dump_json_compiled
+    char *dump_keys;        // backing store of the specs' dump_key fragments
+    DhiStep *plan_steps;    // backing store of the specs' validation plans
+#if DHI_STATS
+    DhiStatsEntry stats;    // hot-path counters (see HOT-PATH STATS)
+#endif
+    CompiledFieldSpec specs[];  // flexible array member
+} CompiledModelSpecs;
 
-    // OPTIMIZATION: Use bitmask instead of PySet during hot loop
-    // PySet_Add has overhead; bitmask is O(1) bit operation
-    // We create the actual PySet only at the end
-    uint64_t fields_bitmask = 0;  // Supports up to 64 fields (more than enough)
+static void compiled_specs_destructor(PyObject *capsule) {
+    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
+    if (ms) {
+#if DHI_STATS
+        dhi_stats_unlink(&ms->stats);
+#endif
+        free(ms->dispatch);
+        free(ms->dump_keys);
+        free(ms->plan_steps);
+        free(ms);
+    }
+}
 
-    // OPTIMIZATION: Use counter instead of consumed set for extra field detection
-    Py_ssize_t found_count = 0;
-    Py_ssize_t kwargs_size = kwargs ? PyDict_Size(kwargs)
-                                    : (kwnames ? PyTuple_GET_SIZE(kwnames) : 0);
+static const char *const dhi_format_names[] = {
+    "unknown", "email", "URL", "UUID", "IPv4", "IPv6", "base64", "ISO date", "ISO datetime",
+};
 
-    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
-        CompiledFieldSpec *fs = &ms->specs[i];
+static int dhi_format_check(int format_code, const char *s) {
+    switch (format_code) {
+        case 1: return inline_validate_email(s);  // INLINED
+        case 2: return dhi_validate_url(s);
+        case 3: return dhi_validate_uuid(s);
+        case 4: return dhi_validate_ipv4(s);
+        case 5: return dhi_validate_ipv6(s);
+        case 6: return dhi_validate_base64(s);
+        case 7: return dhi_validate_iso_date(s);
+        case 8: return dhi_validate_iso_datetime(s);
+    }
+    return 1;
+}
 
-        // --- Extract value from kwargs (dict) or kwvalues/kwnames (vectorcall) ---
-        PyObject *value = NULL;
+// Pre-parse a constraints tuple (the validate_field layout plus the optional
+// cache_strings flag and pattern) into fs's constraint members
+static void dhi_parse_constraints(CompiledFieldSpec *fs, PyObject *constraints) {
+    fs->type_code = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 0));
+    fs->strict    = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 1));
+
+    PyObject *gt = PyTuple_GET_ITEM(constraints, 2);
+    PyObject *ge = PyTuple_GET_ITEM(constraints, 3);
+    PyObject *lt = PyTuple_GET_ITEM(constraints, 4);
+    PyObject *le = PyTuple_GET_ITEM(constraints, 5);
+    PyObject *mul = PyTuple_GET_ITEM(constraints, 6);
+    PyObject *minl = PyTuple_GET_ITEM(constraints, 7);
+    PyObject *maxl = PyTuple_GET_ITEM(constraints, 8);
+
+    fs->has_gt = (gt != Py_None); fs->has_ge = (ge != Py_None);
+    fs->has_lt = (lt != Py_None); fs->has_le = (le != Py_None);
+    fs->has_mul = (mul != Py_None);
+    fs->has_minl = (minl != Py_None); fs->has_maxl = (maxl != Py_None);
+
+    fs->gt_long = fs->has_gt ? as_long_coerce(gt) : 0;
+    fs->ge_long = fs->has_ge ? as_long_coerce(ge) : 0;
+    fs->lt_long = fs->has_lt ? as_long_coerce(lt) : 0;
+    fs->le_long = fs->has_le ? as_long_coerce(le) : 0;
+    fs->mul_long = fs->has_mul ? as_long_coerce(mul) : 0;
+    fs->gt_dbl = fs->has_gt ? as_double_coerce(gt) : 0.0;
+    fs->ge_dbl = fs->has_ge ? as_double_coerce(ge) : 0.0;
+    fs->lt_dbl = fs->has_lt ? as_double_coerce(lt) : 0.0;
+    fs->le_dbl = fs->has_le ? as_double_coerce(le) : 0.0;
+    fs->mul_dbl = fs->has_mul ? as_double_coerce(mul) : 0.0;
+    fs->min_len = fs->has_minl ? PyLong_AsSsize_t(minl) : 0;
+    fs->max_len = fs->has_maxl ? PyLong_AsSsize_t(maxl) : 0;
+
+    fs->allow_inf_nan = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 9));
+    fs->format_code   = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 10));
+    fs->strip_ws      = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 11));
+    fs->to_lower      = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 12));
+    fs->to_upper      = (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 13));
+    fs->cache_strings = PyTuple_GET_SIZE(constraints) > 14
+        ? (int)PyLong_AsLong(PyTuple_GET_ITEM(constraints, 14)) : 0;
+    fs->pattern = PyTuple_GET_SIZE(constraints) > 15 && PyTuple_GET_ITEM(constraints, 15) != Py_None
+        ? PyTuple_GET_ITEM(constraints, 15) : NULL;
+}
 
-        if (kwargs) {
-            if (fs->alias_obj != Py_None) {
-                value = PyDict_GetItem(kwargs, fs->alias_obj);
+// re.match(pattern, s) is not None for a compiled Pattern or an re.Pattern.
+// 1 / 0, or -1 with an exception set.
+static int dhi_pattern_check(PyObject *pattern, PyObject *s) {
+    if (DhiPattern_Check(pattern)) return dhi_pattern_match((DhiPatternObject*)pattern, s);
+    PyObject *m = PyObject_CallMethod(pattern, "match", "O", s);
+    if (!m) return -1;
+    int matched = m != Py_None;
+    Py_DECREF(m);
+    return matched;
+}
+
+// Lower fs's constraints into steps[] (DHI_PLAN_MAX_STEPS). Returns the count.
+static int dhi_plan_build(const CompiledFieldSpec *fs, DhiStep *steps) {
+    int n = 0;
+    int tc = fs->type_code;
+#define DHI_STEP(c, o, a) (steps[n].code = (c), steps[n].op = (o), steps[n].skip = 0, \
+                           steps[n].arg = (a), n++)
+    DhiErrorArg none = {0};
+
+    switch (tc) {
+        case 1: DHI_STEP(fs->strict ? DHI_OP_INT_STRICT : DHI_OP_INT, 0, none); break;
+        case 2: DHI_STEP(fs->strict ? DHI_OP_FLOAT_STRICT : DHI_OP_FLOAT, 0, none); break;
+        case 3: DHI_STEP(DHI_OP_STR, 0, none); break;
+        case 4: DHI_STEP(DHI_OP_BOOL, 0, none); break;
+        case 5: DHI_STEP(DHI_OP_BYTES, 0, none); break;
+        case 9:
+        case 10: DHI_STEP(DHI_OP_DATE, (uint8_t)((tc == 10) | (fs->strict << 1)), none); break;
+    }
+    // Only what the value can still be after the type step
+    int maybe_str = tc == 0 || tc == 3 || (tc >= 6 && tc <= 8);
+    int maybe_int = tc == 0 || tc == 1 || (tc >= 6 && tc <= 8);
+    int maybe_float = tc == 0 || tc == 2 || (tc >= 6 && tc <= 8);
+
+    if (maybe_str && (fs->strip_ws || fs->to_lower || fs->to_upper)) {
+        int guard = tc != 3 ? n : -1;
+        if (guard >= 0) DHI_STEP(DHI_OP_IF_STR, 0, none);
+        if (fs->strip_ws) DHI_STEP(DHI_OP_STRIP, 0, none);
+        if (fs->to_lower) DHI_STEP(DHI_OP_LOWER, 0, none);
+        if (fs->to_upper) DHI_STEP(DHI_OP_UPPER, 0, none);
+        if (guard >= 0) steps[guard].skip = (uint8_t)(n - guard - 1);
+    }
+    if (maybe_int && (fs->has_gt || fs->has_ge || fs->has_lt || fs->has_le || fs->has_mul)) {
+        int guard = n;
+        DHI_STEP(DHI_OP_IF_INT, 0, none);
+        if (fs->has_gt) DHI_STEP(DHI_OP_INT_BOUND, 0, ((DhiErrorArg){.l = fs->gt_long}));
+        if (fs->has_ge) DHI_STEP(DHI_OP_INT_BOUND, 1, ((DhiErrorArg){.l = fs->ge_long}));
+        if (fs->has_lt) DHI_STEP(DHI_OP_INT_BOUND, 2, ((DhiErrorArg){.l = fs->lt_long}));
+        if (fs->has_le) DHI_STEP(DHI_OP_INT_BOUND, 3, ((DhiErrorArg){.l = fs->le_long}));
+        if (fs->has_mul) DHI_STEP(DHI_OP_INT_BOUND, 4, ((DhiErrorArg){.l = fs->mul_long}));
+        steps[guard].skip = (uint8_t)(n - guard - 1);
+    }
+    if (maybe_float && (!fs->allow_inf_nan || fs->has_gt || fs->has_ge || fs->has_lt ||
+                        fs->has_le || fs->has_mul)) {
+        int guard = n;
+        DHI_STEP(DHI_OP_IF_FLOAT, 0, none);
+        if (!fs->allow_inf_nan) DHI_STEP(DHI_OP_FINITE, 0, none);
+        if (fs->has_gt) DHI_STEP(DHI_OP_FLOAT_BOUND, 0, ((DhiErrorArg){.d = fs->gt_dbl}));
+        if (fs->has_ge) DHI_STEP(DHI_OP_FLOAT_BOUND, 1, ((DhiErrorArg){.d = fs->ge_dbl}));
+        if (fs->has_lt) DHI_STEP(DHI_OP_FLOAT_BOUND, 2, ((DhiErrorArg){.d = fs->lt_dbl}));
+        if (fs->has_le) DHI_STEP(DHI_OP_FLOAT_BOUND, 3, ((DhiErrorArg){.d = fs->le_dbl}));
+        if (fs->has_mul) DHI_STEP(DHI_OP_FLOAT_BOUND, 4, ((DhiErrorArg){.d = fs->mul_dbl}));
+        steps[guard].skip = (uint8_t)(n - guard - 1);
+    }
+    if (fs->has_minl || fs->has_maxl) {
+        DHI_STEP(DHI_OP_LEN, 0, none);
+        if (fs->has_minl) DHI_STEP(DHI_OP_MIN_LEN, 0, ((DhiErrorArg){.n = fs->min_len}));
+        if (fs->has_maxl) DHI_STEP(DHI_OP_MAX_LEN, 0, ((DhiErrorArg){.n = fs->max_len}));
+    }
+    if (maybe_str && fs->pattern) DHI_STEP(DHI_OP_PATTERN, 0, none);
+    if (maybe_str && fs->format_code > 0 && fs->format_code <= 8) {
+        DHI_STEP(DHI_OP_FORMAT, (uint8_t)fs->format_code, none);
+    }
+#undef DHI_STEP
+    return n;
+}
+
+// Bound check on a C long; `big` is the PyLong_AsLongAndOverflow sign for
+// ints that don't fit (exact for the comparisons, Python math for multiple_of)
+static int dhi_int_bound_fails(int op, long bound, long val, int big, PyObject *obj) {
+    if (__builtin_expect(big != 0, 0)) {
+        if (op < 2) return big < 0;
+        if (op < 4) return big > 0;
+        if (bound == 0) return 0;
+        PyObject *b = PyLong_FromLong(bound);
+        PyObject *rem = b ? PyNumber_Remainder(obj, b) : NULL;
+        Py_XDECREF(b);
+        if (!rem) return -1;
+        int fails = PyObject_IsTrue(rem);
+        Py_DECREF(rem);
+        return fails;
+    }
+    switch (op) {
+        case 0: return val <= bound;
+        case 1: return val < bound;
+        case 2: return val >= bound;
+        case 3: return val > bound;
+    }
+    return bound != 0 && (bound == -1 ? 0 : val % bound != 0);
+}
+
+static int dhi_float_bound_fails(int op, double bound, double val) {
+    switch (op) {
+        case 0: return val <= bound;
+        case 1: return val < bound;
+        case 2: return val >= bound;
+        case 3: return val > bound;
+    }
+    double remainder = fmod(val, bound);
+    return remainder != 0.0 && fabs(remainder) > 1e-9;
+}
+
+// Run fs's plan on value.
+// Returns 1 with *out = validated (possibly coerced) value as a new ref,
+// 0 with *err filled in (code/op/text/bound/got; detail borrowed from value),
+// -1 with an exception set.
+// `first` skips leading steps: the JSON decoder has already type-checked the
+// value against its JSON token and starts at fs->n_type_steps.
+static int dhi_plan_run_from(const CompiledFieldSpec *fs, int first, PyObject *value,
+                             PyObject **out, DhiFieldError *err) {
+    PyObject *result = value;
+    Py_INCREF(result);
+    long ival = 0;
+    int big = 0;
+    double dval = 0.0;
+    Py_ssize_t length = 0;
+
+    for (int k = first; k < fs->n_steps; k++) {
+        const DhiStep *st = &fs->plan[k];
+        switch (st->code) {
+        case DHI_OP_INT_STRICT:
+            if (!PyLong_CheckExact(result)) {
+                err->code = DHI_ERR_EXPECTED; err->text = "exactly int";
+                goto invalid_type;
             }
-            if (!value) {
-                value = _PyDict_GetItem_KnownHash(kwargs, fs->name_obj, fs->name_hash);
+            break;
+        case DHI_OP_INT:
+            if (PyLong_Check(result) && !PyBool_Check(result)) break;
+            if (!PyFloat_Check(result)) {
+                err->code = DHI_ERR_EXPECTED; err->text = "int";
+                goto invalid_type;
             }
-        } else if (kwnames) {
-            if (fs->alias_obj != Py_None) {
-                value = dhi_kwnames_lookup(kwvalues, kwnames, fs->alias_obj);
+            if (dhi_float_has_fraction(result)) {
+                err->code = DHI_ERR_FRACTION;
+                goto invalid;
             }
-            if (!value) {
-                value = dhi_kwnames_lookup(kwvalues, kwnames, fs->name_obj);
+            {
+                PyObject *coerced = PyNumber_Long(result);
+                if (!coerced) {
+                    PyErr_Clear();
+                    err->code = DHI_ERR_CONVERT; err->text = "float to int";
+                    goto invalid;
+                }
+                Py_SETREF(result, coerced);
             }
-        }
-
-        if (!value) {
-            if (!fs->required) {
-                PyDict_SetItem(obj_dict, fs->name_obj, fs->default_val);
-                continue;
+            break;
+        case DHI_OP_FLOAT_STRICT:
+            if (!PyFloat_CheckExact(result)) {
+                err->code = DHI_ERR_EXPECTED; err->text = "exactly float";
+                goto invalid_type;
             }
-            if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
-            PyObject *err = Py_BuildValue("(Os)", fs->name_obj, "Field required");
-            PyList_Append(errors, err); Py_DECREF(err);
-            continue;
-        }
-
-        // OPTIMIZATION: Use bitmask instead of PySet_Add (O(1) bit op vs hash table)
-        found_count++;
-        fields_bitmask |= ((uint64_t)1 << i);
-
-        // --- TYPE CHECKING (same as init_model_compiled) ---
-        PyObject *result = value;
-        Py_INCREF(result);
-        const char *field_name = NULL;
-
-        if (fs->type_code == 1) { // int
-            if (fs->strict) {
-                if (!PyLong_CheckExact(result) || PyBool_Check(result)) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Expected exactly int, got %s", field_name, Py_TYPE(value)->tp_name);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                    PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
-            } else {
-                if (PyBool_Check(result)) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Expected int, got bool", field_name);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                    PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
-                if (!PyLong_Check(result)) {
-                    if (PyFloat_Check(result)) {
-                        if (dhi_float_has_fraction(result)) {
-                            Py_DECREF(result);
-                            field_name = PyUnicode_AsUTF8(fs->name_obj);
-                            if (!errors) { errors = PyList_New(0); }
-                            PyObject *fmsg = PyUnicode_FromFormat("%s: Expected int, got float with fractional part", field_name);
-                            PyObject *ferr = Py_BuildValue("(OO)", fs->name_obj, fmsg); Py_DECREF(fmsg);
-                            PyList_Append(errors, ferr); Py_DECREF(ferr); continue;
-                        }
-                        PyObject *new_val = PyNumber_Long(result);
-                        if (!new_val) { Py_DECREF(result); PyErr_Clear();
-                            field_name = PyUnicode_AsUTF8(fs->name_obj);
-                            if (!errors) { errors = PyList_New(0); }
-                            PyObject *msg = PyUnicode_FromFormat("%s: Cannot convert float to int", field_name);
-                            PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                            PyList_Append(errors, err); Py_DECREF(err); continue;
-                        }
-                        Py_DECREF(result); result = new_val;
-                    } else {
-                        Py_DECREF(result);
-                        field_name = PyUnicode_AsUTF8(fs->name_obj);
-                        if (!errors) { errors = PyList_New(0); }
-                        PyObject *msg = PyUnicode_FromFormat("%s: Expected int, got %s", field_name, Py_TYPE(value)->tp_name);
-                        PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                        PyList_Append(errors, err); Py_DECREF(err); continue;
-                    }
-                }
+            break;
+        case DHI_OP_FLOAT:
+            if (PyFloat_Check(result)) break;
+            if (!PyLong_Check(result) || PyBool_Check(result)) {
+                err->code = DHI_ERR_EXPECTED; err->text = "float";
+                goto invalid_type;
             }
-        } else if (fs->type_code == 2) { // float
-            if (fs->strict) {
-                if (!PyFloat_CheckExact(result)) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Expected exactly float, got %s", field_name, Py_TYPE(value)->tp_name);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                    PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
-            } else {
-                if (PyBool_Check(result)) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Expected float, got bool", field_name);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                    PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
-                if (!PyFloat_Check(result)) {
-                    if (PyLong_Check(result)) {
-                        PyObject *new_val = PyNumber_Float(result);
-                        if (!new_val) { Py_DECREF(result); PyErr_Clear();
-                            field_name = PyUnicode_AsUTF8(fs->name_obj);
-                            if (!errors) { errors = PyList_New(0); }
-                            PyObject *msg = PyUnicode_FromFormat("%s: Cannot convert int to float", field_name);
-                            PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                            PyList_Append(errors, err); Py_DECREF(err); continue;
-                        }
-                        Py_DECREF(result); result = new_val;
-                    } else {
-                        Py_DECREF(result);
-                        field_name = PyUnicode_AsUTF8(fs->name_obj);
-                        if (!errors) { errors = PyList_New(0); }
-                        PyObject *msg = PyUnicode_FromFormat("%s: Expected float, got %s", field_name, Py_TYPE(value)->tp_name);
-                        PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                        PyList_Append(errors, err); Py_DECREF(err); continue;
-                    }
+            {
+                PyObject *coerced = PyNumber_Float(result);
+                if (!coerced) {
+                    PyErr_Clear();
+                    err->code = DHI_ERR_CONVERT; err->text = "int to float";
+                    goto invalid;
                 }
+                Py_SETREF(result, coerced);
             }
-        } else if (fs->type_code == 3) { // str
+            break;
+        case DHI_OP_STR:
             if (!PyUnicode_Check(result)) {
-                Py_DECREF(result);
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Expected str, got %s", field_name, Py_TYPE(value)->tp_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); continue;
+                err->code = DHI_ERR_EXPECTED; err->text = "str";
+                goto invalid_type;
             }
-        } else if (fs->type_code == 4) { // bool
+            break;
+        case DHI_OP_BOOL:
             if (!PyBool_Check(result)) {
-                Py_DECREF(result);
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Expected bool, got %s", field_name, Py_TYPE(value)->tp_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); continue;
+                err->code = DHI_ERR_EXPECTED; err->text = "bool";
+                goto invalid_type;
             }
-        } else if (fs->type_code == 5) { // bytes
+            break;
+        case DHI_OP_BYTES:
             if (!PyBytes_Check(result)) {
-                Py_DECREF(result);
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Expected bytes, got %s", field_name, Py_TYPE(value)->tp_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); continue;
-            }
-        } else if (fs->type_code == 6) { // nested model - FAST PATH
-            // Check if value is already the correct nested model type
-            if ((PyObject*)Py_TYPE(result) == fs->nested_model_type) {
-                // Already validated! Just set directly in dict (ULTRA FAST)
-                PyDict_SetItem(obj_dict, fs->name_obj, result);
-                Py_DECREF(result);
-                continue;  // Skip all other validation - already done
+                err->code = DHI_ERR_EXPECTED; err->text = "bytes";
+                goto invalid_type;
             }
-            // Check if value is dict - need to create nested model
-            if (PyDict_Check(result)) {
-                // Ensure global empty tuple is initialized
-                if (!g_empty_tuple) {
-                    g_empty_tuple = PyTuple_New(0);
-                    if (!g_empty_tuple) {
-                        Py_DECREF(result);
-                        Py_DECREF(obj_dict);
-                        Py_XDECREF(errors);
-                        return NULL;
-                    }
+            break;
+        case DHI_OP_DATE: {
+            int want_time = st->op & 1;
+            // datetime subclasses date, but a date field takes no time of day
+            if (want_time ? PyDateTime_Check(result)
+                          : PyDate_Check(result) && !PyDateTime_Check(result)) break;
+            if (!(st->op & 2) && PyUnicode_Check(result)) {
+                Py_ssize_t n;
+                const char *s = PyUnicode_AsUTF8AndSize(result, &n);
+                if (!s) {
+                    // Lone surrogates: not ISO text, so a format error
+                    if (!PyErr_ExceptionMatches(PyExc_UnicodeEncodeError)) goto fatal;
+                    PyErr_Clear();
                 }
-                // Create nested model: type(**dict)
-                PyObject *nested_obj = PyObject_Call(fs->nested_model_type, g_empty_tuple, result);
-                Py_DECREF(result);  // Done with dict
-                if (!nested_obj) {
-                    // Nested validation failed - extract error
-                    PyObject *exc_type, *exc_value, *exc_tb;
-                    PyErr_Fetch(&exc_type, &exc_value, &exc_tb);
-                    if (exc_value) {
-                        field_name = PyUnicode_AsUTF8(fs->name_obj);
-                        if (!errors) { errors = PyList_New(0); }
-                        PyObject *err_str = PyObject_Str(exc_value);
-                        PyObject *msg = PyUnicode_FromFormat("%s: %S", field_name, err_str);
-                        Py_XDECREF(err_str);
-                        PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg);
-                        Py_DECREF(msg);
-                        PyList_Append(errors, err);
-                        Py_DECREF(err);
-                    }
-                    Py_XDECREF(exc_type);
-                    Py_XDECREF(exc_value);
-                    Py_XDECREF(exc_tb);
-                    continue;
+                PyObject *parsed;
+                int r = s ? dhi_iso_to_object(s, n, want_time, &parsed) : 0;
+                if (r < 0) goto fatal;
+                if (r == 0) {
+                    err->code = DHI_ERR_FORMAT; err->text = dhi_format_names[want_time ? 8 : 7];
+                    goto invalid;
                 }
-                // Set nested model in dict
-                PyDict_SetItem(obj_dict, fs->name_obj, nested_obj);
-                Py_DECREF(nested_obj);
-                continue;  // Skip all other validation - nested __init__ did it
+                Py_SETREF(result, parsed);
+                break;
             }
-            // Value is neither correct type nor dict - error
-            Py_DECREF(result);
-            field_name = PyUnicode_AsUTF8(fs->name_obj);
-            if (!errors) { errors = PyList_New(0); }
-            const char *expected_name = ((PyTypeObject*)fs->nested_model_type)->tp_name;
-            PyObject *msg = PyUnicode_FromFormat("%s: Expected %s or dict, got %s",
-                field_name, expected_name, Py_TYPE(value)->tp_name);
-            PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg);
-            Py_DECREF(msg);
-            PyList_Append(errors, err);
-            Py_DECREF(err);
-            continue;
-        } else if (fs->type_code == 7) { // list of model variants - FAST PATH
-            if (!PyList_Check(result)) {
-                Py_DECREF(result);
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Expected list, got %s",
-                    field_name, Py_TYPE(value)->tp_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg);
-                Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); continue;
+            err->code = DHI_ERR_EXPECTED; err->text = want_time ? "datetime" : "date";
+            goto invalid_type;
+        }
+        case DHI_OP_IF_STR:
+            if (!PyUnicode_Check(result)) k += st->skip;
+            break;
+        case DHI_OP_STRIP:
+        case DHI_OP_LOWER:
+        case DHI_OP_UPPER: {
+            const char *meth = st->code == DHI_OP_STRIP ? "strip"
+                             : st->code == DHI_OP_LOWER ? "lower" : "upper";
+            PyObject *s = PyObject_CallMethod(result, meth, NULL);
+            if (!s) goto fatal;
+            Py_SETREF(result, s);
+            break;
+        }
+        case DHI_OP_IF_INT:
+            if (!PyLong_Check(result) || PyBool_Check(result)) { k += st->skip; break; }
+            ival = PyLong_AsLongAndOverflow(result, &big);
+            if (ival == -1 && PyErr_Occurred()) goto fatal;
+            break;
+        case DHI_OP_INT_BOUND: {
+            int fails = dhi_int_bound_fails(st->op, st->arg.l, ival, big, result);
+            if (fails < 0) goto fatal;
+            if (fails) {
+                err->code = DHI_ERR_BOUND_INT; err->op = st->op;
+                err->bound.l = st->arg.l; err->got.l = ival;
+                if (big) err->detail = value;
+                goto invalid;
             }
-            // Length constraints on the list
-            if (fs->has_minl || fs->has_maxl) {
-                Py_ssize_t list_len = PyList_GET_SIZE(result);
-                if (fs->has_minl && list_len < fs->min_len) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Length must be >= %zd, got %zd",
-                        field_name, fs->min_len, list_len);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg);
-                    Py_DECREF(msg); PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
-                if (fs->has_maxl && list_len > fs->max_len) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Length must be <= %zd, got %zd",
-                        field_name, fs->max_len, list_len);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg);
-                    Py_DECREF(msg); PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
+            break;
+        }
+        case DHI_OP_IF_FLOAT:
+            if (!PyFloat_Check(result)) { k += st->skip; break; }
+            dval = PyFloat_AS_DOUBLE(result);
+            break;
+        case DHI_OP_FINITE:
+            // INLINED: isfinite check (was dhi_validate_float_finite)
+            if (!isfinite(dval)) {
+                err->code = DHI_ERR_FINITE;
+                goto invalid;
             }
-            // Items are already validated BaseModel instances - just passthrough
-            // For dict items, try to coerce using the first matching type
-            Py_ssize_t list_len = PyList_GET_SIZE(result);
-            int has_dicts = 0;
-            for (Py_ssize_t j = 0; j < list_len; j++) {
-                PyObject *item = PyList_GET_ITEM(result, j);
-                if (PyDict_Check(item)) { has_dicts = 1; break; }
+            break;
+        case DHI_OP_FLOAT_BOUND:
+            if (dhi_float_bound_fails(st->op, st->arg.d, dval)) {
+                err->code = DHI_ERR_BOUND_FLOAT; err->op = st->op;
+                err->bound.d = st->arg.d; err->got.d = dval;
+                goto invalid;
             }
-            if (has_dicts && fs->union_types_tuple) {
-                // Need to coerce dict items - create new list
-                if (!g_empty_tuple) {
-                    g_empty_tuple = PyTuple_New(0);
-                    if (!g_empty_tuple) {
-                        Py_DECREF(result); Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL;
-                    }
-                }
-                PyObject *new_list = PyList_New(list_len);
-                if (!new_list) {
-                    Py_DECREF(result); Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL;
-                }
-                int coerce_error = 0;
-                for (Py_ssize_t j = 0; j < list_len; j++) {
-                    PyObject *item = PyList_GET_ITEM(result, j);
-                    if (PyDict_Check(item)) {
-                        // Try each union type until one succeeds
-                        Py_ssize_t n_types = PyTuple_GET_SIZE(fs->union_types_tuple);
-                        PyObject *coerced = NULL;
-                        for (Py_ssize_t t = 0; t < n_types; t++) {
-                            PyObject *model_type = PyTuple_GET_ITEM(fs->union_types_tuple, t);
-                            coerced = PyObject_Call(model_type, g_empty_tuple, item);
-                            if (coerced) break;
-                            PyErr_Clear();
-                        }
-                        if (coerced) {
-                            PyList_SET_ITEM(new_list, j, coerced);  // steals ref
-                        } else {
-                            field_name = PyUnicode_AsUTF8(fs->name_obj);
-                            if (!errors) { errors = PyList_New(0); }
-                            PyObject *msg = PyUnicode_FromFormat("%s: Item %zd: cannot coerce dict to model", field_name, j);
-                            PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg);
-                            Py_DECREF(msg); PyList_Append(errors, err); Py_DECREF(err);
-                            // Fill remaining items to avoid segfault
-                            Py_INCREF(item);
-                            PyList_SET_ITEM(new_list, j, item);
-                            coerce_error = 1;
-                        }
-                    } else {
-                        Py_INCREF(item);
-                        PyList_SET_ITEM(new_list, j, item);  // steals ref
-                    }
-                }
-                Py_DECREF(result);
-                result = new_list;
-                if (coerce_error) {
-                    PyDict_SetItem(obj_dict, fs->name_obj, result);
-                    Py_DECREF(result); continue;
-                }
+            break;
+        case DHI_OP_LEN:
+            length = PyUnicode_Check(result) ? PyUnicode_GET_LENGTH(result)
+                                             : PyObject_Length(result);
+            if (length == -1 && PyErr_Occurred()) goto fatal;
+            break;
+        case DHI_OP_MIN_LEN:
+        case DHI_OP_MAX_LEN:
+            if (st->code == DHI_OP_MIN_LEN ? length < st->arg.n : length > st->arg.n) {
+                err->code = DHI_ERR_LENGTH; err->op = st->code == DHI_OP_MAX_LEN;
+                err->bound.n = st->arg.n; err->got.n = length;
+                goto invalid;
             }
-            // Set directly - no copy needed for non-dict items
-            PyDict_SetItem(obj_dict, fs->name_obj, result);
-            Py_DECREF(result);
-            continue;
-        } else if (fs->type_code == 8) { // union of model types
-            // Check if value is an instance of any union type
-            if (fs->union_types_tuple) {
-                int is_instance = PyObject_IsInstance(result, fs->union_types_tuple);
-                if (is_instance == 1) {
-                    // Already correct type
-                    PyDict_SetItem(obj_dict, fs->name_obj, result);
-                    Py_DECREF(result);
-                    continue;
+            break;
+        case DHI_OP_PATTERN:
+            if (PyUnicode_Check(result)) {
+                int matched = dhi_pattern_check(fs->pattern, result);
+                if (matched < 0) goto fatal;
+                if (!matched) {
+                    err->code = DHI_ERR_PATTERN;
+                    goto invalid;
                 }
-                // Try dict coercion
-                if (PyDict_Check(result)) {
-                    if (!g_empty_tuple) {
-                        g_empty_tuple = PyTuple_New(0);
-                        if (!g_empty_tuple) {
-                            Py_DECREF(result); Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL;
-                        }
-                    }
-                    Py_ssize_t n_types = PyTuple_GET_SIZE(fs->union_types_tuple);
-                    PyObject *coerced = NULL;
-                    for (Py_ssize_t t = 0; t < n_types; t++) {
-                        PyObject *model_type = PyTuple_GET_ITEM(fs->union_types_tuple, t);
-                        coerced = PyObject_Call(model_type, g_empty_tuple, result);
-                        if (coerced) break;
-                        PyErr_Clear();
-                    }
-                    if (coerced) {
-                        PyDict_SetItem(obj_dict, fs->name_obj, coerced);
-                        Py_DECREF(coerced);
-                        Py_DECREF(result);
-                        continue;
-                    }
+            }
+            break;
+        case DHI_OP_FORMAT:
+            if (PyUnicode_Check(result)) {
+                const char *s = PyUnicode_AsUTF8(result);
+                if (!s) goto fatal;
+                if (!dhi_format_check(st->op, s)) {
+                    err->code = DHI_ERR_FORMAT; err->text = dhi_format_names[st->op];
+                    goto invalid;
                 }
             }
-            // Not a valid type
-            Py_DECREF(result);
-            field_name = PyUnicode_AsUTF8(fs->name_obj);
-            if (!errors) { errors = PyList_New(0); }
-            PyObject *msg = PyUnicode_FromFormat("%s: Value does not match any expected type", field_name);
-            PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg);
-            Py_DECREF(msg); PyList_Append(errors, err); Py_DECREF(err);
-            continue;
+            break;
         }
+    }
+    *out = result;
+    return 1;
 
-        // --- STRING TRANSFORMS (inline for speed) ---
-        if (PyUnicode_Check(result)) {
-            if (fs->strip_ws) {
-                PyObject *s = PyObject_CallMethod(result, "strip", NULL);
-                if (!s) { Py_DECREF(result); Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL; }
-                Py_DECREF(result); result = s;
-            }
-            if (fs->to_lower) {
-                PyObject *s = PyObject_CallMethod(result, "lower", NULL);
-                if (!s) { Py_DECREF(result); Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL; }
-                Py_DECREF(result); result = s;
-            }
-            if (fs->to_upper) {
-                PyObject *s = PyObject_CallMethod(result, "upper", NULL);
-                if (!s) { Py_DECREF(result); Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL; }
-                Py_DECREF(result); result = s;
-            }
-        }
+invalid_type:
+    err->detail = (PyObject*)Py_TYPE(value);
+invalid:
+    Py_DECREF(result);
+    return 0;
+fatal:
+    Py_DECREF(result);
+    return -1;
+}
 
-        // --- NUMERIC CONSTRAINTS (INLINED - no FFI overhead) ---
-        // OPTIMIZATION: Simple comparisons are inlined in C instead of calling Zig
-        // This eliminates FFI overhead for trivial checks (gt/ge/lt/le)
-        int validation_failed = 0;
-        if (PyLong_Check(result) && !PyBool_Check(result)) {
-            long val = PyLong_AsLong(result);
-            // INLINED: val > gt_long (was dhi_validate_int_gt)
-            if (fs->has_gt && val <= fs->gt_long) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be > %ld, got %ld", field_name, fs->gt_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            // INLINED: val >= ge_long (was dhi_validate_int_gte)
-            if (fs->has_ge && val < fs->ge_long) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be >= %ld, got %ld", field_name, fs->ge_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            // INLINED: val < lt_long (was dhi_validate_int_lt)
-            if (fs->has_lt && val >= fs->lt_long) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be < %ld, got %ld", field_name, fs->lt_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            // INLINED: val <= le_long (was dhi_validate_int_lte)
-            if (fs->has_le && val > fs->le_long) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be <= %ld, got %ld", field_name, fs->le_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            // INLINED: val % mul_long == 0 (was dhi_validate_int_multiple_of)
-            if (fs->has_mul && (val % fs->mul_long) != 0) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be a multiple of %ld, got %ld", field_name, fs->mul_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-        } else if (PyFloat_Check(result)) {
-            double val = PyFloat_AsDouble(result);
-            // INLINED: isfinite check (was dhi_validate_float_finite)
-            if (!fs->allow_inf_nan && !isfinite(val)) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be finite", field_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            // INLINED: all float comparisons (no FFI calls)
-            if (fs->has_gt && val <= fs->gt_dbl) { validation_failed = 1; }
-            if (!validation_failed && fs->has_ge && val < fs->ge_dbl) { validation_failed = 2; }
-            if (!validation_failed && fs->has_lt && val >= fs->lt_dbl) { validation_failed = 3; }
-            if (!validation_failed && fs->has_le && val > fs->le_dbl) { validation_failed = 4; }
-            if (!validation_failed && fs->has_mul) {
-                double remainder = fmod(val, fs->mul_dbl);
-                if (remainder != 0.0 && fabs(remainder) > 1e-9) { validation_failed = 5; }
-            }
-            if (validation_failed) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                char buf[128];
-                switch (validation_failed) {
-                    case 1: snprintf(buf, sizeof(buf), "%s: Value must be > %g, got %g", field_name, fs->gt_dbl, val); break;
-                    case 2: snprintf(buf, sizeof(buf), "%s: Value must be >= %g, got %g", field_name, fs->ge_dbl, val); break;
-                    case 3: snprintf(buf, sizeof(buf), "%s: Value must be < %g, got %g", field_name, fs->lt_dbl, val); break;
-                    case 4: snprintf(buf, sizeof(buf), "%s: Value must be <= %g, got %g", field_name, fs->le_dbl, val); break;
-                    case 5: snprintf(buf, sizeof(buf), "%s: Value must be a multiple of %g, got %g", field_name, fs->mul_dbl, val); break;
-                }
-                PyObject *msg = PyUnicode_FromString(buf);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-        }
+static inline int dhi_plan_run(const CompiledFieldSpec *fs, PyObject *value,
+                               PyObject **out, DhiFieldError *err) {
+    return dhi_plan_run_from(fs, 0, value, out, err);
+}
 
-        // --- LENGTH CONSTRAINTS ---
-        if (fs->has_minl || fs->has_maxl) {
-            Py_ssize_t length = PyObject_Length(result);
-            if (length == -1 && PyErr_Occurred()) { Py_DECREF(result); Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL; }
-            if (fs->has_minl && length < fs->min_len) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Length must be >= %zd, got %zd", field_name, fs->min_len, length);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            if (fs->has_maxl && length > fs->max_len) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Length must be <= %zd, got %zd", field_name, fs->max_len, length);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
+// Render one error record into its message, e.g. "age: Value must be >= 0, got -1"
+static PyObject* dhi_error_message(const char *name, const CompiledFieldSpec *fs,
+                                   const DhiFieldError *e) {
+    if (e->code == DHI_ERR_EXTRA) return PyUnicode_FromString("Extra inputs are not permitted");
+    if (e->code == DHI_ERR_REQUIRED) return PyUnicode_FromString("Field required");
+
+    const char *got_type = e->detail && PyType_Check(e->detail)
+        ? ((PyTypeObject*)e->detail)->tp_name : "";
+
+    switch (e->code) {
+    case DHI_ERR_EXPECTED:
+        return PyUnicode_FromFormat("%s: Expected %s, got %s", name, e->text, got_type);
+    case DHI_ERR_EXPECTED_MODEL:
+        return PyUnicode_FromFormat("%s: Expected %s or dict, got %s", name,
+            ((PyTypeObject*)fs->nested_model_type)->tp_name, got_type);
+    case DHI_ERR_FRACTION:
+        return PyUnicode_FromFormat("%s: Expected int, got float with fractional part", name);
+    case DHI_ERR_CONVERT:
+        return PyUnicode_FromFormat("%s: Cannot convert %s", name, e->text);
+    case DHI_ERR_NESTED:
+        return PyUnicode_FromFormat("%s: %S", name, e->detail);
+    case DHI_ERR_LENGTH:
+        return PyUnicode_FromFormat("%s: Length must be %s %zd, got %zd", name,
+            e->op ? "<=" : ">=", e->bound.n, e->got.n);
+    case DHI_ERR_ITEM:
+        return PyUnicode_FromFormat("%s: Item %zd: cannot coerce dict to model", name, e->got.n);
+    case DHI_ERR_UNION:
+        return PyUnicode_FromFormat("%s: Value does not match any expected type", name);
+    case DHI_ERR_BOUND_INT:
+        if (e->detail) {
+            return PyUnicode_FromFormat("%s: Value must be %s %ld, got %S", name,
+                dhi_bound_ops[e->op], e->bound.l, e->detail);
         }
+        return PyUnicode_FromFormat("%s: Value must be %s %ld, got %ld", name,
+            dhi_bound_ops[e->op], e->bound.l, e->got.l);
+    case DHI_ERR_BOUND_FLOAT: {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "%g, got %g", e->bound.d, e->got.d);
+        return PyUnicode_FromFormat("%s: Value must be %s %s", name, dhi_bound_ops[e->op], buf);
+    }
+    case DHI_ERR_FINITE:
+        return PyUnicode_FromFormat("%s: Value must be finite", name);
+    case DHI_ERR_FORMAT:
+        return PyUnicode_FromFormat("%s: Invalid %s format", name, e->text);
+    case DHI_ERR_PATTERN: {
+        PyObject *src = PyObject_GetAttrString(fs->pattern, "pattern");
+        if (!src) return NULL;
+        PyObject *msg = PyUnicode_FromFormat("%s: String does not match pattern '%S'", name, src);
+        Py_DECREF(src);
+        return msg;
+    }
+    }
+    return PyUnicode_FromFormat("%s: Invalid value", name);
+}
 
-        // --- FORMAT VALIDATION ---
-        if (fs->format_code > 0 && PyUnicode_Check(result)) {
-            const char *str_val = PyUnicode_AsUTF8(result);
-            if (!str_val) { Py_DECREF(result); Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL; }
-            int valid = 1;
-            const char *fmt_name = "unknown";
-            switch (fs->format_code) {
-                case 1: valid = inline_validate_email(str_val); fmt_name = "email"; break;  // INLINED
-                case 2: valid = dhi_validate_url(str_val); fmt_name = "URL"; break;
-                case 3: valid = dhi_validate_uuid(str_val); fmt_name = "UUID"; break;
-                case 4: valid = dhi_validate_ipv4(str_val); fmt_name = "IPv4"; break;
-                case 5: valid = dhi_validate_ipv6(str_val); fmt_name = "IPv6"; break;
-                case 6: valid = dhi_validate_base64(str_val); fmt_name = "base64"; break;
-                case 7: valid = dhi_validate_iso_date(str_val); fmt_name = "ISO date"; break;
-                case 8: valid = dhi_validate_iso_datetime(str_val); fmt_name = "ISO datetime"; break;
-            }
-            if (!valid) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Invalid %s format", field_name, fmt_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-        }
+// Run fs's plan from step `first`, appending a rendered (field, msg) pair to *errors
+// on failure. Returns 1 with *out set, 0 when an error was recorded, -1 fatal.
+static int dhi_plan_run_collect(const CompiledFieldSpec *fs, int first, PyObject *value,
+                                PyObject **out, PyObject **errors) {
+    DhiFieldError e = {0};
+    int r = dhi_plan_run_from(fs, first, value, out, &e);
+    if (r != 0) return r;
+    const char *name = PyUnicode_AsUTF8(fs->name_obj);
+    PyObject *msg = name ? dhi_error_message(name, fs, &e) : NULL;
+    PyObject *err = msg ? PyTuple_Pack(2, fs->name_obj, msg) : NULL;
+    Py_XDECREF(msg);
+    if (!err) return -1;
+    if (!*errors && !(*errors = PyList_New(0))) { Py_DECREF(err); return -1; }
+    r = PyList_Append(*errors, err);
+    Py_DECREF(err);
+    return r < 0 ? -1 : 0;
+}
 
-        // --- SUCCESS: set in __dict__ ---
-        PyDict_SetItem(obj_dict, fs->name_obj, result);
-        Py_DECREF(result);
-    }
+// =============================================================================
+// FIELD DISPATCH TABLE - O(1) JSON key -> field index for out-of-order keys
+// =============================================================================
 
-    // --- HANDLE EXTRA FIELDS (OPTIMIZED: no consumed set) ---
-    PyObject *extra_data = NULL;
-    // Only check for extras if we found fewer fields than kwargs has
-    // This is the common case optimization - most models don't have extra fields
-    if (extra_mode != 0 && found_count < kwargs_size) {
-        PyObject *key, *value;
-        Py_ssize_t pos = 0;
-        Py_ssize_t ki = 0;
-        for (;;) {
-            if (kwargs) {
-                if (!PyDict_Next(kwargs, &pos, &key, &value)) break;
-            } else {
-                if (ki >= kwargs_size) break;
-                key = PyTuple_GET_ITEM(kwnames, ki);
-                value = kwvalues[ki];
-                ki++;
-            }
-            // Check if this key is a known field (by name or alias)
-            int is_known = 0;
-            for (Py_ssize_t i = 0; i < ms->n_fields && !is_known; i++) {
-                CompiledFieldSpec *fs = &ms->specs[i];
-                if (PyObject_RichCompareBool(key, fs->name_obj, Py_EQ) == 1) {
-                    is_known = 1;
-                } else if (fs->alias_obj != Py_None &&
-                           PyObject_RichCompareBool(key, fs->alias_obj, Py_EQ) == 1) {
-                    is_known = 1;
-                }
-            }
-            if (!is_known) {
-                if (extra_mode == 1) {  // 'forbid'
-                    if (!errors) { errors = PyList_New(0); }
-                    PyObject *err = Py_BuildValue("(Os)", key, "Extra inputs are not permitted");
-                    PyList_Append(errors, err); Py_DECREF(err);
-                } else if (extra_mode == 2) {  // 'allow'
-                    if (!extra_data) { extra_data = PyDict_New(); }
-                    PyDict_SetItem(extra_data, key, value);
+#define DHI_DISPATCH_SEED_TRIES 64
+#define DHI_DISPATCH_EXTRA_BITS 3
+
+static inline uint32_t dhi_dispatch_slot(const CompiledModelSpecs *ms, uint64_t hash) {
+    return (uint32_t)((hash * ms->dispatch_seed) >> ms->dispatch_shift) & ms->dispatch_mask;
+}
+
+// Fill ms->dispatch with seed/bits chosen so no two fields share a slot.
+// Table size starts at the next power of two >= 2 * n_fields and grows by up
+// to DHI_DISPATCH_EXTRA_BITS bits; if every seed collides, the last layout is
+// kept and lookups fall back to linear probing (still correct, rarely taken).
+// Returns 0 on success, -1 with MemoryError set.
+static int dhi_dispatch_build(CompiledModelSpecs *ms) {
+    Py_ssize_t n = ms->n_fields;
+    int base_bits = 1;
+    while (((Py_ssize_t)1 << base_bits) < 2 * n) base_bits++;
+
+    uint32_t *table = NULL;
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (int bits = base_bits; bits <= base_bits + DHI_DISPATCH_EXTRA_BITS; bits++) {
+        size_t size = (size_t)1 << bits;
+        uint32_t *grown = (uint32_t*)realloc(table, size * sizeof(uint32_t));
+        if (!grown) { free(table); PyErr_NoMemory(); return -1; }
+        table = grown;
+        ms->dispatch = table;
+        ms->dispatch_shift = 64 - bits;
+        ms->dispatch_mask = (uint32_t)(size - 1);
+
+        for (int attempt = 0; attempt < DHI_DISPATCH_SEED_TRIES; attempt++) {
+            // splitmix64 step -> odd multiplier
+            state += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = state;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            ms->dispatch_seed = (z ^ (z >> 31)) | 1;
+
+            memset(table, 0, size * sizeof(uint32_t));
+            int perfect = 1;
+            for (Py_ssize_t i = 0; i < n; i++) {
+                const CompiledFieldSpec *fs = &ms->specs[i];
+                if (!fs->name_ptr) continue;
+                uint32_t slot = dhi_dispatch_slot(ms, fs->name_hash_fnv);
+                while (table[slot]) {
+                    const CompiledFieldSpec *other = &ms->specs[table[slot] - 1];
+                    if (other->name_len == fs->name_len &&
+                        memcmp(other->name_ptr, fs->name_ptr, fs->name_len) == 0) {
+                        break;  // duplicate name: first declaration wins
+                    }
+                    perfect = 0;
+                    slot = (slot + 1) & ms->dispatch_mask;
                 }
+                if (!table[slot]) table[slot] = (uint32_t)(i + 1);
             }
+            if (perfect) return 0;
         }
     }
+    return 0;
+}
 
-    Py_DECREF(obj_dict);
+// Resolve a JSON key to its field index, or -1 for unknown keys.
+static inline Py_ssize_t dhi_dispatch_lookup(const CompiledModelSpecs *ms,
+                                             const char *key, size_t key_len,
+                                             uint64_t key_hash) {
+    uint32_t slot = dhi_dispatch_slot(ms, key_hash);
+    uint32_t entry;
+    while ((entry = ms->dispatch[slot]) != 0) {
+        const CompiledFieldSpec *cfs = &ms->specs[entry - 1];
+        if (cfs->name_hash_fnv == key_hash && cfs->name_len == key_len &&
+            memcmp(cfs->name_ptr, key, key_len) == 0) {
+            return (Py_ssize_t)entry - 1;
+        }
+        slot = (slot + 1) & ms->dispatch_mask;
+    }
+    return -1;
+}
 
-    // --- SET PYDANTIC INTERNAL ATTRIBUTES (direct __dict__ access for speed) ---
-    // Re-get obj_dict since we released it earlier
-    obj_dict = PyObject_GenericGetDict(model_self, NULL);
-    if (!obj_dict) { Py_XDECREF(extra_data); Py_XDECREF(errors); return NULL; }
+static int dhi_dump_plan_build(CompiledModelSpecs *ms);
 
-    // Use interned strings for fast dict access
-    static PyObject *fields_set_key = NULL;
-    static PyObject *extra_key = NULL;
-    static PyObject *private_key = NULL;
-    if (!fields_set_key) {
-        fields_set_key = PyUnicode_InternFromString("__pydantic_fields_set__");
-        extra_key = PyUnicode_InternFromString("__pydantic_extra__");
-        private_key = PyUnicode_InternFromString("__pydantic_private__");
-    }
+// compile_model_specs(field_specs_tuple) -> PyCapsule
+// Pre-parses all constraint values into C structs at class creation time
+// Each field spec is: (name, alias, required, default, constraints, [nested_model_type])
+// nested_model_type is optional - if present and not None, type_code is set to 6
+// compile_model_specs(specs[, name]) -> capsule; name lists the specs in stats()
+static PyObject* py_compile_model_specs(PyObject* self, PyObject* args) {
+    PyObject *field_specs, *name = Py_None;
+    if (!PyArg_ParseTuple(args, "O!|O", &PyTuple_Type, &field_specs, &name)) return NULL;
 
-    // OPTIMIZATION: Create PySet from bitmask only once at the end
-    // This is faster than calling PySet_Add for each field during the loop
-    PyObject *fields_set = PySet_New(NULL);
-    if (!fields_set) { Py_DECREF(obj_dict); Py_XDECREF(extra_data); Py_XDECREF(errors); return NULL; }
-    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
-        if (fields_bitmask & ((uint64_t)1 << i)) {
-            PySet_Add(fields_set, ms->specs[i].name_obj);
+    Py_ssize_t n = PyTuple_GET_SIZE(field_specs);
+    CompiledModelSpecs *ms = (CompiledModelSpecs*)malloc(
+        sizeof(CompiledModelSpecs) + n * sizeof(CompiledFieldSpec));
+    if (!ms) return PyErr_NoMemory();
+    ms->n_fields = n;
+    ms->dispatch = NULL;
+    ms->dump_size_hint = 0;
+    ms->dump_keys = NULL;
+    ms->plan_steps = NULL;
+#if DHI_STATS
+    memset(&ms->stats, 0, sizeof(ms->stats));
+#endif
+
+    for (Py_ssize_t i = 0; i < n; i++) {
+        PyObject *spec = PyTuple_GET_ITEM(field_specs, i);
+        CompiledFieldSpec *fs = &ms->specs[i];
+        Py_ssize_t spec_len = PyTuple_GET_SIZE(spec);
+
+        fs->name_obj    = PyTuple_GET_ITEM(spec, 0);
+        fs->name_hash   = PyObject_Hash(fs->name_obj);  // Pre-compute hash for fast dict ops
+        // Cache JSON parsing info (computed once, avoid strlen/hash per parse)
+        fs->name_ptr    = PyUnicode_AsUTF8(fs->name_obj);
+        fs->name_len    = fs->name_ptr ? strlen(fs->name_ptr) : 0;
+        fs->name_hash_fnv = fs->name_ptr ? fnv1a_hash_inline(fs->name_ptr, fs->name_len) : 0;
+        fs->alias_obj   = PyTuple_GET_ITEM(spec, 1);
+        fs->required    = PyObject_IsTrue(PyTuple_GET_ITEM(spec, 2));
+        fs->default_val = PyTuple_GET_ITEM(spec, 3);
+        PyObject *constraints = PyTuple_GET_ITEM(spec, 4);
+
+        // Check for nested model type or union types (6th element)
+        fs->nested_model_type = NULL;
+        fs->union_types_tuple = NULL;
+        if (spec_len >= 6) {
+            PyObject *sixth = PyTuple_GET_ITEM(spec, 5);
+            if (sixth != Py_None && PyType_Check(sixth)) {
+                fs->nested_model_type = sixth;  // borrowed ref, kept alive by class
+            } else if (sixth != Py_None && PyTuple_Check(sixth)) {
+                fs->union_types_tuple = sixth;  // tuple of acceptable types
+            }
         }
-    }
 
-    PyDict_SetItem(obj_dict, fields_set_key, fields_set);
-    Py_DECREF(fields_set);
+        // Pre-parse all constraint values ONCE (not per-call)
+        dhi_parse_constraints(fs, constraints);
+        // Override type_code based on field kind; for union types the
+        // constraints' type_code tells us: 7=list-of-models, 8=union
+        if (fs->nested_model_type != NULL) {
+            fs->type_code = 6;  // Nested model field
+        }
+    }
 
-    if (extra_data) {
-        PyDict_SetItem(obj_dict, extra_key, extra_data);
-        Py_DECREF(extra_data);
-    } else {
-        PyDict_SetItem(obj_dict, extra_key, Py_None);
+    // Lower each field into its plan (all plans share one block)
+    ms->plan_steps = (DhiStep*)malloc((n ? n : 1) * DHI_PLAN_MAX_STEPS * sizeof(DhiStep));
+    if (!ms->plan_steps) {
+        free(ms);
+        return PyErr_NoMemory();
+    }
+    for (Py_ssize_t i = 0; i < n; i++) {
+        CompiledFieldSpec *fs = &ms->specs[i];
+        fs->plan = ms->plan_steps + i * DHI_PLAN_MAX_STEPS;
+        fs->n_steps = dhi_plan_build(fs, ms->plan_steps + i * DHI_PLAN_MAX_STEPS);
+        fs->n_type_steps = (fs->type_code >= 1 && fs->type_code <= 5) || fs->type_code >= 9;
     }
-    PyDict_SetItem(obj_dict, private_key, Py_None);
-    Py_DECREF(obj_dict);
 
-    if (errors && PyList_GET_SIZE(errors) > 0) return errors;
-    Py_XDECREF(errors);
-    Py_RETURN_NONE;
-}
+    if (dhi_dispatch_build(ms) < 0) {
+        free(ms->plan_steps);
+        free(ms);
+        return NULL;
+    }
+    if (dhi_dump_plan_build(ms) < 0) {
+        free(ms->dispatch);
+        free(ms->plan_steps);
+        free(ms);
+        return NULL;
+    }
 
-// =============================================================================
-// init_model_full: classic entry point (kwargs dict), kept for the Python
-// fast-__init__ fallback path. Uses METH_FASTCALL for faster argument passing.
-// =============================================================================
-static PyObject* py_init_model_full(PyObject* self_unused, PyObject *const *args, Py_ssize_t nargs) {
-    // METH_FASTCALL: args passed as C array - no PyArg_ParseTuple overhead!
-    if (nargs != 4) {
-        PyErr_SetString(PyExc_TypeError, "init_model_full requires 4 arguments");
+    PyObject *capsule = PyCapsule_New(ms, "dhi.compiled_specs", compiled_specs_destructor);
+    if (!capsule) {
+        free(ms->dispatch);
+        free(ms->dump_keys);
+        free(ms->plan_steps);
+        free(ms);
         return NULL;
     }
+#if DHI_STATS
+    if (name != Py_None) dhi_stats_link(&ms->stats, name);
+#endif
+    return capsule;
+}
 
-    PyObject *model_self = args[0];
-    PyObject *kwargs = args[1];
-    PyObject *capsule = args[2];
-    PyObject *extra_mode_obj = args[3];
+// set_stats_fallback(specs_capsule, reason) -> None: record in stats() why the
+// class is off the vectorcall fast path (None: it isn't)
+static PyObject* py_set_stats_fallback(PyObject* self, PyObject* args) {
+    PyObject *capsule, *reason;
+    if (!PyArg_ParseTuple(args, "OO", &capsule, &reason)) return NULL;
+    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
+    if (!ms) return NULL;
+#if DHI_STATS
+    dhi_stats_set_fallback(&ms->stats, reason == Py_None ? NULL : reason);
+#endif
+    Py_RETURN_NONE;
+}
 
-    // Validate kwargs is a dict (fast check)
-    if (!PyDict_Check(kwargs)) {
-        PyErr_SetString(PyExc_TypeError, "kwargs must be a dict");
+// init_model_compiled: Ultra-fast path using pre-compiled C structs
+// No per-call PyTuple_GET_ITEM/PyLong_AsLong — reads C struct members directly
+static PyObject* py_init_model_compiled(PyObject* self_unused, PyObject* args) {
+    PyObject *model_self, *kwargs, *capsule;
+
+    if (!PyArg_ParseTuple(args, "OO!O", &model_self, &PyDict_Type, &kwargs, &capsule)) {
         return NULL;
     }
 
-    // Get extra_mode as C int (0=ignore, 1=forbid, 2=allow)
-    int extra_mode = (int)PyLong_AsLong(extra_mode_obj);
-    if (extra_mode == -1 && PyErr_Occurred()) return NULL;
-
     CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
     if (!ms) return NULL;
 
-    return init_model_core(model_self, ms, extra_mode, kwargs, NULL, NULL);
-}
+    PyObject *obj_dict = PyObject_GenericGetDict(model_self, NULL);
+    if (!obj_dict) return NULL;
 
-// =============================================================================
-// Vectorcall construction fast path
-//
-// For ultra-fast model classes we install a tp_vectorcall on the class object
-// so `User(name=..., age=...)` dispatches straight into C:
-//   - no type_call / tp_new / tp_init slot dance
-//   - no Python __init__ frame
-//   - no **kwargs dict allocation (values read directly from the stack)
-// Requires the metatype to support vectorcall on instances (CPython >= 3.12
-// inherits Py_TPFLAGS_HAVE_VECTORCALL on mutable subclasses of type). On older
-// versions the slot is simply never consulted and the Python fast __init__
-// path is used instead. Note tp_vectorcall is never inherited by subclasses,
-// so each model class opts in explicitly via enable_fast_construct().
-// =============================================================================
+    PyObject *errors = NULL;
 
-typedef struct {
-    PyObject *specs_capsule;   // strong ref (keeps CompiledModelSpecs alive)
-    CompiledModelSpecs *ms;
+    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
+        CompiledFieldSpec *fs = &ms->specs[i];
+
+        // --- Extract value from kwargs ---
+        PyObject *value = NULL;
+        if (fs->alias_obj != Py_None) {
+            value = PyDict_GetItem(kwargs, fs->alias_obj);
+        }
+        if (!value) {
+            value = _PyDict_GetItem_KnownHash(kwargs, fs->name_obj, fs->name_hash);
+        }
+
+        if (!value) {
+            if (!fs->required) {
+                PyDict_SetItem(obj_dict, fs->name_obj, fs->default_val);
+                continue;
+            }
+            if (!errors) { errors = PyList_New(0); if (!errors) { Py_DECREF(obj_dict); return NULL; } }
+            PyObject *err = Py_BuildValue("(Os)", fs->name_obj, "Field required");
+            PyList_Append(errors, err); Py_DECREF(err);
+            continue;
+        }
+
+        // --- TYPE CHECK + CONSTRAINTS (the field's validation plan) ---
+        PyObject *result;
+        int r = dhi_plan_run_collect(fs, 0, value, &result, &errors);
+        if (r < 0) { Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL; }
+        if (r == 0) continue;
+
+        // --- SUCCESS: set in __dict__ ---
+        PyDict_SetItem(obj_dict, fs->name_obj, result);
+        Py_DECREF(result);
+    }
+
+    Py_DECREF(obj_dict);
+    if (errors && PyList_GET_SIZE(errors) > 0) return errors;
+    Py_XDECREF(errors);
+    Py_RETURN_NONE;
+}
+
+// =============================================================================
+// validate_field: Single C call per field — type check + constraints + format
+// Constraints tuple format:
+//   (type_code, strict, gt, ge, lt, le, multiple_of, min_len, max_len,
+//    allow_inf_nan, format_code, strip_ws, to_lower, to_upper)
+//
+// type_code: 0=any, 1=int, 2=float, 3=str, 4=bool, 5=bytes, 9=date, 10=datetime
+// format_code: 0=none, 1=email, 2=url, 3=uuid, 4=ipv4, 5=ipv6,
+//              6=base64, 7=iso_date, 8=iso_datetime
+// =============================================================================
+
+// Core validation logic - no arg parsing overhead. The constraints tuple is
+// lowered into a stack plan and run exactly like a compiled field.
+static PyObject* validate_field_core(PyObject *value, const char *field_name, PyObject *constraints) {
+    CompiledFieldSpec fs = {0};
+    DhiStep steps[DHI_PLAN_MAX_STEPS];
+    dhi_parse_constraints(&fs, constraints);
+    if (PyErr_Occurred()) return NULL;
+    fs.plan = steps;
+    fs.n_steps = dhi_plan_build(&fs, steps);
+
+    PyObject *result;
+    DhiFieldError err = {0};
+    int r = dhi_plan_run(&fs, value, &result, &err);
+    if (r > 0) return result;  // Validated (possibly transformed) value
+    if (r == 0) {
+        PyObject *msg = dhi_error_message(field_name, &fs, &err);
+        if (msg) {
+            PyErr_SetObject(PyExc_ValueError, msg);
+            Py_DECREF(msg);
+        }
+    }
+    return NULL;
+}
+
+// Python wrapper for validate_field - thin wrapper around core
+static PyObject* py_validate_field(PyObject* self, PyObject* args) {
+    PyObject *value, *field_name_obj, *constraints;
+    if (!PyArg_ParseTuple(args, "OOO!", &value, &field_name_obj, &PyTuple_Type, &constraints)) {
+        return NULL;
+    }
+    const char* field_name = PyUnicode_AsUTF8(field_name_obj);
+    if (!field_name) return NULL;
+    return validate_field_core(value, field_name, constraints);
+}
+
+// =============================================================================
+// init_model: Batch init — ONE Python→C call for the entire __init__
+// Validates all fields, sets attributes directly on self.__dict__
+//
+// init_model(self, kwargs_dict, field_specs)
+// field_specs: tuple of (field_name_str, alias_or_None, required_bool,
+//              default_obj, constraints_tuple)
+// Returns: None on success, or list of (field_name, error_msg) tuples on error
+// =============================================================================
+static PyObject* py_init_model(PyObject* self_unused, PyObject* args) {
+    PyObject *model_self, *kwargs, *field_specs;
+
+    if (!PyArg_ParseTuple(args, "OO!O!", &model_self, &PyDict_Type, &kwargs,
+                          &PyTuple_Type, &field_specs)) {
+        return NULL;
+    }
+
+    // Get self.__dict__ for fast direct attribute setting
+    PyObject *obj_dict = PyObject_GenericGetDict(model_self, NULL);
+    if (!obj_dict) return NULL;
+
+    Py_ssize_t n_fields = PyTuple_GET_SIZE(field_specs);
+    PyObject *errors = NULL;  // Lazy-allocated list of (name, msg) tuples
+
+    for (Py_ssize_t i = 0; i < n_fields; i++) {
+        PyObject *spec = PyTuple_GET_ITEM(field_specs, i);
+        PyObject *name_obj   = PyTuple_GET_ITEM(spec, 0);
+        PyObject *alias_obj  = PyTuple_GET_ITEM(spec, 1);
+        int required         = PyObject_IsTrue(PyTuple_GET_ITEM(spec, 2));
+        PyObject *default_val = PyTuple_GET_ITEM(spec, 3);
+        PyObject *constraints = PyTuple_GET_ITEM(spec, 4);
+
+        // --- Extract value from kwargs ---
+        PyObject *value = NULL;
+        if (alias_obj != Py_None) {
+            value = PyDict_GetItem(kwargs, alias_obj);  // borrowed ref
+        }
+        if (value == NULL) {
+            value = PyDict_GetItem(kwargs, name_obj);   // borrowed ref
+        }
+
+        if (value == NULL) {
+            if (!required) {
+                // Set default directly in __dict__
+                PyDict_SetItem(obj_dict, name_obj, default_val);
+                continue;
+            } else {
+                // Missing required field — collect error
+                if (!errors) {
+                    errors = PyList_New(0);
+                    if (!errors) { Py_DECREF(obj_dict); return NULL; }
+                }
+                PyObject *err = Py_BuildValue("(Os)", name_obj, "Field required");
+                PyList_Append(errors, err);
+                Py_DECREF(err);
+                continue;
+            }
+        }
+
+        // --- Validate field ---
+        const char *field_name = PyUnicode_AsUTF8(name_obj);
+        if (!field_name) { Py_DECREF(obj_dict); Py_XDECREF(errors); return NULL; }
+
+        PyObject *validated = validate_field_core(value, field_name, constraints);
+        if (validated == NULL) {
+            // Validation failed — capture error message
+            if (!errors) {
+                errors = PyList_New(0);
+                if (!errors) { Py_DECREF(obj_dict); PyErr_Clear(); return NULL; }
+            }
+            PyObject *exc_type, *exc_value, *exc_tb;
+            PyErr_Fetch(&exc_type, &exc_value, &exc_tb);
+            PyObject *msg = exc_value ? PyObject_Str(exc_value) : PyUnicode_FromString("Validation failed");
+            PyObject *err = Py_BuildValue("(OO)", name_obj, msg);
+            PyList_Append(errors, err);
+            Py_DECREF(err);
+            Py_DECREF(msg);
+            Py_XDECREF(exc_type);
+            Py_XDECREF(exc_value);
+            Py_XDECREF(exc_tb);
+            continue;
+        }
+
+        // Set validated value directly in __dict__ (fastest path)
+        PyDict_SetItem(obj_dict, name_obj, validated);
+        Py_DECREF(validated);
+    }
+
+    Py_DECREF(obj_dict);
+
+    if (errors && PyList_GET_SIZE(errors) > 0) {
+        // Return errors list for Python to wrap in ValidationErrors
+        return errors;
+    }
+    Py_XDECREF(errors);
+    Py_RETURN_NONE;
+}
+
+// =============================================================================
+// dump_json_compiled: Ultra-fast JSON serialization using pre-compiled specs
+// Builds JSON string directly in C, no intermediate Python dict
+// =============================================================================
+
+// Output writer. While everything written is ASCII the bytes go straight into
+// a compact ASCII str (PyUnicode_New, one byte per char) that is trimmed with
+// PyUnicode_Resize at the end - the buffer IS the result, no final copy. The
+// first non-ASCII byte moves the writer to a malloc'd UTF-8 buffer that is
+// decoded once in json_writer_finish.
+typedef struct {
+    PyObject *str;   // ASCII mode: the result object being filled in place
+    char *buf;       // write base: PyUnicode_DATA(str), or the UTF-8 buffer
+    size_t pos, cap;
+} DhiJsonWriter;
+
+static int json_writer_init(DhiJsonWriter *w, size_t cap) {
+    w->str = PyUnicode_New((Py_ssize_t)cap, 127);
+    if (!w->str) return -1;
+    w->buf = (char*)PyUnicode_DATA(w->str);
+    w->pos = 0;
+    w->cap = cap;
+    return 0;
+}
+
+static int json_writer_grow(DhiJsonWriter *w, size_t extra) {
+    size_t cap = w->cap * 2;
+    if (cap < w->pos + extra) cap = w->pos + extra;
+    if (w->str) {
+        if (PyUnicode_Resize(&w->str, (Py_ssize_t)cap) < 0) return -1;
+        w->buf = (char*)PyUnicode_DATA(w->str);
+    } else {
+        char *grown = (char*)realloc(w->buf, cap);
+        if (!grown) { PyErr_NoMemory(); return -1; }
+        w->buf = grown;
+    }
+    w->cap = cap;
+    return 0;
+}
+
+static inline int json_writer_reserve(DhiJsonWriter *w, size_t extra) {
+    if (__builtin_expect(w->pos + extra <= w->cap, 1)) return 0;
+    return json_writer_grow(w, extra);
+}
+
+static int json_writer_to_utf8(DhiJsonWriter *w) {
+    if (!w->str) return 0;
+    char *utf8 = (char*)malloc(w->cap ? w->cap : 1);
+    if (!utf8) { PyErr_NoMemory(); return -1; }
+    memcpy(utf8, w->buf, w->pos);
+    Py_CLEAR(w->str);
+    w->buf = utf8;
+    return 0;
+}
+
+static PyObject* json_writer_finish(DhiJsonWriter *w) {
+    PyObject *result;
+    if (w->str) {
+        result = w->str;
+        w->str = NULL;
+        if (PyUnicode_Resize(&result, (Py_ssize_t)w->pos) < 0) {
+            Py_DECREF(result);
+            result = NULL;
+        }
+    } else {
+        result = PyUnicode_DecodeUTF8(w->buf, (Py_ssize_t)w->pos, NULL);
+        free(w->buf);
+    }
+    w->buf = NULL;
+    return result;
+}
+
+static void json_writer_discard(DhiJsonWriter *w) {
+    if (w->str) Py_CLEAR(w->str);
+    else free(w->buf);
+    w->buf = NULL;
+}
+
+static inline int json_write_raw(DhiJsonWriter *w, const char *str, size_t len) {
+    if (json_writer_reserve(w, len) < 0) return -1;
+    memcpy(w->buf + w->pos, str, len);
+    w->pos += len;
+    return 0;
+}
+
+// Second byte of the short JSON escapes for control bytes (0 = use \u00XX)
+static const char json_short_escape[32] = {
+    ['\b'] = 'b', ['\t'] = 't', ['\n'] = 'n', ['\f'] = 'f', ['\r'] = 'r',
+};
+static const char json_hex_digits[] = "0123456789abcdef";
+
+// Length of the leading run of `s` that can be copied verbatim: no '"', '\\'
+// or control bytes, and (with stop_high) no bytes >= 0x80.
+static inline size_t json_clean_run(const unsigned char *s, size_t len, int stop_high) {
+    size_t i = 0;
+#if (defined(__clang__) || defined(__GNUC__)) && !defined(DHI_FORCE_SCALAR_ESCAPE)
+    typedef unsigned char dhi_v16u8 __attribute__((vector_size(16)));
+    typedef uint64_t dhi_v2u64 __attribute__((vector_size(16)));
+    const dhi_v16u8 zero = {0};
+    const dhi_v16u8 ctrl = zero + 0x20, quote = zero + '"', bslash = zero + '\\';
+    const dhi_v16u8 high = zero + (unsigned char)(stop_high ? 0x80 : 0);
+    while (i + 16 <= len) {
+        dhi_v16u8 v;
+        memcpy(&v, s + i, 16);
+        dhi_v16u8 bad = (dhi_v16u8)((v < ctrl) | (v == quote) | (v == bslash) | ((v & high) != zero));
+        dhi_v2u64 words = (dhi_v2u64)bad;
+        if (words[0] | words[1]) break;  // locate the byte with the scalar loop
+        i += 16;
+    }
+#endif
+    while (i < len) {
+        unsigned char c = s[i];
+        if (c < 0x20 || c == '"' || c == '\\' || (stop_high && c >= 0x80)) break;
+        i++;
+    }
+    return i;
+}
+
+// Append `str` as a quoted, escaped JSON string. `ascii_src` = the source is
+// known to be ASCII (an ASCII writer can then skip the high-byte check).
+static int json_write_string(DhiJsonWriter *w, const char *str, size_t len, int ascii_src) {
+    // Clean strings (the common case) need exactly len + 2 bytes; each escape
+    // below re-reserves for its expansion plus the unwritten remainder.
+    if (json_writer_reserve(w, len + 2) < 0) return -1;
+    const unsigned char *s = (const unsigned char*)str;
+    w->buf[w->pos++] = '"';
+    size_t i = 0;
+    while (i < len) {
+        size_t run = json_clean_run(s + i, len - i, w->str != NULL && !ascii_src);
+        memcpy(w->buf + w->pos, s + i, run);
+        w->pos += run;
+        i += run;
+        if (i >= len) break;
+
+        unsigned char c = s[i];
+        if (c >= 0x80) {
+            if (json_writer_to_utf8(w) < 0) return -1;
+            continue;
+        }
+        if (json_writer_reserve(w, 6 + (len - i)) < 0) return -1;
+        char *p = w->buf + w->pos;
+        if (c == '"' || c == '\\') {
+            p[0] = '\\'; p[1] = (char)c; w->pos += 2;
+        } else if (json_short_escape[c]) {
+            p[0] = '\\'; p[1] = json_short_escape[c]; w->pos += 2;
+        } else {
+            memcpy(p, "\\u00", 4);
+            p[4] = json_hex_digits[c >> 4];
+            p[5] = json_hex_digits[c & 15];
+            w->pos += 6;
+        }
+        i++;
+    }
+    w->buf[w->pos++] = '"';
+    return 0;
+}
+
+// str value: ASCII strs are escaped straight from their 1-byte storage
+static int json_write_unicode(DhiJsonWriter *w, PyObject *value) {
+    if (PyUnicode_IS_ASCII(value)) {
+        return json_write_string(w, (const char*)PyUnicode_DATA(value),
+                                 (size_t)PyUnicode_GET_LENGTH(value), 1);
+    }
+    Py_ssize_t len;
+    const char *utf8 = PyUnicode_AsUTF8AndSize(value, &len);
+    if (!utf8) return -1;
+    return json_write_string(w, utf8, (size_t)len, 0);
+}
+
+// Append one `"key": ` fragment for the serialization plan
+static int dhi_dump_plan_key(DhiJsonWriter *w, PyObject *key, uint32_t *len_out) {
+    size_t start = w->pos;
+    if (json_write_unicode(w, key) < 0 || json_write_raw(w, ": ", 2) < 0) return -1;
+    *len_out = (uint32_t)(w->pos - start);
+    return 0;
+}
+
+// Pre-encode every field's key fragments into one ms->dump_keys block, so the
+// dump loop copies them instead of re-escaping names per object
+static int dhi_dump_plan_build(CompiledModelSpecs *ms) {
+    // UTF-8 mode from the start (str = NULL): the block is raw bytes. Offsets
+    // are collected first since growing the block may move it.
+    size_t cap = 16;
+    for (Py_ssize_t i = 0; i < ms->n_fields; i++) cap += ms->specs[i].name_len * 2 + 8;
+    DhiJsonWriter w = {NULL, (char*)malloc(cap), 0, cap};
+    size_t *offs = (size_t*)malloc(sizeof(size_t) * 2 * (ms->n_fields ? ms->n_fields : 1));
+    if (!w.buf || !offs) { free(w.buf); free(offs); PyErr_NoMemory(); return -1; }
+
+    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
+        CompiledFieldSpec *fs = &ms->specs[i];
+        offs[2 * i] = w.pos;
+        if (dhi_dump_plan_key(&w, fs->name_obj, &fs->dump_key_len) < 0) goto error;
+        fs->dump_keys_ascii = PyUnicode_IS_ASCII(fs->name_obj);
+        if (PyUnicode_Check(fs->alias_obj)) {
+            offs[2 * i + 1] = w.pos;
+            if (dhi_dump_plan_key(&w, fs->alias_obj, &fs->dump_alias_key_len) < 0) goto error;
+            fs->dump_keys_ascii &= PyUnicode_IS_ASCII(fs->alias_obj);
+        } else {
+            offs[2 * i + 1] = offs[2 * i];
+            fs->dump_alias_key_len = fs->dump_key_len;
+        }
+    }
+
+    ms->dump_keys = w.buf;
+    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
+        ms->specs[i].dump_key = ms->dump_keys + offs[2 * i];
+        ms->specs[i].dump_alias_key = ms->dump_keys + offs[2 * i + 1];
+    }
+    free(offs);
+    return 0;
+
+error:
+    free(offs);
+    free(w.buf);
+    return -1;
+}
+
+// =============================================================================
+// init_model_core: ULTRA-OPTIMIZED init that handles EVERYTHING in C
+// Eliminates consumed set tracking for better performance
+// Returns: None on success, list of (field, msg) tuples on error
+// Sets __pydantic_fields_set__, __pydantic_private__, __pydantic_extra__ in C
+//
+// Keyword arguments come from EITHER:
+//   - kwargs: a Python dict (the classic init_model_full path), OR
+//   - args[nargs:] + kwnames: a vectorcall-style array (no dict allocation at all)
+// Exactly one of kwargs / kwnames may be non-NULL. args[0..nargs) are values
+// for the first nargs fields in declaration order (from_row) - no name lookup.
+// =============================================================================
+
+// Look up a keyword by name in a vectorcall kwnames tuple.
+// Fast path: pointer identity (kwnames from compiled code are interned).
+// Slow path: unicode equality (handles non-interned keys from **dict unpacking).
+static inline PyObject* dhi_kwnames_lookup(PyObject *const *kwvalues, PyObject *kwnames, PyObject *name) {
+    Py_ssize_t n = PyTuple_GET_SIZE(kwnames);
+    for (Py_ssize_t i = 0; i < n; i++) {
+        if (PyTuple_GET_ITEM(kwnames, i) == name) return kwvalues[i];
+    }
+    for (Py_ssize_t i = 0; i < n; i++) {
+        PyObject *k = PyTuple_GET_ITEM(kwnames, i);
+        if (k != name && PyUnicode_Check(k) && PyUnicode_Check(name) &&
+            PyUnicode_Compare(k, name) == 0) {
+            return kwvalues[i];
+        }
+    }
+    return NULL;
+}
+
+// Fields-set bitset: one bit per field, 64 fields per word. Models up to
+// DHI_FIELDSET_STACK_WORDS * 64 fields keep the words on the C stack; wider
+// models get a single zeroed heap block per call.
+#define DHI_FIELDSET_STACK_WORDS 8
+#define DHI_FIELDSET_WORDS(n) (((size_t)(n) + 63) / 64)
+#define DHI_FIELDSET_SET(bits, i) ((bits)[(size_t)(i) >> 6] |= ((uint64_t)1 << ((i) & 63)))
+
+// -----------------------------------------------------------------------------
+// Deferred validation errors
+// -----------------------------------------------------------------------------
+// A failing field is recorded as a DhiFieldError - spec index, error code and
+// the offending bound/value - instead of a (field, msg) tuple built on the
+// spot. Messages are rendered by dhi_errors_render() only when somebody asks:
+// init_model_full's caller, or ValidationErrors when it is first inspected.
+// In discard mode (construct_or_none) nothing is stored at all and
+// validation stops at the first invalid field.
+
+#define DHI_ERRORS_INLINE 4
+
+typedef struct {
+    DhiFieldError *items;    // inline_items until it outgrows them
+    Py_ssize_t n, cap;
+    int discard;             // count only, stop at the first error
+    DhiFieldError inline_items[DHI_ERRORS_INLINE];
+} DhiErrorBuf;
+
+static inline void dhi_errors_init(DhiErrorBuf *eb, int discard) {
+    eb->items = eb->inline_items;
+    eb->n = 0;
+    eb->cap = DHI_ERRORS_INLINE;
+    eb->discard = discard;
+}
+
+static void dhi_errors_clear(DhiErrorBuf *eb) {
+    for (Py_ssize_t k = 0; k < eb->n; k++) Py_XDECREF(eb->items[k].detail);
+    if (eb->items != eb->inline_items) PyMem_Free(eb->items);
+    dhi_errors_init(eb, eb->discard);
+}
+
+// Append a copy of *e (detail is borrowed and gets its own ref). 0 or -1.
+static int dhi_errors_push(DhiErrorBuf *eb, const DhiFieldError *e) {
+    if (__builtin_expect(eb->discard, 0)) {
+        eb->n++;
+        return 0;
+    }
+    if (eb->n == eb->cap) {
+        Py_ssize_t cap = eb->cap * 2;
+        DhiFieldError *grown = (DhiFieldError*)PyMem_Malloc(cap * sizeof(DhiFieldError));
+        if (!grown) { PyErr_NoMemory(); return -1; }
+        memcpy(grown, eb->items, eb->n * sizeof(DhiFieldError));
+        if (eb->items != eb->inline_items) PyMem_Free(eb->items);
+        eb->items = grown;
+        eb->cap = cap;
+    }
+    eb->items[eb->n] = *e;
+    Py_XINCREF(e->detail);
+    eb->n++;
+    return 0;
+}
+
+// Render records into the classic list of (field, msg) pairs. The messages
+// drop dhi_error_message's "field: " prefix: ValidationError adds it back.
+static PyObject* dhi_errors_render(CompiledModelSpecs *ms, const DhiFieldError *items,
+                                   Py_ssize_t n) {
+    PyObject *list = PyList_New(n);
+    if (!list) return NULL;
+    for (Py_ssize_t k = 0; k < n; k++) {
+        const DhiFieldError *e = &items[k];
+        const char *name = e->field >= 0 ? PyUnicode_AsUTF8(ms->specs[e->field].name_obj) : "";
+        PyObject *msg = name ? dhi_error_message(name, e->field >= 0 ? &ms->specs[e->field] : NULL, e)
+                             : NULL;
+        if (msg && e->code != DHI_ERR_EXTRA && e->code != DHI_ERR_REQUIRED) {
+            PyObject *bare = PyUnicode_Substring(
+                msg, PyUnicode_GET_LENGTH(ms->specs[e->field].name_obj) + 2, PyUnicode_GET_LENGTH(msg));
+            Py_SETREF(msg, bare);
+        }
+        PyObject *pair = msg ? PyTuple_Pack(2, e->code == DHI_ERR_EXTRA
+                                                   ? e->detail : ms->specs[e->field].name_obj,
+                                            msg) : NULL;
+        Py_XDECREF(msg);
+        if (!pair) { Py_DECREF(list); return NULL; }
+        PyList_SET_ITEM(list, k, pair);
+    }
+    return list;
+}
+
+// Record an error for field i and move on; discard mode bails out instead
+#define DHI_FIELD_ERROR(...) do {                             \
+        DhiFieldError e_ = {.field = i, __VA_ARGS__};         \
+        if (dhi_errors_push(eb, &e_) < 0) goto fatal;         \
+        if (eb->discard) goto rejected;                       \
+    } while (0)
+
+static int init_model_core_impl(PyObject *model_self, CompiledModelSpecs *ms, int extra_mode,
+                                PyObject *kwargs,
+                                PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames,
+                                uint64_t *fields_bits, DhiErrorBuf *eb);
+
+// Validate into model_self, recording failures in *eb.
+// Returns 0 when valid, 1 when eb holds errors, -1 with an exception set.
+static int init_model_core_records(PyObject *model_self, CompiledModelSpecs *ms, int extra_mode,
+                                   PyObject *kwargs,
+                                   PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames,
+                                   DhiErrorBuf *eb) {
+    DHI_STAT_TIMER(t0);
+    DHI_STAT_INC(ms, DHI_STAT_VALIDATIONS);
+    size_t n_words = DHI_FIELDSET_WORDS(ms->n_fields);
+    int r;
+    if (__builtin_expect(n_words <= DHI_FIELDSET_STACK_WORDS, 1)) {
+        uint64_t stack_bits[DHI_FIELDSET_STACK_WORDS];
+        memset(stack_bits, 0, n_words * sizeof(uint64_t));
+        r = init_model_core_impl(model_self, ms, extra_mode, kwargs, args, nargs, kwnames,
+                                 stack_bits, eb);
+    } else {
+        uint64_t *heap_bits = (uint64_t*)PyMem_Calloc(n_words, sizeof(uint64_t));
+        if (!heap_bits) { PyErr_NoMemory(); return -1; }
+        r = init_model_core_impl(model_self, ms, extra_mode, kwargs, args, nargs, kwnames,
+                                 heap_bits, eb);
+        PyMem_Free(heap_bits);
+    }
+    if (r != 0) DHI_STAT_INC(ms, DHI_STAT_ERRORS);
+    DHI_STAT_TIME(ms, t0);
+    return r;
+}
+
+// Returns None, or the rendered list of (field, msg) pairs
+static PyObject* init_model_core(PyObject *model_self, CompiledModelSpecs *ms, int extra_mode,
+                                 PyObject *kwargs) {
+    DhiErrorBuf eb;
+    dhi_errors_init(&eb, 0);
+    int r = init_model_core_records(model_self, ms, extra_mode, kwargs, NULL, 0, NULL, &eb);
+    PyObject *result = NULL;
+    if (r == 0) {
+        Py_INCREF(Py_None);
+        result = Py_None;
+    } else if (r > 0) {
+        result = dhi_errors_render(ms, eb.items, eb.n);
+    }
+    dhi_errors_clear(&eb);
+    return result;
+}
+
+static int init_model_core_impl(PyObject *model_self, CompiledModelSpecs *ms, int extra_mode,
+                                PyObject *kwargs,
+                                PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames,
+                                uint64_t *fields_bits, DhiErrorBuf *eb) {
+    PyObject *obj_dict = PyObject_GenericGetDict(model_self, NULL);
+    if (!obj_dict) return -1;
+
+    PyObject *extra_data = NULL;
+    PyObject *result = NULL;
+
+    // OPTIMIZATION: Use a bitset instead of PySet during hot loop
+    // PySet_Add has overhead; setting a bit is O(1)
+    // We create the actual PySet only at the end
+
+    // OPTIMIZATION: Use counter instead of consumed set for extra field detection
+    Py_ssize_t found_count = 0;
+    Py_ssize_t n_kw = kwargs ? PyDict_Size(kwargs)
+                             : (kwnames ? PyTuple_GET_SIZE(kwnames) : 0);
+    Py_ssize_t kwargs_size = nargs + n_kw;
+    PyObject *const *kwvalues = args ? args + nargs : NULL;
+
+    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
+        CompiledFieldSpec *fs = &ms->specs[i];
+
+        // --- Extract value: positional row, kwargs (dict) or kwvalues/kwnames ---
+        PyObject *value = NULL;
+
+        if (i < nargs) {
+            value = args[i];
+        } else if (kwargs) {
+            if (fs->alias_obj != Py_None) {
+                value = PyDict_GetItem(kwargs, fs->alias_obj);
+            }
+            if (!value) {
+                value = _PyDict_GetItem_KnownHash(kwargs, fs->name_obj, fs->name_hash);
+            }
+        } else if (kwnames) {
+            if (fs->alias_obj != Py_None) {
+                value = dhi_kwnames_lookup(kwvalues, kwnames, fs->alias_obj);
+            }
+            if (!value) {
+                value = dhi_kwnames_lookup(kwvalues, kwnames, fs->name_obj);
+            }
+        }
+
+        if (!value) {
+            if (!fs->required) {
+                PyDict_SetItem(obj_dict, fs->name_obj, fs->default_val);
+                continue;
+            }
+            DHI_FIELD_ERROR(.code = DHI_ERR_REQUIRED);
+            continue;
+        }
+
+        // OPTIMIZATION: Use bitset instead of PySet_Add (O(1) bit op vs hash table)
+        found_count++;
+        DHI_FIELDSET_SET(fields_bits, i);
+
+        // --- MODEL-TYPED FIELDS (6/7/8) are resolved here; scalars run the plan ---
+        // Error paths below drop `result` first, so the labels never see it
+        PyObject *got = (PyObject*)Py_TYPE(value);
+
+        if (fs->type_code == 6) { // nested model - FAST PATH
+            // Check if value is already the correct nested model type
+            if ((PyObject*)Py_TYPE(value) == fs->nested_model_type) {
+                // Already validated! Just set directly in dict (ULTRA FAST)
+                PyDict_SetItem(obj_dict, fs->name_obj, value);
+                continue;  // Skip all other validation - already done
+            }
+            // Value is neither correct type nor dict - error
+            if (!PyDict_Check(value)) {
+                DHI_FIELD_ERROR(.code = DHI_ERR_EXPECTED_MODEL, .detail = got);
+                continue;
+            }
+            // Ensure global empty tuple is initialized
+            if (!g_empty_tuple) {
+                g_empty_tuple = PyTuple_New(0);
+                if (!g_empty_tuple) goto fatal;
+            }
+            // Create nested model: type(**dict)
+            PyObject *nested_obj = PyObject_Call(fs->nested_model_type, g_empty_tuple, value);
+            if (!nested_obj) {
+                // Nested validation failed - keep the exception for the message
+                PyObject *exc_type, *exc_value, *exc_tb;
+                PyErr_Fetch(&exc_type, &exc_value, &exc_tb);
+                Py_XDECREF(exc_type);
+                Py_XDECREF(exc_tb);
+                if (exc_value) {
+                    DhiFieldError e = {.field = i, .code = DHI_ERR_NESTED, .detail = exc_value};
+                    int pushed = dhi_errors_push(eb, &e);
+                    Py_DECREF(exc_value);
+                    if (pushed < 0) goto fatal;
+                    if (eb->discard) goto rejected;
+                }
+                continue;
+            }
+            // Set nested model in dict
+            PyDict_SetItem(obj_dict, fs->name_obj, nested_obj);
+            Py_DECREF(nested_obj);
+            continue;  // Skip all other validation - nested __init__ did it
+        } else if (fs->type_code == 7) { // list of model variants - FAST PATH
+            if (!PyList_Check(value)) {
+                DHI_FIELD_ERROR(.code = DHI_ERR_EXPECTED, .text = "list", .detail = got);
+                continue;
+            }
+            // Length constraints on the list
+            Py_ssize_t list_len = PyList_GET_SIZE(value);
+            if (fs->has_minl && list_len < fs->min_len) {
+                DHI_FIELD_ERROR(.code = DHI_ERR_LENGTH, .op = 0,
+                                .bound.n = fs->min_len, .got.n = list_len);
+                continue;
+            }
+            if (fs->has_maxl && list_len > fs->max_len) {
+                DHI_FIELD_ERROR(.code = DHI_ERR_LENGTH, .op = 1,
+                                .bound.n = fs->max_len, .got.n = list_len);
+                continue;
+            }
+            // Items are already validated BaseModel instances - just passthrough
+            // For dict items, try to coerce using the first matching type
+            int has_dicts = 0;
+            for (Py_ssize_t j = 0; j < list_len; j++) {
+                if (PyDict_Check(PyList_GET_ITEM(value, j))) { has_dicts = 1; break; }
+            }
+            if (!has_dicts || !fs->union_types_tuple) {
+                // Set directly - no copy needed for non-dict items
+                PyDict_SetItem(obj_dict, fs->name_obj, value);
+                continue;
+            }
+            // Need to coerce dict items - create new list
+            if (!g_empty_tuple) {
+                g_empty_tuple = PyTuple_New(0);
+                if (!g_empty_tuple) goto fatal;
+            }
+            result = PyList_New(list_len);
+            if (!result) goto fatal;
+            int coerce_error = 0;
+            for (Py_ssize_t j = 0; j < list_len; j++) {
+                PyObject *item = PyList_GET_ITEM(value, j);
+                if (PyDict_Check(item)) {
+                    // Try each union type until one succeeds
+                    Py_ssize_t n_types = PyTuple_GET_SIZE(fs->union_types_tuple);
+                    PyObject *coerced = NULL;
+                    for (Py_ssize_t t = 0; t < n_types; t++) {
+                        PyObject *model_type = PyTuple_GET_ITEM(fs->union_types_tuple, t);
+                        coerced = PyObject_Call(model_type, g_empty_tuple, item);
+                        if (coerced) break;
+                        PyErr_Clear();
+                    }
+                    if (coerced) {
+                        PyList_SET_ITEM(result, j, coerced);  // steals ref
+                        continue;
+                    }
+                    DhiFieldError e = {.field = i, .code = DHI_ERR_ITEM, .got.n = j};
+                    if (dhi_errors_push(eb, &e) < 0) goto fatal;
+                    coerce_error = 1;
+                }
+                // Keep the item as is (also fills the slot of a failed coercion)
+                Py_INCREF(item);
+                PyList_SET_ITEM(result, j, item);
+            }
+            if (coerce_error && eb->discard) goto rejected;
+            PyDict_SetItem(obj_dict, fs->name_obj, result);
+            Py_CLEAR(result);
+            continue;
+        } else if (fs->type_code == 8) { // union of model types
+            // Check if value is an instance of any union type
+            if (fs->union_types_tuple) {
+                int is_instance = PyObject_IsInstance(value, fs->union_types_tuple);
+                if (is_instance == 1) {
+                    // Already correct type
+                    PyDict_SetItem(obj_dict, fs->name_obj, value);
+                    continue;
+                }
+                // Try dict coercion
+                if (PyDict_Check(value)) {
+                    if (!g_empty_tuple) {
+                        g_empty_tuple = PyTuple_New(0);
+                        if (!g_empty_tuple) goto fatal;
+                    }
+                    Py_ssize_t n_types = PyTuple_GET_SIZE(fs->union_types_tuple);
+                    PyObject *coerced = NULL;
+                    for (Py_ssize_t t = 0; t < n_types; t++) {
+                        PyObject *model_type = PyTuple_GET_ITEM(fs->union_types_tuple, t);
+                        coerced = PyObject_Call(model_type, g_empty_tuple, value);
+                        if (coerced) break;
+                        PyErr_Clear();
+                    }
+                    if (coerced) {
+                        PyDict_SetItem(obj_dict, fs->name_obj, coerced);
+                        Py_DECREF(coerced);
+                        continue;
+                    }
+                }
+            }
+            // Not a valid type
+            DHI_FIELD_ERROR(.code = DHI_ERR_UNION);
+            continue;
+        }
+
+        // --- TYPE CHECK + CONSTRAINTS (the field's validation plan) ---
+        DhiFieldError err = {.field = i};
+        int r = dhi_plan_run(fs, value, &result, &err);
+        if (r < 0) goto fatal;
+        if (r == 0) {
+            if (dhi_errors_push(eb, &err) < 0) goto fatal;
+            if (eb->discard) goto rejected;
+            continue;
+        }
+
+        // --- SUCCESS: set in __dict__ ---
+        PyDict_SetItem(obj_dict, fs->name_obj, result);
+        Py_CLEAR(result);
+    }
+
+    // --- HANDLE EXTRA FIELDS (OPTIMIZED: no consumed set) ---
+    // Only check for extras if we found fewer fields than kwargs has
+    // This is the common case optimization - most models don't have extra fields
+    if (extra_mode != 0 && found_count < kwargs_size) {
+        PyObject *key, *value;
+        Py_ssize_t pos = 0;
+        Py_ssize_t ki = 0;
+        for (;;) {
+            if (kwargs) {
+                if (!PyDict_Next(kwargs, &pos, &key, &value)) break;
+            } else {
+                if (ki >= n_kw) break;
+                key = PyTuple_GET_ITEM(kwnames, ki);
+                value = kwvalues[ki];
+                ki++;
+            }
+            // Check if this key is a known field (by name or alias)
+            int is_known = 0;
+            for (Py_ssize_t i = 0; i < ms->n_fields && !is_known; i++) {
+                CompiledFieldSpec *fs = &ms->specs[i];
+                if (PyObject_RichCompareBool(key, fs->name_obj, Py_EQ) == 1) {
+                    is_known = 1;
+                } else if (fs->alias_obj != Py_None &&
+                           PyObject_RichCompareBool(key, fs->alias_obj, Py_EQ) == 1) {
+                    is_known = 1;
+                }
+            }
+            if (!is_known) {
+                if (extra_mode == 1) {  // 'forbid'
+                    Py_ssize_t i = -1;
+                    DHI_FIELD_ERROR(.code = DHI_ERR_EXTRA, .detail = key);
+                } else if (extra_mode == 2) {  // 'allow'
+                    if (!extra_data) {
+                        extra_data = PyDict_New();
+                        if (!extra_data) goto fatal;
+                    }
+                    PyDict_SetItem(extra_data, key, value);
+                }
+            }
+        }
+    }
+
+    Py_DECREF(obj_dict);
+
+    // --- SET PYDANTIC INTERNAL ATTRIBUTES (direct __dict__ access for speed) ---
+    // Re-get obj_dict since we released it earlier
+    obj_dict = PyObject_GenericGetDict(model_self, NULL);
+    if (!obj_dict) { Py_XDECREF(extra_data); return -1; }
+
+    // Use interned strings for fast dict access
+    static PyObject *fields_set_key = NULL;
+    static PyObject *extra_key = NULL;
+    static PyObject *private_key = NULL;
+    if (!fields_set_key) {
+        fields_set_key = PyUnicode_InternFromString("__pydantic_fields_set__");
+        extra_key = PyUnicode_InternFromString("__pydantic_extra__");
+        private_key = PyUnicode_InternFromString("__pydantic_private__");
+    }
+
+    // OPTIMIZATION: Create PySet from the bitset only once at the end
+    // This is faster than calling PySet_Add for each field during the loop
+    PyObject *fields_set = PySet_New(NULL);
+    if (!fields_set) goto fatal;
+    size_t n_words = DHI_FIELDSET_WORDS(ms->n_fields);
+    for (size_t w = 0; w < n_words; w++) {
+        uint64_t word = fields_bits[w];
+        while (word) {
+            Py_ssize_t i = (Py_ssize_t)(w * 64 + (size_t)__builtin_ctzll(word));
+            word &= word - 1;
+            if (PySet_Add(fields_set, ms->specs[i].name_obj) < 0) {
+                Py_DECREF(fields_set);
+                goto fatal;
+            }
+        }
+    }
+
+    PyDict_SetItem(obj_dict, fields_set_key, fields_set);
+    Py_DECREF(fields_set);
+
+    if (extra_data) {
+        PyDict_SetItem(obj_dict, extra_key, extra_data);
+        Py_DECREF(extra_data);
+    } else {
+        PyDict_SetItem(obj_dict, extra_key, Py_None);
+    }
+    PyDict_SetItem(obj_dict, private_key, Py_None);
+    Py_DECREF(obj_dict);
+
+    return eb->n > 0;
+
+rejected:
+    // Discard mode: the first error decides, the instance is thrown away
+    Py_XDECREF(result);
+    Py_XDECREF(extra_data);
+    Py_DECREF(obj_dict);
+    return 1;
+
+fatal:
+    Py_XDECREF(result);
+    Py_XDECREF(extra_data);
+    Py_DECREF(obj_dict);
+    return -1;
+}
+
+#undef DHI_FIELD_ERROR
+
+// =============================================================================
+// init_model_full: classic entry point (kwargs dict), kept for the Python
+// fast-__init__ fallback path. Uses METH_FASTCALL for faster argument passing.
+// =============================================================================
+static PyObject* py_init_model_full(PyObject* self_unused, PyObject *const *args, Py_ssize_t nargs) {
+    // METH_FASTCALL: args passed as C array - no PyArg_ParseTuple overhead!
+    if (nargs != 4) {
+        PyErr_SetString(PyExc_TypeError, "init_model_full requires 4 arguments");
+        return NULL;
+    }
+
+    PyObject *model_self = args[0];
+    PyObject *kwargs = args[1];
+    PyObject *capsule = args[2];
+    PyObject *extra_mode_obj = args[3];
+
+    // Validate kwargs is a dict (fast check)
+    if (!PyDict_Check(kwargs)) {
+        PyErr_SetString(PyExc_TypeError, "kwargs must be a dict");
+        return NULL;
+    }
+
+    // Get extra_mode as C int (0=ignore, 1=forbid, 2=allow)
+    int extra_mode = (int)PyLong_AsLong(extra_mode_obj);
+    if (extra_mode == -1 && PyErr_Occurred()) return NULL;
+
+    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
+    if (!ms) return NULL;
+
+    return init_model_core(model_self, ms, extra_mode, kwargs);
+}
+
+// =============================================================================
+// ValidationRecords: the DhiFieldError array of one failed construction,
+// handed to the Python raiser unrendered. ValidationErrors calls pairs() the
+// first time its errors or message are looked at; a rejected record that is
+// only caught and dropped never formats a single string.
+// =============================================================================
+
+typedef struct {
+    PyObject_VAR_HEAD
+    PyObject *specs_capsule;   // strong ref (keeps CompiledModelSpecs alive)
+    CompiledModelSpecs *ms;
+    DhiFieldError items[1];
+} ValidationRecordsObject;
+
+static void validation_records_dealloc(ValidationRecordsObject *self) {
+    for (Py_ssize_t k = 0; k < Py_SIZE(self); k++) Py_XDECREF(self->items[k].detail);
+    Py_XDECREF(self->specs_capsule);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static Py_ssize_t validation_records_len(ValidationRecordsObject *self) {
+    return Py_SIZE(self);
+}
+
+static PyObject* validation_records_pairs(ValidationRecordsObject *self, PyObject *unused) {
+    return dhi_errors_render(self->ms, self->items, Py_SIZE(self));
+}
+
+static PyMethodDef validation_records_methods[] = {
+    {"pairs", (PyCFunction)validation_records_pairs, METH_NOARGS,
+     "Render the recorded errors: () -> list[(field, msg)]"},
+    {NULL}
+};
+
+static PySequenceMethods validation_records_as_sequence = {
+    .sq_length = (lenfunc)validation_records_len,
+};
+
+static PyTypeObject ValidationRecordsType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "dhi._dhi_native.ValidationRecords",
+    .tp_basicsize = offsetof(ValidationRecordsObject, items),
+    .tp_itemsize = sizeof(DhiFieldError),
+    .tp_dealloc = (destructor)validation_records_dealloc,
+    .tp_as_sequence = &validation_records_as_sequence,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "Unrendered validation errors of a failed model construction",
+    .tp_methods = validation_records_methods,
+};
+
+// Move the records out of *eb into a new ValidationRecords (eb ends up empty)
+static PyObject* validation_records_take(PyObject *specs_capsule, CompiledModelSpecs *ms,
+                                         DhiErrorBuf *eb) {
+    ValidationRecordsObject *rec = PyObject_NewVar(ValidationRecordsObject,
+                                                   &ValidationRecordsType, eb->n);
+    if (!rec) return NULL;
+    memcpy(rec->items, eb->items, eb->n * sizeof(DhiFieldError));
+    Py_INCREF(specs_capsule);
+    rec->specs_capsule = specs_capsule;
+    rec->ms = ms;
+    if (eb->items != eb->inline_items) PyMem_Free(eb->items);
+    dhi_errors_init(eb, eb->discard);
+    return (PyObject*)rec;
+}
+
+// =============================================================================
+// Vectorcall construction fast path
+//
+// For ultra-fast model classes we install a tp_vectorcall on the class object
+// so `User(name=..., age=...)` dispatches straight into C:
+//   - no type_call / tp_new / tp_init slot dance
+//   - no Python __init__ frame
+//   - no **kwargs dict allocation (values read directly from the stack)
+// Requires the metatype to support vectorcall on instances (CPython >= 3.12
+// inherits Py_TPFLAGS_HAVE_VECTORCALL on mutable subclasses of type). On older
+// versions the slot is simply never consulted and the Python fast __init__
+// path is used instead. Note tp_vectorcall is never inherited by subclasses,
+// so each model class opts in explicitly via enable_fast_construct().
+// =============================================================================
+
+typedef struct {
+    PyObject *specs_capsule;   // strong ref (keeps CompiledModelSpecs alive)
+    CompiledModelSpecs *ms;
+    int extra_mode;
+    PyObject *raiser;          // strong ref; callable(ValidationRecords) that raises
+} FastConstructInfo;
+
+static void fast_construct_info_destructor(PyObject *capsule) {
+    FastConstructInfo *info = (FastConstructInfo*)PyCapsule_GetPointer(capsule, "dhi.fast_construct");
+    if (info) {
+        Py_XDECREF(info->specs_capsule);
+        Py_XDECREF(info->raiser);
+        free(info);
+    }
+}
+
+static PyObject *g_fastinfo_key = NULL;  // interned "__dhi_fast_construct__"
+
+// Finish a fast construction of the freshly allocated `self` from
+// init_model_core_records' status. Returns `self` on success; otherwise hands
+// the unrendered ValidationRecords to the class's Python raiser and returns NULL.
+static PyObject* dhi_fast_construct_finish(FastConstructInfo *info, PyObject *self,
+                                           int status, DhiErrorBuf *eb) {
+    DHI_STAT_INC(info->ms, DHI_STAT_FAST_PATH);
+    if (status == 0) return self;
+    Py_DECREF(self);
+    if (status < 0) {
+        dhi_errors_clear(eb);
+        return NULL;
+    }
+
+    PyObject *records = validation_records_take(info->specs_capsule, info->ms, eb);
+    if (!records) {
+        dhi_errors_clear(eb);
+        return NULL;
+    }
+    PyObject *r = PyObject_CallFunctionObjArgs(info->raiser, records, NULL);
+    Py_DECREF(records);
+    Py_XDECREF(r);
+    if (!PyErr_Occurred()) {
+        PyErr_SetString(PyExc_ValueError, "dhi: validation failed");
+    }
+    return NULL;
+}
+
+// Fallback: route through the normal type_call path (metatype tp_call).
+static PyObject* dhi_vectorcall_fallback(PyObject *cls_obj, PyObject *const *args,
+                                         Py_ssize_t nargs, PyObject *kwnames) {
+    PyObject *args_tuple = PyTuple_New(nargs);
+    if (!args_tuple) return NULL;
+    for (Py_ssize_t i = 0; i < nargs; i++) {
+        Py_INCREF(args[i]);
+        PyTuple_SET_ITEM(args_tuple, i, args[i]);
+    }
+    PyObject *kw = NULL;
+    if (kwnames && PyTuple_GET_SIZE(kwnames) > 0) {
+        kw = PyDict_New();
+        if (!kw) { Py_DECREF(args_tuple); return NULL; }
+        Py_ssize_t nk = PyTuple_GET_SIZE(kwnames);
+        for (Py_ssize_t i = 0; i < nk; i++) {
+            if (PyDict_SetItem(kw, PyTuple_GET_ITEM(kwnames, i), args[nargs + i]) < 0) {
+                Py_DECREF(args_tuple); Py_DECREF(kw); return NULL;
+            }
+        }
+    }
+    // tp_call of the metatype is type_call for classes; always non-NULL.
+    PyObject *result = Py_TYPE(cls_obj)->tp_call(cls_obj, args_tuple, kw);
+    Py_DECREF(args_tuple);
+    Py_XDECREF(kw);
+    return result;
+}
+
+static PyObject* dhi_model_vectorcall(PyObject *cls_obj, PyObject *const *args,
+                                      size_t nargsf, PyObject *kwnames) {
+    PyTypeObject *cls = (PyTypeObject*)cls_obj;
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+
+    // Look up the per-class fast-construct info in the type's own dict.
+    PyObject *info_capsule = g_fastinfo_key
+        ? PyDict_GetItemWithError(cls->tp_dict, g_fastinfo_key)
+        : NULL;
+    if (!info_capsule) {
+        if (PyErr_Occurred()) return NULL;
+        // Shouldn't normally happen; fall back to the regular call path.
+        DHI_STAT_GLOBAL_INC(g_stats_vectorcall_fallbacks);
+        return dhi_vectorcall_fallback(cls_obj, args, nargs, kwnames);
+    }
+    FastConstructInfo *info = (FastConstructInfo*)PyCapsule_GetPointer(info_capsule, "dhi.fast_construct");
+    if (!info) return NULL;
+
+    if (nargs > 0) {
+        PyErr_Format(PyExc_TypeError,
+                     "%.200s() takes no positional arguments", cls->tp_name);
+        return NULL;
+    }
+
+    PyObject *self = cls->tp_alloc(cls, 0);
+    if (!self) return NULL;
+
+    DhiErrorBuf eb;
+    dhi_errors_init(&eb, 0);
+    int status = init_model_core_records(self, info->ms, info->extra_mode,
+                                         NULL, args, 0, kwnames, &eb);
+    return dhi_fast_construct_finish(info, self, status, &eb);
+}
+
+// enable_fast_construct(cls, specs_capsule, extra_mode, raiser) -> None
+static PyObject* py_enable_fast_construct(PyObject* self_unused, PyObject* args) {
+    PyObject *cls_obj, *capsule, *raiser;
     int extra_mode;
-    PyObject *raiser;          // strong ref; callable(list[(field, msg)]) that raises
-} FastConstructInfo;
+    if (!PyArg_ParseTuple(args, "OOiO", &cls_obj, &capsule, &extra_mode, &raiser)) return NULL;
+    if (!PyType_Check(cls_obj)) {
+        PyErr_SetString(PyExc_TypeError, "enable_fast_construct: first argument must be a class");
+        return NULL;
+    }
+    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
+    if (!ms) return NULL;
+
+    if (!g_fastinfo_key) {
+        g_fastinfo_key = PyUnicode_InternFromString("__dhi_fast_construct__");
+        if (!g_fastinfo_key) return NULL;
+    }
+
+    FastConstructInfo *info = (FastConstructInfo*)malloc(sizeof(FastConstructInfo));
+    if (!info) return PyErr_NoMemory();
+    Py_INCREF(capsule);
+    Py_INCREF(raiser);
+    info->specs_capsule = capsule;
+    info->ms = ms;
+    info->extra_mode = extra_mode;
+    info->raiser = raiser;
+
+    PyObject *info_capsule = PyCapsule_New(info, "dhi.fast_construct", fast_construct_info_destructor);
+    if (!info_capsule) {
+        Py_DECREF(capsule); Py_DECREF(raiser); free(info);
+        return NULL;
+    }
+
+    // Store via setattr so type machinery (caches, versioning) stays consistent.
+    if (PyObject_SetAttr(cls_obj, g_fastinfo_key, info_capsule) < 0) {
+        Py_DECREF(info_capsule);
+        return NULL;
+    }
+    Py_DECREF(info_capsule);
+
+#if PY_VERSION_HEX >= 0x030C0000
+    ((PyTypeObject*)cls_obj)->tp_vectorcall = dhi_model_vectorcall;
+#endif
+    Py_RETURN_NONE;
+}
+
+// construct_validated(cls, data_dict) -> instance
+// C-speed model_validate fast path: allocates the instance and validates the
+// dict in one call using the class's fast-construct info (no object.__new__
+// dispatch, no Python-level error re-packing).
+static PyObject* py_construct_validated(PyObject* self_unused, PyObject *const *args, Py_ssize_t nargs) {
+    if (nargs != 2) {
+        PyErr_SetString(PyExc_TypeError, "construct_validated requires 2 arguments");
+        return NULL;
+    }
+    PyObject *cls_obj = args[0];
+    PyObject *data = args[1];
+    if (!PyType_Check(cls_obj) || !PyDict_Check(data)) {
+        PyErr_SetString(PyExc_TypeError, "construct_validated: expected (class, dict)");
+        return NULL;
+    }
+    PyTypeObject *cls = (PyTypeObject*)cls_obj;
+
+    PyObject *info_capsule = g_fastinfo_key
+        ? PyDict_GetItemWithError(cls->tp_dict, g_fastinfo_key)
+        : NULL;
+    if (!info_capsule) {
+        if (!PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError,
+                            "construct_validated: class has no fast-construct info");
+        }
+        return NULL;
+    }
+    FastConstructInfo *info = (FastConstructInfo*)PyCapsule_GetPointer(info_capsule, "dhi.fast_construct");
+    if (!info) return NULL;
+
+    PyObject *self = cls->tp_alloc(cls, 0);
+    if (!self) return NULL;
+
+    DhiErrorBuf eb;
+    dhi_errors_init(&eb, 0);
+    int status = init_model_core_records(self, info->ms, info->extra_mode, data, NULL, 0, NULL, &eb);
+    return dhi_fast_construct_finish(info, self, status, &eb);
+}
+
+// construct_or_none(cls, data_dict) -> instance | None
+// construct_validated for callers that only want to know whether the data is
+// valid: errors are counted, not recorded, validation stops at the first bad
+// field and nothing is raised for invalid data.
+static PyObject* py_construct_or_none(PyObject* self_unused, PyObject *const *args, Py_ssize_t nargs) {
+    if (nargs != 2) {
+        PyErr_SetString(PyExc_TypeError, "construct_or_none requires 2 arguments");
+        return NULL;
+    }
+    PyObject *cls_obj = args[0];
+    PyObject *data = args[1];
+    if (!PyType_Check(cls_obj) || !PyDict_Check(data)) {
+        PyErr_SetString(PyExc_TypeError, "construct_or_none: expected (class, dict)");
+        return NULL;
+    }
+    PyTypeObject *cls = (PyTypeObject*)cls_obj;
+
+    PyObject *info_capsule = g_fastinfo_key
+        ? PyDict_GetItemWithError(cls->tp_dict, g_fastinfo_key)
+        : NULL;
+    if (!info_capsule) {
+        if (!PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError,
+                            "construct_or_none: class has no fast-construct info");
+        }
+        return NULL;
+    }
+    FastConstructInfo *info = (FastConstructInfo*)PyCapsule_GetPointer(info_capsule, "dhi.fast_construct");
+    if (!info) return NULL;
+
+    PyObject *self = cls->tp_alloc(cls, 0);
+    if (!self) return NULL;
+
+    DhiErrorBuf eb;
+    dhi_errors_init(&eb, 1);
+    int status = init_model_core_records(self, info->ms, info->extra_mode, data, NULL, 0, NULL, &eb);
+    DHI_STAT_INC(info->ms, DHI_STAT_FAST_PATH);
+    if (status == 0) return self;
+    Py_DECREF(self);
+    if (status < 0) return NULL;
+    Py_RETURN_NONE;
+}
+
+// disable_fast_construct(cls) -> None
+static PyObject* py_disable_fast_construct(PyObject* self_unused, PyObject* args) {
+    PyObject *cls_obj;
+    if (!PyArg_ParseTuple(args, "O", &cls_obj)) return NULL;
+    if (!PyType_Check(cls_obj)) {
+        PyErr_SetString(PyExc_TypeError, "disable_fast_construct: argument must be a class");
+        return NULL;
+    }
+#if PY_VERSION_HEX >= 0x030C0000
+    ((PyTypeObject*)cls_obj)->tp_vectorcall = NULL;
+#endif
+    if (g_fastinfo_key &&
+        PyDict_GetItemWithError(((PyTypeObject*)cls_obj)->tp_dict, g_fastinfo_key)) {
+        if (PyObject_DelAttr(cls_obj, g_fastinfo_key) < 0) return NULL;
+    } else if (PyErr_Occurred()) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+// =============================================================================
+// dump_model_compiled: Ultra-fast dict dump using pre-compiled specs
+// Returns Python dict directly without intermediate processing
+// =============================================================================
+// Forward declaration for recursive dump
+static PyObject* dump_model_recursive(PyObject *model_self);
+
+// Helper: dump a single value, recursing into BaseModel instances and lists
+static PyObject* dump_value_recursive(PyObject *value) {
+    // Check if value has __dhi_fields__ (is a BaseModel)
+    if (PyObject_HasAttrString(value, "__dhi_fields__")) {
+        return dump_model_recursive(value);
+    }
+    // Check if value is a list - recurse into items
+    if (PyList_Check(value)) {
+        Py_ssize_t len = PyList_GET_SIZE(value);
+        PyObject *new_list = PyList_New(len);
+        if (!new_list) return NULL;
+        for (Py_ssize_t i = 0; i < len; i++) {
+            PyObject *item = PyList_GET_ITEM(value, i);
+            PyObject *dumped;
+            if (PyObject_HasAttrString(item, "__dhi_fields__")) {
+                dumped = dump_model_recursive(item);
+            } else {
+                dumped = item;
+                Py_INCREF(dumped);
+            }
+            if (!dumped) { Py_DECREF(new_list); return NULL; }
+            PyList_SET_ITEM(new_list, i, dumped);  // steals ref
+        }
+        return new_list;
+    }
+    Py_INCREF(value);
+    return value;
+}
+
+// Recursive dump: handles nested models and list-of-models
+static PyObject* dump_model_recursive(PyObject *model_self) {
+    PyObject *obj_dict = PyObject_GenericGetDict(model_self, NULL);
+    if (!obj_dict) return NULL;
+
+    // Dump specs list every dumped field (the init specs can be partial)
+    PyObject *compiled_attr = PyObject_GetAttrString((PyObject*)Py_TYPE(model_self), "__dhi_dump_specs__");
+    if (!compiled_attr || compiled_attr == Py_None) {
+        Py_XDECREF(compiled_attr);
+        // Fallback: call Python model_dump
+        Py_DECREF(obj_dict);
+        return PyObject_CallMethod(model_self, "model_dump", NULL);
+    }
+
+    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(compiled_attr, "dhi.compiled_specs");
+    if (!ms) {
+        Py_DECREF(compiled_attr);
+        Py_DECREF(obj_dict);
+        return PyObject_CallMethod(model_self, "model_dump", NULL);
+    }
+
+    PyObject *result = _PyDict_NewPresized(ms->n_fields);
+    if (!result) { Py_DECREF(compiled_attr); Py_DECREF(obj_dict); return NULL; }
+
+    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
+        CompiledFieldSpec *fs = &ms->specs[i];
+        PyObject *value = PyDict_GetItem(obj_dict, fs->name_obj);
+        if (!value) continue;
+
+        if (value == Py_None || PyLong_Check(value) || PyFloat_Check(value) || PyUnicode_Check(value)) {
+            // Simple value - direct copy
+            PyDict_SetItem(result, fs->name_obj, value);
+        } else {
+            // Nested model or list of models - recurse
+            PyObject *dumped = dump_value_recursive(value);
+            if (!dumped) { Py_DECREF(result); Py_DECREF(compiled_attr); Py_DECREF(obj_dict); return NULL; }
+            PyDict_SetItem(result, fs->name_obj, dumped);
+            Py_DECREF(dumped);
+        }
+    }
+
+    // Extra fields (extra='allow') follow the declared ones
+    PyObject *extra = PyDict_GetItemString(obj_dict, "__pydantic_extra__");
+    if (extra && PyDict_Check(extra) && PyDict_GET_SIZE(extra) > 0 && PyDict_Update(result, extra) < 0) {
+        Py_DECREF(result); Py_DECREF(compiled_attr); Py_DECREF(obj_dict); return NULL;
+    }
+
+    Py_DECREF(compiled_attr);
+    Py_DECREF(obj_dict);
+    return result;
+}
+
+static PyObject* py_dump_model_compiled(PyObject* self_unused, PyObject* args) {
+    PyObject *model_self, *capsule;
+
+    if (!PyArg_ParseTuple(args, "OO", &model_self, &capsule)) {
+        return NULL;
+    }
+
+    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
+    if (!ms) return NULL;
+
+    // Use recursive dump that handles nested models
+    return dump_model_recursive(model_self);
+}
+
+// Options shared by every object of one dump_json_compiled call. Nested
+// models get the flags but not include/exclude, same as model_dump.
+typedef struct {
+    int by_alias, exclude_unset, exclude_none;
+    int compact;           // "," / ":" separators instead of ", " / ": "
+    PyObject *default_fn;  // borrowed; NULL = write str(value) for unknown types
+} DhiDumpOptions;
+
+// Item separator; the key fragments carry ": " and compact drops the space
+#define JSON_WRITE_SEP(w, opt) json_write_raw((w), ", ", (opt)->compact ? 1 : 2)
+
+static PyObject *g_dump_specs_key = NULL;
+static PyObject *g_dump_fields_set_key = NULL;
+static PyObject *g_dump_extra_key = NULL;
+
+static int json_write_value(DhiJsonWriter *w, PyObject *value, const DhiDumpOptions *opt);
+
+static int json_dump_keys_init(void) {
+    if (g_dump_specs_key) return 0;
+    g_dump_specs_key = PyUnicode_InternFromString("__dhi_dump_specs__");
+    g_dump_fields_set_key = PyUnicode_InternFromString("__pydantic_fields_set__");
+    g_dump_extra_key = PyUnicode_InternFromString("__pydantic_extra__");
+    return g_dump_specs_key && g_dump_fields_set_key && g_dump_extra_key ? 0 : -1;
+}
+
+// __dhi_dump_specs__ of a model class (borrowed): the capsule, Py_None for a
+// model the native writer can't cover, or NULL for anything else.
+// Model classes are heap types, which keeps builtins off the dict lookup.
+static inline PyObject* json_dump_specs_of(PyTypeObject *type) {
+    if (!PyType_HasFeature(type, Py_TPFLAGS_HEAPTYPE) || !type->tp_dict) return NULL;
+    return PyDict_GetItem(type->tp_dict, g_dump_specs_key);
+}
+
+// 1 = `key` passes the include/exclude masks, 0 = skip it, -1 = error
+static inline int json_mask_allows(PyObject *include, PyObject *exclude, PyObject *key) {
+    int r;
+    if (exclude && (r = PySequence_Contains(exclude, key)) != 0) return r < 0 ? -1 : 0;
+    if (include && (r = PySequence_Contains(include, key)) != 1) return r;
+    return 1;
+}
+
+// `, "key": value` (no leading separator for the first member)
+static int json_write_member(DhiJsonWriter *w, int *first, PyObject *key,
+                             PyObject *value, const DhiDumpOptions *opt) {
+    if (!*first && JSON_WRITE_SEP(w, opt) < 0) return -1;
+    *first = 0;
+    if (json_write_unicode(w, key) < 0) return -1;
+    if (json_write_raw(w, ": ", opt->compact ? 1 : 2) < 0) return -1;
+    Py_INCREF(value);  // default_fn may run arbitrary code on the way down
+    int r = json_write_value(w, value, opt);
+    Py_DECREF(value);
+    return r;
+}
+
+static int json_write_model(DhiJsonWriter *w, PyObject *obj, CompiledModelSpecs *ms,
+                            const DhiDumpOptions *opt, PyObject *include, PyObject *exclude) {
+    PyObject *obj_dict = PyObject_GenericGetDict(obj, NULL);
+    if (!obj_dict) return -1;
+    PyObject *fields_set = NULL;
+    if (opt->exclude_unset) {
+        fields_set = PyObject_GetAttr(obj, g_dump_fields_set_key);
+        if (!fields_set) goto error;
+    }
+    if (json_write_raw(w, "{", 1) < 0) goto error;
+
+    int first = 1;
+    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
+        CompiledFieldSpec *fs = &ms->specs[i];
+        if (include || exclude) {
+            int r = json_mask_allows(include, exclude, fs->name_obj);
+            if (r < 0) goto error;
+            if (!r) continue;
+        }
+        if (fields_set) {
+            int r = PySequence_Contains(fields_set, fs->name_obj);
+            if (r < 0) goto error;
+            if (!r) continue;
+        }
+        PyObject *value = PyDict_GetItem(obj_dict, fs->name_obj);
+        if (!value || (opt->exclude_none && value == Py_None)) continue;
+
+        // Pre-encoded key; the dump specs carry the by_alias key
+        // (serialization_alias > alias) as the alias variant
+        if (!first && JSON_WRITE_SEP(w, opt) < 0) goto error;
+        first = 0;
+        if (!fs->dump_keys_ascii && json_writer_to_utf8(w) < 0) goto error;
+        if (opt->by_alias ? json_write_raw(w, fs->dump_alias_key, fs->dump_alias_key_len - opt->compact) < 0
+                          : json_write_raw(w, fs->dump_key, fs->dump_key_len - opt->compact) < 0) goto error;
+        Py_INCREF(value);  // as in json_write_member
+        int r = json_write_value(w, value, opt);
+        Py_DECREF(value);
+        if (r < 0) goto error;
+    }
+
+    PyObject *extra = PyDict_GetItem(obj_dict, g_dump_extra_key);
+    if (extra && PyDict_Check(extra) && PyDict_GET_SIZE(extra) > 0) {
+        Py_INCREF(extra);
+        Py_ssize_t pos = 0;
+        PyObject *key, *value;
+        int r = 0;
+        while (r == 0 && PyDict_Next(extra, &pos, &key, &value)) {
+            if (opt->exclude_none && value == Py_None) continue;
+            if (!PyUnicode_Check(key)) {
+                PyErr_SetString(PyExc_TypeError, "dump_json_compiled: extra keys must be str");
+                r = -1;
+                break;
+            }
+            if (include || exclude) {
+                int allowed = json_mask_allows(include, exclude, key);
+                if (allowed <= 0) { r = allowed; continue; }
+            }
+            r = json_write_member(w, &first, key, value, opt);
+        }
+        Py_DECREF(extra);
+        if (r < 0) goto error;
+    }
+
+    if (json_write_raw(w, "}", 1) < 0) goto error;
+    Py_XDECREF(fields_set);
+    Py_DECREF(obj_dict);
+    return 0;
+
+error:
+    Py_XDECREF(fields_set);
+    Py_DECREF(obj_dict);
+    return -1;
+}
+
+static int json_write_sequence(DhiJsonWriter *w, PyObject *seq, const DhiDumpOptions *opt) {
+    if (json_write_raw(w, "[", 1) < 0) return -1;
+    int is_list = PyList_Check(seq);
+    // Re-read the size each step: default_fn may resize the list under us
+    for (Py_ssize_t i = 0; i < (is_list ? PyList_GET_SIZE(seq) : PyTuple_GET_SIZE(seq)); i++) {
+        if (i > 0 && JSON_WRITE_SEP(w, opt) < 0) return -1;
+        PyObject *item = is_list ? PyList_GET_ITEM(seq, i) : PyTuple_GET_ITEM(seq, i);
+        Py_INCREF(item);
+        int r = json_write_value(w, item, opt);
+        Py_DECREF(item);
+        if (r < 0) return -1;
+    }
+    return json_write_raw(w, "]", 1);
+}
+
+static int json_write_iterable(DhiJsonWriter *w, PyObject *iterable, const DhiDumpOptions *opt) {
+    PyObject *it = PyObject_GetIter(iterable);
+    if (!it) return -1;
+    if (json_write_raw(w, "[", 1) < 0) { Py_DECREF(it); return -1; }
+    PyObject *item;
+    int first = 1;
+    while ((item = PyIter_Next(it)) != NULL) {
+        int r = (!first && JSON_WRITE_SEP(w, opt) < 0) ? -1 : json_write_value(w, item, opt);
+        first = 0;
+        Py_DECREF(item);
+        if (r < 0) { Py_DECREF(it); return -1; }
+    }
+    Py_DECREF(it);
+    if (PyErr_Occurred()) return -1;
+    return json_write_raw(w, "]", 1);
+}
+
+static int json_write_dict(DhiJsonWriter *w, PyObject *dict, const DhiDumpOptions *opt) {
+    if (json_write_raw(w, "{", 1) < 0) return -1;
+    Py_ssize_t pos = 0;
+    PyObject *key, *value;
+    int first = 1;
+    while (PyDict_Next(dict, &pos, &key, &value)) {
+        // json.dumps would stringify int/float/bool keys; leave those to it
+        if (!PyUnicode_Check(key)) {
+            PyErr_SetString(PyExc_TypeError, "dump_json_compiled: dict keys must be str");
+            return -1;
+        }
+        if (json_write_member(w, &first, key, value, opt) < 0) return -1;
+    }
+    return json_write_raw(w, "}", 1);
+}
+
+static int json_write_value(DhiJsonWriter *w, PyObject *value, const DhiDumpOptions *opt) {
+    if (value == Py_None) return json_write_raw(w, "null", 4);
+    if (PyBool_Check(value)) {
+        return value == Py_True ? json_write_raw(w, "true", 4) : json_write_raw(w, "false", 5);
+    }
+    if (PyLong_Check(value)) {
+        int overflow;
+        long val = PyLong_AsLongAndOverflow(value, &overflow);
+        if (__builtin_expect(overflow != 0, 0)) {
+            // Beyond C long: Python's decimal repr is valid JSON as-is
+            PyObject *digits = PyLong_Type.tp_repr(value);
+            if (!digits) return -1;
+            int r = json_write_raw(w, (const char*)PyUnicode_DATA(digits),
+                                   (size_t)PyUnicode_GET_LENGTH(digits));
+            Py_DECREF(digits);
+            return r;
+        }
+        char num_buf[32];
+        int num_len = snprintf(num_buf, sizeof(num_buf), "%ld", val);
+        return json_write_raw(w, num_buf, num_len);
+    }
+    if (PyFloat_Check(value)) {
+        double val = PyFloat_AS_DOUBLE(value);
+        // JSON doesn't support Infinity / NaN
+        if (!isfinite(val)) return json_write_raw(w, "null", 4);
+        // Shortest round-trip repr, same digits as json.dumps
+        char *repr = PyOS_double_to_string(val, 'r', 0, Py_DTSF_ADD_DOT_0, NULL);
+        if (!repr) return -1;
+        int r = json_write_raw(w, repr, strlen(repr));
+        PyMem_Free(repr);
+        return r;
+    }
+    if (PyUnicode_Check(value)) return json_write_unicode(w, value);
+    if (PyBytes_Check(value)) {
+        // Raw bytes written as a (UTF-8) string
+        return json_write_string(w, PyBytes_AS_STRING(value),
+                                 (size_t)PyBytes_GET_SIZE(value), 0);
+    }
+
+    // Containers and models recurse; guard against self-referencing data
+    if (Py_EnterRecursiveCall(" while serializing to JSON")) return -1;
+    int r;
+    PyObject *specs;
+    if (PyList_Check(value) || PyTuple_Check(value)) {
+        r = json_write_sequence(w, value, opt);
+    } else if (PyDict_Check(value)) {
+        r = json_write_dict(w, value, opt);
+    } else if (PyAnySet_Check(value)) {
+        r = json_write_iterable(w, value, opt);
+    } else if ((specs = json_dump_specs_of(Py_TYPE(value))) != NULL && specs != Py_None) {
+        CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(specs, "dhi.compiled_specs");
+        r = ms ? json_write_model(w, value, ms, opt, NULL, NULL) : -1;
+    } else if (opt->default_fn) {
+        // Python hook: model_dump for models we can't cover, isoformat/str
+        // for leaf types. Its result is written like any other value.
+        PyObject *converted = PyObject_CallFunctionObjArgs(
+            opt->default_fn, value,
+            opt->by_alias ? Py_True : Py_False,
+            opt->exclude_unset ? Py_True : Py_False,
+            opt->exclude_none ? Py_True : Py_False, NULL);
+        r = converted ? json_write_value(w, converted, opt) : -1;
+        Py_XDECREF(converted);
+    } else {
+        // Fallback: use Python's str
+        PyObject *str_obj = PyObject_Str(value);
+        r = str_obj ? json_write_unicode(w, str_obj) : -1;
+        Py_XDECREF(str_obj);
+    }
+    Py_LeaveRecursiveCall();
+    return r;
+}
+
+// dump_json_compiled(obj, specs, include=None, exclude=None, by_alias=False,
+//                    exclude_unset=False, exclude_none=False, default=None,
+//                    compact=False) -> str
+// `specs` is the class's __dhi_dump_specs__; include/exclude are containers of
+// top-level names (None = no mask); `default(value, by_alias, exclude_unset,
+// exclude_none)` converts values that have no native encoding.
+static PyObject* py_dump_json_compiled(PyObject* self_unused, PyObject* args) {
+    PyObject *model_self, *capsule;
+    PyObject *include = Py_None, *exclude = Py_None, *default_fn = Py_None;
+    DhiDumpOptions opt = {0, 0, 0, 0, NULL};
+
+    if (!PyArg_ParseTuple(args, "OO|OOpppOp", &model_self, &capsule, &include, &exclude,
+                          &opt.by_alias, &opt.exclude_unset, &opt.exclude_none, &default_fn,
+                          &opt.compact)) {
+        return NULL;
+    }
+    if (default_fn != Py_None) opt.default_fn = default_fn;
+
+    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
+    if (!ms) return NULL;
+
+    if (json_dump_keys_init() < 0) return NULL;
+
+    // Size the buffer from what this class produced before, so the common
+    // case is one allocation and no resize until the final trim
+    size_t hint = __atomic_load_n(&ms->dump_size_hint, __ATOMIC_RELAXED);
+    DhiJsonWriter w;
+    if (json_writer_init(&w, hint ? hint : 64 + (size_t)ms->n_fields * 24) < 0) return NULL;
+
+    if (json_write_model(&w, model_self, ms, &opt,
+                         include != Py_None ? include : NULL,
+                         exclude != Py_None ? exclude : NULL) < 0) {
+        json_writer_discard(&w);
+        return NULL;
+    }
+
+    // Track the typical output size: grow immediately, shrink lazily, and
+    // skip the store (shared cache line) while the hint is in range
+    size_t want = w.pos + w.pos / 8 + 16;
+    if (want > hint || hint > 2 * want) {
+        __atomic_store_n(&ms->dump_size_hint, want, __ATOMIC_RELAXED);
+    }
+    return json_writer_finish(&w);
+}
+
+// =============================================================================
+// DhiStruct: HIGH-PERFORMANCE VALIDATED STRUCT (msgspec-like)
+// =============================================================================
+// Stores field values in a C array instead of Python __dict__.
+// This eliminates PyDict overhead and provides ~6x speedup over BaseModel.
+
+// Instance object - stores field values directly in C array.
+// MUST use PyObject_VAR_HEAD (not PyObject_HEAD): the type sets tp_itemsize, so
+// CPython treats instances as variable-sized and writes the item count into
+// ob_size at tp_alloc time. With a plain PyObject_HEAD, ob_size would alias
+// values[0], and populating field 0 would clobber it — corrupting Py_SIZE().
+// On CPython <=3.10 a heap subclass stores __dict__ at a negative offset computed
+// from Py_SIZE(obj), so a corrupted ob_size yields a wild __dict__ pointer and a
+// SIGBUS in GC at interpreter shutdown. VAR_HEAD gives ob_size its own slot ahead
+// of values[], so it stays = n_fields and the dict-offset math is correct.
+typedef struct {
+    PyObject_VAR_HEAD
+    PyObject *values[];  // Flexible array member - holds field values
+} DhiStructObject;
+
+// Forward declarations
+static PyTypeObject DhiStructType;
+static PyTypeObject DhiStructMetaType;
+
+// Recycled instances per class. Off under free-threading, where a shared
+// per-type list would need its own locking.
+#ifndef Py_GIL_DISABLED
+#define DHI_STRUCT_FREELIST_MAX 256
+#else
+#define DHI_STRUCT_FREELIST_MAX 0
+#endif
+
+// Metaclass of Struct subclasses (dhi.struct.StructMeta derives from it):
+// per-class data the alloc/init/decode paths need, kept in the type object
+// itself instead of being looked up in tp_dict on every instance.
+typedef struct {
+    PyHeapTypeObject ht;
+    PyObject *specs_capsule;   // strong ref; NULL until init_struct_class
+    CompiledModelSpecs *ms;
+    Py_ssize_t n_fields;
+    // Freed instances, linked through values[0]. Only used for layouts that
+    // PyObject_InitVar (+ PyObject_GC_Track) fully re-initializes: no
+    // __dict__/__weakref__ slots or pre-header, no finalizer.
+    int freelist_ok;
+    int n_free;
+    DhiStructObject *free_list;
+    int lazy_fields;           // fields served by lazy-aware getset descriptors
+} DhiStructMetaObject;
+
+static inline DhiStructMetaObject* DhiStruct_meta(PyTypeObject *type) {
+    if (!PyObject_TypeCheck((PyObject*)type, &DhiStructMetaType)) return NULL;
+    DhiStructMetaObject *meta = (DhiStructMetaObject*)type;
+    return meta->specs_capsule ? meta : NULL;
+}
+
+// Helper: Get field count from the metaclass slot, or type's tp_dict
+static Py_ssize_t DhiStruct_get_n_fields(PyTypeObject *type) {
+    DhiStructMetaObject *meta = DhiStruct_meta(type);
+    if (meta) return meta->n_fields;
+    PyObject *n_fields_obj = PyDict_GetItemString(type->tp_dict, "__dhi_n_fields__");
+    if (!n_fields_obj) return 0;
+    return PyLong_AsSsize_t(n_fields_obj);
+}
+
+// Allocate an instance with all values NULL, reusing a freed one if the
+// class has any. Every constructor and decoder goes through here.
+static DhiStructObject* DhiStruct_alloc(PyTypeObject *type, Py_ssize_t n_fields) {
+    DhiStructMetaObject *meta = DhiStruct_meta(type);
+    if (meta && meta->free_list) {
+        DhiStructObject *self = meta->free_list;
+        meta->free_list = (DhiStructObject*)self->values[0];
+        meta->n_free--;
+        memset(self->values, 0, sizeof(PyObject*) * (size_t)n_fields);
+        PyObject_InitVar((PyVarObject*)self, type, n_fields);
+        if (PyType_IS_GC(type)) PyObject_GC_Track(self);
+        return self;
+    }
+    return (DhiStructObject*)type->tp_alloc(type, n_fields);
+}
+
+// tp_new: Allocate object with space for field values
+static PyObject* DhiStruct_new(PyTypeObject *type, PyObject *args, PyObject *kwds) {
+    return (PyObject*)DhiStruct_alloc(type, DhiStruct_get_n_fields(type));
+}
+
+// tp_dealloc: Free the object (or park it on the class freelist). Heap
+// subclasses run through subtype_dealloc, which drops the type reference
+// after this returns.
+static void DhiStruct_dealloc(DhiStructObject *self) {
+    PyTypeObject *type = Py_TYPE(self);
+    Py_ssize_t n_fields = Py_SIZE(self);  // set by tp_alloc / PyObject_InitVar
+
+    // Decref all stored values
+    for (Py_ssize_t i = 0; i < n_fields; i++) {
+        Py_CLEAR(self->values[i]);
+    }
+
+    DhiStructMetaObject *meta = DhiStruct_meta(type);
+    if (meta && meta->freelist_ok && n_fields > 0 && meta->n_free < DHI_STRUCT_FREELIST_MAX) {
+        // subtype_dealloc has already untracked heap instances
+        if (PyType_IS_GC(type) && PyObject_GC_IsTracked((PyObject*)self)) {
+            PyObject_GC_UnTrack(self);
+        }
+        self->values[0] = (PyObject*)meta->free_list;
+        meta->free_list = self;
+        meta->n_free++;
+        return;
+    }
+    type->tp_free((PyObject*)self);
+}
+
+static int DhiStruct_fill(DhiStructObject *self, CompiledModelSpecs *ms, PyObject *kwargs,
+                          PyObject *const *row, Py_ssize_t nrow);
+
+// tp_init: Validate and store field values (THE HOT PATH)
+static int DhiStruct_init(DhiStructObject *self, PyObject *args, PyObject *kwargs) {
+    if (args && PyTuple_GET_SIZE(args) > 0) {
+        PyErr_SetString(PyExc_TypeError, "DhiStruct does not accept positional arguments");
+        return -1;
+    }
+
+    if (!kwargs) {
+        kwargs = PyDict_New();
+        if (!kwargs) return -1;
+        Py_DECREF(kwargs);
+        kwargs = NULL;
+    }
+
+    PyTypeObject *type = Py_TYPE(self);
+
+    // Get compiled specs from the metaclass slot, or type's tp_dict
+    DhiStructMetaObject *meta = DhiStruct_meta(type);
+    CompiledModelSpecs *ms = meta ? meta->ms : NULL;
+    if (!ms) {
+        PyObject *capsule = PyDict_GetItemString(type->tp_dict, "__dhi_compiled_specs__");
+        if (!capsule) {
+            PyErr_SetString(PyExc_RuntimeError, "DhiStruct type not properly initialized (missing specs)");
+            return -1;
+        }
+        ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
+        if (!ms) return -1;
+    }
+
+    // Get field indices dict for fast lookup
+    PyObject *field_indices = PyDict_GetItemString(type->tp_dict, "__dhi_field_indices__");
+    if (!field_indices) {
+        PyErr_SetString(PyExc_RuntimeError, "DhiStruct type not properly initialized (missing indices)");
+        return -1;
+    }
+
+    return DhiStruct_fill(self, ms, kwargs, NULL, 0);
+}
+
+// Validate and store field values. The first nrow fields take row[0..nrow)
+// positionally (from_row); the rest are looked up in kwargs, if any.
+static int DhiStruct_fill(DhiStructObject *self, CompiledModelSpecs *ms, PyObject *kwargs,
+                          PyObject *const *row, Py_ssize_t nrow) {
+    PyObject *errors = NULL;
+    DHI_STAT_TIMER(t0);
+    DHI_STAT_INC(ms, DHI_STAT_VALIDATIONS);
+
+    // ULTRA-FAST validation loop - no __dict__ operations!
+    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
+        CompiledFieldSpec *fs = &ms->specs[i];
+
+        // Extract value from the row or kwargs
+        PyObject *value = NULL;
+        if (i < nrow) {
+            value = row[i];
+        } else if (kwargs) {
+            if (fs->alias_obj != Py_None) {
+                value = PyDict_GetItem(kwargs, fs->alias_obj);
+            }
+            if (!value) {
+                value = _PyDict_GetItem_KnownHash(kwargs, fs->name_obj, fs->name_hash);
+            }
+        }
+
+        if (!value) {
+            if (!fs->required) {
+                // Use default value
+                Py_INCREF(fs->default_val);
+                self->values[i] = fs->default_val;
+                continue;
+            }
+            if (!errors) { errors = PyList_New(0); if (!errors) return -1; }
+            PyObject *err = Py_BuildValue("(Os)", fs->name_obj, "Field required");
+            PyList_Append(errors, err); Py_DECREF(err);
+            continue;
+        }
+
+        // --- TYPE CHECK + CONSTRAINTS (the field's validation plan) ---
+        PyObject *result;
+        int r = dhi_plan_run_collect(fs, 0, value, &result, &errors);
+        if (r < 0) { Py_XDECREF(errors); DHI_STAT_INC(ms, DHI_STAT_ERRORS); return -1; }
+        if (r == 0) continue;
+
+        // --- SUCCESS: Store directly in values array (NO __dict__!) ---
+        self->values[i] = result;  // owned ref from the plan
+    }
+    DHI_STAT_TIME(ms, t0);
+
+    // Check for errors
+    if (errors && PyList_GET_SIZE(errors) > 0) {
+        DHI_STAT_INC(ms, DHI_STAT_ERRORS);
+        // Raise ValidationError with all errors
+        PyObject *exc_args = Py_BuildValue("(sO)", "Validation failed", errors);
+        PyErr_SetObject(PyExc_ValueError, exc_args);
+        Py_DECREF(exc_args);
+        Py_DECREF(errors);
+        return -1;
+    }
+    Py_XDECREF(errors);
+
+    return 0;
+}
+
+// tp_repr: String representation. Lazily decoded fields that were never read
+// are shown as their raw JSON (see dhi_lazy_repr), so repr never decodes or raises.
+static int dhi_lazy_repr(PyObject *value, Py_ssize_t i, PyObject **out);
+
+static PyObject* DhiStruct_repr(DhiStructObject *self) {
+    PyTypeObject *type = Py_TYPE(self);
+    PyObject *field_names = PyDict_GetItemString(type->tp_dict, "__dhi_field_names__");
+    if (!field_names) {
+        return PyUnicode_FromFormat("<%s object>", type->tp_name);
+    }
+
+    Py_ssize_t n_fields = PyTuple_GET_SIZE(field_names);
+
+    // Build repr string
+    PyObject *parts = PyList_New(0);
+    if (!parts) return NULL;
+
+    for (Py_ssize_t i = 0; i < n_fields; i++) {
+        PyObject *name = PyTuple_GET_ITEM(field_names, i);
+        PyObject *value = self->values[i];
+        if (value) {
+            PyObject *value_repr = NULL;
+            Py_INCREF(value);
+            if (dhi_lazy_repr(value, i, &value_repr) == 0) value_repr = PyObject_Repr(value);
+            Py_DECREF(value);
+            if (!value_repr) { Py_DECREF(parts); return NULL; }
+            PyObject *part = PyUnicode_FromFormat("%S=%S", name, value_repr);
+            Py_DECREF(value_repr);
+            if (!part) { Py_DECREF(parts); return NULL; }
+            PyList_Append(parts, part);
+            Py_DECREF(part);
+        }
+    }
+
+    PyObject *sep = PyUnicode_FromString(", ");
+    PyObject *joined = PyUnicode_Join(sep, parts);
+    Py_DECREF(sep);
+    Py_DECREF(parts);
+
+    if (!joined) return NULL;
+
+    PyObject *result = PyUnicode_FromFormat("%s(%S)", type->tp_name, joined);
+    Py_DECREF(joined);
+    return result;
+}
+
+// Type object definition
+static PyTypeObject DhiStructType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "dhi._dhi_native.Struct",
+    .tp_doc = "High-performance validated struct (stores fields in C array, not __dict__)",
+    .tp_basicsize = sizeof(DhiStructObject),
+    .tp_itemsize = sizeof(PyObject*),  // For flexible array member
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_new = DhiStruct_new,
+    .tp_init = (initproc)DhiStruct_init,
+    .tp_dealloc = (destructor)DhiStruct_dealloc,
+    // Fields are member descriptors installed by init_struct_class, so plain
+    // generic lookup (and CPython's LOAD_ATTR_SLOT specialization) applies
+    .tp_getattro = PyObject_GenericGetAttr,
+    .tp_setattro = PyObject_GenericSetAttr,
+    .tp_repr = (reprfunc)DhiStruct_repr,
+};
 
-static void fast_construct_info_destructor(PyObject *capsule) {
-    FastConstructInfo *info = (FastConstructInfo*)PyCapsule_GetPointer(capsule, "dhi.fast_construct");
-    if (info) {
-        Py_XDECREF(info->specs_capsule);
-        Py_XDECREF(info->raiser);
-        free(info);
+static void DhiStructMeta_dealloc(DhiStructMetaObject *meta) {
+    while (meta->free_list) {
+        DhiStructObject *obj = meta->free_list;
+        meta->free_list = (DhiStructObject*)obj->values[0];
+        meta->ht.ht_type.tp_free((PyObject*)obj);
     }
+    meta->n_free = 0;
+    Py_CLEAR(meta->specs_capsule);
+    PyType_Type.tp_dealloc((PyObject*)meta);
 }
 
-static PyObject *g_fastinfo_key = NULL;  // interned "__dhi_fast_construct__"
+static PyTypeObject DhiStructMetaType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "dhi._dhi_native.StructMeta",
+    .tp_doc = "Metaclass base for Struct subclasses (holds per-class native data)",
+    .tp_basicsize = sizeof(DhiStructMetaObject),
+    // GC support (traverse/clear) is inherited from type
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_dealloc = (destructor)DhiStructMeta_dealloc,
+};
 
-// Fallback: route through the normal type_call path (metatype tp_call).
-static PyObject* dhi_vectorcall_fallback(PyObject *cls_obj, PyObject *const *args,
-                                         Py_ssize_t nargs, PyObject *kwnames) {
-    PyObject *args_tuple = PyTuple_New(nargs);
-    if (!args_tuple) return NULL;
-    for (Py_ssize_t i = 0; i < nargs; i++) {
-        Py_INCREF(args[i]);
-        PyTuple_SET_ITEM(args_tuple, i, args[i]);
+// Per-class descriptor definitions behind the field attributes: field i is
+// an object slot at a fixed offset into values[] (PyMemberDef), or - once the
+// class has been decoded lazily - a getset pair that parses a pending field
+// on first read. Descriptors point into the block, so a re-initialized class
+// keeps the previous block alive via `prev` for any descriptor still held
+// from before.
+typedef struct {
+    PyObject *prev;            // strong ref to the previous block's capsule, or NULL
+    PyMemberDef *members;      // n_fields entries + sentinel, or NULL
+    PyGetSetDef *getsets;      // likewise, for lazy-aware accessors
+    // the definitions follow, then the names
+} DhiMemberBlock;
+
+static PyObject* DhiStruct_lazy_get(PyObject *op, void *closure);
+static int DhiStruct_lazy_set(PyObject *op, PyObject *value, void *closure);
+
+static void dhi_member_block_destructor(PyObject *capsule) {
+    DhiMemberBlock *block = (DhiMemberBlock*)PyCapsule_GetPointer(capsule, "dhi.struct_members");
+    if (block) {
+        Py_XDECREF(block->prev);
+        PyMem_Free(block);
     }
-    PyObject *kw = NULL;
-    if (kwnames && PyTuple_GET_SIZE(kwnames) > 0) {
-        kw = PyDict_New();
-        if (!kw) { Py_DECREF(args_tuple); return NULL; }
-        Py_ssize_t nk = PyTuple_GET_SIZE(kwnames);
-        for (Py_ssize_t i = 0; i < nk; i++) {
-            if (PyDict_SetItem(kw, PyTuple_GET_ITEM(kwnames, i), args[nargs + i]) < 0) {
-                Py_DECREF(args_tuple); Py_DECREF(kw); return NULL;
+}
+
+// Install one descriptor per field on `type`: member descriptors, or the
+// lazy-aware getsets when `lazy` is set
+static int dhi_install_field_members(PyTypeObject *type, PyObject *field_names, int lazy) {
+    Py_ssize_t n = PyTuple_GET_SIZE(field_names);
+    size_t names_size = 0;
+    for (Py_ssize_t i = 0; i < n; i++) {
+        Py_ssize_t name_len;
+        if (!PyUnicode_AsUTF8AndSize(PyTuple_GET_ITEM(field_names, i), &name_len)) return -1;
+        names_size += (size_t)name_len + 1;
+    }
+    size_t def_size = lazy ? sizeof(PyGetSetDef) : sizeof(PyMemberDef);
+    size_t defs_size = sizeof(DhiMemberBlock) + (size_t)(n + 1) * def_size;
+    DhiMemberBlock *block = (DhiMemberBlock*)PyMem_Calloc(1, defs_size + names_size);
+    if (!block) { PyErr_NoMemory(); return -1; }
+    if (lazy) block->getsets = (PyGetSetDef*)(block + 1);
+    else block->members = (PyMemberDef*)(block + 1);
+
+    char *names = (char*)block + defs_size;
+    for (Py_ssize_t i = 0; i < n; i++) {
+        Py_ssize_t name_len;
+        const char *name = PyUnicode_AsUTF8AndSize(PyTuple_GET_ITEM(field_names, i), &name_len);
+        memcpy(names, name, (size_t)name_len + 1);
+        if (lazy) {
+            block->getsets[i].name = names;
+            block->getsets[i].get = DhiStruct_lazy_get;
+            block->getsets[i].set = DhiStruct_lazy_set;
+            block->getsets[i].closure = (void*)(intptr_t)i;
+        } else {
+            block->members[i].name = names;
+            block->members[i].type = Py_T_OBJECT_EX;
+            block->members[i].offset = (Py_ssize_t)(offsetof(DhiStructObject, values)
+                                                    + (size_t)i * sizeof(PyObject*));
+        }
+        names += name_len + 1;
+    }
+
+    PyObject *capsule = PyCapsule_New(block, "dhi.struct_members", dhi_member_block_destructor);
+    if (!capsule) { PyMem_Free(block); return -1; }
+    block->prev = PyDict_GetItemString(type->tp_dict, "__dhi_members__");
+    Py_XINCREF(block->prev);
+    int r = PyDict_SetItemString(type->tp_dict, "__dhi_members__", capsule);
+    Py_DECREF(capsule);
+    if (r < 0) return -1;
+
+    // setattr (not a raw tp_dict write) so the type's attribute cache is invalidated
+    for (Py_ssize_t i = 0; i < n; i++) {
+        PyObject *descr = lazy ? PyDescr_NewGetSet(type, &block->getsets[i])
+                               : PyDescr_NewMember(type, &block->members[i]);
+        if (!descr) return -1;
+        r = PyObject_SetAttr((PyObject*)type, PyTuple_GET_ITEM(field_names, i), descr);
+        Py_DECREF(descr);
+        if (r < 0) return -1;
+    }
+    return 0;
+}
+
+// Helper function to initialize a Struct subclass
+// Called from Python: _dhi_native.init_struct_class(cls, field_specs_tuple)
+static PyObject* py_init_struct_class(PyObject *self, PyObject *args) {
+    PyObject *cls;
+    PyObject *field_specs;
+
+    if (!PyArg_ParseTuple(args, "OO!", &cls, &PyTuple_Type, &field_specs)) {
+        return NULL;
+    }
+
+    if (!PyType_Check(cls)) {
+        PyErr_SetString(PyExc_TypeError, "First argument must be a class");
+        return NULL;
+    }
+
+    PyTypeObject *type = (PyTypeObject*)cls;
+
+    // Compile specs - need to wrap field_specs in a tuple for py_compile_model_specs
+    // (named after the class for stats())
+    PyObject *qualname = PyObject_GetAttrString(cls, "__qualname__");
+    if (!qualname) return NULL;
+    PyObject *specs_args = PyTuple_Pack(2, field_specs, qualname);
+    Py_DECREF(qualname);
+    if (!specs_args) return NULL;
+    PyObject *capsule = py_compile_model_specs(self, specs_args);
+    Py_DECREF(specs_args);
+    if (!capsule) return NULL;
+
+    // Build field names tuple and indices dict
+    Py_ssize_t n_fields = PyTuple_GET_SIZE(field_specs);
+    PyObject *field_names = PyTuple_New(n_fields);
+    PyObject *field_indices = PyDict_New();
+
+    if (!field_names || !field_indices) {
+        Py_XDECREF(field_names);
+        Py_XDECREF(field_indices);
+        Py_DECREF(capsule);
+        return NULL;
+    }
+
+    for (Py_ssize_t i = 0; i < n_fields; i++) {
+        PyObject *spec = PyTuple_GET_ITEM(field_specs, i);
+        PyObject *name = PyTuple_GET_ITEM(spec, 0);
+        Py_INCREF(name);
+        PyTuple_SET_ITEM(field_names, i, name);
+
+        PyObject *index = PyLong_FromSsize_t(i);
+        PyDict_SetItem(field_indices, name, index);
+        Py_DECREF(index);
+    }
+
+    // Store metadata in type's dict
+    // The compiled specs borrow from field_specs (defaults, model type tuples),
+    // so the class keeps the specs tuple alive as well.
+    PyDict_SetItemString(type->tp_dict, "__dhi_field_specs__", field_specs);
+    PyDict_SetItemString(type->tp_dict, "__dhi_compiled_specs__", capsule);
+    PyDict_SetItemString(type->tp_dict, "__dhi_field_names__", field_names);
+    PyDict_SetItemString(type->tp_dict, "__dhi_field_indices__", field_indices);
+    PyObject *n_fields_obj = PyLong_FromSsize_t(n_fields);
+    if (n_fields_obj) {
+        PyDict_SetItemString(type->tp_dict, "__dhi_n_fields__", n_fields_obj);
+        Py_DECREF(n_fields_obj);
+    }
+
+    if (dhi_install_field_members(type, field_names, 0) < 0) {
+        Py_DECREF(capsule);
+        Py_DECREF(field_names);
+        Py_DECREF(field_indices);
+        return NULL;
+    }
+
+    DhiStructMetaObject *meta = PyObject_TypeCheck(cls, &DhiStructMetaType)
+        ? (DhiStructMetaObject*)cls : NULL;
+    if (meta) {
+        // Re-initialization (model rebuild) swaps specs: drop instances
+        // sized for the old ones
+        while (meta->free_list) {
+            DhiStructObject *obj = meta->free_list;
+            meta->free_list = (DhiStructObject*)obj->values[0];
+            type->tp_free((PyObject*)obj);
+        }
+        meta->n_free = 0;
+        Py_INCREF(capsule);
+        Py_XSETREF(meta->specs_capsule, capsule);
+        meta->ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
+        meta->n_fields = n_fields;
+        meta->lazy_fields = 0;
+        meta->freelist_ok = DHI_STRUCT_FREELIST_MAX > 0
+            && type->tp_dictoffset == 0 && type->tp_weaklistoffset == 0
+#ifdef Py_TPFLAGS_PREHEADER
+            && !PyType_HasFeature(type, Py_TPFLAGS_PREHEADER)
+#endif
+            && type->tp_finalize == NULL && type->tp_del == NULL
+            && type->tp_alloc == PyType_GenericAlloc
+            && type->tp_free == (PyType_IS_GC(type) ? PyObject_GC_Del : PyObject_Free);
+    }
+
+    Py_DECREF(capsule);
+    Py_DECREF(field_names);
+    Py_DECREF(field_indices);
+
+    Py_RETURN_NONE;
+}
+
+// =============================================================================
+// FAST JSON PARSER - Direct JSON -> Struct without intermediate dict
+// Uses Zig SIMD backend for maximum performance
+// =============================================================================
+
+// Skip whitespace using SIMD (via Zig)
+#define SKIP_WS_SIMD(json, pos, len) \
+    (pos) = dhi_skip_whitespace((json), (len), (pos))
+
+// Fallback for simple cases
+#define SKIP_WS(json, pos, len) \
+    while ((pos) < (len) && ((json)[(pos)] == ' ' || (json)[(pos)] == '\t' || \
+           (json)[(pos)] == '\n' || (json)[(pos)] == '\r')) { (pos)++; }
+
+// Hybrid string parsing - inline for small strings, SIMD for larger ones
+// Returns pointer to string content and updates pos
+// Returns NULL on error
+__attribute__((always_inline))
+static inline char* json_parse_string_simd(const char *json, size_t *pos, size_t len,
+                                size_t *out_len, int *needs_unescape) {
+    size_t start = *pos;
+    if (start >= len || json[start] != '"') return NULL;
+    start++;
+
+    // For strings < 64 bytes, use inline C (avoid FFI overhead)
+    // Most field names and short values fall into this category
+    size_t end = start;
+    *needs_unescape = 0;
+
+    // Quick scan - if we find the closing quote within 64 bytes, use inline
+    while (end < len && end - start < 64) {
+        char c = json[end];
+        if (c == '"') {
+            // Found end - use inline result
+            *out_len = end - start;
+            *pos = end + 1;
+            return (char*)&json[start];
+        }
+        if (c == '\\') {
+            *needs_unescape = 1;
+            end += 2;
+        } else {
+            end++;
+        }
+    }
+
+    // Long string (>64 bytes) or didn't find quote yet - use SIMD
+    const char *str_ptr;
+    size_t str_len;
+    int has_escapes;
+    size_t simd_end;
+
+    int result = dhi_extract_json_string(json, len, start, &str_ptr, &str_len, &has_escapes, &simd_end);
+    if (result != 0) return NULL;
+
+    *out_len = str_len;
+    *needs_unescape = has_escapes;
+    *pos = simd_end;
+    return (char*)str_ptr;
+}
+
+// Legacy C version for fallback
+__attribute__((always_inline, unused))
+static inline char* json_parse_string(const char *json, size_t *pos, size_t len,
+                                size_t *out_len, int *needs_unescape) {
+    size_t start = *pos;
+    if (json[start] != '"') return NULL;
+    start++;
+
+    size_t end = start;
+    *needs_unescape = 0;
+
+    while (end < len) {
+        char c = json[end];
+        if (c == '"') {
+            *out_len = end - start;
+            *pos = end + 1;
+            return (char*)&json[start];
+        }
+        if (c == '\\') {
+            *needs_unescape = 1;
+            end += 2;  // Skip escape sequence
+        } else {
+            end++;
+        }
+    }
+    return NULL;  // Unterminated string
+}
+
+// Hex value of the 4 digits at s, or -1
+static inline long json_hex4(const char *s) {
+    long v = 0;
+    for (int j = 0; j < 4; j++) {
+        char h = s[j];
+        v <<= 4;
+        if (h >= '0' && h <= '9') v |= h - '0';
+        else if (h >= 'a' && h <= 'f') v |= h - 'a' + 10;
+        else if (h >= 'A' && h <= 'F') v |= h - 'A' + 10;
+        else return -1;
+    }
+    return v;
+}
+
+// Unescape JSON string into buffer. A \uD8xx\uDCxx surrogate pair becomes one
+// code point; a lone surrogate escape is kept as that code point, as json.loads does.
+static PyObject* json_unescape_string(const char *str, size_t len) {
+    char *buf = malloc(len + 1);
+    if (!buf) return PyErr_NoMemory();
+
+    size_t out = 0;
+    int lone_surrogate = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (str[i] == '\\' && i + 1 < len) {
+            i++;
+            switch (str[i]) {
+                case '"': buf[out++] = '"'; break;
+                case '\\': buf[out++] = '\\'; break;
+                case '/': buf[out++] = '/'; break;
+                case 'b': buf[out++] = '\b'; break;
+                case 'f': buf[out++] = '\f'; break;
+                case 'n': buf[out++] = '\n'; break;
+                case 'r': buf[out++] = '\r'; break;
+                case 't': buf[out++] = '\t'; break;
+                case 'u': {
+                    // Parse 4 hex digits
+                    if (i + 4 < len) {
+                        unsigned int codepoint = 0;
+                        for (int j = 1; j <= 4; j++) {
+                            char h = str[i + j];
+                            codepoint <<= 4;
+                            if (h >= '0' && h <= '9') codepoint |= h - '0';
+                            else if (h >= 'a' && h <= 'f') codepoint |= h - 'a' + 10;
+                            else if (h >= 'A' && h <= 'F') codepoint |= h - 'A' + 10;
+                        }
+                        i += 4;
+                        // A \uD8xx\uDCxx surrogate pair is one code point
+                        if (codepoint >= 0xD800 && codepoint < 0xDC00 && i + 6 < len &&
+                            str[i + 1] == '\\' && str[i + 2] == 'u') {
+                            long low = json_hex4(str + i + 3);
+                            if (low >= 0xDC00 && low < 0xE000) {
+                                codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (unsigned)(low - 0xDC00);
+                                i += 6;
+                            }
+                        }
+                        if (codepoint >= 0xD800 && codepoint < 0xE000) lone_surrogate = 1;
+                        // UTF-8 encode
+                        if (codepoint < 0x80) {
+                            buf[out++] = (char)codepoint;
+                        } else if (codepoint < 0x800) {
+                            buf[out++] = (char)(0xC0 | (codepoint >> 6));
+                            buf[out++] = (char)(0x80 | (codepoint & 0x3F));
+                        } else if (codepoint < 0x10000) {
+                            buf[out++] = (char)(0xE0 | (codepoint >> 12));
+                            buf[out++] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+                            buf[out++] = (char)(0x80 | (codepoint & 0x3F));
+                        } else {
+                            buf[out++] = (char)(0xF0 | (codepoint >> 18));
+                            buf[out++] = (char)(0x80 | ((codepoint >> 12) & 0x3F));
+                            buf[out++] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+                            buf[out++] = (char)(0x80 | (codepoint & 0x3F));
+                        }
+                    }
+                    break;
+                }
+                default: buf[out++] = str[i]; break;
             }
+        } else {
+            buf[out++] = str[i];
         }
     }
-    // tp_call of the metatype is type_call for classes; always non-NULL.
-    PyObject *result = Py_TYPE(cls_obj)->tp_call(cls_obj, args_tuple, kw);
-    Py_DECREF(args_tuple);
-    Py_XDECREF(kw);
+    buf[out] = '\0';
+
+    // Only escapes may produce surrogates; raw input bytes stay strict UTF-8
+    // unless the string also holds a lone surrogate escape.
+    PyObject *result = PyUnicode_DecodeUTF8(buf, out, lone_surrogate ? "surrogatepass" : NULL);
+    free(buf);
     return result;
 }
 
-static PyObject* dhi_model_vectorcall(PyObject *cls_obj, PyObject *const *args,
-                                      size_t nargsf, PyObject *kwnames) {
-    PyTypeObject *cls = (PyTypeObject*)cls_obj;
-    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+// Parse JSON integer
+__attribute__((unused))
+static int json_parse_integer(const char *json, size_t *pos, size_t len, long *out) {
+    size_t start = *pos;
+    int negative = 0;
 
-    // Look up the per-class fast-construct info in the type's own dict.
-    PyObject *info_capsule = g_fastinfo_key
-        ? PyDict_GetItemWithError(cls->tp_dict, g_fastinfo_key)
-        : NULL;
-    if (!info_capsule) {
-        if (PyErr_Occurred()) return NULL;
-        // Shouldn't normally happen; fall back to the regular call path.
-        return dhi_vectorcall_fallback(cls_obj, args, nargs, kwnames);
+    if (start < len && json[start] == '-') {
+        negative = 1;
+        start++;
     }
-    FastConstructInfo *info = (FastConstructInfo*)PyCapsule_GetPointer(info_capsule, "dhi.fast_construct");
-    if (!info) return NULL;
 
-    if (nargs > 0) {
-        PyErr_Format(PyExc_TypeError,
-                     "%.200s() takes no positional arguments", cls->tp_name);
-        return NULL;
+    if (start >= len || json[start] < '0' || json[start] > '9') return 0;
+
+    long value = 0;
+    while (start < len && json[start] >= '0' && json[start] <= '9') {
+        value = value * 10 + (json[start] - '0');
+        start++;
     }
 
-    PyObject *self = cls->tp_alloc(cls, 0);
-    if (!self) return NULL;
+    *out = negative ? -value : value;
+    *pos = start;
+    return 1;
+}
 
-    PyObject *result = init_model_core(self, info->ms, info->extra_mode,
-                                       NULL, args, kwnames);
-    if (!result) { Py_DECREF(self); return NULL; }
-    if (result == Py_None) {
-        Py_DECREF(result);
-        return self;
-    }
+// ============================================================================
+// Number parsing
+// ============================================================================
+// Numbers are scanned once: up to 19 significant digits accumulate into a
+// uint64 mantissa and everything else only moves the decimal exponent. Floats
+// are then built straight from (mantissa, exponent) - Clinger's exact path
+// when both fit a double, Eisel-Lemire otherwise - with no copy and no strtod.
+// The rare inputs Eisel-Lemire can't decide (truncated mantissas sitting on a
+// rounding boundary, subnormals) fall back to the Zig parser.
+
+#define DHI_POW5_MIN (-342)
+#define DHI_POW5_MAX 308
+// CPython's default int/str conversion limit (sys.get_int_max_str_digits)
+#define DHI_MAX_INT_DIGITS 4300
+
+// 5^q normalized to 128 bits and rounded down, as {high, low}, q = -342..308
+static const uint64_t dhi_pow5_128[DHI_POW5_MAX - DHI_POW5_MIN + 1][2] = {
+    {0xEEF453D6923BD65AULL, 0x113FAA2906A13B3FULL},
+    {0x9558B4661B6565F8ULL, 0x4AC7CA59A424C507ULL},
+    {0xBAAEE17FA23EBF76ULL, 0x5D79BCF00D2DF649ULL},
+    {0xE95A99DF8ACE6F53ULL, 0xF4D82C2C107973DCULL},
+    {0x91D8A02BB6C10594ULL, 0x79071B9B8A4BE869ULL},
+    {0xB64EC836A47146F9ULL, 0x9748E2826CDEE284ULL},
+    {0xE3E27A444D8D98B7ULL, 0xFD1B1B2308169B25ULL},
+    {0x8E6D8C6AB0787F72ULL, 0xFE30F0F5E50E20F7ULL},
+    {0xB208EF855C969F4FULL, 0xBDBD2D335E51A935ULL},
+    {0xDE8B2B66B3BC4723ULL, 0xAD2C788035E61382ULL},
+    {0x8B16FB203055AC76ULL, 0x4C3BCB5021AFCC31ULL},
+    {0xADDCB9E83C6B1793ULL, 0xDF4ABE242A1BBF3DULL},
+    {0xD953E8624B85DD78ULL, 0xD71D6DAD34A2AF0DULL},
+    {0x87D4713D6F33AA6BULL, 0x8672648C40E5AD68ULL},
+    {0xA9C98D8CCB009506ULL, 0x680EFDAF511F18C2ULL},
+    {0xD43BF0EFFDC0BA48ULL, 0x0212BD1B2566DEF2ULL},
+    {0x84A57695FE98746DULL, 0x014BB630F7604B57ULL},
+    {0xA5CED43B7E3E9188ULL, 0x419EA3BD35385E2DULL},
+    {0xCF42894A5DCE35EAULL, 0x52064CAC828675B9ULL},
+    {0x818995CE7AA0E1B2ULL, 0x7343EFEBD1940993ULL},
+    {0xA1EBFB4219491A1FULL, 0x1014EBE6C5F90BF8ULL},
+    {0xCA66FA129F9B60A6ULL, 0xD41A26E077774EF6ULL},
+    {0xFD00B897478238D0ULL, 0x8920B098955522B4ULL},
+    {0x9E20735E8CB16382ULL, 0x55B46E5F5D5535B0ULL},
+    {0xC5A890362FDDBC62ULL, 0xEB2189F734AA831DULL},
+    {0xF712B443BBD52B7BULL, 0xA5E9EC7501D523E4ULL},
+    {0x9A6BB0AA55653B2DULL, 0x47B233C92125366EULL},
+    {0xC1069CD4EABE89F8ULL, 0x999EC0BB696E840AULL},
+    {0xF148440A256E2C76ULL, 0xC00670EA43CA250DULL},
+    {0x96CD2A865764DBCAULL, 0x380406926A5E5728ULL},
+    {0xBC807527ED3E12BCULL, 0xC605083704F5ECF2ULL},
+    {0xEBA09271E88D976BULL, 0xF7864A44C633682EULL},
+    {0x93445B8731587EA3ULL, 0x7AB3EE6AFBE0211DULL},
+    {0xB8157268FDAE9E4CULL, 0x5960EA05BAD82964ULL},
+    {0xE61ACF033D1A45DFULL, 0x6FB92487298E33BDULL},
+    {0x8FD0C16206306BABULL, 0xA5D3B6D479F8E056ULL},
+    {0xB3C4F1BA87BC8696ULL, 0x8F48A4899877186CULL},
+    {0xE0B62E2929ABA83CULL, 0x331ACDABFE94DE87ULL},
+    {0x8C71DCD9BA0B4925ULL, 0x9FF0C08B7F1D0B14ULL},
+    {0xAF8E5410288E1B6FULL, 0x07ECF0AE5EE44DD9ULL},
+    {0xDB71E91432B1A24AULL, 0xC9E82CD9F69D6150ULL},
+    {0x892731AC9FAF056EULL, 0xBE311C083A225CD2ULL},
+    {0xAB70FE17C79AC6CAULL, 0x6DBD630A48AAF406ULL},
+    {0xD64D3D9DB981787DULL, 0x092CBBCCDAD5B108ULL},
+    {0x85F0468293F0EB4EULL, 0x25BBF56008C58EA5ULL},
+    {0xA76C582338ED2621ULL, 0xAF2AF2B80AF6F24EULL},
+    {0xD1476E2C07286FAAULL, 0x1AF5AF660DB4AEE1ULL},
+    {0x82CCA4DB847945CAULL, 0x50D98D9FC890ED4DULL},
+    {0xA37FCE126597973CULL, 0xE50FF107BAB528A0ULL},
+    {0xCC5FC196FEFD7D0CULL, 0x1E53ED49A96272C8ULL},
+    {0xFF77B1FCBEBCDC4FULL, 0x25E8E89C13BB0F7AULL},
+    {0x9FAACF3DF73609B1ULL, 0x77B191618C54E9ACULL},
+    {0xC795830D75038C1DULL, 0xD59DF5B9EF6A2417ULL},
+    {0xF97AE3D0D2446F25ULL, 0x4B0573286B44AD1DULL},
+    {0x9BECCE62836AC577ULL, 0x4EE367F9430AEC32ULL},
+    {0xC2E801FB244576D5ULL, 0x229C41F793CDA73FULL},
+    {0xF3A20279ED56D48AULL, 0x6B43527578C1110FULL},
+    {0x9845418C345644D6ULL, 0x830A13896B78AAA9ULL},
+    {0xBE5691EF416BD60CULL, 0x23CC986BC656D553ULL},
+    {0xEDEC366B11C6CB8FULL, 0x2CBFBE86B7EC8AA8ULL},
+    {0x94B3A202EB1C3F39ULL, 0x7BF7D71432F3D6A9ULL},
+    {0xB9E08A83A5E34F07ULL, 0xDAF5CCD93FB0CC53ULL},
+    {0xE858AD248F5C22C9ULL, 0xD1B3400F8F9CFF68ULL},
+    {0x91376C36D99995BEULL, 0x23100809B9C21FA1ULL},
+    {0xB58547448FFFFB2DULL, 0xABD40A0C2832A78AULL},
+    {0xE2E69915B3FFF9F9ULL, 0x16C90C8F323F516CULL},
+    {0x8DD01FAD907FFC3BULL, 0xAE3DA7D97F6792E3ULL},
+    {0xB1442798F49FFB4AULL, 0x99CD11CFDF41779CULL},
+    {0xDD95317F31C7FA1DULL, 0x40405643D711D583ULL},
+    {0x8A7D3EEF7F1CFC52ULL, 0x482835EA666B2572ULL},
+    {0xAD1C8EAB5EE43B66ULL, 0xDA3243650005EECFULL},
+    {0xD863B256369D4A40ULL, 0x90BED43E40076A82ULL},
+    {0x873E4F75E2224E68ULL, 0x5A7744A6E804A291ULL},
+    {0xA90DE3535AAAE202ULL, 0x711515D0A205CB36ULL},
+    {0xD3515C2831559A83ULL, 0x0D5A5B44CA873E03ULL},
+    {0x8412D9991ED58091ULL, 0xE858790AFE9486C2ULL},
+    {0xA5178FFF668AE0B6ULL, 0x626E974DBE39A872ULL},
+    {0xCE5D73FF402D98E3ULL, 0xFB0A3D212DC8128FULL},
+    {0x80FA687F881C7F8EULL, 0x7CE66634BC9D0B99ULL},
+    {0xA139029F6A239F72ULL, 0x1C1FFFC1EBC44E80ULL},
+    {0xC987434744AC874EULL, 0xA327FFB266B56220ULL},
+    {0xFBE9141915D7A922ULL, 0x4BF1FF9F0062BAA8ULL},
+    {0x9D71AC8FADA6C9B5ULL, 0x6F773FC3603DB4A9ULL},
+    {0xC4CE17B399107C22ULL, 0xCB550FB4384D21D3ULL},
+    {0xF6019DA07F549B2BULL, 0x7E2A53A146606A48ULL},
+    {0x99C102844F94E0FBULL, 0x2EDA7444CBFC426DULL},
+    {0xC0314325637A1939ULL, 0xFA911155FEFB5308ULL},
+    {0xF03D93EEBC589F88ULL, 0x793555AB7EBA27CAULL},
+    {0x96267C7535B763B5ULL, 0x4BC1558B2F3458DEULL},
+    {0xBBB01B9283253CA2ULL, 0x9EB1AAEDFB016F16ULL},
+    {0xEA9C227723EE8BCBULL, 0x465E15A979C1CADCULL},
+    {0x92A1958A7675175FULL, 0x0BFACD89EC191EC9ULL},
+    {0xB749FAED14125D36ULL, 0xCEF980EC671F667BULL},
+    {0xE51C79A85916F484ULL, 0x82B7E12780E7401AULL},
+    {0x8F31CC0937AE58D2ULL, 0xD1B2ECB8B0908810ULL},
+    {0xB2FE3F0B8599EF07ULL, 0x861FA7E6DCB4AA15ULL},
+    {0xDFBDCECE67006AC9ULL, 0x67A791E093E1D49AULL},
+    {0x8BD6A141006042BDULL, 0xE0C8BB2C5C6D24E0ULL},
+    {0xAECC49914078536DULL, 0x58FAE9F773886E18ULL},
+    {0xDA7F5BF590966848ULL, 0xAF39A475506A899EULL},
+    {0x888F99797A5E012DULL, 0x6D8406C952429603ULL},
+    {0xAAB37FD7D8F58178ULL, 0xC8E5087BA6D33B83ULL},
+    {0xD5605FCDCF32E1D6ULL, 0xFB1E4A9A90880A64ULL},
+    {0x855C3BE0A17FCD26ULL, 0x5CF2EEA09A55067FULL},
+    {0xA6B34AD8C9DFC06FULL, 0xF42FAA48C0EA481EULL},
+    {0xD0601D8EFC57B08BULL, 0xF13B94DAF124DA26ULL},
+    {0x823C12795DB6CE57ULL, 0x76C53D08D6B70858ULL},
+    {0xA2CB1717B52481EDULL, 0x54768C4B0C64CA6EULL},
+    {0xCB7DDCDDA26DA268ULL, 0xA9942F5DCF7DFD09ULL},
+    {0xFE5D54150B090B02ULL, 0xD3F93B35435D7C4CULL},
+    {0x9EFA548D26E5A6E1ULL, 0xC47BC5014A1A6DAFULL},
+    {0xC6B8E9B0709F109AULL, 0x359AB6419CA1091BULL},
+    {0xF867241C8CC6D4C0ULL, 0xC30163D203C94B62ULL},
+    {0x9B407691D7FC44F8ULL, 0x79E0DE63425DCF1DULL},
+    {0xC21094364DFB5636ULL, 0x985915FC12F542E4ULL},
+    {0xF294B943E17A2BC4ULL, 0x3E6F5B7B17B2939DULL},
+    {0x979CF3CA6CEC5B5AULL, 0xA705992CEECF9C42ULL},
+    {0xBD8430BD08277231ULL, 0x50C6FF782A838353ULL},
+    {0xECE53CEC4A314EBDULL, 0xA4F8BF5635246428ULL},
+    {0x940F4613AE5ED136ULL, 0x871B7795E136BE99ULL},
+    {0xB913179899F68584ULL, 0x28E2557B59846E3FULL},
+    {0xE757DD7EC07426E5ULL, 0x331AEADA2FE589CFULL},
+    {0x9096EA6F3848984FULL, 0x3FF0D2C85DEF7621ULL},
+    {0xB4BCA50B065ABE63ULL, 0x0FED077A756B53A9ULL},
+    {0xE1EBCE4DC7F16DFBULL, 0xD3E8495912C62894ULL},
+    {0x8D3360F09CF6E4BDULL, 0x64712DD7ABBBD95CULL},
+    {0xB080392CC4349DECULL, 0xBD8D794D96AACFB3ULL},
+    {0xDCA04777F541C567ULL, 0xECF0D7A0FC5583A0ULL},
+    {0x89E42CAAF9491B60ULL, 0xF41686C49DB57244ULL},
+    {0xAC5D37D5B79B6239ULL, 0x311C2875C522CED5ULL},
+    {0xD77485CB25823AC7ULL, 0x7D633293366B828BULL},
+    {0x86A8D39EF77164BCULL, 0xAE5DFF9C02033197ULL},
+    {0xA8530886B54DBDEBULL, 0xD9F57F830283FDFCULL},
+    {0xD267CAA862A12D66ULL, 0xD072DF63C324FD7BULL},
+    {0x8380DEA93DA4BC60ULL, 0x4247CB9E59F71E6DULL},
+    {0xA46116538D0DEB78ULL, 0x52D9BE85F074E608ULL},
+    {0xCD795BE870516656ULL, 0x67902E276C921F8BULL},
+    {0x806BD9714632DFF6ULL, 0x00BA1CD8A3DB53B6ULL},
+    {0xA086CFCD97BF97F3ULL, 0x80E8A40ECCD228A4ULL},
+    {0xC8A883C0FDAF7DF0ULL, 0x6122CD128006B2CDULL},
+    {0xFAD2A4B13D1B5D6CULL, 0x796B805720085F81ULL},
+    {0x9CC3A6EEC6311A63ULL, 0xCBE3303674053BB0ULL},
+    {0xC3F490AA77BD60FCULL, 0xBEDBFC4411068A9CULL},
+    {0xF4F1B4D515ACB93BULL, 0xEE92FB5515482D44ULL},
+    {0x991711052D8BF3C5ULL, 0x751BDD152D4D1C4AULL},
+    {0xBF5CD54678EEF0B6ULL, 0xD262D45A78A0635DULL},
+    {0xEF340A98172AACE4ULL, 0x86FB897116C87C34ULL},
+    {0x9580869F0E7AAC0EULL, 0xD45D35E6AE3D4DA0ULL},
+    {0xBAE0A846D2195712ULL, 0x8974836059CCA109ULL},
+    {0xE998D258869FACD7ULL, 0x2BD1A438703FC94BULL},
+    {0x91FF83775423CC06ULL, 0x7B6306A34627DDCFULL},
+    {0xB67F6455292CBF08ULL, 0x1A3BC84C17B1D542ULL},
+    {0xE41F3D6A7377EECAULL, 0x20CABA5F1D9E4A93ULL},
+    {0x8E938662882AF53EULL, 0x547EB47B7282EE9CULL},
+    {0xB23867FB2A35B28DULL, 0xE99E619A4F23AA43ULL},
+    {0xDEC681F9F4C31F31ULL, 0x6405FA00E2EC94D4ULL},
+    {0x8B3C113C38F9F37EULL, 0xDE83BC408DD3DD04ULL},
+    {0xAE0B158B4738705EULL, 0x9624AB50B148D445ULL},
+    {0xD98DDAEE19068C76ULL, 0x3BADD624DD9B0957ULL},
+    {0x87F8A8D4CFA417C9ULL, 0xE54CA5D70A80E5D6ULL},
+    {0xA9F6D30A038D1DBCULL, 0x5E9FCF4CCD211F4CULL},
+    {0xD47487CC8470652BULL, 0x7647C3200069671FULL},
+    {0x84C8D4DFD2C63F3BULL, 0x29ECD9F40041E073ULL},
+    {0xA5FB0A17C777CF09ULL, 0xF468107100525890ULL},
+    {0xCF79CC9DB955C2CCULL, 0x7182148D4066EEB4ULL},
+    {0x81AC1FE293D599BFULL, 0xC6F14CD848405530ULL},
+    {0xA21727DB38CB002FULL, 0xB8ADA00E5A506A7CULL},
+    {0xCA9CF1D206FDC03BULL, 0xA6D90811F0E4851CULL},
+    {0xFD442E4688BD304AULL, 0x908F4A166D1DA663ULL},
+    {0x9E4A9CEC15763E2EULL, 0x9A598E4E043287FEULL},
+    {0xC5DD44271AD3CDBAULL, 0x40EFF1E1853F29FDULL},
+    {0xF7549530E188C128ULL, 0xD12BEE59E68EF47CULL},
+    {0x9A94DD3E8CF578B9ULL, 0x82BB74F8301958CEULL},
+    {0xC13A148E3032D6E7ULL, 0xE36A52363C1FAF01ULL},
+    {0xF18899B1BC3F8CA1ULL, 0xDC44E6C3CB279AC1ULL},
+    {0x96F5600F15A7B7E5ULL, 0x29AB103A5EF8C0B9ULL},
+    {0xBCB2B812DB11A5DEULL, 0x7415D448F6B6F0E7ULL},
+    {0xEBDF661791D60F56ULL, 0x111B495B3464AD21ULL},
+    {0x936B9FCEBB25C995ULL, 0xCAB10DD900BEEC34ULL},
+    {0xB84687C269EF3BFBULL, 0x3D5D514F40EEA742ULL},
+    {0xE65829B3046B0AFAULL, 0x0CB4A5A3112A5112ULL},
+    {0x8FF71A0FE2C2E6DCULL, 0x47F0E785EABA72ABULL},
+    {0xB3F4E093DB73A093ULL, 0x59ED216765690F56ULL},
+    {0xE0F218B8D25088B8ULL, 0x306869C13EC3532CULL},
+    {0x8C974F7383725573ULL, 0x1E414218C73A13FBULL},
+    {0xAFBD2350644EEACFULL, 0xE5D1929EF90898FAULL},
+    {0xDBAC6C247D62A583ULL, 0xDF45F746B74ABF39ULL},
+    {0x894BC396CE5DA772ULL, 0x6B8BBA8C328EB783ULL},
+    {0xAB9EB47C81F5114FULL, 0x066EA92F3F326564ULL},
+    {0xD686619BA27255A2ULL, 0xC80A537B0EFEFEBDULL},
+    {0x8613FD0145877585ULL, 0xBD06742CE95F5F36ULL},
+    {0xA798FC4196E952E7ULL, 0x2C48113823B73704ULL},
+    {0xD17F3B51FCA3A7A0ULL, 0xF75A15862CA504C5ULL},
+    {0x82EF85133DE648C4ULL, 0x9A984D73DBE722FBULL},
+    {0xA3AB66580D5FDAF5ULL, 0xC13E60D0D2E0EBBAULL},
+    {0xCC963FEE10B7D1B3ULL, 0x318DF905079926A8ULL},
+    {0xFFBBCFE994E5C61FULL, 0xFDF17746497F7052ULL},
+    {0x9FD561F1FD0F9BD3ULL, 0xFEB6EA8BEDEFA633ULL},
+    {0xC7CABA6E7C5382C8ULL, 0xFE64A52EE96B8FC0ULL},
+    {0xF9BD690A1B68637BULL, 0x3DFDCE7AA3C673B0ULL},
+    {0x9C1661A651213E2DULL, 0x06BEA10CA65C084EULL},
+    {0xC31BFA0FE5698DB8ULL, 0x486E494FCFF30A62ULL},
+    {0xF3E2F893DEC3F126ULL, 0x5A89DBA3C3EFCCFAULL},
+    {0x986DDB5C6B3A76B7ULL, 0xF89629465A75E01CULL},
+    {0xBE89523386091465ULL, 0xF6BBB397F1135823ULL},
+    {0xEE2BA6C0678B597FULL, 0x746AA07DED582E2CULL},
+    {0x94DB483840B717EFULL, 0xA8C2A44EB4571CDCULL},
+    {0xBA121A4650E4DDEBULL, 0x92F34D62616CE413ULL},
+    {0xE896A0D7E51E1566ULL, 0x77B020BAF9C81D17ULL},
+    {0x915E2486EF32CD60ULL, 0x0ACE1474DC1D122EULL},
+    {0xB5B5ADA8AAFF80B8ULL, 0x0D819992132456BAULL},
+    {0xE3231912D5BF60E6ULL, 0x10E1FFF697ED6C69ULL},
+    {0x8DF5EFABC5979C8FULL, 0xCA8D3FFA1EF463C1ULL},
+    {0xB1736B96B6FD83B3ULL, 0xBD308FF8A6B17CB2ULL},
+    {0xDDD0467C64BCE4A0ULL, 0xAC7CB3F6D05DDBDEULL},
+    {0x8AA22C0DBEF60EE4ULL, 0x6BCDF07A423AA96BULL},
+    {0xAD4AB7112EB3929DULL, 0x86C16C98D2C953C6ULL},
+    {0xD89D64D57A607744ULL, 0xE871C7BF077BA8B7ULL},
+    {0x87625F056C7C4A8BULL, 0x11471CD764AD4972ULL},
+    {0xA93AF6C6C79B5D2DULL, 0xD598E40D3DD89BCFULL},
+    {0xD389B47879823479ULL, 0x4AFF1D108D4EC2C3ULL},
+    {0x843610CB4BF160CBULL, 0xCEDF722A585139BAULL},
+    {0xA54394FE1EEDB8FEULL, 0xC2974EB4EE658828ULL},
+    {0xCE947A3DA6A9273EULL, 0x733D226229FEEA32ULL},
+    {0x811CCC668829B887ULL, 0x0806357D5A3F525FULL},
+    {0xA163FF802A3426A8ULL, 0xCA07C2DCB0CF26F7ULL},
+    {0xC9BCFF6034C13052ULL, 0xFC89B393DD02F0B5ULL},
+    {0xFC2C3F3841F17C67ULL, 0xBBAC2078D443ACE2ULL},
+    {0x9D9BA7832936EDC0ULL, 0xD54B944B84AA4C0DULL},
+    {0xC5029163F384A931ULL, 0x0A9E795E65D4DF11ULL},
+    {0xF64335BCF065D37DULL, 0x4D4617B5FF4A16D5ULL},
+    {0x99EA0196163FA42EULL, 0x504BCED1BF8E4E45ULL},
+    {0xC06481FB9BCF8D39ULL, 0xE45EC2862F71E1D6ULL},
+    {0xF07DA27A82C37088ULL, 0x5D767327BB4E5A4CULL},
+    {0x964E858C91BA2655ULL, 0x3A6A07F8D510F86FULL},
+    {0xBBE226EFB628AFEAULL, 0x890489F70A55368BULL},
+    {0xEADAB0ABA3B2DBE5ULL, 0x2B45AC74CCEA842EULL},
+    {0x92C8AE6B464FC96FULL, 0x3B0B8BC90012929DULL},
+    {0xB77ADA0617E3BBCBULL, 0x09CE6EBB40173744ULL},
+    {0xE55990879DDCAABDULL, 0xCC420A6A101D0515ULL},
+    {0x8F57FA54C2A9EAB6ULL, 0x9FA946824A12232DULL},
+    {0xB32DF8E9F3546564ULL, 0x47939822DC96ABF9ULL},
+    {0xDFF9772470297EBDULL, 0x59787E2B93BC56F7ULL},
+    {0x8BFBEA76C619EF36ULL, 0x57EB4EDB3C55B65AULL},
+    {0xAEFAE51477A06B03ULL, 0xEDE622920B6B23F1ULL},
+    {0xDAB99E59958885C4ULL, 0xE95FAB368E45ECEDULL},
+    {0x88B402F7FD75539BULL, 0x11DBCB0218EBB414ULL},
+    {0xAAE103B5FCD2A881ULL, 0xD652BDC29F26A119ULL},
+    {0xD59944A37C0752A2ULL, 0x4BE76D3346F0495FULL},
+    {0x857FCAE62D8493A5ULL, 0x6F70A4400C562DDBULL},
+    {0xA6DFBD9FB8E5B88EULL, 0xCB4CCD500F6BB952ULL},
+    {0xD097AD07A71F26B2ULL, 0x7E2000A41346A7A7ULL},
+    {0x825ECC24C873782FULL, 0x8ED400668C0C28C8ULL},
+    {0xA2F67F2DFA90563BULL, 0x728900802F0F32FAULL},
+    {0xCBB41EF979346BCAULL, 0x4F2B40A03AD2FFB9ULL},
+    {0xFEA126B7D78186BCULL, 0xE2F610C84987BFA8ULL},
+    {0x9F24B832E6B0F436ULL, 0x0DD9CA7D2DF4D7C9ULL},
+    {0xC6EDE63FA05D3143ULL, 0x91503D1C79720DBBULL},
+    {0xF8A95FCF88747D94ULL, 0x75A44C6397CE912AULL},
+    {0x9B69DBE1B548CE7CULL, 0xC986AFBE3EE11ABAULL},
+    {0xC24452DA229B021BULL, 0xFBE85BADCE996168ULL},
+    {0xF2D56790AB41C2A2ULL, 0xFAE27299423FB9C3ULL},
+    {0x97C560BA6B0919A5ULL, 0xDCCD879FC967D41AULL},
+    {0xBDB6B8E905CB600FULL, 0x5400E987BBC1C920ULL},
+    {0xED246723473E3813ULL, 0x290123E9AAB23B68ULL},
+    {0x9436C0760C86E30BULL, 0xF9A0B6720AAF6521ULL},
+    {0xB94470938FA89BCEULL, 0xF808E40E8D5B3E69ULL},
+    {0xE7958CB87392C2C2ULL, 0xB60B1D1230B20E04ULL},
+    {0x90BD77F3483BB9B9ULL, 0xB1C6F22B5E6F48C2ULL},
+    {0xB4ECD5F01A4AA828ULL, 0x1E38AEB6360B1AF3ULL},
+    {0xE2280B6C20DD5232ULL, 0x25C6DA63C38DE1B0ULL},
+    {0x8D590723948A535FULL, 0x579C487E5A38AD0EULL},
+    {0xB0AF48EC79ACE837ULL, 0x2D835A9DF0C6D851ULL},
+    {0xDCDB1B2798182244ULL, 0xF8E431456CF88E65ULL},
+    {0x8A08F0F8BF0F156BULL, 0x1B8E9ECB641B58FFULL},
+    {0xAC8B2D36EED2DAC5ULL, 0xE272467E3D222F3FULL},
+    {0xD7ADF884AA879177ULL, 0x5B0ED81DCC6ABB0FULL},
+    {0x86CCBB52EA94BAEAULL, 0x98E947129FC2B4E9ULL},
+    {0xA87FEA27A539E9A5ULL, 0x3F2398D747B36224ULL},
+    {0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AADULL},
+    {0x83A3EEEEF9153E89ULL, 0x1953CF68300424ACULL},
+    {0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD7ULL},
+    {0xCDB02555653131B6ULL, 0x3792F412CB06794DULL},
+    {0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD0ULL},
+    {0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC4ULL},
+    {0xC8DE047564D20A8BULL, 0xF245825A5A445275ULL},
+    {0xFB158592BE068D2EULL, 0xEED6E2F0F0D56712ULL},
+    {0x9CED737BB6C4183DULL, 0x55464DD69685606BULL},
+    {0xC428D05AA4751E4CULL, 0xAA97E14C3C26B886ULL},
+    {0xF53304714D9265DFULL, 0xD53DD99F4B3066A8ULL},
+    {0x993FE2C6D07B7FABULL, 0xE546A8038EFE4029ULL},
+    {0xBF8FDB78849A5F96ULL, 0xDE98520472BDD033ULL},
+    {0xEF73D256A5C0F77CULL, 0x963E66858F6D4440ULL},
+    {0x95A8637627989AADULL, 0xDDE7001379A44AA8ULL},
+    {0xBB127C53B17EC159ULL, 0x5560C018580D5D52ULL},
+    {0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A6ULL},
+    {0x9226712162AB070DULL, 0xCAB3961304CA70E8ULL},
+    {0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D22ULL},
+    {0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506AULL},
+    {0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB242ULL},
+    {0xB267ED1940F1C61CULL, 0x55F038B237591ED3ULL},
+    {0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6688ULL},
+    {0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA015ULL},
+    {0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081AULL},
+    {0xD9C7DCED53C72255ULL, 0x96E7BD358C904A21ULL},
+    {0x881CEA14545C7575ULL, 0x7E50D64177DA2E54ULL},
+    {0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9E9ULL},
+    {0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E864ULL},
+    {0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113EULL},
+    {0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58EULL},
+    {0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF2ULL},
+    {0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED7ULL},
+    {0xA2425FF75E14FC31ULL, 0xA1258379A94D028DULL},
+    {0xCAD2F7F5359A3B3EULL, 0x096EE45813A04330ULL},
+    {0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FCULL},
+    {0x9E74D1B791E07E48ULL, 0x775EA264CF55347DULL},
+    {0xC612062576589DDAULL, 0x95364AFE032A819DULL},
+    {0xF79687AED3EEC551ULL, 0x3A83DDBD83F52204ULL},
+    {0x9ABE14CD44753B52ULL, 0xC4926A9672793542ULL},
+    {0xC16D9A0095928A27ULL, 0x75B7053C0F178293ULL},
+    {0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6338ULL},
+    {0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E03ULL},
+    {0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF584ULL},
+    {0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E5ULL},
+    {0x9392EE8E921D5D07ULL, 0x3AFF322E62439FCFULL},
+    {0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C2ULL},
+    {0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B3ULL},
+    {0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A10ULL},
+    {0xB424DC35095CD80FULL, 0x538484C19EF38C94ULL},
+    {0xE12E13424BB40E13ULL, 0x2865A5F206B06FB9ULL},
+    {0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D3ULL},
+    {0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D748ULL},
+    {0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1BULL},
+    {0x89705F4136B4A597ULL, 0x31680A88F8953030ULL},
+    {0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3DULL},
+    {0xD6BF94D5E57A42BCULL, 0x3D32907604691B4CULL},
+    {0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B10FULL},
+    {0xA7C5AC471B478423ULL, 0x0FCF80DC33721D53ULL},
+    {0xD1B71758E219652BULL, 0xD3C36113404EA4A8ULL},
+    {0x83126E978D4FDF3BULL, 0x645A1CAC083126E9ULL},
+    {0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A3ULL},
+    {0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCCULL},
+    {0x8000000000000000ULL, 0x0000000000000000ULL},
+    {0xA000000000000000ULL, 0x0000000000000000ULL},
+    {0xC800000000000000ULL, 0x0000000000000000ULL},
+    {0xFA00000000000000ULL, 0x0000000000000000ULL},
+    {0x9C40000000000000ULL, 0x0000000000000000ULL},
+    {0xC350000000000000ULL, 0x0000000000000000ULL},
+    {0xF424000000000000ULL, 0x0000000000000000ULL},
+    {0x9896800000000000ULL, 0x0000000000000000ULL},
+    {0xBEBC200000000000ULL, 0x0000000000000000ULL},
+    {0xEE6B280000000000ULL, 0x0000000000000000ULL},
+    {0x9502F90000000000ULL, 0x0000000000000000ULL},
+    {0xBA43B74000000000ULL, 0x0000000000000000ULL},
+    {0xE8D4A51000000000ULL, 0x0000000000000000ULL},
+    {0x9184E72A00000000ULL, 0x0000000000000000ULL},
+    {0xB5E620F480000000ULL, 0x0000000000000000ULL},
+    {0xE35FA931A0000000ULL, 0x0000000000000000ULL},
+    {0x8E1BC9BF04000000ULL, 0x0000000000000000ULL},
+    {0xB1A2BC2EC5000000ULL, 0x0000000000000000ULL},
+    {0xDE0B6B3A76400000ULL, 0x0000000000000000ULL},
+    {0x8AC7230489E80000ULL, 0x0000000000000000ULL},
+    {0xAD78EBC5AC620000ULL, 0x0000000000000000ULL},
+    {0xD8D726B7177A8000ULL, 0x0000000000000000ULL},
+    {0x878678326EAC9000ULL, 0x0000000000000000ULL},
+    {0xA968163F0A57B400ULL, 0x0000000000000000ULL},
+    {0xD3C21BCECCEDA100ULL, 0x0000000000000000ULL},
+    {0x84595161401484A0ULL, 0x0000000000000000ULL},
+    {0xA56FA5B99019A5C8ULL, 0x0000000000000000ULL},
+    {0xCECB8F27F4200F3AULL, 0x0000000000000000ULL},
+    {0x813F3978F8940984ULL, 0x4000000000000000ULL},
+    {0xA18F07D736B90BE5ULL, 0x5000000000000000ULL},
+    {0xC9F2C9CD04674EDEULL, 0xA400000000000000ULL},
+    {0xFC6F7C4045812296ULL, 0x4D00000000000000ULL},
+    {0x9DC5ADA82B70B59DULL, 0xF020000000000000ULL},
+    {0xC5371912364CE305ULL, 0x6C28000000000000ULL},
+    {0xF684DF56C3E01BC6ULL, 0xC732000000000000ULL},
+    {0x9A130B963A6C115CULL, 0x3C7F400000000000ULL},
+    {0xC097CE7BC90715B3ULL, 0x4B9F100000000000ULL},
+    {0xF0BDC21ABB48DB20ULL, 0x1E86D40000000000ULL},
+    {0x96769950B50D88F4ULL, 0x1314448000000000ULL},
+    {0xBC143FA4E250EB31ULL, 0x17D955A000000000ULL},
+    {0xEB194F8E1AE525FDULL, 0x5DCFAB0800000000ULL},
+    {0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000000ULL},
+    {0xB7ABC627050305ADULL, 0xF14A3D9E40000000ULL},
+    {0xE596B7B0C643C719ULL, 0x6D9CCD05D0000000ULL},
+    {0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000000ULL},
+    {0xB35DBF821AE4F38BULL, 0xDDA2802C8A800000ULL},
+    {0xE0352F62A19E306EULL, 0xD50B2037AD200000ULL},
+    {0x8C213D9DA502DE45ULL, 0x4526F422CC340000ULL},
+    {0xAF298D050E4395D6ULL, 0x9670B12B7F410000ULL},
+    {0xDAF3F04651D47B4CULL, 0x3C0CDD765F114000ULL},
+    {0x88D8762BF324CD0FULL, 0xA5880A69FB6AC800ULL},
+    {0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A00ULL},
+    {0xD5D238A4ABE98068ULL, 0x72A4904598D6D880ULL},
+    {0x85A36366EB71F041ULL, 0x47A6DA2B7F864750ULL},
+    {0xA70C3C40A64E6C51ULL, 0x999090B65F67D924ULL},
+    {0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6DULL},
+    {0x82818F1281ED449FULL, 0xBFF8F10E7A8921A4ULL},
+    {0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0DULL},
+    {0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764490ULL},
+    {0xFEE50B7025C36A08ULL, 0x02F236D04753D5B4ULL},
+    {0x9F4F2726179A2245ULL, 0x01D762422C946590ULL},
+    {0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF5ULL},
+    {0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB2ULL},
+    {0x9B934C3B330C8577ULL, 0x63CC55F49F88EB2FULL},
+    {0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FBULL},
+    {0xF316271C7FC3908AULL, 0x8BEF464E3945EF7AULL},
+    {0x97EDD871CFDA3A56ULL, 0x97758BF0E3CBB5ACULL},
+    {0xBDE94E8E43D0C8ECULL, 0x3D52EEED1CBEA317ULL},
+    {0xED63A231D4C4FB27ULL, 0x4CA7AAA863EE4BDDULL},
+    {0x945E455F24FB1CF8ULL, 0x8FE8CAA93E74EF6AULL},
+    {0xB975D6B6EE39E436ULL, 0xB3E2FD538E122B44ULL},
+    {0xE7D34C64A9C85D44ULL, 0x60DBBCA87196B616ULL},
+    {0x90E40FBEEA1D3A4AULL, 0xBC8955E946FE31CDULL},
+    {0xB51D13AEA4A488DDULL, 0x6BABAB6398BDBE41ULL},
+    {0xE264589A4DCDAB14ULL, 0xC696963C7EED2DD1ULL},
+    {0x8D7EB76070A08AECULL, 0xFC1E1DE5CF543CA2ULL},
+    {0xB0DE65388CC8ADA8ULL, 0x3B25A55F43294BCBULL},
+    {0xDD15FE86AFFAD912ULL, 0x49EF0EB713F39EBEULL},
+    {0x8A2DBF142DFCC7ABULL, 0x6E3569326C784337ULL},
+    {0xACB92ED9397BF996ULL, 0x49C2C37F07965404ULL},
+    {0xD7E77A8F87DAF7FBULL, 0xDC33745EC97BE906ULL},
+    {0x86F0AC99B4E8DAFDULL, 0x69A028BB3DED71A3ULL},
+    {0xA8ACD7C0222311BCULL, 0xC40832EA0D68CE0CULL},
+    {0xD2D80DB02AABD62BULL, 0xF50A3FA490C30190ULL},
+    {0x83C7088E1AAB65DBULL, 0x792667C6DA79E0FAULL},
+    {0xA4B8CAB1A1563F52ULL, 0x577001B891185938ULL},
+    {0xCDE6FD5E09ABCF26ULL, 0xED4C0226B55E6F86ULL},
+    {0x80B05E5AC60B6178ULL, 0x544F8158315B05B4ULL},
+    {0xA0DC75F1778E39D6ULL, 0x696361AE3DB1C721ULL},
+    {0xC913936DD571C84CULL, 0x03BC3A19CD1E38E9ULL},
+    {0xFB5878494ACE3A5FULL, 0x04AB48A04065C723ULL},
+    {0x9D174B2DCEC0E47BULL, 0x62EB0D64283F9C76ULL},
+    {0xC45D1DF942711D9AULL, 0x3BA5D0BD324F8394ULL},
+    {0xF5746577930D6500ULL, 0xCA8F44EC7EE36479ULL},
+    {0x9968BF6ABBE85F20ULL, 0x7E998B13CF4E1ECBULL},
+    {0xBFC2EF456AE276E8ULL, 0x9E3FEDD8C321A67EULL},
+    {0xEFB3AB16C59B14A2ULL, 0xC5CFE94EF3EA101EULL},
+    {0x95D04AEE3B80ECE5ULL, 0xBBA1F1D158724A12ULL},
+    {0xBB445DA9CA61281FULL, 0x2A8A6E45AE8EDC97ULL},
+    {0xEA1575143CF97226ULL, 0xF52D09D71A3293BDULL},
+    {0x924D692CA61BE758ULL, 0x593C2626705F9C56ULL},
+    {0xB6E0C377CFA2E12EULL, 0x6F8B2FB00C77836CULL},
+    {0xE498F455C38B997AULL, 0x0B6DFB9C0F956447ULL},
+    {0x8EDF98B59A373FECULL, 0x4724BD4189BD5EACULL},
+    {0xB2977EE300C50FE7ULL, 0x58EDEC91EC2CB657ULL},
+    {0xDF3D5E9BC0F653E1ULL, 0x2F2967B66737E3EDULL},
+    {0x8B865B215899F46CULL, 0xBD79E0D20082EE74ULL},
+    {0xAE67F1E9AEC07187ULL, 0xECD8590680A3AA11ULL},
+    {0xDA01EE641A708DE9ULL, 0xE80E6F4820CC9495ULL},
+    {0x884134FE908658B2ULL, 0x3109058D147FDCDDULL},
+    {0xAA51823E34A7EEDEULL, 0xBD4B46F0599FD415ULL},
+    {0xD4E5E2CDC1D1EA96ULL, 0x6C9E18AC7007C91AULL},
+    {0x850FADC09923329EULL, 0x03E2CF6BC604DDB0ULL},
+    {0xA6539930BF6BFF45ULL, 0x84DB8346B786151CULL},
+    {0xCFE87F7CEF46FF16ULL, 0xE612641865679A63ULL},
+    {0x81F14FAE158C5F6EULL, 0x4FCB7E8F3F60C07EULL},
+    {0xA26DA3999AEF7749ULL, 0xE3BE5E330F38F09DULL},
+    {0xCB090C8001AB551CULL, 0x5CADF5BFD3072CC5ULL},
+    {0xFDCB4FA002162A63ULL, 0x73D9732FC7C8F7F6ULL},
+    {0x9E9F11C4014DDA7EULL, 0x2867E7FDDCDD9AFAULL},
+    {0xC646D63501A1511DULL, 0xB281E1FD541501B8ULL},
+    {0xF7D88BC24209A565ULL, 0x1F225A7CA91A4226ULL},
+    {0x9AE757596946075FULL, 0x3375788DE9B06958ULL},
+    {0xC1A12D2FC3978937ULL, 0x0052D6B1641C83AEULL},
+    {0xF209787BB47D6B84ULL, 0xC0678C5DBD23A49AULL},
+    {0x9745EB4D50CE6332ULL, 0xF840B7BA963646E0ULL},
+    {0xBD176620A501FBFFULL, 0xB650E5A93BC3D898ULL},
+    {0xEC5D3FA8CE427AFFULL, 0xA3E51F138AB4CEBEULL},
+    {0x93BA47C980E98CDFULL, 0xC66F336C36B10137ULL},
+    {0xB8A8D9BBE123F017ULL, 0xB80B0047445D4184ULL},
+    {0xE6D3102AD96CEC1DULL, 0xA60DC059157491E5ULL},
+    {0x9043EA1AC7E41392ULL, 0x87C89837AD68DB2FULL},
+    {0xB454E4A179DD1877ULL, 0x29BABE4598C311FBULL},
+    {0xE16A1DC9D8545E94ULL, 0xF4296DD6FEF3D67AULL},
+    {0x8CE2529E2734BB1DULL, 0x1899E4A65F58660CULL},
+    {0xB01AE745B101E9E4ULL, 0x5EC05DCFF72E7F8FULL},
+    {0xDC21A1171D42645DULL, 0x76707543F4FA1F73ULL},
+    {0x899504AE72497EBAULL, 0x6A06494A791C53A8ULL},
+    {0xABFA45DA0EDBDE69ULL, 0x0487DB9D17636892ULL},
+    {0xD6F8D7509292D603ULL, 0x45A9D2845D3C42B6ULL},
+    {0x865B86925B9BC5C2ULL, 0x0B8A2392BA45A9B2ULL},
+    {0xA7F26836F282B732ULL, 0x8E6CAC7768D7141EULL},
+    {0xD1EF0244AF2364FFULL, 0x3207D795430CD926ULL},
+    {0x8335616AED761F1FULL, 0x7F44E6BD49E807B8ULL},
+    {0xA402B9C5A8D3A6E7ULL, 0x5F16206C9C6209A6ULL},
+    {0xCD036837130890A1ULL, 0x36DBA887C37A8C0FULL},
+    {0x802221226BE55A64ULL, 0xC2494954DA2C9789ULL},
+    {0xA02AA96B06DEB0FDULL, 0xF2DB9BAA10B7BD6CULL},
+    {0xC83553C5C8965D3DULL, 0x6F92829494E5ACC7ULL},
+    {0xFA42A8B73ABBF48CULL, 0xCB772339BA1F17F9ULL},
+    {0x9C69A97284B578D7ULL, 0xFF2A760414536EFBULL},
+    {0xC38413CF25E2D70DULL, 0xFEF5138519684ABAULL},
+    {0xF46518C2EF5B8CD1ULL, 0x7EB258665FC25D69ULL},
+    {0x98BF2F79D5993802ULL, 0xEF2F773FFBD97A61ULL},
+    {0xBEEEFB584AFF8603ULL, 0xAAFB550FFACFD8FAULL},
+    {0xEEAABA2E5DBF6784ULL, 0x95BA2A53F983CF38ULL},
+    {0x952AB45CFA97A0B2ULL, 0xDD945A747BF26183ULL},
+    {0xBA756174393D88DFULL, 0x94F971119AEEF9E4ULL},
+    {0xE912B9D1478CEB17ULL, 0x7A37CD5601AAB85DULL},
+    {0x91ABB422CCB812EEULL, 0xAC62E055C10AB33AULL},
+    {0xB616A12B7FE617AAULL, 0x577B986B314D6009ULL},
+    {0xE39C49765FDF9D94ULL, 0xED5A7E85FDA0B80BULL},
+    {0x8E41ADE9FBEBC27DULL, 0x14588F13BE847307ULL},
+    {0xB1D219647AE6B31CULL, 0x596EB2D8AE258FC8ULL},
+    {0xDE469FBD99A05FE3ULL, 0x6FCA5F8ED9AEF3BBULL},
+    {0x8AEC23D680043BEEULL, 0x25DE7BB9480D5854ULL},
+    {0xADA72CCC20054AE9ULL, 0xAF561AA79A10AE6AULL},
+    {0xD910F7FF28069DA4ULL, 0x1B2BA1518094DA04ULL},
+    {0x87AA9AFF79042286ULL, 0x90FB44D2F05D0842ULL},
+    {0xA99541BF57452B28ULL, 0x353A1607AC744A53ULL},
+    {0xD3FA922F2D1675F2ULL, 0x42889B8997915CE8ULL},
+    {0x847C9B5D7C2E09B7ULL, 0x69956135FEBADA11ULL},
+    {0xA59BC234DB398C25ULL, 0x43FAB9837E699095ULL},
+    {0xCF02B2C21207EF2EULL, 0x94F967E45E03F4BBULL},
+    {0x8161AFB94B44F57DULL, 0x1D1BE0EEBAC278F5ULL},
+    {0xA1BA1BA79E1632DCULL, 0x6462D92A69731732ULL},
+    {0xCA28A291859BBF93ULL, 0x7D7B8F7503CFDCFEULL},
+    {0xFCB2CB35E702AF78ULL, 0x5CDA735244C3D43EULL},
+    {0x9DEFBF01B061ADABULL, 0x3A0888136AFA64A7ULL},
+    {0xC56BAEC21C7A1916ULL, 0x088AAA1845B8FDD0ULL},
+    {0xF6C69A72A3989F5BULL, 0x8AAD549E57273D45ULL},
+    {0x9A3C2087A63F6399ULL, 0x36AC54E2F678864BULL},
+    {0xC0CB28A98FCF3C7FULL, 0x84576A1BB416A7DDULL},
+    {0xF0FDF2D3F3C30B9FULL, 0x656D44A2A11C51D5ULL},
+    {0x969EB7C47859E743ULL, 0x9F644AE5A4B1B325ULL},
+    {0xBC4665B596706114ULL, 0x873D5D9F0DDE1FEEULL},
+    {0xEB57FF22FC0C7959ULL, 0xA90CB506D155A7EAULL},
+    {0x9316FF75DD87CBD8ULL, 0x09A7F12442D588F2ULL},
+    {0xB7DCBF5354E9BECEULL, 0x0C11ED6D538AEB2FULL},
+    {0xE5D3EF282A242E81ULL, 0x8F1668C8A86DA5FAULL},
+    {0x8FA475791A569D10ULL, 0xF96E017D694487BCULL},
+    {0xB38D92D760EC4455ULL, 0x37C981DCC395A9ACULL},
+    {0xE070F78D3927556AULL, 0x85BBE253F47B1417ULL},
+    {0x8C469AB843B89562ULL, 0x93956D7478CCEC8EULL},
+    {0xAF58416654A6BABBULL, 0x387AC8D1970027B2ULL},
+    {0xDB2E51BFE9D0696AULL, 0x06997B05FCC0319EULL},
+    {0x88FCF317F22241E2ULL, 0x441FECE3BDF81F03ULL},
+    {0xAB3C2FDDEEAAD25AULL, 0xD527E81CAD7626C3ULL},
+    {0xD60B3BD56A5586F1ULL, 0x8A71E223D8D3B074ULL},
+    {0x85C7056562757456ULL, 0xF6872D5667844E49ULL},
+    {0xA738C6BEBB12D16CULL, 0xB428F8AC016561DBULL},
+    {0xD106F86E69D785C7ULL, 0xE13336D701BEBA52ULL},
+    {0x82A45B450226B39CULL, 0xECC0024661173473ULL},
+    {0xA34D721642B06084ULL, 0x27F002D7F95D0190ULL},
+    {0xCC20CE9BD35C78A5ULL, 0x31EC038DF7B441F4ULL},
+    {0xFF290242C83396CEULL, 0x7E67047175A15271ULL},
+    {0x9F79A169BD203E41ULL, 0x0F0062C6E984D386ULL},
+    {0xC75809C42C684DD1ULL, 0x52C07B78A3E60868ULL},
+    {0xF92E0C3537826145ULL, 0xA7709A56CCDF8A82ULL},
+    {0x9BBCC7A142B17CCBULL, 0x88A66076400BB691ULL},
+    {0xC2ABF989935DDBFEULL, 0x6ACFF893D00EA435ULL},
+    {0xF356F7EBF83552FEULL, 0x0583F6B8C4124D43ULL},
+    {0x98165AF37B2153DEULL, 0xC3727A337A8B704AULL},
+    {0xBE1BF1B059E9A8D6ULL, 0x744F18C0592E4C5CULL},
+    {0xEDA2EE1C7064130CULL, 0x1162DEF06F79DF73ULL},
+    {0x9485D4D1C63E8BE7ULL, 0x8ADDCB5645AC2BA8ULL},
+    {0xB9A74A0637CE2EE1ULL, 0x6D953E2BD7173692ULL},
+    {0xE8111C87C5C1BA99ULL, 0xC8FA8DB6CCDD0437ULL},
+    {0x910AB1D4DB9914A0ULL, 0x1D9C9892400A22A2ULL},
+    {0xB54D5E4A127F59C8ULL, 0x2503BEB6D00CAB4BULL},
+    {0xE2A0B5DC971F303AULL, 0x2E44AE64840FD61DULL},
+    {0x8DA471A9DE737E24ULL, 0x5CEAECFED289E5D2ULL},
+    {0xB10D8E1456105DADULL, 0x7425A83E872C5F47ULL},
+    {0xDD50F1996B947518ULL, 0xD12F124E28F77719ULL},
+    {0x8A5296FFE33CC92FULL, 0x82BD6B70D99AAA6FULL},
+    {0xACE73CBFDC0BFB7BULL, 0x636CC64D1001550BULL},
+    {0xD8210BEFD30EFA5AULL, 0x3C47F7E05401AA4EULL},
+    {0x8714A775E3E95C78ULL, 0x65ACFAEC34810A71ULL},
+    {0xA8D9D1535CE3B396ULL, 0x7F1839A741A14D0DULL},
+    {0xD31045A8341CA07CULL, 0x1EDE48111209A050ULL},
+    {0x83EA2B892091E44DULL, 0x934AED0AAB460432ULL},
+    {0xA4E4B66B68B65D60ULL, 0xF81DA84D5617853FULL},
+    {0xCE1DE40642E3F4B9ULL, 0x36251260AB9D668EULL},
+    {0x80D2AE83E9CE78F3ULL, 0xC1D72B7C6B426019ULL},
+    {0xA1075A24E4421730ULL, 0xB24CF65B8612F81FULL},
+    {0xC94930AE1D529CFCULL, 0xDEE033F26797B627ULL},
+    {0xFB9B7CD9A4A7443CULL, 0x169840EF017DA3B1ULL},
+    {0x9D412E0806E88AA5ULL, 0x8E1F289560EE864EULL},
+    {0xC491798A08A2AD4EULL, 0xF1A6F2BAB92A27E2ULL},
+    {0xF5B5D7EC8ACB58A2ULL, 0xAE10AF696774B1DBULL},
+    {0x9991A6F3D6BF1765ULL, 0xACCA6DA1E0A8EF29ULL},
+    {0xBFF610B0CC6EDD3FULL, 0x17FD090A58D32AF3ULL},
+    {0xEFF394DCFF8A948EULL, 0xDDFC4B4CEF07F5B0ULL},
+    {0x95F83D0A1FB69CD9ULL, 0x4ABDAF101564F98EULL},
+    {0xBB764C4CA7A4440FULL, 0x9D6D1AD41ABE37F1ULL},
+    {0xEA53DF5FD18D5513ULL, 0x84C86189216DC5EDULL},
+    {0x92746B9BE2F8552CULL, 0x32FD3CF5B4E49BB4ULL},
+    {0xB7118682DBB66A77ULL, 0x3FBC8C33221DC2A1ULL},
+    {0xE4D5E82392A40515ULL, 0x0FABAF3FEAA5334AULL},
+    {0x8F05B1163BA6832DULL, 0x29CB4D87F2A7400EULL},
+    {0xB2C71D5BCA9023F8ULL, 0x743E20E9EF511012ULL},
+    {0xDF78E4B2BD342CF6ULL, 0x914DA9246B255416ULL},
+    {0x8BAB8EEFB6409C1AULL, 0x1AD089B6C2F7548EULL},
+    {0xAE9672ABA3D0C320ULL, 0xA184AC2473B529B1ULL},
+    {0xDA3C0F568CC4F3E8ULL, 0xC9E5D72D90A2741EULL},
+    {0x8865899617FB1871ULL, 0x7E2FA67C7A658892ULL},
+    {0xAA7EEBFB9DF9DE8DULL, 0xDDBB901B98FEEAB7ULL},
+    {0xD51EA6FA85785631ULL, 0x552A74227F3EA565ULL},
+    {0x8533285C936B35DEULL, 0xD53A88958F87275FULL},
+    {0xA67FF273B8460356ULL, 0x8A892ABAF368F137ULL},
+    {0xD01FEF10A657842CULL, 0x2D2B7569B0432D85ULL},
+    {0x8213F56A67F6B29BULL, 0x9C3B29620E29FC73ULL},
+    {0xA298F2C501F45F42ULL, 0x8349F3BA91B47B8FULL},
+    {0xCB3F2F7642717713ULL, 0x241C70A936219A73ULL},
+    {0xFE0EFB53D30DD4D7ULL, 0xED238CD383AA0110ULL},
+    {0x9EC95D1463E8A506ULL, 0xF4363804324A40AAULL},
+    {0xC67BB4597CE2CE48ULL, 0xB143C6053EDCD0D5ULL},
+    {0xF81AA16FDC1B81DAULL, 0xDD94B7868E94050AULL},
+    {0x9B10A4E5E9913128ULL, 0xCA7CF2B4191C8326ULL},
+    {0xC1D4CE1F63F57D72ULL, 0xFD1C2F611F63A3F0ULL},
+    {0xF24A01A73CF2DCCFULL, 0xBC633B39673C8CECULL},
+    {0x976E41088617CA01ULL, 0xD5BE0503E085D813ULL},
+    {0xBD49D14AA79DBC82ULL, 0x4B2D8644D8A74E18ULL},
+    {0xEC9C459D51852BA2ULL, 0xDDF8E7D60ED1219EULL},
+    {0x93E1AB8252F33B45ULL, 0xCABB90E5C942B503ULL},
+    {0xB8DA1662E7B00A17ULL, 0x3D6A751F3B936243ULL},
+    {0xE7109BFBA19C0C9DULL, 0x0CC512670A783AD4ULL},
+    {0x906A617D450187E2ULL, 0x27FB2B80668B24C5ULL},
+    {0xB484F9DC9641E9DAULL, 0xB1F9F660802DEDF6ULL},
+    {0xE1A63853BBD26451ULL, 0x5E7873F8A0396973ULL},
+    {0x8D07E33455637EB2ULL, 0xDB0B487B6423E1E8ULL},
+    {0xB049DC016ABC5E5FULL, 0x91CE1A9A3D2CDA62ULL},
+    {0xDC5C5301C56B75F7ULL, 0x7641A140CC7810FBULL},
+    {0x89B9B3E11B6329BAULL, 0xA9E904C87FCB0A9DULL},
+    {0xAC2820D9623BF429ULL, 0x546345FA9FBDCD44ULL},
+    {0xD732290FBACAF133ULL, 0xA97C177947AD4095ULL},
+    {0x867F59A9D4BED6C0ULL, 0x49ED8EABCCCC485DULL},
+    {0xA81F301449EE8C70ULL, 0x5C68F256BFFF5A74ULL},
+    {0xD226FC195C6A2F8CULL, 0x73832EEC6FFF3111ULL},
+    {0x83585D8FD9C25DB7ULL, 0xC831FD53C5FF7EABULL},
+    {0xA42E74F3D032F525ULL, 0xBA3E7CA8B77F5E55ULL},
+    {0xCD3A1230C43FB26FULL, 0x28CE1BD2E55F35EBULL},
+    {0x80444B5E7AA7CF85ULL, 0x7980D163CF5B81B3ULL},
+    {0xA0555E361951C366ULL, 0xD7E105BCC332621FULL},
+    {0xC86AB5C39FA63440ULL, 0x8DD9472BF3FEFAA7ULL},
+    {0xFA856334878FC150ULL, 0xB14F98F6F0FEB951ULL},
+    {0x9C935E00D4B9D8D2ULL, 0x6ED1BF9A569F33D3ULL},
+    {0xC3B8358109E84F07ULL, 0x0A862F80EC4700C8ULL},
+    {0xF4A642E14C6262C8ULL, 0xCD27BB612758C0FAULL},
+    {0x98E7E9CCCFBD7DBDULL, 0x8038D51CB897789CULL},
+    {0xBF21E44003ACDD2CULL, 0xE0470A63E6BD56C3ULL},
+    {0xEEEA5D5004981478ULL, 0x1858CCFCE06CAC74ULL},
+    {0x95527A5202DF0CCBULL, 0x0F37801E0C43EBC8ULL},
+    {0xBAA718E68396CFFDULL, 0xD30560258F54E6BAULL},
+    {0xE950DF20247C83FDULL, 0x47C6B82EF32A2069ULL},
+    {0x91D28B7416CDD27EULL, 0x4CDC331D57FA5441ULL},
+    {0xB6472E511C81471DULL, 0xE0133FE4ADF8E952ULL},
+    {0xE3D8F9E563A198E5ULL, 0x58180FDDD97723A6ULL},
+    {0x8E679C2F5E44FF8FULL, 0x570F09EAA7EA7648ULL},
+};
 
-    // result is a list of (field, msg) tuples: delegate raising to Python
-    PyObject *r = PyObject_CallFunctionObjArgs(info->raiser, result, NULL);
-    Py_DECREF(result);
-    Py_XDECREF(r);
-    Py_DECREF(self);
-    if (!PyErr_Occurred()) {
-        PyErr_SetString(PyExc_ValueError, "dhi: validation failed");
-    }
-    return NULL;
+static const double dhi_exact_pow10[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+// 64x64 -> 128 multiply: returns the low half, stores the high half
+static inline uint64_t dhi_mul64(uint64_t a, uint64_t b, uint64_t *hi) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 p = (unsigned __int128)a * b;
+    *hi = (uint64_t)(p >> 64);
+    return (uint64_t)p;
+#else
+    uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+    uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+    uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo;
+    uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+    *hi = a_hi * b_hi + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return (mid << 32) | (uint32_t)ll;
+#endif
 }
 
-// enable_fast_construct(cls, specs_capsule, extra_mode, raiser) -> None
-static PyObject* py_enable_fast_construct(PyObject* self_unused, PyObject* args) {
-    PyObject *cls_obj, *capsule, *raiser;
-    int extra_mode;
-    if (!PyArg_ParseTuple(args, "OOiO", &cls_obj, &capsule, &extra_mode, &raiser)) return NULL;
-    if (!PyType_Check(cls_obj)) {
-        PyErr_SetString(PyExc_TypeError, "enable_fast_construct: first argument must be a class");
-        return NULL;
+// Eisel-Lemire: man * 10^q correctly rounded to a double. Returns 0 when the
+// 128-bit product can't decide the rounding and the caller must fall back.
+static int dhi_eisel_lemire(uint64_t man, int64_t q, int negative, double *out) {
+    uint64_t bits;
+    if (man == 0 || q < DHI_POW5_MIN) {
+        bits = 0;  // man < 10^19, so anything below 10^-342 rounds to zero
+    } else if (q > DHI_POW5_MAX) {
+        bits = 0x7FF0000000000000ULL;
+    } else {
+        int clz = __builtin_clzll(man);
+        man <<= clz;
+        uint64_t exp2 = (uint64_t)(((217706 * q) >> 16) + 64 + 1023) - (uint64_t)clz;
+
+        const uint64_t *p5 = dhi_pow5_128[q - DHI_POW5_MIN];
+        uint64_t x_hi, x_lo = dhi_mul64(man, p5[0], &x_hi);
+        if ((x_hi & 0x1FF) == 0x1FF && x_lo + man < man) {
+            // Truncation error may carry into the kept bits: widen
+            uint64_t y_hi, y_lo = dhi_mul64(man, p5[1], &y_hi);
+            uint64_t m_hi = x_hi, m_lo = x_lo + y_hi;
+            if (m_lo < x_lo) m_hi++;
+            if ((m_hi & 0x1FF) == 0x1FF && m_lo + 1 == 0 && y_lo + man < man) return 0;
+            x_hi = m_hi;
+            x_lo = m_lo;
+        }
+
+        uint64_t msb = x_hi >> 63;
+        uint64_t m = x_hi >> (msb + 9);
+        exp2 -= 1 ^ msb;
+        // Exactly halfway between two doubles: needs the full digits
+        if (x_lo == 0 && (x_hi & 0x1FF) == 0 && (m & 3) == 1) return 0;
+
+        m += m & 1;
+        m >>= 1;
+        if (m >> 53) {
+            m >>= 1;
+            exp2++;
+        }
+        // Subnormal or overflow
+        if (exp2 - 1 >= 0x7FF - 1) return 0;
+        bits = (exp2 << 52) | (m & 0x000FFFFFFFFFFFFFULL);
     }
-    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
-    if (!ms) return NULL;
+    if (negative) bits |= 0x8000000000000000ULL;
+    memcpy(out, &bits, sizeof(bits));
+    return 1;
+}
 
-    if (!g_fastinfo_key) {
-        g_fastinfo_key = PyUnicode_InternFromString("__dhi_fast_construct__");
-        if (!g_fastinfo_key) return NULL;
+// Integers past 18 digits: fold 18-digit chunks into a PyLong
+static PyObject* json_parse_big_int(const char *digits, size_t n, int negative) {
+    if (__builtin_expect(n > DHI_MAX_INT_DIGITS, 0)) {
+        PyErr_Format(PyExc_ValueError,
+                     "Integer too large: %zu digits exceeds the limit of %d",
+                     n, DHI_MAX_INT_DIGITS);
+        return NULL;
     }
+    size_t k = n % 18 ? n % 18 : 18;
+    long long chunk = 0;
+    for (size_t j = 0; j < k; j++) chunk = chunk * 10 + (digits[j] - '0');
+    PyObject *acc = PyLong_FromLongLong(chunk);
+    PyObject *scale = NULL;
+    while (acc && k < n) {
+        if (!scale && !(scale = PyLong_FromLongLong(1000000000000000000LL))) {
+            Py_CLEAR(acc);
+            break;
+        }
+        chunk = 0;
+        for (size_t j = k; j < k + 18; j++) chunk = chunk * 10 + (digits[j] - '0');
+        k += 18;
+        PyObject *t = PyNumber_Multiply(acc, scale);
+        Py_DECREF(acc);
+        PyObject *c = t ? PyLong_FromLongLong(chunk) : NULL;
+        acc = c ? PyNumber_Add(t, c) : NULL;
+        Py_XDECREF(t);
+        Py_XDECREF(c);
+    }
+    Py_XDECREF(scale);
+    if (acc && negative) {
+        PyObject *t = PyNumber_Negative(acc);
+        Py_DECREF(acc);
+        acc = t;
+    }
+    return acc;
+}
 
-    FastConstructInfo *info = (FastConstructInfo*)malloc(sizeof(FastConstructInfo));
-    if (!info) return PyErr_NoMemory();
-    Py_INCREF(capsule);
-    Py_INCREF(raiser);
-    info->specs_capsule = capsule;
-    info->ms = ms;
-    info->extra_mode = extra_mode;
-    info->raiser = raiser;
+// Parse a JSON number - inline for ints, Eisel-Lemire for floats
+__attribute__((always_inline))
+static inline PyObject* json_parse_number_simd(const char *json, size_t *pos, size_t len) {
+    size_t start = *pos;
+    size_t i = start;
+    int is_negative = 0;
 
-    PyObject *info_capsule = PyCapsule_New(info, "dhi.fast_construct", fast_construct_info_destructor);
-    if (!info_capsule) {
-        Py_DECREF(capsule); Py_DECREF(raiser); free(info);
+    if (i < len && json[i] == '-') {
+        is_negative = 1;
+        i++;
+    }
+    if (__builtin_expect(i >= len || json[i] < '0' || json[i] > '9', 0)) {
+        PyErr_SetString(PyExc_ValueError, "Invalid number");
         return NULL;
     }
 
-    // Store via setattr so type machinery (caches, versioning) stays consistent.
-    if (PyObject_SetAttr(cls_obj, g_fastinfo_key, info_capsule) < 0) {
-        Py_DECREF(info_capsule);
+    // No leading zeros (RFC 8259): "0" alone, never "01"
+    if (__builtin_expect(json[i] == '0' && i + 1 < len && json[i + 1] >= '0' &&
+                         json[i + 1] <= '9', 0)) {
+        PyErr_SetString(PyExc_ValueError, "Invalid number");
         return NULL;
     }
-    Py_DECREF(info_capsule);
 
-#if PY_VERSION_HEX >= 0x030C0000
-    ((PyTypeObject*)cls_obj)->tp_vectorcall = dhi_model_vectorcall;
-#endif
-    Py_RETURN_NONE;
-}
+    uint64_t mant = 0;
+    int64_t exp10 = 0;
+    int sig = 0, truncated = 0;
+    size_t int_start = i;
+    while (i < len && json[i] >= '0' && json[i] <= '9') {
+        unsigned d = (unsigned)(json[i] - '0');
+        if (sig < 19) {
+            mant = mant * 10 + d;
+            sig += mant != 0;
+        } else {
+            exp10++;
+            truncated |= d != 0;
+        }
+        i++;
+    }
 
-// construct_validated(cls, data_dict) -> instance
-// C-speed model_validate fast path: allocates the instance and validates the
-// dict in one call using the class's fast-construct info (no object.__new__
-// dispatch, no Python-level error re-packing).
-static PyObject* py_construct_validated(PyObject* self_unused, PyObject *const *args, Py_ssize_t nargs) {
-    if (nargs != 2) {
-        PyErr_SetString(PyExc_TypeError, "construct_validated requires 2 arguments");
-        return NULL;
+    if (i >= len || (json[i] != '.' && json[i] != 'e' && json[i] != 'E')) {
+        size_t n_digits = i - int_start;
+        *pos = i;
+        // Small integer - common case, no allocation beyond the PyLong
+        if (__builtin_expect(n_digits <= 18, 1)) {
+            return PyLong_FromLongLong(is_negative ? -(long long)mant : (long long)mant);
+        }
+        return json_parse_big_int(json + int_start, n_digits, is_negative);
     }
-    PyObject *cls_obj = args[0];
-    PyObject *data = args[1];
-    if (!PyType_Check(cls_obj) || !PyDict_Check(data)) {
-        PyErr_SetString(PyExc_TypeError, "construct_validated: expected (class, dict)");
-        return NULL;
+
+    if (json[i] == '.') {
+        size_t frac_start = ++i;
+        while (i < len && json[i] >= '0' && json[i] <= '9') {
+            unsigned d = (unsigned)(json[i] - '0');
+            if (sig < 19) {
+                mant = mant * 10 + d;
+                sig += mant != 0;
+                exp10--;
+            } else {
+                truncated |= d != 0;
+            }
+            i++;
+        }
+        if (__builtin_expect(i == frac_start, 0)) goto invalid;
     }
-    PyTypeObject *cls = (PyTypeObject*)cls_obj;
 
-    PyObject *info_capsule = g_fastinfo_key
-        ? PyDict_GetItemWithError(cls->tp_dict, g_fastinfo_key)
-        : NULL;
-    if (!info_capsule) {
-        if (!PyErr_Occurred()) {
-            PyErr_SetString(PyExc_TypeError,
-                            "construct_validated: class has no fast-construct info");
+    if (i < len && (json[i] == 'e' || json[i] == 'E')) {
+        i++;
+        int exp_negative = 0;
+        if (i < len && (json[i] == '+' || json[i] == '-')) {
+            exp_negative = json[i] == '-';
+            i++;
         }
-        return NULL;
+        size_t exp_start = i;
+        int64_t e = 0;
+        while (i < len && json[i] >= '0' && json[i] <= '9') {
+            if (e < 100000) e = e * 10 + (json[i] - '0');  // saturate: far past any double
+            i++;
+        }
+        if (__builtin_expect(i == exp_start, 0)) goto invalid;
+        exp10 += exp_negative ? -e : e;
     }
-    FastConstructInfo *info = (FastConstructInfo*)PyCapsule_GetPointer(info_capsule, "dhi.fast_construct");
-    if (!info) return NULL;
 
-    PyObject *self = cls->tp_alloc(cls, 0);
-    if (!self) return NULL;
+    double value;
+#if FLT_EVAL_METHOD == 0
+    // Clinger: mantissa and power of ten are both exact doubles, so a single
+    // IEEE multiply/divide is correctly rounded
+    if (!truncated && mant <= (1ULL << 53) && exp10 >= -22 && exp10 <= 22) {
+        value = (double)mant;
+        value = exp10 < 0 ? value / dhi_exact_pow10[-exp10] : value * dhi_exact_pow10[exp10];
+        *pos = i;
+        return PyFloat_FromDouble(is_negative ? -value : value);
+    }
+#endif
+    if (dhi_eisel_lemire(mant, exp10, is_negative, &value)) {
+        double upper;
+        // Dropped digits: the answer is only certain if mant and mant+1 agree
+        if (!truncated || (dhi_eisel_lemire(mant + 1, exp10, is_negative, &upper) &&
+                           upper == value)) {
+            *pos = i;
+            return PyFloat_FromDouble(value);
+        }
+    }
 
-    PyObject *result = init_model_core(self, info->ms, info->extra_mode, data, NULL, NULL);
-    if (!result) { Py_DECREF(self); return NULL; }
-    if (result == Py_None) {
-        Py_DECREF(result);
-        return self;
+    size_t end;
+    if (dhi_parse_json_float(json, len, start, &value, &end) != 0) goto invalid;
+    *pos = end;
+    return PyFloat_FromDouble(value);
+
+invalid:
+    PyErr_SetString(PyExc_ValueError, "Invalid float");
+    return NULL;
+}
+
+// Skip a JSON value (for unknown fields)
+__attribute__((unused))
+static int json_skip_value(const char *json, size_t *pos, size_t len) {
+    SKIP_WS(json, *pos, len);
+    if (*pos >= len) return 0;
+
+    char c = json[*pos];
+
+    if (c == '"') {
+        // Skip string
+        (*pos)++;
+        while (*pos < len) {
+            if (json[*pos] == '\\') (*pos) += 2;
+            else if (json[*pos] == '"') { (*pos)++; return 1; }
+            else (*pos)++;
+        }
+        return 0;
+    } else if (c == '{') {
+        // Skip object
+        (*pos)++;
+        int depth = 1;
+        while (*pos < len && depth > 0) {
+            if (json[*pos] == '{') depth++;
+            else if (json[*pos] == '}') depth--;
+            else if (json[*pos] == '"') {
+                (*pos)++;
+                while (*pos < len && json[*pos] != '"') {
+                    if (json[*pos] == '\\') (*pos)++;
+                    (*pos)++;
+                }
+            }
+            (*pos)++;
+        }
+        return depth == 0;
+    } else if (c == '[') {
+        // Skip array
+        (*pos)++;
+        int depth = 1;
+        while (*pos < len && depth > 0) {
+            if (json[*pos] == '[') depth++;
+            else if (json[*pos] == ']') depth--;
+            else if (json[*pos] == '"') {
+                (*pos)++;
+                while (*pos < len && json[*pos] != '"') {
+                    if (json[*pos] == '\\') (*pos)++;
+                    (*pos)++;
+                }
+            }
+            (*pos)++;
+        }
+        return depth == 0;
+    } else if (c == 't' && *pos + 4 <= len && memcmp(&json[*pos], "true", 4) == 0) {
+        *pos += 4; return 1;
+    } else if (c == 'f' && *pos + 5 <= len && memcmp(&json[*pos], "false", 5) == 0) {
+        *pos += 5; return 1;
+    } else if (c == 'n' && *pos + 4 <= len && memcmp(&json[*pos], "null", 4) == 0) {
+        *pos += 4; return 1;
+    } else if (c == '-' || (c >= '0' && c <= '9')) {
+        // Skip number
+        if (c == '-') (*pos)++;
+        while (*pos < len && json[*pos] >= '0' && json[*pos] <= '9') (*pos)++;
+        if (*pos < len && json[*pos] == '.') {
+            (*pos)++;
+            while (*pos < len && json[*pos] >= '0' && json[*pos] <= '9') (*pos)++;
+        }
+        if (*pos < len && (json[*pos] == 'e' || json[*pos] == 'E')) {
+            (*pos)++;
+            if (*pos < len && (json[*pos] == '+' || json[*pos] == '-')) (*pos)++;
+            while (*pos < len && json[*pos] >= '0' && json[*pos] <= '9') (*pos)++;
+        }
+        return 1;
     }
+    return 0;
+}
+
+// SIMD-accelerated skip value using Zig backend
+static int json_skip_value_simd(const char *json, size_t *pos, size_t len) {
+    size_t end;
+    int result = dhi_skip_json_value(json, len, *pos, &end);
+    if (result != 0) return 0;
+    *pos = end;
+    return 1;
+}
+
+// =============================================================================
+// STRUCTURAL INDEX - classify each byte once, shared by splitter and decoder
+// =============================================================================
+// Built in one SIMD pass by the Zig stage-1 scanner: the offset of every
+// structural character outside strings plus both quotes of every string.
+// The decoder looks entries up through a forward-moving cursor, so string
+// bounds and nested-value extents come straight from the index instead of
+// rescanning bytes. A NULL index means "scan inline" everywhere.
+
+#define DHI_SI_ESCAPED     0x80000000u  // closing quote of a string with escapes
+#define DHI_SI_OFFSET_MASK 0x7FFFFFFFu
+#define DHI_SI_MAX_LEN     ((size_t)DHI_SI_OFFSET_MASK)
+
+typedef struct {
+    uint32_t *entries;
+    size_t n;
+    size_t cur;  // first entry >= the last looked-up offset
+} DhiJsonIndex;
+
+static void dhi_index_free(DhiJsonIndex *ix) {
+    free(ix->entries);
+    ix->entries = NULL;
+    ix->n = ix->cur = 0;
+}
 
-    PyObject *r = PyObject_CallFunctionObjArgs(info->raiser, result, NULL);
-    Py_DECREF(result);
-    Py_XDECREF(r);
-    Py_DECREF(self);
-    if (!PyErr_Occurred()) {
-        PyErr_SetString(PyExc_ValueError, "dhi: validation failed");
+// Build the index for json[0..len). Returns 0, or -1 with MemoryError set.
+static int dhi_index_build(DhiJsonIndex *ix, const char *json, size_t len) {
+    DhiStructuralIndexState state = {0, 0, 0, 0};
+    // Typical JSON has one structural entry per 4-8 bytes; grow on demand
+    size_t cap = len / 4 + 64;
+    ix->entries = (uint32_t*)malloc(cap * sizeof(uint32_t));
+    ix->n = ix->cur = 0;
+    if (!ix->entries) { PyErr_NoMemory(); return -1; }
+
+    for (;;) {
+        ix->n += dhi_json_structural_index(json, len, &state, ix->entries + ix->n, cap - ix->n);
+        if (state.offset >= len) return 0;
+        cap *= 2;
+        uint32_t *grown = (uint32_t*)realloc(ix->entries, cap * sizeof(uint32_t));
+        if (!grown) { dhi_index_free(ix); PyErr_NoMemory(); return -1; }
+        ix->entries = grown;
     }
-    return NULL;
 }
 
-// disable_fast_construct(cls) -> None
-static PyObject* py_disable_fast_construct(PyObject* self_unused, PyObject* args) {
-    PyObject *cls_obj;
-    if (!PyArg_ParseTuple(args, "O", &cls_obj)) return NULL;
-    if (!PyType_Check(cls_obj)) {
-        PyErr_SetString(PyExc_TypeError, "disable_fast_construct: argument must be a class");
-        return NULL;
+// Move the cursor to the first entry >= offset; true if that entry is offset
+static inline int dhi_index_seek(DhiJsonIndex *ix, size_t offset) {
+    size_t k = ix->cur;
+    if (__builtin_expect(k > 0 && (ix->entries[k - 1] & DHI_SI_OFFSET_MASK) >= offset, 0)) {
+        // Rewound (union retry) - binary search
+        size_t lo = 0, hi = k;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if ((ix->entries[mid] & DHI_SI_OFFSET_MASK) < offset) lo = mid + 1;
+            else hi = mid;
+        }
+        k = lo;
     }
-#if PY_VERSION_HEX >= 0x030C0000
-    ((PyTypeObject*)cls_obj)->tp_vectorcall = NULL;
-#endif
-    if (g_fastinfo_key &&
-        PyDict_GetItemWithError(((PyTypeObject*)cls_obj)->tp_dict, g_fastinfo_key)) {
-        if (PyObject_DelAttr(cls_obj, g_fastinfo_key) < 0) return NULL;
-    } else if (PyErr_Occurred()) {
-        return NULL;
+    while (k < ix->n && (ix->entries[k] & DHI_SI_OFFSET_MASK) < offset) k++;
+    ix->cur = k;
+    return k < ix->n && (ix->entries[k] & DHI_SI_OFFSET_MASK) == offset;
+}
+
+// String token at *pos: bounds from the index when available, else scan
+__attribute__((always_inline))
+static inline char* decoder_scan_string(const char *json, size_t *pos, size_t len,
+                                        size_t *out_len, int *needs_unescape,
+                                        DhiJsonIndex *ix) {
+    if (ix && dhi_index_seek(ix, *pos) && ix->cur + 1 < ix->n) {
+        // Entry after an opening quote is always its closing quote
+        uint32_t close = ix->entries[ix->cur + 1];
+        size_t end = close & DHI_SI_OFFSET_MASK;
+        char *start = (char*)&json[*pos + 1];
+        *out_len = end - *pos - 1;
+        *needs_unescape = (close & DHI_SI_ESCAPED) != 0;
+        ix->cur += 2;
+        *pos = end + 1;
+        return start;
+    }
+    return json_parse_string_simd(json, pos, len, out_len, needs_unescape);
+}
+
+// Skip a value; objects/arrays jump to their matching close via the index
+static int decoder_skip_value(const char *json, size_t *pos, size_t len, DhiJsonIndex *ix) {
+    char c = json[*pos];
+    if (ix && (c == '{' || c == '[') && dhi_index_seek(ix, *pos)) {
+        size_t depth = 0;
+        for (size_t k = ix->cur; k < ix->n; k++) {
+            size_t off = ix->entries[k] & DHI_SI_OFFSET_MASK;
+            char e = json[off];
+            if (e == '{' || e == '[') {
+                depth++;
+            } else if (e == '}' || e == ']') {
+                if (--depth == 0) {
+                    ix->cur = k + 1;
+                    *pos = off + 1;
+                    return 1;
+                }
+            }
+        }
+        return 0;
     }
-    Py_RETURN_NONE;
+    return json_skip_value_simd(json, pos, len);
 }
 
 // =============================================================================
-// dump_model_compiled: Ultra-fast dict dump using pre-compiled specs
-// Returns Python dict directly without intermediate processing
+// VALUE CACHE - shared str/int objects for repeated JSON values
 // =============================================================================
-// Forward declaration for recursive dump
-static PyObject* dump_model_recursive(PyObject *model_self);
+// Event streams repeat a small set of enum-like strings ("ok", "GET") and
+// counters millions of times. A Decoder with the cache enabled keeps a
+// bounded direct-mapped table keyed on the raw token bytes, so a repeated
+// value costs an INCREF instead of a new object. Only unescaped strings of up
+// to DHI_VCACHE_MAX_LEN bytes and ints of up to 18 digits are cached; a
+// colliding value simply takes over the slot.
 
-// Helper: dump a single value, recursing into BaseModel instances and lists
-static PyObject* dump_value_recursive(PyObject *value) {
-    // Check if value has __dhi_fields__ (is a BaseModel)
-    if (PyObject_HasAttrString(value, "__dhi_fields__")) {
-        return dump_model_recursive(value);
-    }
-    // Check if value is a list - recurse into items
-    if (PyList_Check(value)) {
-        Py_ssize_t len = PyList_GET_SIZE(value);
-        PyObject *new_list = PyList_New(len);
-        if (!new_list) return NULL;
-        for (Py_ssize_t i = 0; i < len; i++) {
-            PyObject *item = PyList_GET_ITEM(value, i);
-            PyObject *dumped;
-            if (PyObject_HasAttrString(item, "__dhi_fields__")) {
-                dumped = dump_model_recursive(item);
-            } else {
-                dumped = item;
-                Py_INCREF(dumped);
-            }
-            if (!dumped) { Py_DECREF(new_list); return NULL; }
-            PyList_SET_ITEM(new_list, i, dumped);  // steals ref
-        }
-        return new_list;
+#define DHI_VCACHE_BITS    10
+#define DHI_VCACHE_SLOTS   (1 << DHI_VCACHE_BITS)
+#define DHI_VCACHE_MAX_LEN 48
+
+#define DHI_VCACHE_STR 1
+#define DHI_VCACHE_INT 2
+
+typedef struct {
+    PyObject *value;        // strong ref, or NULL when empty
+    uint64_t hash;
+    uint32_t len;
+    uint32_t kind;
+    char bytes[DHI_VCACHE_MAX_LEN];
+} DhiValueCacheSlot;
+
+typedef struct {
+    int all_fields;         // cache every field, not only Field(cache_strings=True)
+    uint64_t hits, misses;
+    Py_ssize_t used;
+    DhiValueCacheSlot slots[DHI_VCACHE_SLOTS];
+} DhiValueCache;
+
+static void dhi_vcache_free(DhiValueCache *cache) {
+    if (!cache) return;
+    for (size_t k = 0; k < DHI_VCACHE_SLOTS; k++) Py_XDECREF(cache->slots[k].value);
+    free(cache);
+}
+
+static inline int dhi_vcache_wants(const DhiValueCache *cache, const CompiledFieldSpec *fs) {
+    return cache && (cache->all_fields || fs->cache_strings);
+}
+
+// Slot for the token; *hit says whether it already holds this value
+static inline DhiValueCacheSlot* dhi_vcache_slot(DhiValueCache *cache, uint32_t kind,
+                                                 const char *s, size_t n, int *hit) {
+    uint64_t h = fnv1a_hash_inline(s, n) + kind;
+    DhiValueCacheSlot *slot =
+        &cache->slots[(h * 0x9E3779B97F4A7C15ULL) >> (64 - DHI_VCACHE_BITS)];
+    *hit = slot->value && slot->hash == h && slot->len == n && slot->kind == kind &&
+           memcmp(slot->bytes, s, n) == 0;
+    if (*hit) {
+        cache->hits++;
+    } else {
+        cache->misses++;
+        slot->hash = h;  // claimed by the caller's store
     }
+    return slot;
+}
+
+static inline void dhi_vcache_store(DhiValueCache *cache, DhiValueCacheSlot *slot,
+                                    uint32_t kind, const char *s, size_t n,
+                                    PyObject *value) {
+    if (!slot->value) cache->used++;
     Py_INCREF(value);
+    Py_XSETREF(slot->value, value);
+    slot->len = (uint32_t)n;
+    slot->kind = kind;
+    memcpy(slot->bytes, s, n);
+}
+
+// str for an unescaped string token (n <= DHI_VCACHE_MAX_LEN)
+static inline PyObject* dhi_vcache_str(DhiValueCache *cache, const char *s, size_t n) {
+    int hit;
+    DhiValueCacheSlot *slot = dhi_vcache_slot(cache, DHI_VCACHE_STR, s, n, &hit);
+    if (hit) {
+        Py_INCREF(slot->value);
+        return slot->value;
+    }
+    PyObject *value = PyUnicode_FromStringAndSize(s, n);
+    if (value) dhi_vcache_store(cache, slot, DHI_VCACHE_STR, s, n, value);
     return value;
 }
 
-// Recursive dump: handles nested models and list-of-models
-static PyObject* dump_model_recursive(PyObject *model_self) {
-    PyObject *obj_dict = PyObject_GenericGetDict(model_self, NULL);
-    if (!obj_dict) return NULL;
+// Number at *pos: ints of 3..18 digits go through the cache (CPython already
+// shares the smaller ones), everything else is parsed as usual
+static inline PyObject* dhi_vcache_number(DhiValueCache *cache, const char *json,
+                                          size_t *pos, size_t len) {
+    size_t start = *pos, i = start;
+    if (i < len && json[i] == '-') i++;
+    size_t digits = i;
+    while (i < len && json[i] >= '0' && json[i] <= '9') i++;
+    digits = i - digits;
+    if (digits < 3 || digits > 18 ||
+        (i < len && (json[i] == '.' || json[i] == 'e' || json[i] == 'E'))) {
+        return json_parse_number_simd(json, pos, len);
+    }
+    size_t n = i - start;
+    int hit;
+    DhiValueCacheSlot *slot = dhi_vcache_slot(cache, DHI_VCACHE_INT, json + start, n, &hit);
+    if (hit) {
+        *pos = i;
+        Py_INCREF(slot->value);
+        return slot->value;
+    }
+    PyObject *value = json_parse_number_simd(json, pos, len);
+    if (value) dhi_vcache_store(cache, slot, DHI_VCACHE_INT, json + start, n, value);
+    return value;
+}
 
-    // Get compiled specs if available
-    PyObject *compiled_attr = PyObject_GetAttrString((PyObject*)Py_TYPE(model_self), "__dhi_compiled_specs__");
-    if (!compiled_attr || compiled_attr == Py_None) {
-        Py_XDECREF(compiled_attr);
-        // Fallback: call Python model_dump
-        Py_DECREF(obj_dict);
-        return PyObject_CallMethod(model_self, "model_dump", NULL);
+// =============================================================================
+// NESTED VALUE DECODING - objects/arrays decoded straight into their targets
+// =============================================================================
+// Nested Struct fields (type_code 6), lists of models (7) and unions (8) are
+// decoded in place from the JSON bytes: a nested object becomes a DhiStruct
+// instance directly, with no intermediate dict. Untyped fields (type_code 0)
+// get plain list/dict values.
+
+typedef struct DhiLazySourceObject DhiLazySourceObject;
+
+static int decoder_parse_object(DhiStructObject *self, const char *json,
+                                size_t *pos_io, size_t len,
+                                CompiledModelSpecs *ms, PyObject **errors_out,
+                                DhiJsonIndex *ix, DhiValueCache *cache,
+                                DhiLazySourceObject *lazy);
+
+static PyObject *g_compiled_specs_key = NULL;
+
+// Compiled specs of a Struct class (interned key - no temp str per lookup)
+static CompiledModelSpecs* decoder_struct_specs(PyTypeObject *type) {
+    DhiStructMetaObject *meta = DhiStruct_meta(type);
+    if (meta) return meta->ms;
+    if (!g_compiled_specs_key) {
+        g_compiled_specs_key = PyUnicode_InternFromString("__dhi_compiled_specs__");
+        if (!g_compiled_specs_key) return NULL;
+    }
+    PyObject *capsule = PyDict_GetItemWithError(type->tp_dict, g_compiled_specs_key);
+    if (!capsule) {
+        if (!PyErr_Occurred()) {
+            PyErr_Format(PyExc_ValueError, "Struct class %s not initialized", type->tp_name);
+        }
+        return NULL;
     }
+    return (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
+}
 
-    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(compiled_attr, "dhi.compiled_specs");
-    if (!ms) {
-        Py_DECREF(compiled_attr);
-        Py_DECREF(obj_dict);
-        return PyObject_CallMethod(model_self, "model_dump", NULL);
+// Parse a JSON string token into a str object
+static inline PyObject* decoder_parse_str(const char *json, size_t *pos, size_t len,
+                                           DhiJsonIndex *ix) {
+    size_t str_len;
+    int needs_esc;
+    char *str_start = decoder_scan_string(json, pos, len, &str_len, &needs_esc, ix);
+    if (__builtin_expect(!str_start, 0)) {
+        PyErr_SetString(PyExc_ValueError, "Invalid string value");
+        return NULL;
+    }
+    if (__builtin_expect(needs_esc, 0)) {
+        return json_unescape_string(str_start, str_len);
     }
+    return PyUnicode_FromStringAndSize(str_start, str_len);
+}
 
-    PyObject *result = _PyDict_NewPresized(ms->n_fields);
-    if (!result) { Py_DECREF(compiled_attr); Py_DECREF(obj_dict); return NULL; }
+// Parse any JSON value into plain Python objects (dict/list/str/int/float/bool/None)
+static PyObject* decoder_parse_any(const char *json, size_t *pos, size_t len, DhiJsonIndex *ix) {
+    SKIP_WS(json, *pos, len);
+    if (__builtin_expect(*pos >= len, 0)) {
+        PyErr_SetString(PyExc_ValueError, "Unexpected end of JSON");
+        return NULL;
+    }
 
-    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
-        CompiledFieldSpec *fs = &ms->specs[i];
-        PyObject *value = PyDict_GetItem(obj_dict, fs->name_obj);
-        if (!value) continue;
+    char c = json[*pos];
+    if (c == '"') return decoder_parse_str(json, pos, len, ix);
+    if (c == '-' || (c >= '0' && c <= '9')) return json_parse_number_simd(json, pos, len);
+    if (c == 't' && *pos + 4 <= len && memcmp(&json[*pos], "true", 4) == 0) {
+        *pos += 4; Py_RETURN_TRUE;
+    }
+    if (c == 'f' && *pos + 5 <= len && memcmp(&json[*pos], "false", 5) == 0) {
+        *pos += 5; Py_RETURN_FALSE;
+    }
+    if (c == 'n' && *pos + 4 <= len && memcmp(&json[*pos], "null", 4) == 0) {
+        *pos += 4; Py_RETURN_NONE;
+    }
+    if (c != '[' && c != '{') {
+        PyErr_SetString(PyExc_ValueError, "Invalid JSON value");
+        return NULL;
+    }
 
-        if (fs->type_code == 6 || fs->type_code == 8) {
-            // Nested model or union - recurse
-            PyObject *dumped = dump_value_recursive(value);
-            if (!dumped) { Py_DECREF(result); Py_DECREF(compiled_attr); Py_DECREF(obj_dict); return NULL; }
-            PyDict_SetItem(result, fs->name_obj, dumped);
-            Py_DECREF(dumped);
-        } else if (fs->type_code == 7) {
-            // List of models - recurse into list
-            PyObject *dumped = dump_value_recursive(value);
-            if (!dumped) { Py_DECREF(result); Py_DECREF(compiled_attr); Py_DECREF(obj_dict); return NULL; }
-            PyDict_SetItem(result, fs->name_obj, dumped);
-            Py_DECREF(dumped);
-        } else {
-            // Simple value - direct copy
-            PyDict_SetItem(result, fs->name_obj, value);
+    if (Py_EnterRecursiveCall(" while decoding JSON")) return NULL;
+    (*pos)++;
+    PyObject *result;
+
+    if (c == '[') {
+        result = PyList_New(0);
+        if (!result) goto done;
+        SKIP_WS(json, *pos, len);
+        if (*pos < len && json[*pos] == ']') { (*pos)++; goto done; }
+        for (;;) {
+            PyObject *item = decoder_parse_any(json, pos, len, ix);
+            if (!item || PyList_Append(result, item) < 0) {
+                Py_XDECREF(item);
+                Py_CLEAR(result);
+                goto done;
+            }
+            Py_DECREF(item);
+            SKIP_WS(json, *pos, len);
+            if (*pos < len && json[*pos] == ',') { (*pos)++; continue; }
+            if (*pos < len && json[*pos] == ']') { (*pos)++; goto done; }
+            PyErr_SetString(PyExc_ValueError, "Expected ',' or ']' in array");
+            Py_CLEAR(result);
+            goto done;
         }
     }
 
-    Py_DECREF(compiled_attr);
-    Py_DECREF(obj_dict);
+    result = PyDict_New();
+    if (!result) goto done;
+    SKIP_WS(json, *pos, len);
+    if (*pos < len && json[*pos] == '}') { (*pos)++; goto done; }
+    for (;;) {
+        SKIP_WS(json, *pos, len);
+        if (__builtin_expect(*pos >= len || json[*pos] != '"', 0)) {
+            PyErr_SetString(PyExc_ValueError, "Expected field name");
+            Py_CLEAR(result);
+            goto done;
+        }
+        PyObject *key = decoder_parse_str(json, pos, len, ix);
+        if (!key) { Py_CLEAR(result); goto done; }
+        SKIP_WS(json, *pos, len);
+        if (__builtin_expect(*pos >= len || json[*pos] != ':', 0)) {
+            Py_DECREF(key);
+            PyErr_SetString(PyExc_ValueError, "Expected ':'");
+            Py_CLEAR(result);
+            goto done;
+        }
+        (*pos)++;
+        PyObject *item = decoder_parse_any(json, pos, len, ix);
+        if (!item || PyDict_SetItem(result, key, item) < 0) {
+            Py_DECREF(key);
+            Py_XDECREF(item);
+            Py_CLEAR(result);
+            goto done;
+        }
+        Py_DECREF(key);
+        Py_DECREF(item);
+        SKIP_WS(json, *pos, len);
+        if (*pos < len && json[*pos] == ',') { (*pos)++; continue; }
+        if (*pos < len && json[*pos] == '}') { (*pos)++; goto done; }
+        PyErr_SetString(PyExc_ValueError, "Expected ',' or '}' in object");
+        Py_CLEAR(result);
+        goto done;
+    }
+
+done:
+    Py_LeaveRecursiveCall();
     return result;
 }
 
-static PyObject* py_dump_model_compiled(PyObject* self_unused, PyObject* args) {
-    PyObject *model_self, *capsule;
+// Join nested (name, msg) error tuples into one "msg; msg" string
+static PyObject* decoder_join_errors(PyObject *errors) {
+    PyObject *msgs = PyList_New(PyList_GET_SIZE(errors));
+    if (!msgs) return NULL;
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(errors); i++) {
+        PyObject *msg = PyTuple_GET_ITEM(PyList_GET_ITEM(errors, i), 1);
+        Py_INCREF(msg);
+        PyList_SET_ITEM(msgs, i, msg);
+    }
+    PyObject *sep = PyUnicode_FromString("; ");
+    PyObject *joined = sep ? PyUnicode_Join(sep, msgs) : NULL;
+    Py_XDECREF(sep);
+    Py_DECREF(msgs);
+    return joined;
+}
 
-    if (!PyArg_ParseTuple(args, "OO", &model_self, &capsule)) {
-        return NULL;
-    }
+// Decode the JSON object at *pos into a new instance of model_type.
+// Returns a new reference on success. On failure returns NULL and either:
+//   - sets a Python exception (malformed JSON / memory) - caller must abort, or
+//   - leaves no exception and stores a validation message in *err_msg.
+// In the validation case *pos has still advanced past the object.
+static PyObject* decoder_decode_model(PyObject *model_type, const char *json,
+                                      size_t *pos, size_t len, PyObject **err_msg,
+                                      DhiJsonIndex *ix, DhiValueCache *cache) {
+    *err_msg = NULL;
+
+    if (PyType_Check(model_type) &&
+        PyType_IsSubtype((PyTypeObject*)model_type, &DhiStructType)) {
+        // Struct: decode fields directly into the C value array
+        PyTypeObject *type = (PyTypeObject*)model_type;
+        CompiledModelSpecs *ms = decoder_struct_specs(type);
+        if (!ms) return NULL;
+        DhiStructObject *obj = DhiStruct_alloc(type, ms->n_fields);
+        if (!obj) return NULL;
+
+        PyObject *sub_errors = NULL;
+        if (Py_EnterRecursiveCall(" while decoding nested JSON")) {
+            Py_DECREF(obj);
+            return NULL;
+        }
+        int r = decoder_parse_object(obj, json, pos, len, ms, &sub_errors, ix, cache, NULL);
+        Py_LeaveRecursiveCall();
+        if (r < 0) {
+            Py_DECREF(obj);
+            return NULL;
+        }
+        if (sub_errors) {
+            Py_DECREF(obj);
+            *err_msg = decoder_join_errors(sub_errors);
+            Py_DECREF(sub_errors);
+            return NULL;  // exception set only if join failed
+        }
+        return (PyObject*)obj;
+    }
+
+    // Other model classes (e.g. BaseModel): build kwargs and call the class
+    PyObject *data = decoder_parse_any(json, pos, len, ix);
+    if (!data) return NULL;
+    if (!g_empty_tuple) {
+        g_empty_tuple = PyTuple_New(0);
+        if (!g_empty_tuple) { Py_DECREF(data); return NULL; }
+    }
+    PyObject *inst = PyObject_Call(model_type, g_empty_tuple, data);
+    Py_DECREF(data);
+    if (!inst && (PyErr_ExceptionMatches(PyExc_ValueError) ||
+                  PyErr_ExceptionMatches(PyExc_TypeError))) {
+        PyObject *exc_type, *exc_value, *exc_tb;
+        PyErr_Fetch(&exc_type, &exc_value, &exc_tb);
+        *err_msg = exc_value ? PyObject_Str(exc_value) : PyUnicode_FromString("invalid value");
+        Py_XDECREF(exc_type);
+        Py_XDECREF(exc_value);
+        Py_XDECREF(exc_tb);
+    }
+    return inst;
+}
 
-    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
-    if (!ms) return NULL;
+// Try each type of a union in order, rewinding to the same object each time
+static PyObject* decoder_decode_union(PyObject *types, const char *json,
+                                      size_t *pos, size_t len, PyObject **err_msg,
+                                      DhiJsonIndex *ix, DhiValueCache *cache) {
+    Py_ssize_t n_types = PyTuple_GET_SIZE(types);
+    size_t start = *pos;
+    *err_msg = NULL;
 
-    // Use recursive dump that handles nested models
-    return dump_model_recursive(model_self);
+    // Single-type lists (List[Model]) keep the nested message for context
+    if (n_types == 1) {
+        return decoder_decode_model(PyTuple_GET_ITEM(types, 0), json, pos, len, err_msg, ix, cache);
+    }
+
+    for (Py_ssize_t t = 0; t < n_types; t++) {
+        size_t p = start;
+        PyObject *msg = NULL;
+        PyObject *inst = decoder_decode_model(PyTuple_GET_ITEM(types, t), json, &p, len, &msg, ix,
+                                              cache);
+        if (inst) { *pos = p; return inst; }
+        if (!msg) return NULL;  // malformed JSON - same for every type
+        Py_DECREF(msg);
+        *pos = p;
+    }
+    *err_msg = PyUnicode_FromString("Value does not match any expected type");
+    return NULL;
 }
 
-static PyObject* py_dump_json_compiled(PyObject* self_unused, PyObject* args) {
-    PyObject *model_self, *capsule;
+// Record a field error: "<field>: <msg>"
+static int decoder_add_error(PyObject **errors, CompiledFieldSpec *fs, PyObject *msg) {
+    if (!msg) return -1;
+    if (!*errors) {
+        *errors = PyList_New(0);
+        if (!*errors) { Py_DECREF(msg); return -1; }
+    }
+    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg);
+    Py_DECREF(msg);
+    if (!err) return -1;
+    int r = PyList_Append(*errors, err);
+    Py_DECREF(err);
+    return r;
+}
 
-    if (!PyArg_ParseTuple(args, "OO", &model_self, &capsule)) {
-        return NULL;
+// Decode a model-typed field value (type_code 6/7/8) at *pos.
+// Returns 1 with *out set, 0 if a validation error was recorded, -1 on fatal error.
+static int decoder_parse_model_field(CompiledFieldSpec *fs, const char *json,
+                                     size_t *pos, size_t len,
+                                     PyObject **out, PyObject **errors,
+                                     DhiJsonIndex *ix, DhiValueCache *cache) {
+    const char *field_name = fs->name_ptr;
+    char c = json[*pos];
+    PyObject *err_msg = NULL;
+
+    // null is accepted for Optional[...] = None fields
+    if (c == 'n' && *pos + 4 <= len && memcmp(&json[*pos], "null", 4) == 0) {
+        *pos += 4;
+        if (!fs->required && fs->default_val == Py_None) {
+            Py_INCREF(Py_None);
+            *out = Py_None;
+            return 1;
+        }
+        return decoder_add_error(errors, fs,
+            PyUnicode_FromFormat("%s: Expected %s, got NoneType", field_name,
+                fs->type_code == 7 ? "list" : "object")) < 0 ? -1 : 0;
+    }
+
+    if (fs->type_code == 7) {
+        // List of models: decode each element straight into its model type
+        if (c != '[') {
+            PyObject *v = decoder_parse_any(json, pos, len, ix);
+            if (!v) return -1;
+            PyObject *msg = PyUnicode_FromFormat("%s: Expected list, got %s",
+                field_name, Py_TYPE(v)->tp_name);
+            Py_DECREF(v);
+            return decoder_add_error(errors, fs, msg) < 0 ? -1 : 0;
+        }
+        PyObject *list = PyList_New(0);
+        if (!list) return -1;
+        int failed = 0;
+        (*pos)++;
+        SKIP_WS(json, *pos, len);
+        if (*pos < len && json[*pos] == ']') {
+            (*pos)++;
+        } else {
+            for (Py_ssize_t j = 0;; j++) {
+                SKIP_WS(json, *pos, len);
+                if (__builtin_expect(*pos >= len, 0)) {
+                    PyErr_SetString(PyExc_ValueError, "Unexpected end of JSON");
+                    Py_DECREF(list);
+                    return -1;
+                }
+                PyObject *item;
+                if (json[*pos] == '{') {
+                    item = decoder_decode_union(fs->union_types_tuple, json, pos, len, &err_msg,
+                                                ix, cache);
+                } else {
+                    item = decoder_parse_any(json, pos, len, ix);
+                    if (item) {
+                        err_msg = PyUnicode_FromFormat("expected object, got %s",
+                            Py_TYPE(item)->tp_name);
+                        Py_CLEAR(item);
+                        if (!err_msg) { Py_DECREF(list); return -1; }
+                    }
+                }
+                if (item) {
+                    int r = PyList_Append(list, item);
+                    Py_DECREF(item);
+                    if (r < 0) { Py_DECREF(list); return -1; }
+                } else if (err_msg) {
+                    PyObject *msg = PyUnicode_FromFormat("%s: Item %zd: %U", field_name, j, err_msg);
+                    Py_CLEAR(err_msg);
+                    if (decoder_add_error(errors, fs, msg) < 0) { Py_DECREF(list); return -1; }
+                    failed = 1;
+                } else {
+                    Py_DECREF(list);
+                    return -1;
+                }
+                SKIP_WS(json, *pos, len);
+                if (*pos < len && json[*pos] == ',') { (*pos)++; continue; }
+                if (*pos < len && json[*pos] == ']') { (*pos)++; break; }
+                PyErr_SetString(PyExc_ValueError, "Expected ',' or ']' in array");
+                Py_DECREF(list);
+                return -1;
+            }
+        }
+        if (failed) { Py_DECREF(list); return 0; }
+
+        // Length constraints on the list
+        Py_ssize_t list_len = PyList_GET_SIZE(list);
+        if (__builtin_expect((fs->has_minl && list_len < fs->min_len) ||
+                             (fs->has_maxl && list_len > fs->max_len), 0)) {
+            Py_DECREF(list);
+            PyObject *msg = (fs->has_minl && list_len < fs->min_len)
+                ? PyUnicode_FromFormat("%s: Length must be >= %zd, got %zd",
+                      field_name, fs->min_len, list_len)
+                : PyUnicode_FromFormat("%s: Length must be <= %zd, got %zd",
+                      field_name, fs->max_len, list_len);
+            return decoder_add_error(errors, fs, msg) < 0 ? -1 : 0;
+        }
+        *out = list;
+        return 1;
     }
 
-    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
-    if (!ms) return NULL;
-
-    PyObject *obj_dict = PyObject_GenericGetDict(model_self, NULL);
-    if (!obj_dict) return NULL;
+    // Nested model (6) or union of models (8): must be a JSON object
+    if (c != '{') {
+        PyObject *v = decoder_parse_any(json, pos, len, ix);
+        if (!v) return -1;
+        PyObject *msg = fs->type_code == 6
+            ? PyUnicode_FromFormat("%s: Expected %s or dict, got %s", field_name,
+                  ((PyTypeObject*)fs->nested_model_type)->tp_name, Py_TYPE(v)->tp_name)
+            : PyUnicode_FromFormat("%s: Value does not match any expected type", field_name);
+        Py_DECREF(v);
+        return decoder_add_error(errors, fs, msg) < 0 ? -1 : 0;
+    }
+
+    PyObject *inst = fs->type_code == 6
+        ? decoder_decode_model(fs->nested_model_type, json, pos, len, &err_msg, ix, cache)
+        : decoder_decode_union(fs->union_types_tuple, json, pos, len, &err_msg, ix, cache);
+    if (inst) { *out = inst; return 1; }
+    if (!err_msg) return -1;
+    PyObject *msg = PyUnicode_FromFormat("%s: %U", field_name, err_msg);
+    Py_DECREF(err_msg);
+    return decoder_add_error(errors, fs, msg) < 0 ? -1 : 0;
+}
 
-    // Initial buffer
-    size_t buf_size = 256;
-    char *buf = malloc(buf_size);
-    if (!buf) { Py_DECREF(obj_dict); return PyErr_NoMemory(); }
-    size_t pos = 0;
+// Decode and validate the value at *pos for field fs, advancing *pos past it.
+// Returns 1 with *out set, 0 when the value was invalid (recorded in
+// *errors), -1 on malformed JSON or another exception.
+static int decoder_parse_field(CompiledFieldSpec *fs, const char *json,
+                               size_t *pos, size_t len,
+                               PyObject **out, PyObject **errors,
+                               DhiJsonIndex *ix, DhiValueCache *cache) {
+    // Nested model / list of models / union - decoded recursively in place
+    if (fs->type_code >= 6 && fs->type_code <= 8) {
+        PyObject *nested = NULL;
+        int r = decoder_parse_model_field(fs, json, pos, len, &nested, errors, ix, cache);
+        if (r < 0) return -1;
+        if (r == 0) return 0;
+        *out = nested;
+        return 1;
+    }
 
-    buf[pos++] = '{';
+    // Parse value based on expected type
+    // Track JSON value type to skip redundant type checks
+    PyObject *value = NULL;
+    int json_type = 0;  // 1=int, 2=float, 3=str, 4=bool, 5=null, 6=object, 7=array
+    char c = json[*pos];
 
-    int first = 1;
-    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
-        CompiledFieldSpec *fs = &ms->specs[i];
-        PyObject *value = PyDict_GetItem(obj_dict, fs->name_obj);
-        if (!value) continue;
+    if (c == '"') {
+        // String value - SIMD accelerated parsing
+        json_type = 3;
+        size_t str_len;
+        int needs_esc;
+        char *str_start = decoder_scan_string(json, pos, len, &str_len, &needs_esc, ix);
+        if (__builtin_expect(!str_start, 0)) {
+            PyErr_SetString(PyExc_ValueError, "Invalid string value");
+            return -1;
+        }
 
-        // Comma separator
-        if (!first) {
-            if (json_append(&buf, &buf_size, &pos, ", ", 2) < 0) {
-                free(buf); Py_DECREF(obj_dict); return PyErr_NoMemory();
+        if (fs->type_code >= 9 && !needs_esc) {
+            // date/datetime: built straight from the JSON bytes
+            int r = dhi_iso_to_object(str_start, (Py_ssize_t)str_len, fs->type_code == 10, &value);
+            if (r < 0) return -1;
+            if (r == 0) {
+                DhiFieldError e = {0};
+                e.code = DHI_ERR_FORMAT;
+                e.text = dhi_format_names[fs->type_code == 10 ? 8 : 7];
+                return decoder_add_error(errors, fs, dhi_error_message(fs->name_ptr, fs, &e)) < 0
+                    ? -1 : 0;
             }
+            *out = value;
+            return 1;
+        } else if (__builtin_expect(needs_esc, 0)) {
+            // Rare case: string has escapes
+            value = json_unescape_string(str_start, str_len);
+        } else if (str_len <= DHI_VCACHE_MAX_LEN && dhi_vcache_wants(cache, fs)) {
+            // Repeated value - shared object from the Decoder's cache
+            value = dhi_vcache_str(cache, str_start, str_len);
+        } else {
+            // Common case: no escapes, use faster function
+            value = PyUnicode_FromStringAndSize(str_start, str_len);
         }
-        first = 0;
+        if (__builtin_expect(!value, 0)) return -1;
 
-        // Field name
-        const char *field_name = PyUnicode_AsUTF8(fs->name_obj);
-        Py_ssize_t name_len = strlen(field_name);
-        if (json_escape_string(&buf, &buf_size, &pos, field_name, name_len) < 0) {
-            free(buf); Py_DECREF(obj_dict); return PyErr_NoMemory();
-        }
-        if (json_append(&buf, &buf_size, &pos, ": ", 2) < 0) {
-            free(buf); Py_DECREF(obj_dict); return PyErr_NoMemory();
+    } else if (c == '-' || (c >= '0' && c <= '9')) {
+        // Number value - SIMD accelerated parsing
+        value = dhi_vcache_wants(cache, fs)
+            ? dhi_vcache_number(cache, json, pos, len)
+            : json_parse_number_simd(json, pos, len);
+        if (!value) return -1;
+        json_type = PyFloat_Check(value) ? 2 : 1;
+
+        // Convert int to float if needed
+        if (fs->type_code == 2 && json_type == 1) {
+            PyObject *fval = PyNumber_Float(value);
+            Py_DECREF(value);
+            value = fval;
+            if (!value) return -1;
+            json_type = 2;
         }
 
-        // Value serialization
-        if (value == Py_None) {
-            if (json_append(&buf, &buf_size, &pos, "null", 4) < 0) {
-                free(buf); Py_DECREF(obj_dict); return PyErr_NoMemory();
-            }
-        } else if (PyBool_Check(value)) {
-            if (value == Py_True) {
-                if (json_append(&buf, &buf_size, &pos, "true", 4) < 0) {
-                    free(buf); Py_DECREF(obj_dict); return PyErr_NoMemory();
-                }
-            } else {
-                if (json_append(&buf, &buf_size, &pos, "false", 5) < 0) {
-                    free(buf); Py_DECREF(obj_dict); return PyErr_NoMemory();
-                }
-            }
-        } else if (PyLong_Check(value)) {
-            long val = PyLong_AsLong(value);
-            char num_buf[32];
-            int num_len = snprintf(num_buf, sizeof(num_buf), "%ld", val);
-            if (json_append(&buf, &buf_size, &pos, num_buf, num_len) < 0) {
-                free(buf); Py_DECREF(obj_dict); return PyErr_NoMemory();
-            }
-        } else if (PyFloat_Check(value)) {
-            double val = PyFloat_AsDouble(value);
-            char num_buf[64];
-            int num_len;
-            // Handle special floats
-            if (isinf(val)) {
-                num_len = snprintf(num_buf, sizeof(num_buf), "null"); // JSON doesn't support Infinity
-            } else if (isnan(val)) {
-                num_len = snprintf(num_buf, sizeof(num_buf), "null"); // JSON doesn't support NaN
-            } else {
-                num_len = snprintf(num_buf, sizeof(num_buf), "%.17g", val);
-            }
-            if (json_append(&buf, &buf_size, &pos, num_buf, num_len) < 0) {
-                free(buf); Py_DECREF(obj_dict); return PyErr_NoMemory();
-            }
-        } else if (PyUnicode_Check(value)) {
-            Py_ssize_t str_len;
-            const char *str = PyUnicode_AsUTF8AndSize(value, &str_len);
-            if (!str) { free(buf); Py_DECREF(obj_dict); return NULL; }
-            if (json_escape_string(&buf, &buf_size, &pos, str, str_len) < 0) {
-                free(buf); Py_DECREF(obj_dict); return PyErr_NoMemory();
-            }
-        } else if (PyBytes_Check(value)) {
-            // Encode bytes as base64 or just the raw bytes as string
-            Py_ssize_t bytes_len = PyBytes_GET_SIZE(value);
-            const char *bytes_data = PyBytes_AS_STRING(value);
-            if (json_escape_string(&buf, &buf_size, &pos, bytes_data, bytes_len) < 0) {
-                free(buf); Py_DECREF(obj_dict); return PyErr_NoMemory();
-            }
+    } else if (c == 't' && *pos + 4 <= len && memcmp(&json[*pos], "true", 4) == 0) {
+        value = Py_True;
+        Py_INCREF(value);
+        *pos += 4;
+        json_type = 4;
+    } else if (c == 'f' && *pos + 5 <= len && memcmp(&json[*pos], "false", 5) == 0) {
+        value = Py_False;
+        Py_INCREF(value);
+        *pos += 5;
+        json_type = 4;
+    } else if (c == 'n' && *pos + 4 <= len && memcmp(&json[*pos], "null", 4) == 0) {
+        value = Py_None;
+        Py_INCREF(value);
+        *pos += 4;
+        json_type = 5;
+    } else if (c == '[' || c == '{') {
+        // Array or object on an untyped field - decode to plain list/dict
+        value = decoder_parse_any(json, pos, len, ix);
+        if (!value) return -1;
+        json_type = c == '{' ? 6 : 7;
+    } else {
+        PyErr_SetString(PyExc_ValueError, "Invalid JSON value");
+        return -1;
+    }
+
+    // Type checking - only when JSON type doesn't match expected type
+    // This skips redundant checks when types align (common case)
+    const char *field_name = fs->name_ptr;
+    int type_mismatch = 0;
+
+    if (fs->type_code == 1) {  // int
+        if (json_type != 1) type_mismatch = 1;
+    } else if (fs->type_code == 2) {  // float
+        if (json_type != 1 && json_type != 2) type_mismatch = 1;
+    } else if (fs->type_code == 3) {  // str
+        if (json_type != 3) type_mismatch = 1;
+    } else if (fs->type_code == 4) {  // bool
+        if (json_type != 4) type_mismatch = 1;
+    } else if (fs->type_code >= 9) {  // date / datetime (escaped strings)
+        if (json_type != 3) {
+            type_mismatch = 1;
         } else {
-            // Fallback: use Python's repr or str
-            PyObject *str_obj = PyObject_Str(value);
-            if (!str_obj) { free(buf); Py_DECREF(obj_dict); return NULL; }
-            Py_ssize_t str_len;
-            const char *str = PyUnicode_AsUTF8AndSize(str_obj, &str_len);
-            if (!str) { Py_DECREF(str_obj); free(buf); Py_DECREF(obj_dict); return NULL; }
-            if (json_escape_string(&buf, &buf_size, &pos, str, str_len) < 0) {
-                Py_DECREF(str_obj); free(buf); Py_DECREF(obj_dict); return PyErr_NoMemory();
-            }
-            Py_DECREF(str_obj);
+            PyObject *checked;
+            int r = dhi_plan_run_collect(fs, 0, value, &checked, errors);
+            Py_DECREF(value);
+            if (r <= 0) return r;
+            value = checked;
         }
     }
+    // type_code == 0 (any) or 5 (bytes) - skip type checking
 
-    buf[pos++] = '}';
+    if (__builtin_expect(type_mismatch, 0)) {
+        const char *expected =
+            fs->type_code == 1 ? "int" :
+            fs->type_code == 2 ? "float" :
+            fs->type_code == 3 ? "str" :
+            fs->type_code == 4 ? "bool" :
+            fs->type_code == 9 ? "date" :
+            fs->type_code == 10 ? "datetime" : "unknown";
+        PyObject *msg = PyUnicode_FromFormat("%s: Expected %s, got %s",
+            field_name, expected, Py_TYPE(value)->tp_name);
+        Py_DECREF(value);
+        return decoder_add_error(errors, fs, msg) < 0 ? -1 : 0;
+    }
 
-    Py_DECREF(obj_dict);
+    // Constraints: the rest of the field's validation plan
+    if (fs->n_steps > fs->n_type_steps) {
+        PyObject *checked;
+        int r = dhi_plan_run_collect(fs, fs->n_type_steps, value, &checked, errors);
+        Py_DECREF(value);
+        if (r < 0) return -1;
+        if (r == 0) return 0;
+        value = checked;
+    }
 
-    PyObject *result = PyUnicode_FromStringAndSize(buf, pos);
-    free(buf);
-    return result;
+    *out = value;
+    return 1;
 }
 
 // =============================================================================
-// DhiStruct: HIGH-PERFORMANCE VALIDATED STRUCT (msgspec-like)
+// LAZY DECODING - fields parsed and validated on first access
 // =============================================================================
-// Stores field values in a C array instead of Python __dict__.
-// This eliminates PyDict overhead and provides ~6x speedup over BaseModel.
+// struct_from_json(..., lazy=True) / Decoder(lazy=True) only scan the object:
+// each field's value is skipped structurally and its byte span recorded in a
+// DhiLazySource shared by the instance. Pending slots in values[] point at
+// that source; the field's getset descriptor parses and validates the span
+// the first time it is read and replaces the slot with the value. The source
+// (and with it the JSON buffer) is released once no slot refers to it.
+// Structural errors and missing required fields still fail at decode time.
 
-// Instance object - stores field values directly in C array.
-// MUST use PyObject_VAR_HEAD (not PyObject_HEAD): the type sets tp_itemsize, so
-// CPython treats instances as variable-sized and writes the item count into
-// ob_size at tp_alloc time. With a plain PyObject_HEAD, ob_size would alias
-// values[0], and populating field 0 would clobber it — corrupting Py_SIZE().
-// On CPython <=3.10 a heap subclass stores __dict__ at a negative offset computed
-// from Py_SIZE(obj), so a corrupted ob_size yields a wild __dict__ pointer and a
-// SIGBUS in GC at interpreter shutdown. VAR_HEAD gives ob_size its own slot ahead
-// of values[], so it stays = n_fields and the dict-offset math is correct.
 typedef struct {
-    PyObject_VAR_HEAD
-    PyObject *values[];  // Flexible array member - holds field values
-} DhiStructObject;
-
-// Forward declarations
-static PyTypeObject DhiStructType;
+    size_t start, end;
+} DhiSpan;
 
-// Helper: Get field count from type's tp_dict
-static Py_ssize_t DhiStruct_get_n_fields(PyTypeObject *type) {
-    PyObject *n_fields_obj = PyDict_GetItemString(type->tp_dict, "__dhi_n_fields__");
-    if (!n_fields_obj) return 0;
-    return PyLong_AsSsize_t(n_fields_obj);
+struct DhiLazySourceObject {
+    PyObject_VAR_HEAD
+    PyObject *owner;           // keeps `data` alive: bytes, ASCII str or a private copy
+    const char *data;
+    PyObject *specs_capsule;   // keeps `ms` alive
+    CompiledModelSpecs *ms;
+    DhiSpan spans[];           // per field; valid while its slot points here
+};
+
+static void DhiLazySource_dealloc(DhiLazySourceObject *self) {
+    Py_XDECREF(self->owner);
+    Py_XDECREF(self->specs_capsule);
+    Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
-// tp_new: Allocate object with space for field values
-static PyObject* DhiStruct_new(PyTypeObject *type, PyObject *args, PyObject *kwds) {
-    Py_ssize_t n_fields = DhiStruct_get_n_fields(type);
+static PyTypeObject DhiLazySourceType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "dhi._dhi_native.LazySource",
+    .tp_doc = "JSON bytes behind a lazily decoded Struct's pending fields",
+    .tp_basicsize = sizeof(DhiLazySourceObject),
+    .tp_itemsize = sizeof(DhiSpan),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc = (destructor)DhiLazySource_dealloc,
+};
 
-    // Allocate object with flexible array for values
-    DhiStructObject *self = (DhiStructObject*)type->tp_alloc(type, n_fields);
-    if (!self) return NULL;
+#define DhiLazy_Check(op) (Py_TYPE(op) == &DhiLazySourceType)
+
+// Source for decoding json_data lazily; data/len/tmp come from
+// dhi_json_input_get. Immutable inputs are referenced as they are; buffers
+// are copied, since their contents may change before the fields are read.
+static DhiLazySourceObject* dhi_lazy_source_new(PyObject *json_data, const char *data,
+                                                size_t len, PyObject *tmp,
+                                                DhiStructMetaObject *meta) {
+    DhiLazySourceObject *src = PyObject_NewVar(DhiLazySourceObject, &DhiLazySourceType,
+                                               meta->n_fields);
+    if (!src) return NULL;
+    src->specs_capsule = meta->specs_capsule;
+    Py_INCREF(src->specs_capsule);
+    src->ms = meta->ms;
+    if (tmp || PyBytes_Check(json_data) || PyUnicode_Check(json_data)) {
+        src->owner = tmp ? tmp : json_data;
+        Py_INCREF(src->owner);
+        src->data = data;
+    } else {
+        src->owner = PyBytes_FromStringAndSize(data, (Py_ssize_t)len);
+        if (!src->owner) {
+            Py_DECREF(src);
+            return NULL;
+        }
+        src->data = PyBytes_AS_STRING(src->owner);
+    }
+    return src;
+}
 
-    // Initialize all values to NULL
-    for (Py_ssize_t i = 0; i < n_fields; i++) {
-        self->values[i] = NULL;
+// Serve the class's fields through DhiStruct_lazy_get/set (once per class)
+static int dhi_struct_enable_lazy(PyTypeObject *type) {
+    DhiStructMetaObject *meta = DhiStruct_meta(type);
+    if (!meta) {
+        PyErr_Format(PyExc_TypeError, "lazy decoding needs a Struct subclass, got %s",
+                     type->tp_name);
+        return -1;
+    }
+    if (meta->lazy_fields) return 0;
+    PyObject *field_names = PyDict_GetItemString(type->tp_dict, "__dhi_field_names__");
+    if (!field_names || !PyTuple_Check(field_names)) {
+        PyErr_SetString(PyExc_RuntimeError, "Struct class not initialized (missing field names)");
+        return -1;
     }
+    if (dhi_install_field_members(type, field_names, 1) < 0) return -1;
+    meta->lazy_fields = 1;
+    return 0;
+}
 
-    return (PyObject*)self;
+static int decoder_raise_errors(PyObject *errors) {
+    PyObject *exc_args = Py_BuildValue("(sO)", "Validation failed", errors);
+    if (exc_args) {
+        PyErr_SetObject(PyExc_ValueError, exc_args);
+        Py_DECREF(exc_args);
+    }
+    Py_DECREF(errors);
+    return -1;
 }
 
-// tp_dealloc: Free the object
-static void DhiStruct_dealloc(DhiStructObject *self) {
-    PyTypeObject *type = Py_TYPE(self);
-    Py_ssize_t n_fields = DhiStruct_get_n_fields(type);
+// Decode pending field i in place. 1 done, 0 invalid (recorded in *errors;
+// the field stays pending), -1 malformed span or another exception.
+static int dhi_lazy_load(DhiStructObject *self, Py_ssize_t i, PyObject **errors) {
+    DhiLazySourceObject *src = (DhiLazySourceObject*)self->values[i];
+    size_t pos = src->spans[i].start;
+    PyObject *value;
+    int r = decoder_parse_field(&src->ms->specs[i], src->data, &pos, src->spans[i].end,
+                                &value, errors, NULL, NULL);
+    if (r > 0) Py_SETREF(self->values[i], value);  // may release the source
+    return r;
+}
 
-    // Decref all stored values
-    for (Py_ssize_t i = 0; i < n_fields; i++) {
-        Py_XDECREF(self->values[i]);
+// AttributeError for an unset field, worded like a member descriptor's
+static int dhi_lazy_no_attr(PyObject *op, Py_ssize_t i) {
+    DhiStructMetaObject *meta = DhiStruct_meta(Py_TYPE(op));
+    if (meta && i < meta->n_fields) {
+        PyErr_Format(PyExc_AttributeError, "'%.200s' object has no attribute '%U'",
+                     Py_TYPE(op)->tp_name, meta->ms->specs[i].name_obj);
+    } else {
+        PyErr_Format(PyExc_AttributeError, "'%.200s' object has no field %zd",
+                     Py_TYPE(op)->tp_name, i);
+    }
+    return -1;
+}
+
+static PyObject* DhiStruct_lazy_get(PyObject *op, void *closure) {
+    DhiStructObject *self = (DhiStructObject*)op;
+    Py_ssize_t i = (Py_ssize_t)(intptr_t)closure;
+    PyObject *value = i < Py_SIZE(self) ? self->values[i] : NULL;
+    if (__builtin_expect(value != NULL && !DhiLazy_Check(value), 1)) {
+        Py_INCREF(value);
+        return value;
+    }
+    if (!value) {
+        dhi_lazy_no_attr(op, i);
+        return NULL;
     }
 
-    type->tp_free((PyObject*)self);
+    PyObject *errors = NULL;
+    int r;
+    DHI_BEGIN_CRITICAL_SECTION(op);
+    r = DhiLazy_Check(self->values[i]) ? dhi_lazy_load(self, i, &errors) : 1;
+    if (r > 0) {
+        value = self->values[i];
+        Py_INCREF(value);
+    }
+    DHI_END_CRITICAL_SECTION();
+    if (r > 0) return value;
+    if (r == 0) decoder_raise_errors(errors);
+    else Py_XDECREF(errors);
+    return NULL;
 }
 
-// tp_init: Validate and store field values (THE HOT PATH)
-static int DhiStruct_init(DhiStructObject *self, PyObject *args, PyObject *kwargs) {
-    if (args && PyTuple_GET_SIZE(args) > 0) {
-        PyErr_SetString(PyExc_TypeError, "DhiStruct does not accept positional arguments");
+static int DhiStruct_lazy_set(PyObject *op, PyObject *value, void *closure) {
+    DhiStructObject *self = (DhiStructObject*)op;
+    Py_ssize_t i = (Py_ssize_t)(intptr_t)closure;
+    if (i >= Py_SIZE(self) || (!value && !self->values[i])) {
+        return dhi_lazy_no_attr(op, i);
+    }
+    Py_XINCREF(value);
+    DHI_BEGIN_CRITICAL_SECTION(op);
+    Py_XSETREF(self->values[i], value);
+    DHI_END_CRITICAL_SECTION();
+    return 0;
+}
+
+#define DHI_LAZY_REPR_BYTES 40
+
+// If `value` is pending field i, set *out to "<pending RAW>" (RAW = the field's
+// JSON, cut at DHI_LAZY_REPR_BYTES) and return 1; 0 if it is not pending, -1 error.
+static int dhi_lazy_repr(PyObject *value, Py_ssize_t i, PyObject **out) {
+    if (!DhiLazy_Check(value)) return 0;
+    DhiLazySourceObject *src = (DhiLazySourceObject*)value;
+    size_t n = src->spans[i].end - src->spans[i].start;
+    int cut = n > DHI_LAZY_REPR_BYTES;
+    PyObject *raw = PyUnicode_DecodeUTF8(src->data + src->spans[i].start,
+                                         (Py_ssize_t)(cut ? DHI_LAZY_REPR_BYTES : n), "replace");
+    if (!raw) return -1;
+    *out = PyUnicode_FromFormat("<pending %U%s>", raw, cut ? "..." : "");
+    Py_DECREF(raw);
+    return *out ? 1 : -1;
+}
+
+// Decode every pending field. Validation errors from all of them are raised
+// together (the failing fields stay pending). 0 or -1.
+static int DhiStruct_materialize(DhiStructObject *self) {
+    PyObject *errors = NULL;
+    int r = 0;
+    DHI_BEGIN_CRITICAL_SECTION(self);
+    for (Py_ssize_t i = 0; i < Py_SIZE(self) && r >= 0; i++) {
+        if (self->values[i] && DhiLazy_Check(self->values[i])) {
+            r = dhi_lazy_load(self, i, &errors);
+        }
+    }
+    DHI_END_CRITICAL_SECTION();
+    if (r < 0) {
+        Py_XDECREF(errors);
         return -1;
     }
+    return errors ? decoder_raise_errors(errors) : 0;
+}
 
-    if (!kwargs) {
-        kwargs = PyDict_New();
-        if (!kwargs) return -1;
-        Py_DECREF(kwargs);
-        kwargs = NULL;
+// struct_materialize(obj) -> obj, with every lazily decoded field validated
+static PyObject* py_struct_materialize(PyObject *self_unused, PyObject *obj) {
+    if (!PyObject_TypeCheck(obj, &DhiStructType)) {
+        PyErr_Format(PyExc_TypeError, "expected a Struct instance, got %s", Py_TYPE(obj)->tp_name);
+        return NULL;
     }
+    if (DhiStruct_materialize((DhiStructObject*)obj) < 0) return NULL;
+    Py_INCREF(obj);
+    return obj;
+}
 
-    PyTypeObject *type = Py_TYPE(self);
+// Parse the JSON object at *pos_io with validation into DhiStructObject.
+// Advances *pos_io past the closing '}'. Validation errors are collected into
+// *errors_out (left NULL when there are none) so nested callers can report
+// them against the parent field.
+// Returns 0 when the JSON was well-formed, -1 on error (with Python exception set)
+static int decoder_parse_object(
+    DhiStructObject *self,
+    const char *json,
+    size_t *pos_io,
+    size_t len,
+    CompiledModelSpecs *ms,
+    PyObject **errors_out,
+    DhiJsonIndex *ix,
+    DhiValueCache *cache,
+    DhiLazySourceObject *lazy
+) {
+    Py_ssize_t n_fields = ms->n_fields;
+    DHI_STAT_TIMER(t0);
+    DHI_STAT_INC(ms, DHI_STAT_VALIDATIONS);
+    DHI_STAT_INC(ms, DHI_STAT_JSON_DECODES);
 
-    // Get compiled specs from type
-    PyObject *capsule = PyDict_GetItemString(type->tp_dict, "__dhi_compiled_specs__");
-    if (!capsule) {
-        PyErr_SetString(PyExc_RuntimeError, "DhiStruct type not properly initialized (missing specs)");
-        return -1;
+    // Initialize all values to NULL first for safe cleanup on error
+    // Use memset for speed when n_fields > 0
+    if (n_fields > 0) {
+        memset(self->values, 0, n_fields * sizeof(PyObject*));
     }
 
-    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
-    if (!ms) return -1;
+    size_t pos = *pos_io;
+    SKIP_WS(json, pos, len);
 
-    // Get field indices dict for fast lookup
-    PyObject *field_indices = PyDict_GetItemString(type->tp_dict, "__dhi_field_indices__");
-    if (!field_indices) {
-        PyErr_SetString(PyExc_RuntimeError, "DhiStruct type not properly initialized (missing indices)");
+    if (__builtin_expect(pos >= len || json[pos] != '{', 0)) {
+        PyErr_SetString(PyExc_ValueError, "Expected JSON object");
+        DHI_STAT_INC(ms, DHI_STAT_ERRORS);
         return -1;
     }
+    pos++;
+
+    // Track which fields we've seen (no malloc needed - use cached specs)
+    Py_ssize_t expected_field = 0;  // For ordered field matching
 
     PyObject *errors = NULL;
+    int closed = 0;
 
-    // ULTRA-FAST validation loop - no __dict__ operations!
-    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
-        CompiledFieldSpec *fs = &ms->specs[i];
+    while (pos < len) {
+        SKIP_WS(json, pos, len);
+        if (__builtin_expect(pos >= len, 0)) {
+            PyErr_SetString(PyExc_ValueError, "Unexpected end of JSON");
+            goto error;
+        }
+        if (json[pos] == '}') { pos++; closed = 1; break; }
+        if (json[pos] == ',') { pos++; continue; }
 
-        // Extract value from kwargs
-        PyObject *value = NULL;
-        if (kwargs) {
-            if (fs->alias_obj != Py_None) {
-                value = PyDict_GetItem(kwargs, fs->alias_obj);
-            }
-            if (!value) {
-                value = _PyDict_GetItem_KnownHash(kwargs, fs->name_obj, fs->name_hash);
-            }
+        // Parse field name
+        if (__builtin_expect(json[pos] != '"', 0)) {
+            PyErr_SetString(PyExc_ValueError, "Expected field name");
+            goto error;
         }
 
-        if (!value) {
-            if (!fs->required) {
-                // Use default value
-                Py_INCREF(fs->default_val);
-                self->values[i] = fs->default_val;
-                continue;
-            }
-            if (!errors) { errors = PyList_New(0); if (!errors) return -1; }
-            PyObject *err = Py_BuildValue("(Os)", fs->name_obj, "Field required");
-            PyList_Append(errors, err); Py_DECREF(err);
-            continue;
+        size_t key_len;
+        int needs_unescape;
+        // Use SIMD-accelerated string parsing for field names
+        char *key_start = decoder_scan_string(json, &pos, len, &key_len, &needs_unescape, ix);
+        if (__builtin_expect(!key_start, 0)) {
+            PyErr_SetString(PyExc_ValueError, "Invalid field name");
+            goto error;
         }
 
-        // --- TYPE CHECKING ---
-        PyObject *result = value;
-        Py_INCREF(result);
-        const char *field_name = NULL;
-
-        if (fs->type_code == 1) { // int
-            if (fs->strict) {
-                if (!PyLong_CheckExact(result) || PyBool_Check(result)) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Expected exactly int, got %s", field_name, Py_TYPE(value)->tp_name);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                    PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
-            } else {
-                if (PyBool_Check(result)) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Expected int, got bool", field_name);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                    PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
-                if (!PyLong_Check(result)) {
-                    if (PyFloat_Check(result)) {
-                        if (dhi_float_has_fraction(result)) {
-                            Py_DECREF(result);
-                            field_name = PyUnicode_AsUTF8(fs->name_obj);
-                            if (!errors) { errors = PyList_New(0); }
-                            PyObject *fmsg = PyUnicode_FromFormat("%s: Expected int, got float with fractional part", field_name);
-                            PyObject *ferr = Py_BuildValue("(OO)", fs->name_obj, fmsg); Py_DECREF(fmsg);
-                            PyList_Append(errors, ferr); Py_DECREF(ferr); continue;
-                        }
-                        PyObject *new_val = PyNumber_Long(result);
-                        if (!new_val) { Py_DECREF(result); PyErr_Clear();
-                            field_name = PyUnicode_AsUTF8(fs->name_obj);
-                            if (!errors) { errors = PyList_New(0); }
-                            PyObject *msg = PyUnicode_FromFormat("%s: Cannot convert float to int", field_name);
-                            PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                            PyList_Append(errors, err); Py_DECREF(err); continue;
-                        }
-                        Py_DECREF(result); result = new_val;
-                    } else {
-                        Py_DECREF(result);
-                        field_name = PyUnicode_AsUTF8(fs->name_obj);
-                        if (!errors) { errors = PyList_New(0); }
-                        PyObject *msg = PyUnicode_FromFormat("%s: Expected int, got %s", field_name, Py_TYPE(value)->tp_name);
-                        PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                        PyList_Append(errors, err); Py_DECREF(err); continue;
-                    }
-                }
-            }
-        } else if (fs->type_code == 2) { // float
-            if (fs->strict) {
-                if (!PyFloat_CheckExact(result)) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Expected exactly float, got %s", field_name, Py_TYPE(value)->tp_name);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                    PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
-            } else {
-                if (PyBool_Check(result)) {
-                    Py_DECREF(result);
-                    field_name = PyUnicode_AsUTF8(fs->name_obj);
-                    if (!errors) { errors = PyList_New(0); }
-                    PyObject *msg = PyUnicode_FromFormat("%s: Expected float, got bool", field_name);
-                    PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                    PyList_Append(errors, err); Py_DECREF(err); continue;
-                }
-                if (!PyFloat_Check(result)) {
-                    if (PyLong_Check(result)) {
-                        PyObject *new_val = PyNumber_Float(result);
-                        if (!new_val) { Py_DECREF(result); PyErr_Clear();
-                            field_name = PyUnicode_AsUTF8(fs->name_obj);
-                            if (!errors) { errors = PyList_New(0); }
-                            PyObject *msg = PyUnicode_FromFormat("%s: Cannot convert int to float", field_name);
-                            PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                            PyList_Append(errors, err); Py_DECREF(err); continue;
-                        }
-                        Py_DECREF(result); result = new_val;
-                    } else {
-                        Py_DECREF(result);
-                        field_name = PyUnicode_AsUTF8(fs->name_obj);
-                        if (!errors) { errors = PyList_New(0); }
-                        PyObject *msg = PyUnicode_FromFormat("%s: Expected float, got %s", field_name, Py_TYPE(value)->tp_name);
-                        PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                        PyList_Append(errors, err); Py_DECREF(err); continue;
-                    }
-                }
-            }
-        } else if (fs->type_code == 3) { // str
-            if (!PyUnicode_Check(result)) {
-                Py_DECREF(result);
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Expected str, got %s", field_name, Py_TYPE(value)->tp_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); continue;
-            }
-        } else if (fs->type_code == 4) { // bool
-            if (!PyBool_Check(result)) {
-                Py_DECREF(result);
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Expected bool, got %s", field_name, Py_TYPE(value)->tp_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); continue;
-            }
+        // Skip colon
+        SKIP_WS(json, pos, len);
+        if (__builtin_expect(pos >= len || json[pos] != ':', 0)) {
+            PyErr_SetString(PyExc_ValueError, "Expected ':'");
+            goto error;
+        }
+        pos++;
+        SKIP_WS(json, pos, len);
+        if (__builtin_expect(pos >= len, 0)) {
+            PyErr_SetString(PyExc_ValueError, "Unexpected end of JSON");
+            goto error;
         }
 
-        // --- NUMERIC CONSTRAINTS (INLINED - no FFI) ---
-        int validation_failed = 0;
-        if (PyLong_Check(result) && !PyBool_Check(result)) {
-            long val = PyLong_AsLong(result);
-            if (fs->has_gt && val <= fs->gt_long) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be > %ld, got %ld", field_name, fs->gt_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            if (fs->has_ge && val < fs->ge_long) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be >= %ld, got %ld", field_name, fs->ge_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            if (fs->has_lt && val >= fs->lt_long) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be < %ld, got %ld", field_name, fs->lt_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            if (fs->has_le && val > fs->le_long) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be <= %ld, got %ld", field_name, fs->le_long, val);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-        } else if (PyFloat_Check(result)) {
-            double val = PyFloat_AsDouble(result);
-            if (!fs->allow_inf_nan && !isfinite(val)) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Value must be finite", field_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            if (fs->has_gt && val <= fs->gt_dbl) { validation_failed = 1; }
-            if (!validation_failed && fs->has_ge && val < fs->ge_dbl) { validation_failed = 2; }
-            if (!validation_failed && fs->has_lt && val >= fs->lt_dbl) { validation_failed = 3; }
-            if (!validation_failed && fs->has_le && val > fs->le_dbl) { validation_failed = 4; }
-            if (validation_failed) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                char buf[128];
-                switch (validation_failed) {
-                    case 1: snprintf(buf, sizeof(buf), "%s: Value must be > %g, got %g", field_name, fs->gt_dbl, val); break;
-                    case 2: snprintf(buf, sizeof(buf), "%s: Value must be >= %g, got %g", field_name, fs->ge_dbl, val); break;
-                    case 3: snprintf(buf, sizeof(buf), "%s: Value must be < %g, got %g", field_name, fs->lt_dbl, val); break;
-                    case 4: snprintf(buf, sizeof(buf), "%s: Value must be <= %g, got %g", field_name, fs->le_dbl, val); break;
-                    default: buf[0] = '\0';
-                }
-                PyObject *msg = PyUnicode_FromString(buf);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
+        // Match field name using cached hash and length (no malloc, no strlen!)
+        uint64_t key_hash = fnv1a_hash_inline(key_start, key_len);
+        Py_ssize_t field_idx = -1;
+
+        // Ordered matching: check expected field first (fast path for in-order JSON)
+        // Skip memcmp in fast path - FNV-1a hash + length match is sufficient
+        // (collision probability is ~1 in 2^64 for same-length strings)
+        if (expected_field < n_fields) {
+            CompiledFieldSpec *efs = &ms->specs[expected_field];
+            if (efs->name_hash_fnv == key_hash && efs->name_len == key_len) {
+                field_idx = expected_field;
+                expected_field++;
+                goto field_matched;
             }
         }
 
-        // --- LENGTH CONSTRAINTS ---
-        if (fs->has_minl || fs->has_maxl) {
-            Py_ssize_t length = PyObject_Length(result);
-            if (length == -1 && PyErr_Occurred()) { Py_DECREF(result); Py_XDECREF(errors); return -1; }
-            if (fs->has_minl && length < fs->min_len) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Length must be >= %zd, got %zd", field_name, fs->min_len, length);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
-            if (fs->has_maxl && length > fs->max_len) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Length must be <= %zd, got %zd", field_name, fs->max_len, length);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
-            }
+        // Out-of-order key: one probe into the dispatch table, then resume
+        // ordered matching from the field after it
+        field_idx = dhi_dispatch_lookup(ms, key_start, key_len, key_hash);
+        if (field_idx >= 0) {
+            DHI_STAT_INC(ms, DHI_STAT_KEY_ORDER_MISSES);
+            expected_field = field_idx + 1;
         }
 
-        // --- FORMAT VALIDATION ---
-        if (fs->format_code > 0 && PyUnicode_Check(result)) {
-            const char *str_val = PyUnicode_AsUTF8(result);
-            if (!str_val) { Py_DECREF(result); Py_XDECREF(errors); return -1; }
-            int valid = 1;
-            const char *fmt_name = "unknown";
-            switch (fs->format_code) {
-                case 1: valid = inline_validate_email(str_val); fmt_name = "email"; break;
-                case 2: valid = dhi_validate_url(str_val); fmt_name = "URL"; break;
-                case 3: valid = dhi_validate_uuid(str_val); fmt_name = "UUID"; break;
-                case 4: valid = dhi_validate_ipv4(str_val); fmt_name = "IPv4"; break;
-                case 5: valid = dhi_validate_ipv6(str_val); fmt_name = "IPv6"; break;
-                case 6: valid = dhi_validate_base64(str_val); fmt_name = "base64"; break;
-                case 7: valid = dhi_validate_iso_date(str_val); fmt_name = "ISO date"; break;
-                case 8: valid = dhi_validate_iso_datetime(str_val); fmt_name = "ISO datetime"; break;
+field_matched:
+
+        // Unknown field - skip value using SIMD
+        if (field_idx < 0) {
+            DHI_STAT_INC(ms, DHI_STAT_UNKNOWN_KEYS);
+            if (!decoder_skip_value(json, &pos, len, ix)) {
+                PyErr_SetString(PyExc_ValueError, "Invalid JSON value");
+                goto error;
             }
-            if (!valid) {
-                field_name = PyUnicode_AsUTF8(fs->name_obj);
-                if (!errors) { errors = PyList_New(0); }
-                PyObject *msg = PyUnicode_FromFormat("%s: Invalid %s format", field_name, fmt_name);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg); Py_DECREF(msg);
-                PyList_Append(errors, err); Py_DECREF(err); Py_DECREF(result); continue;
+            continue;
+        }
+
+        // Lazy: remember where the value is, decode it on first access
+        if (lazy) {
+            size_t start = pos;
+            if (!decoder_skip_value(json, &pos, len, ix)) {
+                PyErr_SetString(PyExc_ValueError, "Invalid JSON value");
+                goto error;
             }
+            lazy->spans[field_idx].start = start;
+            lazy->spans[field_idx].end = pos;
+            Py_INCREF(lazy);
+            Py_XSETREF(self->values[field_idx], (PyObject*)lazy);
+            continue;
         }
 
-        // --- SUCCESS: Store directly in values array (NO __dict__!) ---
-        self->values[i] = result;  // Already incref'd above
+        CompiledFieldSpec *fs = &ms->specs[field_idx];
+        PyObject *value;
+        int r = decoder_parse_field(fs, json, &pos, len, &value, &errors, ix, cache);
+        if (r < 0) goto error;
+        if (r == 0) goto invalid_value;
+
+        // Store value (a repeated key replaces the earlier one)
+        Py_XSETREF(self->values[field_idx], value);
+        continue;
+
+invalid_value:
+        // Error already recorded - fill the slot so the field isn't also
+        // reported as missing (the instance is discarded on error anyway)
+        Py_INCREF(Py_None);
+        Py_XSETREF(self->values[field_idx], Py_None);
     }
 
-    // Check for errors
-    if (errors && PyList_GET_SIZE(errors) > 0) {
-        // Raise ValidationError with all errors
-        PyObject *exc_args = Py_BuildValue("(sO)", "Validation failed", errors);
-        PyErr_SetObject(PyExc_ValueError, exc_args);
-        Py_DECREF(exc_args);
-        Py_DECREF(errors);
-        return -1;
+    if (__builtin_expect(!closed, 0)) {
+        PyErr_SetString(PyExc_ValueError, "Unexpected end of JSON");
+        goto error;
+    }
+
+    // Check required fields and apply defaults
+    for (Py_ssize_t i = 0; i < n_fields; i++) {
+        if (self->values[i] == NULL) {
+            CompiledFieldSpec *fs = &ms->specs[i];
+            if (fs->required) {
+                if (!errors) errors = PyList_New(0);
+                PyObject *msg = PyUnicode_FromFormat("Field '%s' is required",
+                    fs->name_ptr);
+                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg);
+                Py_DECREF(msg);
+                PyList_Append(errors, err);
+                Py_DECREF(err);
+            } else if (fs->default_val && fs->default_val != Py_None) {
+                Py_INCREF(fs->default_val);
+                self->values[i] = fs->default_val;
+            } else {
+                Py_INCREF(Py_None);
+                self->values[i] = Py_None;
+            }
+        }
     }
-    Py_XDECREF(errors);
 
+    if (errors) DHI_STAT_INC(ms, DHI_STAT_ERRORS);
+    DHI_STAT_TIME(ms, t0);
+    *pos_io = pos;
+    *errors_out = errors;
     return 0;
+
+error:
+    DHI_STAT_INC(ms, DHI_STAT_ERRORS);
+    Py_XDECREF(errors);
+    return -1;
 }
 
-// tp_getattro: Fast field access by name
-static PyObject* DhiStruct_getattro(DhiStructObject *self, PyObject *name) {
-    PyTypeObject *type = Py_TYPE(self);
+// Internal JSON parsing with validation into DhiStructObject (lazy: only
+// record the field spans, see LAZY DECODING)
+// Returns 0 on success, -1 on error (with Python exception set)
+static int decoder_parse_json_internal(
+    DhiStructObject *self,
+    const char *json,
+    size_t len,
+    CompiledModelSpecs *ms,
+    DhiValueCache *cache,
+    DhiLazySourceObject *lazy
+) {
+    size_t pos = 0;
+    PyObject *errors = NULL;
 
-    // First check if it's a field
-    PyObject *field_indices = PyDict_GetItemString(type->tp_dict, "__dhi_field_indices__");
-    if (field_indices) {
-        PyObject *index_obj = PyDict_GetItem(field_indices, name);
-        if (index_obj) {
-            Py_ssize_t index = PyLong_AsSsize_t(index_obj);
-            PyObject *value = self->values[index];
-            if (value) {
-                Py_INCREF(value);
-                return value;
-            }
-            PyErr_Format(PyExc_AttributeError, "'%.50s' object has no attribute '%.400s'",
-                        type->tp_name, PyUnicode_AsUTF8(name));
-            return NULL;
-        }
-    }
+    if (decoder_parse_object(self, json, &pos, len, ms, &errors, NULL, cache, lazy) < 0) return -1;
 
-    // Fall back to generic attribute lookup (for methods, etc.)
-    return PyObject_GenericGetAttr((PyObject*)self, name);
+    if (errors) return decoder_raise_errors(errors);
+    return 0;
 }
 
-// tp_setattro: Fast field setting by name
-static int DhiStruct_setattro(DhiStructObject *self, PyObject *name, PyObject *value) {
-    PyTypeObject *type = Py_TYPE(self);
+// =============================================================================
+// JSON INPUT - borrow the caller's bytes without copying
+// =============================================================================
+// bytes, ASCII str (read straight from PyUnicode_DATA) and any contiguous
+// buffer (memoryview, bytearray, mmap, ...) are decoded in place. Only
+// non-ASCII str pays for a UTF-8 encode.
 
-    // Check if it's a field
-    PyObject *field_indices = PyDict_GetItemString(type->tp_dict, "__dhi_field_indices__");
-    if (field_indices) {
-        PyObject *index_obj = PyDict_GetItem(field_indices, name);
-        if (index_obj) {
-            Py_ssize_t index = PyLong_AsSsize_t(index_obj);
-            PyObject *old = self->values[index];
-            Py_XINCREF(value);
-            self->values[index] = value;
-            Py_XDECREF(old);
+typedef struct {
+    const char *data;
+    size_t len;
+    PyObject *tmp;      // owned UTF-8 bytes for non-ASCII str, or NULL
+    Py_buffer view;
+    int has_view;
+} DhiJsonInput;
+
+static int dhi_json_input_get(PyObject *obj, DhiJsonInput *in) {
+    in->tmp = NULL;
+    in->has_view = 0;
+
+    if (PyBytes_Check(obj)) {
+        in->data = PyBytes_AS_STRING(obj);
+        in->len = (size_t)PyBytes_GET_SIZE(obj);
+        return 0;
+    }
+    if (PyUnicode_Check(obj)) {
+        if (PyUnicode_IS_ASCII(obj)) {
+            // Compact ASCII: the code units are already valid UTF-8
+            in->data = (const char*)PyUnicode_DATA(obj);
+            in->len = (size_t)PyUnicode_GET_LENGTH(obj);
             return 0;
         }
+        in->tmp = PyUnicode_AsUTF8String(obj);
+        if (!in->tmp) return -1;
+        in->data = PyBytes_AS_STRING(in->tmp);
+        in->len = (size_t)PyBytes_GET_SIZE(in->tmp);
+        return 0;
     }
-
-    PyErr_Format(PyExc_AttributeError, "'%.50s' object has no attribute '%.400s'",
-                type->tp_name, PyUnicode_AsUTF8(name));
+    if (PyObject_CheckBuffer(obj)) {
+        if (PyObject_GetBuffer(obj, &in->view, PyBUF_SIMPLE) < 0) return -1;
+        in->has_view = 1;
+        in->data = (const char*)in->view.buf;
+        in->len = (size_t)in->view.len;
+        return 0;
+    }
+    PyErr_SetString(PyExc_TypeError, "JSON data must be bytes, str or a buffer");
     return -1;
 }
 
-// tp_repr: String representation
-static PyObject* DhiStruct_repr(DhiStructObject *self) {
-    PyTypeObject *type = Py_TYPE(self);
-    PyObject *field_names = PyDict_GetItemString(type->tp_dict, "__dhi_field_names__");
-    if (!field_names) {
-        return PyUnicode_FromFormat("<%s object>", type->tp_name);
-    }
-
-    Py_ssize_t n_fields = PyTuple_GET_SIZE(field_names);
-
-    // Build repr string
-    PyObject *parts = PyList_New(0);
-    if (!parts) return NULL;
-
-    for (Py_ssize_t i = 0; i < n_fields; i++) {
-        PyObject *name = PyTuple_GET_ITEM(field_names, i);
-        PyObject *value = self->values[i];
-        if (value) {
-            PyObject *value_repr = PyObject_Repr(value);
-            if (!value_repr) { Py_DECREF(parts); return NULL; }
-            PyObject *part = PyUnicode_FromFormat("%S=%S", name, value_repr);
-            Py_DECREF(value_repr);
-            if (!part) { Py_DECREF(parts); return NULL; }
-            PyList_Append(parts, part);
-            Py_DECREF(part);
-        }
+static void dhi_json_input_release(DhiJsonInput *in) {
+    Py_CLEAR(in->tmp);
+    if (in->has_view) {
+        PyBuffer_Release(&in->view);
+        in->has_view = 0;
     }
-
-    PyObject *sep = PyUnicode_FromString(", ");
-    PyObject *joined = PyUnicode_Join(sep, parts);
-    Py_DECREF(sep);
-    Py_DECREF(parts);
-
-    if (!joined) return NULL;
-
-    PyObject *result = PyUnicode_FromFormat("%s(%S)", type->tp_name, joined);
-    Py_DECREF(joined);
-    return result;
 }
 
-// Type object definition
-static PyTypeObject DhiStructType = {
-    PyVarObject_HEAD_INIT(NULL, 0)
-    .tp_name = "dhi._dhi_native.Struct",
-    .tp_doc = "High-performance validated struct (stores fields in C array, not __dict__)",
-    .tp_basicsize = sizeof(DhiStructObject),
-    .tp_itemsize = sizeof(PyObject*),  // For flexible array member
-    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
-    .tp_new = DhiStruct_new,
-    .tp_init = (initproc)DhiStruct_init,
-    .tp_dealloc = (destructor)DhiStruct_dealloc,
-    .tp_getattro = (getattrofunc)DhiStruct_getattro,
-    .tp_setattro = (setattrofunc)DhiStruct_setattro,
-    .tp_repr = (reprfunc)DhiStruct_repr,
-};
-
-// Helper function to initialize a Struct subclass
-// Called from Python: _dhi_native.init_struct_class(cls, field_specs_tuple)
-static PyObject* py_init_struct_class(PyObject *self, PyObject *args) {
+// struct_from_json(cls, json_bytes, lazy=False) -> Struct instance
+static PyObject* py_struct_from_json(PyObject *self, PyObject *args) {
     PyObject *cls;
-    PyObject *field_specs;
+    PyObject *json_data;
+    int lazy = 0;
 
-    if (!PyArg_ParseTuple(args, "OO!", &cls, &PyTuple_Type, &field_specs)) {
+    if (!PyArg_ParseTuple(args, "OO|p", &cls, &json_data, &lazy)) {
         return NULL;
     }
 
     if (!PyType_Check(cls)) {
-        PyErr_SetString(PyExc_TypeError, "First argument must be a class");
+        PyErr_SetString(PyExc_TypeError, "First argument must be a Struct class");
         return NULL;
     }
 
-    PyTypeObject *type = (PyTypeObject*)cls;
-
-    // Compile specs - need to wrap field_specs in a tuple for py_compile_model_specs
-    PyObject *specs_args = PyTuple_Pack(1, field_specs);
-    if (!specs_args) return NULL;
-    PyObject *capsule = py_compile_model_specs(self, specs_args);
-    Py_DECREF(specs_args);
-    if (!capsule) return NULL;
-
-    // Build field names tuple and indices dict
-    Py_ssize_t n_fields = PyTuple_GET_SIZE(field_specs);
-    PyObject *field_names = PyTuple_New(n_fields);
-    PyObject *field_indices = PyDict_New();
+    // Borrow the JSON bytes (zero-copy for bytes, ASCII str and buffers)
+    DhiJsonInput input;
+    if (dhi_json_input_get(json_data, &input) < 0) return NULL;
+    const char *json = input.data;
+    Py_ssize_t len = (Py_ssize_t)input.len;
 
-    if (!field_names || !field_indices) {
-        Py_XDECREF(field_names);
-        Py_XDECREF(field_indices);
-        Py_DECREF(capsule);
+    // Get compiled specs
+    PyTypeObject *type = (PyTypeObject*)cls;
+    PyObject *capsule = PyDict_GetItemString(type->tp_dict, "__dhi_compiled_specs__");
+    if (!capsule) {
+        dhi_json_input_release(&input);
+        PyErr_SetString(PyExc_ValueError, "Struct class not initialized");
         return NULL;
     }
 
-    for (Py_ssize_t i = 0; i < n_fields; i++) {
-        PyObject *spec = PyTuple_GET_ITEM(field_specs, i);
-        PyObject *name = PyTuple_GET_ITEM(spec, 0);
-        Py_INCREF(name);
-        PyTuple_SET_ITEM(field_names, i, name);
+    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
+    if (!ms) {
+        dhi_json_input_release(&input);
+        return NULL;
+    }
 
-        PyObject *index = PyLong_FromSsize_t(i);
-        PyDict_SetItem(field_indices, name, index);
-        Py_DECREF(index);
+    // Allocate struct object
+    DhiStructObject *obj = DhiStruct_alloc(type, ms->n_fields);
+    if (!obj) {
+        dhi_json_input_release(&input);
+        return NULL;
     }
 
-    // Store metadata in type's dict
-    PyDict_SetItemString(type->tp_dict, "__dhi_compiled_specs__", capsule);
-    PyDict_SetItemString(type->tp_dict, "__dhi_field_names__", field_names);
-    PyDict_SetItemString(type->tp_dict, "__dhi_field_indices__", field_indices);
-    PyDict_SetItemString(type->tp_dict, "__dhi_n_fields__", PyLong_FromSsize_t(n_fields));
+    // Parse JSON and populate fields (lazy: record spans, see LAZY DECODING)
+    int result;
+    if (lazy) {
+        DhiStructMetaObject *meta = DhiStruct_meta(type);
+        DhiLazySourceObject *src = NULL;
+        result = dhi_struct_enable_lazy(type);
+        if (result == 0) {
+            src = dhi_lazy_source_new(json_data, json, (size_t)len, input.tmp, meta);
+            if (!src) result = -1;
+        }
+        if (result == 0) {
+            result = decoder_parse_json_internal(obj, src->data, len, ms, NULL, src);
+        }
+        Py_XDECREF(src);
+    } else {
+        result = decoder_parse_json_internal(obj, json, len, ms, NULL, NULL);
+    }
+    dhi_json_input_release(&input);
 
-    Py_DECREF(capsule);
-    Py_DECREF(field_names);
-    Py_DECREF(field_indices);
+    if (result < 0) {
+        Py_DECREF(obj);
+        return NULL;
+    }
 
-    Py_RETURN_NONE;
+    return (PyObject*)obj;
 }
 
 // =============================================================================
-// FAST JSON PARSER - Direct JSON -> Struct without intermediate dict
-// Uses Zig SIMD backend for maximum performance
+// RESULT LISTS - pre-sized, or the caller's `out` list reused in place
 // =============================================================================
+// Batch decoders store results through a DhiListFill. A fresh list starts at
+// the expected count (structural index / line count) and is filled with
+// PyList_SET_ITEM; an `out` list keeps its storage: existing slots are
+// overwritten, extra items appended and leftover slots trimmed at the end.
 
-// Skip whitespace using SIMD (via Zig)
-#define SKIP_WS_SIMD(json, pos, len) \
-    (pos) = dhi_skip_whitespace((json), (len), (pos))
+typedef struct {
+    PyObject *list;
+    Py_ssize_t n;   // items stored so far
+    int fresh;      // list created here: slots [n, size) are still NULL
+} DhiListFill;
+
+// `out` = list to overwrite, or NULL for a new list of `hint` slots
+static int dhi_list_fill_init(DhiListFill *f, PyObject *out, Py_ssize_t hint) {
+    f->n = 0;
+    f->fresh = out == NULL;
+    if (out) {
+        Py_INCREF(out);
+        f->list = out;
+    } else {
+        f->list = PyList_New(hint);
+    }
+    return f->list ? 0 : -1;
+}
 
-// Fallback for simple cases
-#define SKIP_WS(json, pos, len) \
-    while ((pos) < (len) && ((json)[(pos)] == ' ' || (json)[(pos)] == '\t' || \
-           (json)[(pos)] == '\n' || (json)[(pos)] == '\r')) { (pos)++; }
+// Store `item` (stolen, even on failure) in the next slot
+static inline int dhi_list_fill_put(DhiListFill *f, PyObject *item) {
+    if (f->n < PyList_GET_SIZE(f->list)) {
+        if (f->fresh) PyList_SET_ITEM(f->list, f->n, item);
+        else if (PyList_SetItem(f->list, f->n, item) < 0) return -1;  // drops the old item
+        f->n++;
+        return 0;
+    }
+    int r = PyList_Append(f->list, item);
+    Py_DECREF(item);
+    if (r == 0) f->n++;
+    return r;
+}
 
-// Hybrid string parsing - inline for small strings, SIMD for larger ones
-// Returns pointer to string content and updates pos
-// Returns NULL on error
-__attribute__((always_inline))
-static inline char* json_parse_string_simd(const char *json, size_t *pos, size_t len,
-                                size_t *out_len, int *needs_unescape) {
-    size_t start = *pos;
-    if (start >= len || json[start] != '"') return NULL;
-    start++;
+// Trim to the stored items. Returns the list (new reference) or NULL. On
+// the error path an `out` list is left holding the items decoded so far.
+static PyObject* dhi_list_fill_finish(DhiListFill *f) {
+    PyObject *list = f->list;
+    f->list = NULL;
+    Py_ssize_t size = PyList_GET_SIZE(list);
+    if (f->n < size && PyList_SetSlice(list, f->n, size, NULL) < 0) {
+        Py_DECREF(list);
+        return NULL;
+    }
+    return list;
+}
 
-    // For strings < 64 bytes, use inline C (avoid FFI overhead)
-    // Most field names and short values fall into this category
-    size_t end = start;
-    *needs_unescape = 0;
+static void dhi_list_fill_abort(DhiListFill *f) {
+    if (!f->list) return;
+    PyObject *exc_type, *exc_value, *exc_tb;
+    PyErr_Fetch(&exc_type, &exc_value, &exc_tb);
+    Py_XDECREF(dhi_list_fill_finish(f));
+    PyErr_Restore(exc_type, exc_value, exc_tb);
+}
 
-    // Quick scan - if we find the closing quote within 64 bytes, use inline
-    while (end < len && end - start < 64) {
-        char c = json[end];
-        if (c == '"') {
-            // Found end - use inline result
-            *out_len = end - start;
-            *pos = end + 1;
-            return (char*)&json[start];
-        }
-        if (c == '\\') {
-            *needs_unescape = 1;
-            end += 2;
-        } else {
-            end++;
+// Objects directly inside the array whose '[' is at json[array_pos], counted
+// from the index (the cursor is left where it was)
+static Py_ssize_t dhi_index_count_array_objects(DhiJsonIndex *ix, const char *json,
+                                                size_t array_pos) {
+    size_t saved = ix->cur;
+    dhi_index_seek(ix, array_pos);
+    Py_ssize_t n = 0;
+    size_t depth = 0;
+    for (size_t k = ix->cur; k < ix->n; k++) {
+        char c = json[ix->entries[k] & DHI_SI_OFFSET_MASK];
+        if (c == '{' || c == '[') {
+            if (c == '{' && depth == 1) n++;
+            depth++;
+        } else if (c == '}' || c == ']') {
+            if (depth == 0 || --depth == 0) break;
         }
     }
-
-    // Long string (>64 bytes) or didn't find quote yet - use SIMD
-    const char *str_ptr;
-    size_t str_len;
-    int has_escapes;
-    size_t simd_end;
-
-    int result = dhi_extract_json_string(json, len, start, &str_ptr, &str_len, &has_escapes, &simd_end);
-    if (result != 0) return NULL;
-
-    *out_len = str_len;
-    *needs_unescape = has_escapes;
-    *pos = simd_end;
-    return (char*)str_ptr;
+    ix->cur = saved;
+    return n;
 }
 
-// Legacy C version for fallback
-__attribute__((always_inline, unused))
-static inline char* json_parse_string(const char *json, size_t *pos, size_t len,
-                                size_t *out_len, int *needs_unescape) {
-    size_t start = *pos;
-    if (json[start] != '"') return NULL;
-    start++;
+#if DHI_PARALLEL_BATCH
+// =============================================================================
+// PARALLEL BATCH DECODING - free-threaded builds only
+// =============================================================================
+// The structural index gives every top-level object's start offset (and its
+// index entry) up front, so the array splits at object boundaries without
+// parsing. Each worker decodes a contiguous range of objects into pre-sized
+// result slots with its own index cursor; objects are allocated on the
+// worker thread. The first failing object (lowest index) wins, as sequential.
 
-    size_t end = start;
-    *needs_unescape = 0;
+#define DHI_BATCH_MAX_THREADS 256
+#define DHI_BATCH_MIN_PER_THREAD 16  // below this a thread costs more than it saves
 
-    while (end < len) {
-        char c = json[end];
-        if (c == '"') {
-            *out_len = end - start;
-            *pos = end + 1;
-            return (char*)&json[start];
+typedef struct {
+    PyTypeObject *type;
+    CompiledModelSpecs *ms;
+    const char *json;
+    size_t len;
+    DhiJsonIndex ix;               // shared entries, private cursor
+    const size_t *starts;          // object start offsets
+    const size_t *start_entries;   // index entry of each object's '{'
+    size_t *ends;                  // offset just past each object
+    PyObject **slots;
+    Py_ssize_t first, last;        // objects [first, last)
+    Py_ssize_t *min_failed;        // lowest failing object index so far
+    Py_ssize_t failed_at;
+    PyObject *exc_type, *exc_value, *exc_tb;
+} DhiBatchWorker;
+
+static void* decoder_batch_worker(void *arg) {
+    DhiBatchWorker *w = (DhiBatchWorker*)arg;
+    PyGILState_STATE gstate = PyGILState_Ensure();
+
+    for (Py_ssize_t i = w->first; i < w->last; i++) {
+        // An earlier object already failed - nothing after it matters
+        if (__atomic_load_n(w->min_failed, __ATOMIC_RELAXED) < i) break;
+
+        DhiStructObject *obj = DhiStruct_alloc(w->type, w->ms->n_fields);
+        PyObject *errors = NULL;
+        size_t pos = w->starts[i];
+        w->ix.cur = w->start_entries[i];
+
+        if (obj && decoder_parse_object(obj, w->json, &pos, w->len, w->ms, &errors, &w->ix, NULL, NULL) == 0
+                && !errors) {
+            w->slots[i] = (PyObject*)obj;
+            w->ends[i] = pos;
+            continue;
         }
-        if (c == '\\') {
-            *needs_unescape = 1;
-            end += 2;  // Skip escape sequence
-        } else {
-            end++;
+
+        if (errors) {
+            PyObject *exc_args = Py_BuildValue("(sO)", "Validation failed", errors);
+            PyErr_SetObject(PyExc_ValueError, exc_args);
+            Py_XDECREF(exc_args);
+            Py_DECREF(errors);
+        }
+        Py_XDECREF(obj);
+        w->failed_at = i;
+        PyErr_Fetch(&w->exc_type, &w->exc_value, &w->exc_tb);
+
+        Py_ssize_t seen = __atomic_load_n(w->min_failed, __ATOMIC_RELAXED);
+        while (i < seen && !__atomic_compare_exchange_n(w->min_failed, &seen, i, 0,
+                                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
         }
+        break;
     }
-    return NULL;  // Unterminated string
-}
 
-// Unescape JSON string into buffer
-static PyObject* json_unescape_string(const char *str, size_t len) {
-    char *buf = malloc(len + 1);
-    if (!buf) return PyErr_NoMemory();
+    PyGILState_Release(gstate);
+    return NULL;
+}
 
-    size_t out = 0;
-    for (size_t i = 0; i < len; i++) {
-        if (str[i] == '\\' && i + 1 < len) {
-            i++;
-            switch (str[i]) {
-                case '"': buf[out++] = '"'; break;
-                case '\\': buf[out++] = '\\'; break;
-                case '/': buf[out++] = '/'; break;
-                case 'b': buf[out++] = '\b'; break;
-                case 'f': buf[out++] = '\f'; break;
-                case 'n': buf[out++] = '\n'; break;
-                case 'r': buf[out++] = '\r'; break;
-                case 't': buf[out++] = '\t'; break;
-                case 'u': {
-                    // Parse 4 hex digits
-                    if (i + 4 < len) {
-                        unsigned int codepoint = 0;
-                        for (int j = 1; j <= 4; j++) {
-                            char h = str[i + j];
-                            codepoint <<= 4;
-                            if (h >= '0' && h <= '9') codepoint |= h - '0';
-                            else if (h >= 'a' && h <= 'f') codepoint |= h - 'a' + 10;
-                            else if (h >= 'A' && h <= 'F') codepoint |= h - 'A' + 10;
-                        }
-                        i += 4;
-                        // UTF-8 encode
-                        if (codepoint < 0x80) {
-                            buf[out++] = (char)codepoint;
-                        } else if (codepoint < 0x800) {
-                            buf[out++] = (char)(0xC0 | (codepoint >> 6));
-                            buf[out++] = (char)(0x80 | (codepoint & 0x3F));
-                        } else {
-                            buf[out++] = (char)(0xE0 | (codepoint >> 12));
-                            buf[out++] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
-                            buf[out++] = (char)(0x80 | (codepoint & 0x3F));
-                        }
-                    }
-                    break;
+// Decode the array whose '[' is at json[array_pos] across n_threads workers.
+static PyObject* decoder_batch_parallel(PyTypeObject *type, CompiledModelSpecs *ms,
+                                        const char *json, size_t len, DhiJsonIndex *ix,
+                                        size_t array_pos, Py_ssize_t n_threads, PyObject *out) {
+    PyObject *result = NULL;
+    size_t *starts = NULL, *start_entries = NULL, *ends = NULL;
+    PyObject **slots = NULL;
+    DhiBatchWorker *workers = NULL;
+    pthread_t *tids = NULL;
+    Py_ssize_t n_objects = 0, cap = 64;
+
+    // Lazily created globals must exist before workers race to create them
+    if (!g_empty_tuple && !(g_empty_tuple = PyTuple_New(0))) return NULL;
+    if (!decoder_struct_specs(type)) return NULL;
+
+    // Split: every '{' at depth 1 of the array starts an object
+    starts = (size_t*)malloc(cap * sizeof(size_t));
+    start_entries = (size_t*)malloc(cap * sizeof(size_t));
+    if (!starts || !start_entries) { PyErr_NoMemory(); goto done; }
+
+    dhi_index_seek(ix, array_pos);
+    size_t depth = 0;
+    for (size_t k = ix->cur; k < ix->n; k++) {
+        size_t off = ix->entries[k] & DHI_SI_OFFSET_MASK;
+        char c = json[off];
+        if (c == '{' || c == '[') {
+            if (c == '{' && depth == 1) {
+                if (n_objects == cap) {
+                    cap *= 2;
+                    size_t *s2 = (size_t*)realloc(starts, cap * sizeof(size_t));
+                    if (s2) starts = s2;
+                    size_t *e2 = (size_t*)realloc(start_entries, cap * sizeof(size_t));
+                    if (e2) start_entries = e2;
+                    if (!s2 || !e2) { PyErr_NoMemory(); goto done; }
                 }
-                default: buf[out++] = str[i]; break;
+                starts[n_objects] = off;
+                start_entries[n_objects] = k;
+                n_objects++;
+            }
+            depth++;
+        } else if (c == '}' || c == ']') {
+            if (depth == 0 || --depth == 0) break;
+        }
+    }
+
+    ends = (size_t*)malloc((n_objects + 1) * sizeof(size_t));
+    slots = (PyObject**)calloc(n_objects + 1, sizeof(PyObject*));
+    if (!ends || !slots) { PyErr_NoMemory(); goto done; }
+
+    if (n_threads > n_objects / DHI_BATCH_MIN_PER_THREAD) {
+        n_threads = n_objects / DHI_BATCH_MIN_PER_THREAD;
+    }
+    if (n_threads < 1) n_threads = 1;
+    if (n_threads > DHI_BATCH_MAX_THREADS) n_threads = DHI_BATCH_MAX_THREADS;
+
+    workers = (DhiBatchWorker*)calloc(n_threads, sizeof(DhiBatchWorker));
+    tids = (pthread_t*)calloc(n_threads, sizeof(pthread_t));
+    if (!workers || !tids) { PyErr_NoMemory(); goto done; }
+
+    Py_ssize_t min_failed = PY_SSIZE_T_MAX;
+    for (Py_ssize_t t = 0; t < n_threads; t++) {
+        DhiBatchWorker *w = &workers[t];
+        w->type = type;
+        w->ms = ms;
+        w->json = json;
+        w->len = len;
+        w->ix.entries = ix->entries;
+        w->ix.n = ix->n;
+        w->starts = starts;
+        w->start_entries = start_entries;
+        w->ends = ends;
+        w->slots = slots;
+        w->first = n_objects * t / n_threads;
+        w->last = n_objects * (t + 1) / n_threads;
+        w->min_failed = &min_failed;
+        w->failed_at = -1;
+    }
+
+    // Workers 1..n-1 on new threads; worker 0 runs here
+    Py_ssize_t started = 1;
+    for (; started < n_threads; started++) {
+        if (pthread_create(&tids[started], NULL, decoder_batch_worker, &workers[started]) != 0) break;
+    }
+    Py_ssize_t inline_from = started;
+    decoder_batch_worker(&workers[0]);
+    for (Py_ssize_t t = inline_from; t < n_threads; t++) {
+        decoder_batch_worker(&workers[t]);  // thread creation failed - do it here
+    }
+    // Detach while waiting so a worker-triggered GC can stop the world
+    Py_BEGIN_ALLOW_THREADS
+    for (Py_ssize_t t = 1; t < inline_from; t++) pthread_join(tids[t], NULL);
+    Py_END_ALLOW_THREADS
+
+    // Report the lowest-index failure; drop the rest
+    DhiBatchWorker *failed = NULL;
+    for (Py_ssize_t t = 0; t < n_threads; t++) {
+        if (workers[t].failed_at >= 0 && (!failed || workers[t].failed_at < failed->failed_at)) {
+            failed = &workers[t];
+        }
+    }
+    for (Py_ssize_t t = 0; t < n_threads; t++) {
+        if (&workers[t] != failed) {
+            Py_XDECREF(workers[t].exc_type);
+            Py_XDECREF(workers[t].exc_value);
+            Py_XDECREF(workers[t].exc_tb);
+        }
+    }
+    if (failed) {
+        PyErr_Restore(failed->exc_type, failed->exc_value, failed->exc_tb);
+        goto done;
+    }
+
+    // Everything between objects must be ',' (and the array must close, with
+    // only whitespace after it)
+    size_t pos = array_pos + 1;
+    for (Py_ssize_t i = 0; i <= n_objects; i++) {
+        SKIP_WS(json, pos, len);
+        if (i == n_objects) {
+            if (pos >= len || json[pos] != ']') {
+                PyErr_SetString(PyExc_ValueError,
+                    n_objects ? "Expected ',' or ']' in array" : "Expected JSON object in array");
+                goto done;
             }
-        } else {
-            buf[out++] = str[i];
+            pos++;
+            SKIP_WS(json, pos, len);
+            if (pos != len) {
+                PyErr_SetString(PyExc_ValueError, "Extra data after JSON array");
+                goto done;
+            }
+            break;
+        }
+        if (i > 0) {
+            if (pos >= len || json[pos] != ',') {
+                PyErr_SetString(PyExc_ValueError, "Expected ',' or ']' in array");
+                goto done;
+            }
+            pos++;
+            SKIP_WS(json, pos, len);
+        }
+        if (pos != starts[i]) {
+            PyErr_SetString(PyExc_ValueError, "Expected JSON object in array");
+            goto done;
         }
+        pos = ends[i];
     }
-    buf[out] = '\0';
 
-    PyObject *result = PyUnicode_DecodeUTF8(buf, out, NULL);
-    free(buf);
+    DhiListFill fill;
+    if (dhi_list_fill_init(&fill, out, n_objects) < 0) goto done;
+    for (Py_ssize_t i = 0; i < n_objects; i++) {
+        PyObject *obj = slots[i];
+        slots[i] = NULL;
+        if (dhi_list_fill_put(&fill, obj) < 0) {
+            dhi_list_fill_abort(&fill);
+            goto done;
+        }
+    }
+    result = dhi_list_fill_finish(&fill);
+
+done:
+    if (slots) {
+        for (Py_ssize_t i = 0; i < n_objects; i++) Py_XDECREF(slots[i]);
+    }
+    free(starts);
+    free(start_entries);
+    free(ends);
+    free(slots);
+    free(workers);
+    free(tids);
     return result;
 }
+#endif  // DHI_PARALLEL_BATCH
 
-// Parse JSON integer
-__attribute__((unused))
-static int json_parse_integer(const char *json, size_t *pos, size_t len, long *out) {
-    size_t start = *pos;
-    int negative = 0;
+// struct_from_json_batch(cls, json_bytes, threads=1, out=None) -> list of Struct instances
+// With `out`, that list is overwritten with the results and returned.
+static PyObject* py_struct_from_json_batch(PyObject *self, PyObject *args, PyObject *kwargs) {
+    static char *kwlist[] = {"cls", "json_data", "threads", "out", NULL};
+    PyObject *cls;
+    PyObject *json_data;
+    Py_ssize_t threads = 1;
+    PyObject *out = Py_None;
 
-    if (start < len && json[start] == '-') {
-        negative = 1;
-        start++;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|nO", kwlist, &cls, &json_data, &threads, &out)) {
+        return NULL;
+    }
+    if (out == Py_None) {
+        out = NULL;
+    } else if (!PyList_Check(out)) {
+        PyErr_SetString(PyExc_TypeError, "out must be a list");
+        return NULL;
     }
 
-    if (start >= len || json[start] < '0' || json[start] > '9') return 0;
+    if (threads < 1) {
+        PyErr_SetString(PyExc_ValueError, "threads must be >= 1");
+        return NULL;
+    }
 
-    long value = 0;
-    while (start < len && json[start] >= '0' && json[start] <= '9') {
-        value = value * 10 + (json[start] - '0');
-        start++;
+    if (!PyType_Check(cls)) {
+        PyErr_SetString(PyExc_TypeError, "First argument must be a Struct class");
+        return NULL;
     }
 
-    *out = negative ? -value : value;
-    *pos = start;
-    return 1;
-}
+    // Borrow the JSON bytes (zero-copy for bytes, ASCII str and buffers)
+    DhiJsonInput input;
+    if (dhi_json_input_get(json_data, &input) < 0) return NULL;
+    const char *json = input.data;
+    Py_ssize_t len = (Py_ssize_t)input.len;
 
-// Parse JSON number (int or float) - optimized for small integers
-__attribute__((always_inline, unused))
-static inline PyObject* json_parse_number(const char *json, size_t *pos, size_t len) {
-    size_t i = *pos;
-    int is_negative = 0;
-    int is_float = 0;
+    // Get compiled specs
+    PyTypeObject *type = (PyTypeObject*)cls;
+    PyObject *capsule = PyDict_GetItemString(type->tp_dict, "__dhi_compiled_specs__");
+    if (!capsule) {
+        dhi_json_input_release(&input);
+        PyErr_SetString(PyExc_ValueError, "Struct class not initialized");
+        return NULL;
+    }
 
-    // Check for negative sign
-    if (i < len && json[i] == '-') {
-        is_negative = 1;
-        i++;
+    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
+    if (!ms) {
+        dhi_json_input_release(&input);
+        return NULL;
     }
 
-    // Fast path: parse small integer inline (up to 18 digits fits in int64)
-    if (i < len && json[i] >= '0' && json[i] <= '9') {
-        long value = 0;
-        int digit_count = 0;
+    // Find array start
+    size_t pos = 0;
+    SKIP_WS(json, pos, (size_t)len);
 
-        while (i < len && json[i] >= '0' && json[i] <= '9') {
-            value = value * 10 + (json[i] - '0');
-            i++;
-            digit_count++;
-            if (digit_count > 18) break;  // Fall back for very large numbers
-        }
+    if (pos >= (size_t)len || json[pos] != '[') {
+        dhi_json_input_release(&input);
+        PyErr_SetString(PyExc_ValueError, "Expected JSON array");
+        return NULL;
+    }
+    pos++;
 
-        // Check if it's a float (has . or e/E)
-        if (i < len && (json[i] == '.' || json[i] == 'e' || json[i] == 'E')) {
-            is_float = 1;
-        } else if (digit_count <= 18) {
-            // It's a small integer - use fast path
-            *pos = i;
-            return PyLong_FromLong(is_negative ? -value : value);
+    // Stage 1: classify every byte once. Each object is then decoded in place
+    // (stage 2) and reports where it ended, so there is no separate boundary
+    // scan and no rescan of the same bytes.
+    DhiJsonIndex index = {NULL, 0, 0};
+    DhiJsonIndex *ix = NULL;
+    if ((size_t)len <= DHI_SI_MAX_LEN) {
+        if (dhi_index_build(&index, json, (size_t)len) < 0) {
+            dhi_json_input_release(&input);
+            return NULL;
         }
+        ix = &index;
     }
 
-    // Slow path: parse as string (for floats and very large integers)
-    size_t start = *pos;
-    i = start;
-
-    // Re-scan the number
-    if (i < len && json[i] == '-') i++;
-    while (i < len && json[i] >= '0' && json[i] <= '9') i++;
-
-    if (i < len && json[i] == '.') {
-        is_float = 1;
-        i++;
-        while (i < len && json[i] >= '0' && json[i] <= '9') i++;
+#if DHI_PARALLEL_BATCH
+    if (threads > 1 && ix) {
+        PyObject *result = decoder_batch_parallel(type, ms, json, (size_t)len, ix, pos - 1, threads, out);
+        dhi_index_free(ix);
+        dhi_json_input_release(&input);
+        return result;
     }
+#endif
 
-    if (i < len && (json[i] == 'e' || json[i] == 'E')) {
-        is_float = 1;
-        i++;
-        if (i < len && (json[i] == '+' || json[i] == '-')) i++;
-        while (i < len && json[i] >= '0' && json[i] <= '9') i++;
+    // Result list sized from the index up front; without one it grows
+    DhiListFill fill;
+    if (dhi_list_fill_init(&fill, out, ix ? dhi_index_count_array_objects(ix, json, pos - 1) : 0) < 0) {
+        goto fail;
     }
 
-    size_t num_len = i - start;
+    SKIP_WS(json, pos, (size_t)len);
+    if (pos < (size_t)len && json[pos] == ']') goto close;
 
-    // Use stack buffer for small numbers (avoid malloc)
-    char stack_buf[32];
-    char *num_str;
-    if (num_len < 32) {
-        num_str = stack_buf;
-    } else {
-        num_str = malloc(num_len + 1);
-        if (!num_str) return PyErr_NoMemory();
-    }
-    memcpy(num_str, &json[start], num_len);
-    num_str[num_len] = '\0';
+    for (;;) {
+        SKIP_WS(json, pos, (size_t)len);
+        if (pos >= (size_t)len || json[pos] != '{') {
+            PyErr_SetString(PyExc_ValueError, "Expected JSON object in array");
+            goto fail;
+        }
 
-    PyObject *result;
-    if (is_float) {
-        result = PyFloat_FromDouble(strtod(num_str, NULL));
-    } else {
-        result = PyLong_FromString(num_str, NULL, 10);
+        // Allocate and parse single object
+        DhiStructObject *obj = DhiStruct_alloc(type, ms->n_fields);
+        if (!obj) goto fail;
+
+        PyObject *errors = NULL;
+        if (decoder_parse_object(obj, json, &pos, (size_t)len, ms, &errors, ix, NULL, NULL) < 0) {
+            Py_DECREF(obj);
+            goto fail;
+        }
+        if (errors) {
+            PyObject *exc_args = Py_BuildValue("(sO)", "Validation failed", errors);
+            PyErr_SetObject(PyExc_ValueError, exc_args);
+            Py_XDECREF(exc_args);
+            Py_DECREF(errors);
+            Py_DECREF(obj);
+            goto fail;
+        }
+
+        if (dhi_list_fill_put(&fill, (PyObject*)obj) < 0) goto fail;
+
+        SKIP_WS(json, pos, (size_t)len);
+        if (pos < (size_t)len && json[pos] == ',') { pos++; continue; }
+        if (pos < (size_t)len && json[pos] == ']') break;
+        PyErr_SetString(PyExc_ValueError, "Expected ',' or ']' in array");
+        goto fail;
     }
 
-    if (num_len >= 32) free(num_str);
-    *pos = i;
-    return result;
+close:
+    pos++;
+    SKIP_WS(json, pos, (size_t)len);
+    if (pos != (size_t)len) {
+        PyErr_SetString(PyExc_ValueError, "Extra data after JSON array");
+        goto fail;
+    }
+    if (ix) dhi_index_free(ix);
+    dhi_json_input_release(&input);
+    return dhi_list_fill_finish(&fill);
+
+fail:
+    if (ix) dhi_index_free(ix);
+    dhi_list_fill_abort(&fill);
+    dhi_json_input_release(&input);
+    return NULL;
 }
 
-// Hybrid number parsing - inline for small ints, SIMD for large numbers/floats
-__attribute__((always_inline))
-static inline PyObject* json_parse_number_simd(const char *json, size_t *pos, size_t len) {
-    size_t i = *pos;
-    int is_negative = 0;
+// NDJSON on_error modes
+#define DHI_NDJSON_RAISE   0
+#define DHI_NDJSON_SKIP    1
+#define DHI_NDJSON_COLLECT 2
 
-    // Check for negative
-    if (i < len && json[i] == '-') {
-        is_negative = 1;
-        i++;
+// struct_from_ndjson(cls, data, on_error="raise", out=None) -> list, or (list, errors) for "collect"
+// Each non-blank line is one object. Rejects are reported as
+// (line_no, byte_offset, exception) without re-parsing anything in Python.
+static PyObject* py_struct_from_ndjson(PyObject *self, PyObject *args, PyObject *kwargs) {
+    static char *kwlist[] = {"cls", "data", "on_error", "out", NULL};
+    PyObject *cls;
+    PyObject *json_data;
+    const char *on_error = "raise";
+    PyObject *out = Py_None;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|sO", kwlist, &cls, &json_data, &on_error, &out)) {
+        return NULL;
+    }
+    if (out == Py_None) {
+        out = NULL;
+    } else if (!PyList_Check(out)) {
+        PyErr_SetString(PyExc_TypeError, "out must be a list");
+        return NULL;
     }
 
-    // Fast path: inline parsing for small integers (up to 18 digits)
-    // This avoids FFI overhead for common cases like "30", "100", etc.
-    if (i < len && json[i] >= '0' && json[i] <= '9') {
-        long value = 0;
-        int digit_count = 0;
+    int mode;
+    if (strcmp(on_error, "raise") == 0) mode = DHI_NDJSON_RAISE;
+    else if (strcmp(on_error, "skip") == 0) mode = DHI_NDJSON_SKIP;
+    else if (strcmp(on_error, "collect") == 0) mode = DHI_NDJSON_COLLECT;
+    else {
+        PyErr_Format(PyExc_ValueError,
+            "on_error must be 'raise', 'skip' or 'collect', got '%s'", on_error);
+        return NULL;
+    }
 
-        while (i < len && json[i] >= '0' && json[i] <= '9') {
-            value = value * 10 + (json[i] - '0');
-            i++;
-            digit_count++;
-            if (digit_count > 18) break;  // Fall back for very large numbers
-        }
-
-        // Check if it's a float
-        if (i < len && (json[i] == '.' || json[i] == 'e' || json[i] == 'E')) {
-            // Float - use Zig SIMD for accuracy
-            double fval;
-            size_t end;
-            int result = dhi_parse_json_float(json, len, *pos, &fval, &end);
-            if (result != 0) {
-                PyErr_SetString(PyExc_ValueError, "Invalid float");
-                return NULL;
+    if (!PyType_Check(cls)) {
+        PyErr_SetString(PyExc_TypeError, "First argument must be a Struct class");
+        return NULL;
+    }
+
+    PyTypeObject *type = (PyTypeObject*)cls;
+    CompiledModelSpecs *ms = decoder_struct_specs(type);
+    if (!ms) return NULL;
+
+    // Borrow the JSON bytes (zero-copy for bytes, ASCII str and buffers)
+    DhiJsonInput input;
+    if (dhi_json_input_get(json_data, &input) < 0) return NULL;
+    const char *json = input.data;
+    size_t len = input.len;
+
+    // One slot per line; blank and rejected lines are trimmed at the end
+    DhiListFill fill;
+    Py_ssize_t n_lines = 0;
+    for (size_t p = 0; p < len; p = dhi_find_newline(json, len, p) + 1) n_lines++;
+    PyObject *rejects = NULL;
+    if (dhi_list_fill_init(&fill, out, n_lines) < 0) goto fail;
+    if (mode == DHI_NDJSON_COLLECT && !(rejects = PyList_New(0))) goto fail;
+
+    size_t pos = 0;
+    Py_ssize_t line_no = 0;
+    while (pos < len) {
+        line_no++;
+        size_t line_start = pos;
+        size_t eol = dhi_find_newline(json, len, pos);
+        pos = eol + 1;
+
+        // Objects are parsed against the line end, so a bad record can never
+        // run into the next one
+        size_t p = line_start;
+        SKIP_WS(json, p, eol);
+        if (p == eol) continue;  // blank line
+
+        DhiStructObject *obj = NULL;
+        PyObject *errors = NULL;
+        int ok = 0;
+
+        if (json[p] != '{') {
+            PyErr_SetString(PyExc_ValueError, "Expected JSON object");
+        } else if (!(obj = DhiStruct_alloc(type, ms->n_fields))) {
+            goto fail;
+        } else if (decoder_parse_object(obj, json, &p, eol, ms, &errors, NULL, NULL, NULL) == 0) {
+            if (errors) {
+                if (mode != DHI_NDJSON_SKIP) {
+                    PyObject *exc_args = Py_BuildValue("(sO)", "Validation failed", errors);
+                    PyErr_SetObject(PyExc_ValueError, exc_args);
+                    Py_XDECREF(exc_args);
+                }
+                Py_DECREF(errors);
+            } else {
+                SKIP_WS(json, p, eol);
+                ok = p == eol;
+                if (!ok) PyErr_SetString(PyExc_ValueError, "Unexpected data after JSON object");
             }
-            *pos = end;
-            return PyFloat_FromDouble(fval);
         }
 
-        // Small integer - return directly (no FFI needed!)
-        if (digit_count <= 18) {
-            *pos = i;
-            return PyLong_FromLong(is_negative ? -value : value);
+        if (ok) {
+            if (dhi_list_fill_put(&fill, (PyObject*)obj) < 0) goto fail;
+            continue;
         }
+        Py_XDECREF(obj);
 
-        // Very large integer - fall back to Zig SIMD
-        long int_val;
-        size_t end;
-        int result = dhi_parse_json_int(json, len, *pos, &int_val, &end);
-        if (result != 0) {
-            PyErr_SetString(PyExc_ValueError, "Invalid integer");
-            return NULL;
+        // Only MemoryError-class failures abort every mode
+        if (PyErr_Occurred() && !PyErr_ExceptionMatches(PyExc_ValueError)) goto fail;
+
+        if (mode == DHI_NDJSON_SKIP) {
+            PyErr_Clear();
+            continue;
+        }
+
+        PyObject *exc_type, *exc_value, *exc_tb;
+        PyErr_Fetch(&exc_type, &exc_value, &exc_tb);
+        PyErr_NormalizeException(&exc_type, &exc_value, &exc_tb);
+
+        if (mode == DHI_NDJSON_RAISE) {
+            PyErr_Format(PyExc_ValueError, "NDJSON line %zd (byte %zu): %S",
+                line_no, line_start, exc_value);
+            PyObject *t2, *v2, *tb2;
+            PyErr_Fetch(&t2, &v2, &tb2);
+            PyErr_NormalizeException(&t2, &v2, &tb2);
+            PyException_SetCause(v2, exc_value);  // steals exc_value
+            Py_XDECREF(exc_type);
+            Py_XDECREF(exc_tb);
+            PyErr_Restore(t2, v2, tb2);
+            goto fail;
+        }
+
+        PyObject *reject = Py_BuildValue("(nnO)", line_no, (Py_ssize_t)line_start, exc_value);
+        Py_XDECREF(exc_type);
+        Py_XDECREF(exc_value);
+        Py_XDECREF(exc_tb);
+        if (!reject || PyList_Append(rejects, reject) < 0) {
+            Py_XDECREF(reject);
+            goto fail;
         }
-        *pos = end;
-        return PyLong_FromLong(int_val);
+        Py_DECREF(reject);
+    }
+
+    dhi_json_input_release(&input);
+    PyObject *result = dhi_list_fill_finish(&fill);
+    if (result && mode == DHI_NDJSON_COLLECT) {
+        PyObject *pair = PyTuple_Pack(2, result, rejects);
+        Py_DECREF(result);
+        result = pair;
     }
+    Py_XDECREF(rejects);
+    return result;
 
-    // Invalid number
-    PyErr_SetString(PyExc_ValueError, "Invalid number");
+fail:
+    dhi_json_input_release(&input);
+    dhi_list_fill_abort(&fill);
+    Py_XDECREF(rejects);
     return NULL;
 }
 
-// Skip a JSON value (for unknown fields)
-__attribute__((unused))
-static int json_skip_value(const char *json, size_t *pos, size_t len) {
-    SKIP_WS(json, *pos, len);
-    if (*pos >= len) return 0;
-
-    char c = json[*pos];
+// =============================================================================
+// BaseModel.model_validate_json - JSON straight into init_model_core
+// =============================================================================
+// The top-level object is decoded into vectorcall-style kwvalues/kwnames and
+// validated by init_model_core, exactly like Model(**data) - no json.loads and
+// no intermediate top-level dict. Known keys resolve through the class's
+// dispatch table to the (interned) field-name objects, so init_model_core's
+// kwnames lookup hits on pointer identity. Nested values are decoded to plain
+// dict/list objects and validated the same way model_validate would.
+
+#define DHI_MVJ_STACK_KEYS 32
+
+// model_validate_json(cls, data) -> instance, or NotImplemented when the JSON
+// root is not an object or the document doesn't parse here (NaN/Infinity
+// literals, syntax errors). The Python caller then takes the json.loads path,
+// so those inputs keep json's own results and JSONDecodeError reporting.
+static PyObject* py_model_validate_json(PyObject *self_unused, PyObject *const *args, Py_ssize_t nargs) {
+    if (nargs != 2) {
+        PyErr_SetString(PyExc_TypeError, "model_validate_json requires 2 arguments");
+        return NULL;
+    }
+    PyObject *cls_obj = args[0];
+    if (!PyType_Check(cls_obj)) {
+        PyErr_SetString(PyExc_TypeError, "model_validate_json: expected a class");
+        return NULL;
+    }
+    PyTypeObject *cls = (PyTypeObject*)cls_obj;
 
-    if (c == '"') {
-        // Skip string
-        (*pos)++;
-        while (*pos < len) {
-            if (json[*pos] == '\\') (*pos) += 2;
-            else if (json[*pos] == '"') { (*pos)++; return 1; }
-            else (*pos)++;
-        }
-        return 0;
-    } else if (c == '{') {
-        // Skip object
-        (*pos)++;
-        int depth = 1;
-        while (*pos < len && depth > 0) {
-            if (json[*pos] == '{') depth++;
-            else if (json[*pos] == '}') depth--;
-            else if (json[*pos] == '"') {
-                (*pos)++;
-                while (*pos < len && json[*pos] != '"') {
-                    if (json[*pos] == '\\') (*pos)++;
-                    (*pos)++;
-                }
-            }
-            (*pos)++;
-        }
-        return depth == 0;
-    } else if (c == '[') {
-        // Skip array
-        (*pos)++;
-        int depth = 1;
-        while (*pos < len && depth > 0) {
-            if (json[*pos] == '[') depth++;
-            else if (json[*pos] == ']') depth--;
-            else if (json[*pos] == '"') {
-                (*pos)++;
-                while (*pos < len && json[*pos] != '"') {
-                    if (json[*pos] == '\\') (*pos)++;
-                    (*pos)++;
-                }
-            }
-            (*pos)++;
-        }
-        return depth == 0;
-    } else if (c == 't' && *pos + 4 <= len && memcmp(&json[*pos], "true", 4) == 0) {
-        *pos += 4; return 1;
-    } else if (c == 'f' && *pos + 5 <= len && memcmp(&json[*pos], "false", 5) == 0) {
-        *pos += 5; return 1;
-    } else if (c == 'n' && *pos + 4 <= len && memcmp(&json[*pos], "null", 4) == 0) {
-        *pos += 4; return 1;
-    } else if (c == '-' || (c >= '0' && c <= '9')) {
-        // Skip number
-        if (c == '-') (*pos)++;
-        while (*pos < len && json[*pos] >= '0' && json[*pos] <= '9') (*pos)++;
-        if (*pos < len && json[*pos] == '.') {
-            (*pos)++;
-            while (*pos < len && json[*pos] >= '0' && json[*pos] <= '9') (*pos)++;
+    PyObject *info_capsule = g_fastinfo_key
+        ? PyDict_GetItemWithError(cls->tp_dict, g_fastinfo_key)
+        : NULL;
+    if (!info_capsule) {
+        if (!PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError,
+                            "model_validate_json: class has no fast-construct info");
         }
-        if (*pos < len && (json[*pos] == 'e' || json[*pos] == 'E')) {
-            (*pos)++;
-            if (*pos < len && (json[*pos] == '+' || json[*pos] == '-')) (*pos)++;
-            while (*pos < len && json[*pos] >= '0' && json[*pos] <= '9') (*pos)++;
+        return NULL;
+    }
+    FastConstructInfo *info = (FastConstructInfo*)PyCapsule_GetPointer(info_capsule, "dhi.fast_construct");
+    if (!info) return NULL;
+    CompiledModelSpecs *ms = info->ms;
+
+    DhiJsonInput input;
+    if (dhi_json_input_get(args[1], &input) < 0) return NULL;
+    const char *json = input.data;
+    size_t len = input.len;
+    size_t pos = 0;
+
+    SKIP_WS(json, pos, len);
+    if (pos >= len || json[pos] != '{') {
+        dhi_json_input_release(&input);
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    pos++;
+
+    // kwnames must be a tuple; values sit in a parallel C array. Both start on
+    // the stack and move to the heap for objects with many keys.
+    PyObject *stack_keys[DHI_MVJ_STACK_KEYS], *stack_values[DHI_MVJ_STACK_KEYS];
+    PyObject **keys = stack_keys, **values = stack_values;
+    Py_ssize_t n_kw = 0, cap = DHI_MVJ_STACK_KEYS;
+    Py_ssize_t *field_slot = (Py_ssize_t*)PyMem_Malloc((ms->n_fields ? ms->n_fields : 1) * sizeof(Py_ssize_t));
+    PyObject *kwnames = NULL, *result = NULL;
+    int parsed = 0;
+    if (!field_slot) { PyErr_NoMemory(); goto done; }
+    for (Py_ssize_t i = 0; i < ms->n_fields; i++) field_slot[i] = -1;
+
+    SKIP_WS(json, pos, len);
+    if (pos < len && json[pos] == '}') {
+        pos++;
+    } else {
+        for (;;) {
+            SKIP_WS(json, pos, len);
+            if (__builtin_expect(pos >= len || json[pos] != '"', 0)) {
+                PyErr_SetString(PyExc_ValueError, "Expected field name");
+                goto done;
+            }
+            size_t key_len;
+            int needs_unescape;
+            char *key_start = decoder_scan_string(json, &pos, len, &key_len, &needs_unescape, NULL);
+            if (__builtin_expect(!key_start, 0)) {
+                PyErr_SetString(PyExc_ValueError, "Invalid field name");
+                goto done;
+            }
+            SKIP_WS(json, pos, len);
+            if (__builtin_expect(pos >= len || json[pos] != ':', 0)) {
+                PyErr_SetString(PyExc_ValueError, "Expected ':'");
+                goto done;
+            }
+            pos++;
+
+            PyObject *value = decoder_parse_any(json, &pos, len, NULL);
+            if (!value) goto done;
+
+            Py_ssize_t field_idx = needs_unescape ? -1
+                : dhi_dispatch_lookup(ms, key_start, key_len, fnv1a_hash_inline(key_start, key_len));
+            Py_ssize_t slot = -1;
+            PyObject *key;
+            if (field_idx >= 0) {
+                key = ms->specs[field_idx].name_obj;
+                Py_INCREF(key);
+                slot = field_slot[field_idx];
+            } else {
+                key = needs_unescape ? json_unescape_string(key_start, key_len)
+                                     : PyUnicode_FromStringAndSize(key_start, key_len);
+                if (!key) { Py_DECREF(value); goto done; }
+                for (Py_ssize_t k = 0; k < n_kw; k++) {  // duplicates: last one wins
+                    if (PyUnicode_Compare(keys[k], key) == 0) { slot = k; break; }
+                }
+            }
+
+            if (slot >= 0) {
+                Py_DECREF(key);
+                Py_SETREF(values[slot], value);
+            } else {
+                if (n_kw == cap) {
+                    Py_ssize_t new_cap = cap * 2;
+                    PyObject **nk = (PyObject**)PyMem_Malloc(new_cap * sizeof(PyObject*));
+                    PyObject **nv = (PyObject**)PyMem_Malloc(new_cap * sizeof(PyObject*));
+                    if (!nk || !nv) {
+                        PyMem_Free(nk); PyMem_Free(nv);
+                        Py_DECREF(key); Py_DECREF(value);
+                        PyErr_NoMemory();
+                        goto done;
+                    }
+                    memcpy(nk, keys, n_kw * sizeof(PyObject*));
+                    memcpy(nv, values, n_kw * sizeof(PyObject*));
+                    if (keys != stack_keys) { PyMem_Free(keys); PyMem_Free(values); }
+                    keys = nk; values = nv; cap = new_cap;
+                }
+                if (field_idx >= 0) field_slot[field_idx] = n_kw;
+                keys[n_kw] = key;
+                values[n_kw] = value;
+                n_kw++;
+            }
+
+            SKIP_WS(json, pos, len);
+            if (pos < len && json[pos] == ',') { pos++; continue; }
+            if (pos < len && json[pos] == '}') { pos++; break; }
+            PyErr_SetString(PyExc_ValueError, "Expected ',' or '}' in object");
+            goto done;
         }
-        return 1;
     }
+    SKIP_WS(json, pos, len);
+    if (pos != len) {
+        PyErr_SetString(PyExc_ValueError, "Extra data after JSON object");
+        goto done;
+    }
+    parsed = 1;
+
+    kwnames = PyTuple_New(n_kw);
+    if (!kwnames) goto done;
+    for (Py_ssize_t k = 0; k < n_kw; k++) {
+        Py_INCREF(keys[k]);
+        PyTuple_SET_ITEM(kwnames, k, keys[k]);
+    }
+
+    PyObject *inst = cls->tp_alloc(cls, 0);
+    if (!inst) goto done;
+    DhiErrorBuf eb;
+    dhi_errors_init(&eb, 0);
+    int status = init_model_core_records(inst, ms, info->extra_mode, NULL, values, 0, kwnames, &eb);
+    result = dhi_fast_construct_finish(info, inst, status, &eb);
+
+done:
+    for (Py_ssize_t k = 0; k < n_kw; k++) {
+        Py_DECREF(keys[k]);
+        Py_DECREF(values[k]);
+    }
+    if (keys != stack_keys) { PyMem_Free(keys); PyMem_Free(values); }
+    PyMem_Free(field_slot);
+    Py_XDECREF(kwnames);
+    dhi_json_input_release(&input);
+    if (!result && !parsed && PyErr_ExceptionMatches(PyExc_ValueError)) {
+        PyErr_Clear();
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    return result;
+}
+
+// =============================================================================
+// MESSAGEPACK - binary encode/decode for Structs and compiled models
+// =============================================================================
+// Same shapes as the JSON paths, minus number formatting and parsing: a Struct
+// or model is a map of field name -> value, or with positional=True (Structs
+// only) an array in field order. Decoding accepts either form, skips unknown
+// keys, runs every field through its validation plan exactly as keyword
+// construction does, and decodes nested Structs straight into their values[].
+
+// Output buffer: the result bytes object itself, grown in place and trimmed
+// once at the end
+typedef struct {
+    PyObject *bytes;
+    char *buf;
+    size_t pos, cap;
+} DhiPackWriter;
+
+static int pack_writer_init(DhiPackWriter *w, size_t cap) {
+    w->bytes = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)cap);
+    if (!w->bytes) return -1;
+    w->buf = PyBytes_AS_STRING(w->bytes);
+    w->pos = 0;
+    w->cap = cap;
     return 0;
 }
 
-// SIMD-accelerated skip value using Zig backend
-static int json_skip_value_simd(const char *json, size_t *pos, size_t len) {
-    size_t end;
-    int result = dhi_skip_json_value(json, len, *pos, &end);
-    if (result != 0) return 0;
-    *pos = end;
-    return 1;
+static int pack_writer_grow(DhiPackWriter *w, size_t extra) {
+    size_t cap = w->cap * 2;
+    if (cap < w->pos + extra) cap = w->pos + extra;
+    if (_PyBytes_Resize(&w->bytes, (Py_ssize_t)cap) < 0) return -1;  // frees on error
+    w->buf = PyBytes_AS_STRING(w->bytes);
+    w->cap = cap;
+    return 0;
 }
 
-// Internal JSON parsing with validation into DhiStructObject
-// Returns 0 on success, -1 on error (with Python exception set)
-static int decoder_parse_json_internal(
-    DhiStructObject *self,
-    const char *json,
-    size_t len,
-    CompiledModelSpecs *ms
-) {
-    Py_ssize_t n_fields = ms->n_fields;
+static inline int pack_reserve(DhiPackWriter *w, size_t extra) {
+    if (__builtin_expect(w->pos + extra <= w->cap, 1)) return 0;
+    return pack_writer_grow(w, extra);
+}
 
-    // Initialize all values to NULL first for safe cleanup on error
-    // Use memset for speed when n_fields > 0
-    if (n_fields > 0) {
-        memset(self->values, 0, n_fields * sizeof(PyObject*));
+static PyObject* pack_writer_finish(DhiPackWriter *w) {
+    PyObject *result = w->bytes;
+    w->bytes = NULL;
+    if (_PyBytes_Resize(&result, (Py_ssize_t)w->pos) < 0) return NULL;
+    return result;
+}
+
+// Big-endian store of the low n bytes of v (space already reserved)
+static inline void pack_put_be(DhiPackWriter *w, uint64_t v, int n) {
+    for (int i = n - 1; i >= 0; i--) {
+        w->buf[w->pos++] = (char)(v >> (8 * i));
     }
+}
 
-    size_t pos = 0;
-    SKIP_WS(json, pos, len);
+static inline int pack_write_byte(DhiPackWriter *w, uint8_t b) {
+    if (pack_reserve(w, 1) < 0) return -1;
+    w->buf[w->pos++] = (char)b;
+    return 0;
+}
 
-    if (__builtin_expect(pos >= len || json[pos] != '{', 0)) {
-        PyErr_SetString(PyExc_ValueError, "Expected JSON object");
+// Length header: the fix form for n < fix_limit (fix_limit 0 = none), else
+// the 8/16/32-bit forms code8 (0 = none), code16, code16 + 1
+static int pack_write_header(DhiPackWriter *w, size_t n, uint8_t fix, size_t fix_limit,
+                             uint8_t code8, uint8_t code16) {
+    if (pack_reserve(w, 5) < 0) return -1;
+    if (n < fix_limit) {
+        w->buf[w->pos++] = (char)(fix | n);
+    } else if (code8 && n <= 0xff) {
+        w->buf[w->pos++] = (char)code8;
+        pack_put_be(w, n, 1);
+    } else if (n <= 0xffff) {
+        w->buf[w->pos++] = (char)code16;
+        pack_put_be(w, n, 2);
+    } else if (n <= 0xffffffffu) {
+        w->buf[w->pos++] = (char)(code16 + 1);
+        pack_put_be(w, n, 4);
+    } else {
+        PyErr_SetString(PyExc_ValueError, "MessagePack: value too large (over 2**32 - 1 items)");
         return -1;
     }
-    pos++;
-
-    // Track which fields we've seen (no malloc needed - use cached specs)
-    Py_ssize_t expected_field = 0;  // For ordered field matching
+    return 0;
+}
 
-    PyObject *errors = NULL;
+#define PACK_ARRAY_HEADER(w, n) pack_write_header((w), (n), 0x90, 16, 0, 0xdc)
+#define PACK_MAP_HEADER(w, n)   pack_write_header((w), (n), 0x80, 16, 0, 0xde)
 
-    while (pos < len) {
-        SKIP_WS(json, pos, len);
-        if (__builtin_expect(pos >= len, 0)) {
-            PyErr_SetString(PyExc_ValueError, "Unexpected end of JSON");
-            goto error;
-        }
-        if (json[pos] == '}') { pos++; break; }
-        if (json[pos] == ',') { pos++; continue; }
+static inline int pack_write_raw(DhiPackWriter *w, const char *data, size_t n) {
+    if (pack_reserve(w, n) < 0) return -1;
+    memcpy(w->buf + w->pos, data, n);
+    w->pos += n;
+    return 0;
+}
 
-        // Parse field name
-        if (__builtin_expect(json[pos] != '"', 0)) {
-            PyErr_SetString(PyExc_ValueError, "Expected field name");
-            goto error;
-        }
+static int pack_write_str(DhiPackWriter *w, PyObject *value) {
+    Py_ssize_t n;
+    const char *s = PyUnicode_AsUTF8AndSize(value, &n);
+    if (!s) return -1;
+    if (pack_write_header(w, (size_t)n, 0xa0, 32, 0xd9, 0xda) < 0) return -1;
+    return pack_write_raw(w, s, (size_t)n);
+}
 
-        size_t key_len;
-        int needs_unescape;
-        // Use SIMD-accelerated string parsing for field names
-        char *key_start = json_parse_string_simd(json, &pos, len, &key_len, &needs_unescape);
-        if (__builtin_expect(!key_start, 0)) {
-            PyErr_SetString(PyExc_ValueError, "Invalid field name");
-            goto error;
-        }
+static int pack_write_bin(DhiPackWriter *w, const char *data, size_t n) {
+    if (pack_write_header(w, n, 0, 0, 0xc4, 0xc5) < 0) return -1;
+    return pack_write_raw(w, data, n);
+}
 
-        // Skip colon
-        SKIP_WS(json, pos, len);
-        if (__builtin_expect(pos >= len || json[pos] != ':', 0)) {
-            PyErr_SetString(PyExc_ValueError, "Expected ':'");
-            goto error;
-        }
-        pos++;
-        SKIP_WS(json, pos, len);
-        if (__builtin_expect(pos >= len, 0)) {
-            PyErr_SetString(PyExc_ValueError, "Unexpected end of JSON");
-            goto error;
+// Smallest encoding of the int: fixints, then (u)int8..64
+static int pack_write_int(DhiPackWriter *w, PyObject *value) {
+    int overflow;
+    long long v = PyLong_AsLongLongAndOverflow(value, &overflow);
+    if (v == -1 && PyErr_Occurred()) return -1;
+    if (pack_reserve(w, 9) < 0) return -1;
+    if (__builtin_expect(overflow != 0, 0)) {
+        unsigned long long u = overflow > 0 ? PyLong_AsUnsignedLongLong(value) : 0;
+        if (overflow < 0 || (u == (unsigned long long)-1 && PyErr_Occurred())) {
+            PyErr_Clear();
+            PyErr_SetString(PyExc_OverflowError, "MessagePack: int out of 64-bit range");
+            return -1;
         }
+        w->buf[w->pos++] = (char)0xcf;
+        pack_put_be(w, u, 8);
+        return 0;
+    }
+    if (v >= 0) {
+        if (v < 0x80) { w->buf[w->pos++] = (char)v; }
+        else if (v <= 0xff) { w->buf[w->pos++] = (char)0xcc; pack_put_be(w, (uint64_t)v, 1); }
+        else if (v <= 0xffff) { w->buf[w->pos++] = (char)0xcd; pack_put_be(w, (uint64_t)v, 2); }
+        else if (v <= 0xffffffffLL) { w->buf[w->pos++] = (char)0xce; pack_put_be(w, (uint64_t)v, 4); }
+        else { w->buf[w->pos++] = (char)0xcf; pack_put_be(w, (uint64_t)v, 8); }
+    } else {
+        if (v >= -32) { w->buf[w->pos++] = (char)v; }
+        else if (v >= INT8_MIN) { w->buf[w->pos++] = (char)0xd0; pack_put_be(w, (uint64_t)v, 1); }
+        else if (v >= INT16_MIN) { w->buf[w->pos++] = (char)0xd1; pack_put_be(w, (uint64_t)v, 2); }
+        else if (v >= INT32_MIN) { w->buf[w->pos++] = (char)0xd2; pack_put_be(w, (uint64_t)v, 4); }
+        else { w->buf[w->pos++] = (char)0xd3; pack_put_be(w, (uint64_t)v, 8); }
+    }
+    return 0;
+}
 
-        // Match field name using cached hash and length (no malloc, no strlen!)
-        uint64_t key_hash = fnv1a_hash_inline(key_start, key_len);
-        Py_ssize_t field_idx = -1;
+static int pack_write_value(DhiPackWriter *w, PyObject *value, int positional);
 
-        // Ordered matching: check expected field first (fast path for in-order JSON)
-        // Skip memcmp in fast path - FNV-1a hash + length match is sufficient
-        // (collision probability is ~1 in 2^64 for same-length strings)
-        if (expected_field < n_fields) {
-            CompiledFieldSpec *efs = &ms->specs[expected_field];
-            if (efs->name_hash_fnv == key_hash && efs->name_len == key_len) {
-                field_idx = expected_field;
-                expected_field++;
-                goto field_matched;
-            }
-        }
+static int pack_write_struct(DhiPackWriter *w, DhiStructObject *obj, int positional) {
+    DhiStructMetaObject *meta = DhiStruct_meta(Py_TYPE(obj));
+    if (meta && meta->lazy_fields && DhiStruct_materialize(obj) < 0) return -1;
+    CompiledModelSpecs *ms = decoder_struct_specs(Py_TYPE(obj));
+    if (!ms) return -1;
+    Py_ssize_t n_fields = ms->n_fields < Py_SIZE(obj) ? ms->n_fields : Py_SIZE(obj);
 
-        // Fall back to linear search - use memcmp for safety in edge cases
+    if (positional) {
+        // A deleted field is written as nil to keep the later ones in place
+        if (PACK_ARRAY_HEADER(w, (size_t)n_fields) < 0) return -1;
         for (Py_ssize_t i = 0; i < n_fields; i++) {
-            CompiledFieldSpec *cfs = &ms->specs[i];
-            if (cfs->name_hash_fnv == key_hash && cfs->name_len == key_len) {
-                if (memcmp(cfs->name_ptr, key_start, key_len) == 0) {
-                    field_idx = i;
-                    break;
-                }
-            }
+            PyObject *value = obj->values[i];
+            if (pack_write_value(w, value ? value : Py_None, 1) < 0) return -1;
         }
+        return 0;
+    }
 
-field_matched:
+    size_t n_set = 0;
+    for (Py_ssize_t i = 0; i < n_fields; i++) n_set += obj->values[i] != NULL;
+    if (PACK_MAP_HEADER(w, n_set) < 0) return -1;
+    for (Py_ssize_t i = 0; i < n_fields; i++) {
+        PyObject *value = obj->values[i];
+        if (!value) continue;
+        if (pack_write_str(w, ms->specs[i].name_obj) < 0) return -1;
+        if (pack_write_value(w, value, 0) < 0) return -1;
+    }
+    return 0;
+}
 
-        // Unknown field - skip value using SIMD
-        if (field_idx < 0) {
-            if (!json_skip_value_simd(json, &pos, len)) {
-                PyErr_SetString(PyExc_ValueError, "Invalid JSON value");
-                goto error;
-            }
-            continue;
+// Compiled model: the declared fields present in __dict__, by field name
+// (extras are not written)
+static int pack_write_model(DhiPackWriter *w, PyObject *obj, CompiledModelSpecs *ms) {
+    PyObject *obj_dict = PyObject_GenericGetDict(obj, NULL);
+    if (!obj_dict) return -1;
+    size_t n_set = 0;
+    for (Py_ssize_t i = 0; i < ms->n_fields; i++) {
+        n_set += PyDict_GetItem(obj_dict, ms->specs[i].name_obj) != NULL;
+    }
+    int r = PACK_MAP_HEADER(w, n_set);
+    for (Py_ssize_t i = 0; i < ms->n_fields && r == 0; i++) {
+        PyObject *value = PyDict_GetItem(obj_dict, ms->specs[i].name_obj);
+        if (!value) continue;
+        Py_INCREF(value);
+        r = pack_write_str(w, ms->specs[i].name_obj);
+        if (r == 0) r = pack_write_value(w, value, 0);
+        Py_DECREF(value);
+    }
+    Py_DECREF(obj_dict);
+    return r;
+}
+
+static int pack_write_value(DhiPackWriter *w, PyObject *value, int positional) {
+    if (value == Py_None) return pack_write_byte(w, 0xc0);
+    if (PyBool_Check(value)) return pack_write_byte(w, value == Py_True ? 0xc3 : 0xc2);
+    if (PyLong_Check(value)) return pack_write_int(w, value);
+    if (PyFloat_Check(value)) {
+        double d = PyFloat_AS_DOUBLE(value);
+        uint64_t bits;
+        memcpy(&bits, &d, sizeof(bits));
+        if (pack_reserve(w, 9) < 0) return -1;
+        w->buf[w->pos++] = (char)0xcb;
+        pack_put_be(w, bits, 8);
+        return 0;
+    }
+    if (PyUnicode_Check(value)) return pack_write_str(w, value);
+    if (PyBytes_Check(value)) {
+        return pack_write_bin(w, PyBytes_AS_STRING(value), (size_t)PyBytes_GET_SIZE(value));
+    }
+    if (PyByteArray_Check(value)) {
+        return pack_write_bin(w, PyByteArray_AS_STRING(value), (size_t)PyByteArray_GET_SIZE(value));
+    }
+    if (PyDate_Check(value)) {
+        // date/datetime as its isoformat() str, which the decoder parses back
+        PyObject *iso = PyObject_CallMethod(value, "isoformat", NULL);
+        if (!iso) return -1;
+        int r = PyUnicode_Check(iso) ? pack_write_str(w, iso) : -1;
+        if (r < 0 && !PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "MessagePack: isoformat() did not return a str");
+        }
+        Py_DECREF(iso);
+        return r;
+    }
+
+    // Containers and models recurse; guard against self-referencing data
+    if (Py_EnterRecursiveCall(" while serializing to MessagePack")) return -1;
+    int r;
+    PyObject *specs;
+    if (PyList_Check(value) || PyTuple_Check(value)) {
+        PyObject *seq = PySequence_Tuple(value);  // snapshot: items stay alive
+        r = seq ? PACK_ARRAY_HEADER(w, (size_t)PyTuple_GET_SIZE(seq)) : -1;
+        for (Py_ssize_t i = 0; r == 0 && i < PyTuple_GET_SIZE(seq); i++) {
+            r = pack_write_value(w, PyTuple_GET_ITEM(seq, i), positional);
+        }
+        Py_XDECREF(seq);
+    } else if (PyDict_Check(value)) {
+        r = PACK_MAP_HEADER(w, (size_t)PyDict_GET_SIZE(value));
+        Py_ssize_t pos = 0;
+        PyObject *key, *item;
+        while (r == 0 && PyDict_Next(value, &pos, &key, &item)) {
+            r = pack_write_value(w, key, positional);
+            if (r == 0) r = pack_write_value(w, item, positional);
         }
+    } else if (PyObject_TypeCheck(value, &DhiStructType)) {
+        r = pack_write_struct(w, (DhiStructObject*)value, positional);
+    } else if ((specs = json_dump_specs_of(Py_TYPE(value))) != NULL && specs != Py_None) {
+        CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(specs, "dhi.compiled_specs");
+        r = ms ? pack_write_model(w, value, ms) : -1;
+    } else {
+        PyErr_Format(PyExc_TypeError, "MessagePack: cannot serialize %.200s",
+                     Py_TYPE(value)->tp_name);
+        r = -1;
+    }
+    Py_LeaveRecursiveCall();
+    return r;
+}
 
-        CompiledFieldSpec *fs = &ms->specs[field_idx];
+// dump_msgpack(obj, positional=False) -> bytes
+static PyObject* py_dump_msgpack(PyObject *self_unused, PyObject *args) {
+    PyObject *obj;
+    int positional = 0;
+    if (!PyArg_ParseTuple(args, "O|p", &obj, &positional)) return NULL;
+    if (json_dump_keys_init() < 0) return NULL;
+
+    DhiPackWriter w;
+    Py_ssize_t n_fields = PyObject_TypeCheck(obj, &DhiStructType) ? Py_SIZE(obj) : 4;
+    if (pack_writer_init(&w, 32 + (size_t)n_fields * 16) < 0) return NULL;
+    if (pack_write_value(&w, obj, positional) < 0) {
+        Py_CLEAR(w.bytes);
+        return NULL;
+    }
+    return pack_writer_finish(&w);
+}
 
-        // Parse value based on expected type
-        // Track JSON value type to skip redundant type checks
-        PyObject *value = NULL;
-        int json_type = 0;  // 1=int, 2=float, 3=str, 4=bool, 5=null
-        char c = json[pos];
+// --- Decoding ---
 
-        if (c == '"') {
-            // String value - SIMD accelerated parsing
-            json_type = 3;
-            size_t str_len;
-            int needs_esc;
-            char *str_start = json_parse_string_simd(json, &pos, len, &str_len, &needs_esc);
-            if (__builtin_expect(!str_start, 0)) {
-                PyErr_SetString(PyExc_ValueError, "Invalid string value");
-                goto error;
-            }
+enum { DHI_MP_NIL, DHI_MP_BOOL, DHI_MP_INT, DHI_MP_UINT, DHI_MP_FLOAT,
+       DHI_MP_STR, DHI_MP_BIN, DHI_MP_ARRAY, DHI_MP_MAP, DHI_MP_EXT };
+
+// One decoded header. For str/bin/ext the payload (n bytes) follows at the
+// new position and is known to be in bounds; arrays have n items, maps n pairs.
+typedef struct {
+    int kind;
+    uint64_t n;     // length / count, or the DHI_MP_UINT value (also bool)
+    int64_t i;      // DHI_MP_INT value
+    double d;       // DHI_MP_FLOAT value
+} DhiMpHeader;
+
+static inline uint64_t unpack_be(const unsigned char *p, int n) {
+    uint64_t v = 0;
+    for (int i = 0; i < n; i++) v = (v << 8) | p[i];
+    return v;
+}
 
-            if (__builtin_expect(needs_esc, 0)) {
-                // Rare case: string has escapes
-                value = json_unescape_string(str_start, str_len);
+// Fixed-width header; 0 ok, -1 truncated or invalid (exception set)
+static int unpack_header(const unsigned char *b, size_t *pos, size_t len, DhiMpHeader *h) {
+    if (__builtin_expect(*pos >= len, 0)) goto truncated;
+    size_t p = *pos;
+    unsigned c = b[p++];
+    int width = 0;   // bytes of length / value after the type byte
+    int64_t sext;
+
+    if (c <= 0x7f) { h->kind = DHI_MP_UINT; h->n = c; *pos = p; return 0; }
+    if (c >= 0xe0) { h->kind = DHI_MP_INT; h->i = (int8_t)c; *pos = p; return 0; }
+    if (c <= 0x8f) { h->kind = DHI_MP_MAP; h->n = c & 0x0f; *pos = p; return 0; }
+    if (c <= 0x9f) { h->kind = DHI_MP_ARRAY; h->n = c & 0x0f; *pos = p; return 0; }
+    if (c <= 0xbf) { h->kind = DHI_MP_STR; h->n = c & 0x1f; goto payload; }
+
+    switch (c) {
+        case 0xc0: h->kind = DHI_MP_NIL; *pos = p; return 0;
+        case 0xc2: case 0xc3: h->kind = DHI_MP_BOOL; h->n = c == 0xc3; *pos = p; return 0;
+        case 0xc4: case 0xc5: case 0xc6: h->kind = DHI_MP_BIN; width = 1 << (c - 0xc4); break;
+        case 0xc7: case 0xc8: case 0xc9: h->kind = DHI_MP_EXT; width = 1 << (c - 0xc7); break;
+        case 0xca: case 0xcb: h->kind = DHI_MP_FLOAT; width = c == 0xca ? 4 : 8; break;
+        case 0xcc: case 0xcd: case 0xce: case 0xcf: h->kind = DHI_MP_UINT; width = 1 << (c - 0xcc); break;
+        case 0xd0: case 0xd1: case 0xd2: case 0xd3: h->kind = DHI_MP_INT; width = 1 << (c - 0xd0); break;
+        case 0xd4: case 0xd5: case 0xd6: case 0xd7: case 0xd8:
+            // fixext: type byte + 1..16 data bytes
+            h->kind = DHI_MP_EXT; h->n = ((uint64_t)1 << (c - 0xd4)) + 1; goto payload;
+        case 0xd9: case 0xda: case 0xdb: h->kind = DHI_MP_STR; width = 1 << (c - 0xd9); break;
+        case 0xdc: case 0xdd: h->kind = DHI_MP_ARRAY; width = c == 0xdc ? 2 : 4; break;
+        case 0xde: case 0xdf: h->kind = DHI_MP_MAP; width = c == 0xde ? 2 : 4; break;
+        default:
+            PyErr_Format(PyExc_ValueError, "Invalid MessagePack type byte 0x%02x", c);
+            return -1;
+    }
+    if (__builtin_expect(len - p < (size_t)width, 0)) goto truncated;
+    uint64_t v = unpack_be(b + p, width);
+    p += width;
+    switch (h->kind) {
+        case DHI_MP_FLOAT:
+            if (width == 4) {
+                uint32_t bits32 = (uint32_t)v;
+                float f;
+                memcpy(&f, &bits32, sizeof(f));
+                h->d = f;
             } else {
-                // Common case: no escapes, use faster function
-                value = PyUnicode_FromStringAndSize(str_start, str_len);
-            }
-            if (__builtin_expect(!value, 0)) goto error;
-
-        } else if (c == '-' || (c >= '0' && c <= '9')) {
-            // Number value - SIMD accelerated parsing
-            value = json_parse_number_simd(json, &pos, len);
-            if (!value) goto error;
-            json_type = PyFloat_Check(value) ? 2 : 1;
-
-            // Convert int to float if needed
-            if (fs->type_code == 2 && json_type == 1) {
-                PyObject *fval = PyNumber_Float(value);
-                Py_DECREF(value);
-                value = fval;
-                if (!value) goto error;
-                json_type = 2;
+                memcpy(&h->d, &v, sizeof(h->d));
             }
+            *pos = p;
+            return 0;
+        case DHI_MP_INT:
+            sext = width == 8 ? (int64_t)v : (int64_t)(v << (64 - 8 * width)) >> (64 - 8 * width);
+            h->i = sext;
+            *pos = p;
+            return 0;
+        case DHI_MP_UINT: case DHI_MP_ARRAY: case DHI_MP_MAP:
+            h->n = v;
+            *pos = p;
+            return 0;
+        default:
+            h->n = v;
+            if (h->kind == DHI_MP_EXT) h->n++;  // the ext type byte comes first
+            break;
+    }
 
-        } else if (c == 't' && pos + 4 <= len && memcmp(&json[pos], "true", 4) == 0) {
-            value = Py_True;
-            Py_INCREF(value);
-            pos += 4;
-            json_type = 4;
-        } else if (c == 'f' && pos + 5 <= len && memcmp(&json[pos], "false", 5) == 0) {
-            value = Py_False;
-            Py_INCREF(value);
-            pos += 5;
-            json_type = 4;
-        } else if (c == 'n' && pos + 4 <= len && memcmp(&json[pos], "null", 4) == 0) {
-            value = Py_None;
-            Py_INCREF(value);
-            pos += 4;
-            json_type = 5;
-        } else if (c == '[' || c == '{') {
-            // Array or nested object - skip using SIMD
-            if (!json_skip_value_simd(json, &pos, len)) {
-                PyErr_SetString(PyExc_ValueError, "Invalid nested value");
-                goto error;
-            }
-            value = Py_None;
-            Py_INCREF(value);
-            json_type = 5;
-        } else {
-            PyErr_SetString(PyExc_ValueError, "Invalid JSON value");
-            goto error;
+payload:
+    if (__builtin_expect(len - p < h->n, 0)) goto truncated;
+    *pos = p;
+    return 0;
+
+truncated:
+    PyErr_SetString(PyExc_ValueError, "Truncated MessagePack data");
+    return -1;
+}
+
+// Skip one value without building objects. 0 or -1.
+static int unpack_skip(const unsigned char *b, size_t *pos, size_t len) {
+    uint64_t remaining = 1;
+    while (remaining > 0) {
+        remaining--;
+        DhiMpHeader h;
+        if (unpack_header(b, pos, len, &h) < 0) return -1;
+        switch (h.kind) {
+            case DHI_MP_STR: case DHI_MP_BIN: case DHI_MP_EXT: *pos += h.n; break;
+            case DHI_MP_ARRAY: remaining += h.n; break;
+            case DHI_MP_MAP: remaining += 2 * h.n; break;
+            default: break;
         }
+    }
+    return 0;
+}
 
-        // Type checking - only when JSON type doesn't match expected type
-        // This skips redundant checks when types align (common case)
-        const char *field_name = fs->name_ptr;
-        int type_mismatch = 0;
-
-        if (fs->type_code == 1) {  // int
-            if (json_type != 1) type_mismatch = 1;
-        } else if (fs->type_code == 2) {  // float
-            if (json_type != 1 && json_type != 2) type_mismatch = 1;
-        } else if (fs->type_code == 3) {  // str
-            if (json_type != 3) type_mismatch = 1;
-        } else if (fs->type_code == 4) {  // bool
-            if (json_type != 4) type_mismatch = 1;
-        }
-        // type_code == 0 (any) or 5 (bytes) - skip type checking
-
-        if (__builtin_expect(type_mismatch, 0)) {
-            if (!errors) errors = PyList_New(0);
-            const char *expected =
-                fs->type_code == 1 ? "int" :
-                fs->type_code == 2 ? "float" :
-                fs->type_code == 3 ? "str" :
-                fs->type_code == 4 ? "bool" : "unknown";
-            PyObject *msg = PyUnicode_FromFormat("%s: Expected %s, got %s",
-                field_name, expected, Py_TYPE(value)->tp_name);
-            PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg);
-            Py_DECREF(msg);
-            PyList_Append(errors, err);
-            Py_DECREF(err);
-            Py_DECREF(value);
-            continue;
+// Any value into plain Python objects (dict/list/str/bytes/int/float/bool/None)
+static PyObject* unpack_any(const unsigned char *b, size_t *pos, size_t len) {
+    DhiMpHeader h;
+    if (unpack_header(b, pos, len, &h) < 0) return NULL;
+    PyObject *result;
+    switch (h.kind) {
+        case DHI_MP_NIL: Py_RETURN_NONE;
+        case DHI_MP_BOOL: return PyBool_FromLong((long)h.n);
+        case DHI_MP_UINT: return PyLong_FromUnsignedLongLong(h.n);
+        case DHI_MP_INT: return PyLong_FromLongLong(h.i);
+        case DHI_MP_FLOAT: return PyFloat_FromDouble(h.d);
+        case DHI_MP_STR:
+            result = PyUnicode_DecodeUTF8((const char*)b + *pos, (Py_ssize_t)h.n, NULL);
+            *pos += h.n;
+            return result;
+        case DHI_MP_BIN:
+            result = PyBytes_FromStringAndSize((const char*)b + *pos, (Py_ssize_t)h.n);
+            *pos += h.n;
+            return result;
+        case DHI_MP_EXT:
+            PyErr_Format(PyExc_ValueError, "Unsupported MessagePack extension type %d",
+                         (int)(int8_t)b[*pos]);
+            return NULL;
+        default:
+            break;
+    }
+
+    // Every item takes at least one byte, which bounds hostile counts
+    if (__builtin_expect(h.n > len - *pos, 0)) {
+        PyErr_SetString(PyExc_ValueError, "Truncated MessagePack data");
+        return NULL;
+    }
+    if (Py_EnterRecursiveCall(" while decoding MessagePack")) return NULL;
+    if (h.kind == DHI_MP_ARRAY) {
+        result = PyList_New((Py_ssize_t)h.n);
+        for (uint64_t k = 0; result && k < h.n; k++) {
+            PyObject *item = unpack_any(b, pos, len);
+            if (!item) { Py_CLEAR(result); break; }
+            PyList_SET_ITEM(result, (Py_ssize_t)k, item);
         }
+    } else {
+        result = PyDict_New();
+        for (uint64_t k = 0; result && k < h.n; k++) {
+            PyObject *key = unpack_any(b, pos, len);
+            PyObject *item = key ? unpack_any(b, pos, len) : NULL;
+            if (!item || PyDict_SetItem(result, key, item) < 0) Py_CLEAR(result);
+            Py_XDECREF(key);
+            Py_XDECREF(item);
+        }
+    }
+    Py_LeaveRecursiveCall();
+    return result;
+}
 
-        // Numeric constraint validation - combined check for happy path
-        if (PyLong_Check(value) && !PyBool_Check(value) &&
-            (fs->has_gt | fs->has_ge | fs->has_lt | fs->has_le)) {
-            long val = PyLong_AsLong(value);
-            // Combined validity check - single branch for happy path
-            int valid = (!fs->has_gt || val > fs->gt_long) &&
-                        (!fs->has_ge || val >= fs->ge_long) &&
-                        (!fs->has_lt || val < fs->lt_long) &&
-                        (!fs->has_le || val <= fs->le_long);
-            if (__builtin_expect(!valid, 0)) {
-                // Error path - figure out which constraint failed
-                if (!errors) errors = PyList_New(0);
-                PyObject *msg = NULL;
-                if (fs->has_gt && val <= fs->gt_long) {
-                    msg = PyUnicode_FromFormat("%s: Value must be > %ld, got %ld",
-                        field_name, fs->gt_long, val);
-                } else if (fs->has_ge && val < fs->ge_long) {
-                    msg = PyUnicode_FromFormat("%s: Value must be >= %ld, got %ld",
-                        field_name, fs->ge_long, val);
-                } else if (fs->has_lt && val >= fs->lt_long) {
-                    msg = PyUnicode_FromFormat("%s: Value must be < %ld, got %ld",
-                        field_name, fs->lt_long, val);
-                } else {
-                    msg = PyUnicode_FromFormat("%s: Value must be <= %ld, got %ld",
-                        field_name, fs->le_long, val);
-                }
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg);
-                Py_DECREF(msg);
-                PyList_Append(errors, err);
-                Py_DECREF(err);
-                Py_DECREF(value);
+static int unpack_struct(DhiStructObject *self, const unsigned char *b, size_t *pos,
+                         size_t len, CompiledModelSpecs *ms, PyObject **errors_out);
+
+// MessagePack counterpart of decoder_decode_model: a new instance, or NULL
+// with either an exception set or (validation failure) a message in *err_msg
+static PyObject* unpack_model(PyObject *model_type, const unsigned char *b, size_t *pos,
+                              size_t len, PyObject **err_msg) {
+    *err_msg = NULL;
+
+    if (PyType_Check(model_type) &&
+        PyType_IsSubtype((PyTypeObject*)model_type, &DhiStructType)) {
+        PyTypeObject *type = (PyTypeObject*)model_type;
+        CompiledModelSpecs *ms = decoder_struct_specs(type);
+        if (!ms) return NULL;
+        DhiStructObject *obj = DhiStruct_alloc(type, ms->n_fields);
+        if (!obj) return NULL;
+
+        PyObject *sub_errors = NULL;
+        if (Py_EnterRecursiveCall(" while decoding nested MessagePack")) {
+            Py_DECREF(obj);
+            return NULL;
+        }
+        int r = unpack_struct(obj, b, pos, len, ms, &sub_errors);
+        Py_LeaveRecursiveCall();
+        if (r < 0) {
+            Py_DECREF(obj);
+            return NULL;
+        }
+        if (sub_errors) {
+            Py_DECREF(obj);
+            *err_msg = decoder_join_errors(sub_errors);
+            Py_DECREF(sub_errors);
+            return NULL;
+        }
+        return (PyObject*)obj;
+    }
+
+    // Other model classes: decode the map and call the class with it
+    PyObject *data = unpack_any(b, pos, len);
+    if (!data) return NULL;
+    if (!PyDict_Check(data)) {
+        *err_msg = PyUnicode_FromFormat("expected map, got %s", Py_TYPE(data)->tp_name);
+        Py_DECREF(data);
+        return NULL;
+    }
+    if (!g_empty_tuple) {
+        g_empty_tuple = PyTuple_New(0);
+        if (!g_empty_tuple) { Py_DECREF(data); return NULL; }
+    }
+    PyObject *inst = PyObject_Call(model_type, g_empty_tuple, data);
+    Py_DECREF(data);
+    if (!inst && (PyErr_ExceptionMatches(PyExc_ValueError) ||
+                  PyErr_ExceptionMatches(PyExc_TypeError))) {
+        PyObject *exc_type, *exc_value, *exc_tb;
+        PyErr_Fetch(&exc_type, &exc_value, &exc_tb);
+        *err_msg = exc_value ? PyObject_Str(exc_value) : PyUnicode_FromString("invalid value");
+        Py_XDECREF(exc_type);
+        Py_XDECREF(exc_value);
+        Py_XDECREF(exc_tb);
+    }
+    return inst;
+}
+
+// First type of the union that accepts the value, rewinding between tries
+static PyObject* unpack_union(PyObject *types, const unsigned char *b, size_t *pos,
+                              size_t len, PyObject **err_msg) {
+    Py_ssize_t n_types = PyTuple_GET_SIZE(types);
+    if (n_types == 1) return unpack_model(PyTuple_GET_ITEM(types, 0), b, pos, len, err_msg);
+
+    size_t start = *pos;
+    for (Py_ssize_t t = 0; t < n_types; t++) {
+        size_t p = start;
+        PyObject *msg = NULL;
+        PyObject *inst = unpack_model(PyTuple_GET_ITEM(types, t), b, &p, len, &msg);
+        if (inst) { *pos = p; return inst; }
+        if (!msg) return NULL;
+        Py_DECREF(msg);
+        *pos = p;
+    }
+    *err_msg = PyUnicode_FromString("Value does not match any expected type");
+    return NULL;
+}
+
+// Whether the value at pos is a map or array (either encodes a model)
+static inline int unpack_at_container(const unsigned char *b, size_t pos, size_t len) {
+    if (pos >= len) return 0;
+    unsigned c = b[pos];
+    return (c >= 0x80 && c <= 0x9f) || (c >= 0xdc && c <= 0xdf);
+}
+
+// Model-typed field (type_code 6/7/8); same contract as decoder_parse_model_field
+static int unpack_model_field(CompiledFieldSpec *fs, const unsigned char *b, size_t *pos,
+                              size_t len, PyObject **out, PyObject **errors) {
+    const char *field_name = fs->name_ptr;
+    PyObject *err_msg = NULL;
+    if (__builtin_expect(*pos >= len, 0)) {
+        PyErr_SetString(PyExc_ValueError, "Truncated MessagePack data");
+        return -1;
+    }
+
+    if (b[*pos] == 0xc0) {
+        (*pos)++;
+        if (!fs->required && fs->default_val == Py_None) {
+            Py_INCREF(Py_None);
+            *out = Py_None;
+            return 1;
+        }
+        return decoder_add_error(errors, fs,
+            PyUnicode_FromFormat("%s: Expected %s, got NoneType", field_name,
+                fs->type_code == 7 ? "list" : "object")) < 0 ? -1 : 0;
+    }
+
+    if (fs->type_code == 7) {
+        size_t p = *pos;
+        DhiMpHeader h;
+        if (unpack_header(b, &p, len, &h) < 0) return -1;
+        if (h.kind != DHI_MP_ARRAY) {
+            PyObject *v = unpack_any(b, pos, len);
+            if (!v) return -1;
+            PyObject *msg = PyUnicode_FromFormat("%s: Expected list, got %s",
+                field_name, Py_TYPE(v)->tp_name);
+            Py_DECREF(v);
+            return decoder_add_error(errors, fs, msg) < 0 ? -1 : 0;
+        }
+        *pos = p;
+        if (h.n > len - p) {
+            PyErr_SetString(PyExc_ValueError, "Truncated MessagePack data");
+            return -1;
+        }
+        PyObject *list = PyList_New((Py_ssize_t)h.n);
+        if (!list) return -1;
+        int failed = 0;
+        for (uint64_t j = 0; j < h.n; j++) {
+            PyObject *item;
+            if (unpack_at_container(b, *pos, len)) {
+                item = unpack_union(fs->union_types_tuple, b, pos, len, &err_msg);
+            } else {
+                item = unpack_any(b, pos, len);
+                if (!item) { Py_DECREF(list); return -1; }
+                err_msg = PyUnicode_FromFormat("expected object, got %s", Py_TYPE(item)->tp_name);
+                Py_CLEAR(item);
+                if (!err_msg) { Py_DECREF(list); return -1; }
+            }
+            if (item) {
+                PyList_SET_ITEM(list, (Py_ssize_t)j, item);
                 continue;
             }
+            if (!err_msg) { Py_DECREF(list); return -1; }
+            PyObject *msg = PyUnicode_FromFormat("%s: Item %zd: %U", field_name,
+                                                 (Py_ssize_t)j, err_msg);
+            Py_CLEAR(err_msg);
+            Py_INCREF(Py_None);
+            PyList_SET_ITEM(list, (Py_ssize_t)j, Py_None);
+            if (decoder_add_error(errors, fs, msg) < 0) { Py_DECREF(list); return -1; }
+            failed = 1;
+        }
+        if (failed) { Py_DECREF(list); return 0; }
+
+        Py_ssize_t list_len = PyList_GET_SIZE(list);
+        if (__builtin_expect((fs->has_minl && list_len < fs->min_len) ||
+                             (fs->has_maxl && list_len > fs->max_len), 0)) {
+            Py_DECREF(list);
+            PyObject *msg = (fs->has_minl && list_len < fs->min_len)
+                ? PyUnicode_FromFormat("%s: Length must be >= %zd, got %zd",
+                      field_name, fs->min_len, list_len)
+                : PyUnicode_FromFormat("%s: Length must be <= %zd, got %zd",
+                      field_name, fs->max_len, list_len);
+            return decoder_add_error(errors, fs, msg) < 0 ? -1 : 0;
         }
+        *out = list;
+        return 1;
+    }
 
-        // String length validation - combined check for happy path
-        if (PyUnicode_Check(value) && (fs->has_minl | fs->has_maxl)) {
-            Py_ssize_t slen = PyUnicode_GET_LENGTH(value);
-            int valid = (!fs->has_minl || slen >= fs->min_len) &&
-                        (!fs->has_maxl || slen <= fs->max_len);
-            if (__builtin_expect(!valid, 0)) {
-                if (!errors) errors = PyList_New(0);
-                PyObject *msg;
-                if (fs->has_minl && slen < fs->min_len) {
-                    msg = PyUnicode_FromFormat("%s: Length must be >= %zd, got %zd",
-                        field_name, fs->min_len, slen);
-                } else {
-                    msg = PyUnicode_FromFormat("%s: Length must be <= %zd, got %zd",
-                        field_name, fs->max_len, slen);
-                }
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg);
-                Py_DECREF(msg);
-                PyList_Append(errors, err);
-                Py_DECREF(err);
-                Py_DECREF(value);
+    // Nested model (6) or union of models (8): must be a map or array
+    if (!unpack_at_container(b, *pos, len)) {
+        PyObject *v = unpack_any(b, pos, len);
+        if (!v) return -1;
+        PyObject *msg = fs->type_code == 6
+            ? PyUnicode_FromFormat("%s: Expected %s or dict, got %s", field_name,
+                  ((PyTypeObject*)fs->nested_model_type)->tp_name, Py_TYPE(v)->tp_name)
+            : PyUnicode_FromFormat("%s: Value does not match any expected type", field_name);
+        Py_DECREF(v);
+        return decoder_add_error(errors, fs, msg) < 0 ? -1 : 0;
+    }
+
+    PyObject *inst = fs->type_code == 6
+        ? unpack_model(fs->nested_model_type, b, pos, len, &err_msg)
+        : unpack_union(fs->union_types_tuple, b, pos, len, &err_msg);
+    if (inst) { *out = inst; return 1; }
+    if (!err_msg) return -1;
+    PyObject *msg = PyUnicode_FromFormat("%s: %U", field_name, err_msg);
+    Py_DECREF(err_msg);
+    return decoder_add_error(errors, fs, msg) < 0 ? -1 : 0;
+}
+
+// Decode and validate one field value; same contract as decoder_parse_field
+static int unpack_field(CompiledFieldSpec *fs, const unsigned char *b, size_t *pos,
+                        size_t len, PyObject **out, PyObject **errors) {
+    if (fs->type_code >= 6 && fs->type_code <= 8) {
+        return unpack_model_field(fs, b, pos, len, out, errors);
+    }
+    PyObject *value = unpack_any(b, pos, len);
+    if (!value) return -1;
+    int r = dhi_plan_run_collect(fs, 0, value, out, errors);
+    Py_DECREF(value);
+    return r;
+}
+
+// Decode the map or array at *pos into self, collecting validation errors
+// into *errors_out like decoder_parse_object. 0 when well-formed, else -1.
+static int unpack_struct(DhiStructObject *self, const unsigned char *b, size_t *pos,
+                         size_t len, CompiledModelSpecs *ms, PyObject **errors_out) {
+    Py_ssize_t n_fields = ms->n_fields;
+    if (n_fields > 0) memset(self->values, 0, n_fields * sizeof(PyObject*));
+    DHI_STAT_TIMER(t0);
+    DHI_STAT_INC(ms, DHI_STAT_VALIDATIONS);
+
+    PyObject *errors = NULL;
+    DhiMpHeader h;
+    if (unpack_header(b, pos, len, &h) < 0) return -1;
+
+    if (h.kind == DHI_MP_ARRAY) {
+        // Positional: item k is field k
+        if (h.n > (uint64_t)n_fields) {
+            PyErr_Format(PyExc_ValueError, "MessagePack array has %llu items, %s has %zd fields",
+                         (unsigned long long)h.n, Py_TYPE(self)->tp_name, n_fields);
+            return -1;
+        }
+        for (Py_ssize_t i = 0; i < (Py_ssize_t)h.n; i++) {
+            PyObject *value;
+            int r = unpack_field(&ms->specs[i], b, pos, len, &value, &errors);
+            if (r < 0) goto error;
+            if (r == 0) { Py_INCREF(Py_None); value = Py_None; }
+            self->values[i] = value;
+        }
+    } else if (h.kind == DHI_MP_MAP) {
+        for (uint64_t k = 0; k < h.n; k++) {
+            DhiMpHeader kh;
+            size_t key_pos = *pos;
+            if (unpack_header(b, pos, len, &kh) < 0) goto error;
+            Py_ssize_t field_idx = -1;
+            if (kh.kind == DHI_MP_STR) {
+                const char *key = (const char*)b + *pos;
+                *pos += kh.n;
+                field_idx = dhi_dispatch_lookup(ms, key, (size_t)kh.n,
+                                                fnv1a_hash_inline(key, (size_t)kh.n));
+            } else {
+                *pos = key_pos;
+                if (unpack_skip(b, pos, len) < 0) goto error;
+            }
+            if (field_idx < 0) {
+                DHI_STAT_INC(ms, DHI_STAT_UNKNOWN_KEYS);
+                if (unpack_skip(b, pos, len) < 0) goto error;
                 continue;
             }
+            PyObject *value;
+            int r = unpack_field(&ms->specs[field_idx], b, pos, len, &value, &errors);
+            if (r < 0) goto error;
+            if (r == 0) { Py_INCREF(Py_None); value = Py_None; }
+            Py_XSETREF(self->values[field_idx], value);
         }
-
-        // Store value
-        self->values[field_idx] = value;
+    } else {
+        PyErr_SetString(PyExc_ValueError, "Expected MessagePack map or array");
+        return -1;
     }
 
-    // Check required fields and apply defaults
+    // Required fields and defaults, as in decoder_parse_object
     for (Py_ssize_t i = 0; i < n_fields; i++) {
-        if (self->values[i] == NULL) {
-            CompiledFieldSpec *fs = &ms->specs[i];
-            if (fs->required) {
-                if (!errors) errors = PyList_New(0);
-                PyObject *msg = PyUnicode_FromFormat("Field '%s' is required",
-                    fs->name_ptr);
-                PyObject *err = Py_BuildValue("(OO)", fs->name_obj, msg);
-                Py_DECREF(msg);
-                PyList_Append(errors, err);
-                Py_DECREF(err);
-            } else if (fs->default_val && fs->default_val != Py_None) {
-                Py_INCREF(fs->default_val);
-                self->values[i] = fs->default_val;
-            } else {
-                Py_INCREF(Py_None);
-                self->values[i] = Py_None;
-            }
+        if (self->values[i]) continue;
+        CompiledFieldSpec *fs = &ms->specs[i];
+        if (fs->required) {
+            if (decoder_add_error(&errors, fs,
+                    PyUnicode_FromFormat("Field '%s' is required", fs->name_ptr)) < 0) goto error;
+            continue;
         }
+        PyObject *dflt = fs->default_val ? fs->default_val : Py_None;
+        Py_INCREF(dflt);
+        self->values[i] = dflt;
     }
 
-    if (errors && PyList_GET_SIZE(errors) > 0) {
-        PyObject *exc_args = Py_BuildValue("(sO)", "Validation failed", errors);
-        PyErr_SetObject(PyExc_ValueError, exc_args);
-        Py_DECREF(exc_args);
-        Py_DECREF(errors);
-        return -1;
-    }
-    Py_XDECREF(errors);
-
+    if (errors) DHI_STAT_INC(ms, DHI_STAT_ERRORS);
+    DHI_STAT_TIME(ms, t0);
+    *errors_out = errors;
     return 0;
 
 error:
+    DHI_STAT_INC(ms, DHI_STAT_ERRORS);
     Py_XDECREF(errors);
     return -1;
 }
 
-// struct_from_json(cls, json_bytes) -> Struct instance
-static PyObject* py_struct_from_json(PyObject *self, PyObject *args) {
-    PyObject *cls;
-    PyObject *json_data;
-
-    if (!PyArg_ParseTuple(args, "OO", &cls, &json_data)) {
-        return NULL;
+// Borrow a bytes-like input; 0 or -1
+static int dhi_msgpack_input_get(PyObject *obj, Py_buffer *view) {
+    if (PyUnicode_Check(obj)) {
+        PyErr_SetString(PyExc_TypeError, "MessagePack data must be bytes or a buffer, not str");
+        return -1;
     }
+    return PyObject_GetBuffer(obj, view, PyBUF_SIMPLE);
+}
 
-    if (!PyType_Check(cls)) {
-        PyErr_SetString(PyExc_TypeError, "First argument must be a Struct class");
-        return NULL;
+static int dhi_msgpack_check_end(size_t pos, size_t len) {
+    if (__builtin_expect(pos != len, 0)) {
+        PyErr_Format(PyExc_ValueError, "Extra data after MessagePack value (%zu bytes)", len - pos);
+        return -1;
     }
+    return 0;
+}
 
-    // Get JSON as UTF-8 bytes
-    const char *json;
-    Py_ssize_t len;
-    PyObject *bytes_obj = NULL;
-
-    if (PyBytes_Check(json_data)) {
-        json = PyBytes_AS_STRING(json_data);
-        len = PyBytes_GET_SIZE(json_data);
-    } else if (PyUnicode_Check(json_data)) {
-        bytes_obj = PyUnicode_AsUTF8String(json_data);
-        if (!bytes_obj) return NULL;
-        json = PyBytes_AS_STRING(bytes_obj);
-        len = PyBytes_GET_SIZE(bytes_obj);
-    } else {
-        PyErr_SetString(PyExc_TypeError, "JSON data must be bytes or str");
+// struct_from_msgpack(cls, data) -> Struct instance
+static PyObject* py_struct_from_msgpack(PyObject *self_unused, PyObject *args) {
+    PyObject *cls, *data;
+    if (!PyArg_ParseTuple(args, "OO", &cls, &data)) return NULL;
+    if (!PyType_Check(cls) || !PyType_IsSubtype((PyTypeObject*)cls, &DhiStructType)) {
+        PyErr_SetString(PyExc_TypeError, "First argument must be a Struct class");
         return NULL;
     }
-
-    // Get compiled specs
     PyTypeObject *type = (PyTypeObject*)cls;
-    PyObject *capsule = PyDict_GetItemString(type->tp_dict, "__dhi_compiled_specs__");
-    if (!capsule) {
-        Py_XDECREF(bytes_obj);
-        PyErr_SetString(PyExc_ValueError, "Struct class not initialized");
-        return NULL;
-    }
-
-    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
-    if (!ms) {
-        Py_XDECREF(bytes_obj);
-        return NULL;
-    }
+    CompiledModelSpecs *ms = decoder_struct_specs(type);
+    if (!ms) return NULL;
 
-    // Allocate struct object
-    DhiStructObject *obj = (DhiStructObject*)type->tp_alloc(type, ms->n_fields);
+    Py_buffer view;
+    if (dhi_msgpack_input_get(data, &view) < 0) return NULL;
+    DhiStructObject *obj = DhiStruct_alloc(type, ms->n_fields);
     if (!obj) {
-        Py_XDECREF(bytes_obj);
+        PyBuffer_Release(&view);
         return NULL;
     }
 
-    // Parse JSON and populate fields
-    int result = decoder_parse_json_internal(obj, json, len, ms);
-    Py_XDECREF(bytes_obj);
-
-    if (result < 0) {
+    size_t pos = 0, len = (size_t)view.len;
+    PyObject *errors = NULL;
+    int r = unpack_struct(obj, (const unsigned char*)view.buf, &pos, len, ms, &errors);
+    PyBuffer_Release(&view);
+    if (r == 0 && errors) r = decoder_raise_errors(errors);
+    if (r == 0) r = dhi_msgpack_check_end(pos, len);
+    if (r < 0) {
         Py_DECREF(obj);
         return NULL;
     }
-
     return (PyObject*)obj;
 }
 
-// struct_from_json_batch(cls, json_bytes) -> list of Struct instances
-static PyObject* py_struct_from_json_batch(PyObject *self, PyObject *args) {
-    PyObject *cls;
-    PyObject *json_data;
+// load_msgpack(data) -> plain Python objects (BaseModel.model_validate_msgpack)
+static PyObject* py_load_msgpack(PyObject *self_unused, PyObject *data) {
+    Py_buffer view;
+    if (dhi_msgpack_input_get(data, &view) < 0) return NULL;
+    size_t pos = 0, len = (size_t)view.len;
+    PyObject *result = unpack_any((const unsigned char*)view.buf, &pos, len);
+    PyBuffer_Release(&view);
+    if (result && dhi_msgpack_check_end(pos, len) < 0) Py_CLEAR(result);
+    return result;
+}
 
-    if (!PyArg_ParseTuple(args, "OO", &cls, &json_data)) {
-        return NULL;
-    }
+// =============================================================================
+// from_row / from_rows - positional construction from DB cursor / CSV rows
+//
+// Value k of a row goes straight to field k (CompiledFieldSpec index), so a
+// row costs no kwnames tuple and no per-field name lookup. Works for Struct
+// classes and for BaseModel classes on the fast-construct path. Short rows
+// leave the trailing fields to their defaults.
+// =============================================================================
 
-    if (!PyType_Check(cls)) {
-        PyErr_SetString(PyExc_TypeError, "First argument must be a Struct class");
-        return NULL;
-    }
+typedef struct {
+    CompiledModelSpecs *ms;
+    FastConstructInfo *info;   // NULL for Struct classes
+} DhiRowTarget;
 
-    // Get JSON as UTF-8 bytes
-    const char *json;
-    Py_ssize_t len;
-    PyObject *bytes_obj = NULL;
-
-    if (PyBytes_Check(json_data)) {
-        json = PyBytes_AS_STRING(json_data);
-        len = PyBytes_GET_SIZE(json_data);
-    } else if (PyUnicode_Check(json_data)) {
-        bytes_obj = PyUnicode_AsUTF8String(json_data);
-        if (!bytes_obj) return NULL;
-        json = PyBytes_AS_STRING(bytes_obj);
-        len = PyBytes_GET_SIZE(bytes_obj);
-    } else {
-        PyErr_SetString(PyExc_TypeError, "JSON data must be bytes or str");
-        return NULL;
+static int dhi_row_target(PyObject *cls_obj, DhiRowTarget *t) {
+    if (!PyType_Check(cls_obj)) {
+        PyErr_SetString(PyExc_TypeError, "from_row: first argument must be a class");
+        return -1;
     }
-
-    // Get compiled specs
-    PyTypeObject *type = (PyTypeObject*)cls;
-    PyObject *capsule = PyDict_GetItemString(type->tp_dict, "__dhi_compiled_specs__");
-    if (!capsule) {
-        Py_XDECREF(bytes_obj);
-        PyErr_SetString(PyExc_ValueError, "Struct class not initialized");
-        return NULL;
+    PyTypeObject *cls = (PyTypeObject*)cls_obj;
+    if (PyType_IsSubtype(cls, &DhiStructType)) {
+        t->ms = decoder_struct_specs(cls);
+        t->info = NULL;
+        return t->ms ? 0 : -1;
+    }
+    PyObject *info_capsule = g_fastinfo_key
+        ? PyDict_GetItemWithError(cls->tp_dict, g_fastinfo_key)
+        : NULL;
+    if (!info_capsule) {
+        if (!PyErr_Occurred()) {
+            PyErr_Format(PyExc_TypeError,
+                         "from_row: %.200s is not a Struct or fast-construct model class",
+                         cls->tp_name);
+        }
+        return -1;
     }
+    t->info = (FastConstructInfo*)PyCapsule_GetPointer(info_capsule, "dhi.fast_construct");
+    if (!t->info) return -1;
+    t->ms = t->info->ms;
+    return 0;
+}
 
-    CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
-    if (!ms) {
-        Py_XDECREF(bytes_obj);
-        return NULL;
+// Build one instance from a row (tuple, list or any sequence)
+static PyObject* dhi_row_build(PyTypeObject *cls, DhiRowTarget *t, PyObject *row) {
+    PyObject *seq = PySequence_Fast(row, "from_row: row must be a sequence");
+    if (!seq) return NULL;
+    PyObject *result = NULL;
+
+    DHI_BEGIN_CRITICAL_SECTION(seq);
+    Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+    PyObject *const *items = PySequence_Fast_ITEMS(seq);
+    if (__builtin_expect(n > t->ms->n_fields, 0)) {
+        PyErr_Format(PyExc_TypeError, "%.200s.from_row() takes at most %zd values (%zd given)",
+                     cls->tp_name, t->ms->n_fields, n);
+    } else if (!t->info) {
+        DhiStructObject *obj = DhiStruct_alloc(cls, t->ms->n_fields);
+        if (obj) {
+            if (DhiStruct_fill(obj, t->ms, NULL, items, n) < 0) {
+                Py_DECREF(obj);
+            } else {
+                result = (PyObject*)obj;
+            }
+        }
+    } else {
+        PyObject *self = cls->tp_alloc(cls, 0);
+        if (self) {
+            DhiErrorBuf eb;
+            dhi_errors_init(&eb, 0);
+            int status = init_model_core_records(self, t->ms, t->info->extra_mode,
+                                                 NULL, items, n, NULL, &eb);
+            result = dhi_fast_construct_finish(t->info, self, status, &eb);
+        }
     }
+    DHI_END_CRITICAL_SECTION();
 
-    // Find array start
-    size_t pos = 0;
-    SKIP_WS(json, pos, (size_t)len);
+    Py_DECREF(seq);
+    return result;
+}
 
-    if (pos >= (size_t)len || json[pos] != '[') {
-        Py_XDECREF(bytes_obj);
-        PyErr_SetString(PyExc_ValueError, "Expected JSON array");
+// from_row(cls, row) -> instance
+static PyObject* py_from_row(PyObject *self_unused, PyObject *const *args, Py_ssize_t nargs) {
+    if (nargs != 2) {
+        PyErr_SetString(PyExc_TypeError, "from_row requires 2 arguments");
         return NULL;
     }
-    pos++;
+    DhiRowTarget t;
+    if (dhi_row_target(args[0], &t) < 0) return NULL;
+    return dhi_row_build((PyTypeObject*)args[0], &t, args[1]);
+}
 
-    // Create result list
-    PyObject *result = PyList_New(0);
-    if (!result) {
-        Py_XDECREF(bytes_obj);
+// from_rows(cls, rows) -> list of instances; stops at the first invalid row
+static PyObject* py_from_rows(PyObject *self_unused, PyObject *const *args, Py_ssize_t nargs) {
+    if (nargs != 2) {
+        PyErr_SetString(PyExc_TypeError, "from_rows requires 2 arguments");
         return NULL;
     }
-
-    while (pos < (size_t)len) {
-        SKIP_WS(json, pos, (size_t)len);
-        if (json[pos] == ']') break;
-        if (json[pos] == ',') { pos++; continue; }
-
-        // Find object start
-        if (json[pos] != '{') {
-            Py_XDECREF(bytes_obj);
-            Py_DECREF(result);
-            PyErr_SetString(PyExc_ValueError, "Expected JSON object in array");
-            return NULL;
-        }
-
-        // Find object end to get substring
-        size_t obj_start = pos;
-        int depth = 0;
-        int in_string = 0;
-        while (pos < (size_t)len) {
-            char c = json[pos];
-            if (in_string) {
-                if (c == '\\') pos++;
-                else if (c == '"') in_string = 0;
-            } else {
-                if (c == '"') in_string = 1;
-                else if (c == '{') depth++;
-                else if (c == '}') {
-                    depth--;
-                    if (depth == 0) { pos++; break; }
-                }
-            }
-            pos++;
-        }
-
-        // Allocate and parse single object
-        DhiStructObject *obj = (DhiStructObject*)type->tp_alloc(type, ms->n_fields);
-        if (!obj) {
-            Py_XDECREF(bytes_obj);
-            Py_DECREF(result);
-            return NULL;
-        }
-
-        int parse_result = decoder_parse_json_internal(obj, &json[obj_start], pos - obj_start, ms);
-        if (parse_result < 0) {
-            Py_DECREF(obj);
-            Py_XDECREF(bytes_obj);
-            Py_DECREF(result);
+    DhiRowTarget t;
+    if (dhi_row_target(args[0], &t) < 0) return NULL;
+    PyTypeObject *cls = (PyTypeObject*)args[0];
+
+    PyObject *it = PyObject_GetIter(args[1]);
+    if (!it) return NULL;
+    PyObject *out = PyList_New(0);
+    if (!out) { Py_DECREF(it); return NULL; }
+
+    PyObject *row;
+    while ((row = PyIter_Next(it))) {
+        PyObject *inst = dhi_row_build(cls, &t, row);
+        Py_DECREF(row);
+        if (!inst || PyList_Append(out, inst) < 0) {
+            Py_XDECREF(inst);
+            Py_DECREF(it);
+            Py_DECREF(out);
             return NULL;
         }
-
-        PyList_Append(result, (PyObject*)obj);
-        Py_DECREF(obj);
+        Py_DECREF(inst);
     }
-
-    Py_XDECREF(bytes_obj);
-    return result;
+    Py_DECREF(it);
+    if (PyErr_Occurred()) { Py_DECREF(out); return NULL; }
+    return out;
 }
 
 // =============================================================================
 // DECODER TYPE - Caches specs for faster repeated parsing
 // =============================================================================
 
+// Streaming modes for feed()/flush()
+#define DHI_STREAM_START   0  // nothing seen yet
+#define DHI_STREAM_ARRAY   1  // inside a top-level [ ... ]
+#define DHI_STREAM_NDJSON  2  // newline-delimited / concatenated objects
+#define DHI_STREAM_CLOSED  3  // top-level array finished
+
 typedef struct {
     PyObject_HEAD
     PyTypeObject *struct_type;
     CompiledModelSpecs *specs;
+    // Streaming state (feed/flush) - only the unfinished tail is buffered
+    char *stream_buf;
+    size_t stream_len, stream_cap;
+    size_t scan_pos;        // stream_buf[0..scan_pos) already scanned
+    size_t obj_start;       // start of the open object (valid while depth > 0)
+    Py_ssize_t n_items;     // objects seen in the current array
+    int mode, depth, in_string, escape, expect_value;
+    PyObject *pending;      // decoded before a failing object; returned next call
+    DhiValueCache *cache;   // shared str/int values, or NULL when disabled
+    int lazy;               // decode(): fields parsed on first access
 } DhiDecoderObject;
 
+static void DhiDecoder_stream_reset(DhiDecoderObject *self) {
+    free(self->stream_buf);
+    self->stream_buf = NULL;
+    self->stream_len = self->stream_cap = 0;
+    self->scan_pos = self->obj_start = 0;
+    self->n_items = 0;
+    self->mode = DHI_STREAM_START;
+    self->depth = self->in_string = self->escape = self->expect_value = 0;
+}
+
 static void DhiDecoder_dealloc(DhiDecoderObject *self) {
     Py_XDECREF(self->struct_type);
+    Py_XDECREF(self->pending);
+    free(self->stream_buf);
+    dhi_vcache_free(self->cache);
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
@@ -4206,14 +9531,22 @@ static PyObject* DhiDecoder_new(PyTypeObject *type, PyObject *args, PyObject *kw
     if (self) {
         self->struct_type = NULL;
         self->specs = NULL;
+        self->stream_buf = NULL;
+        self->pending = NULL;
+        self->cache = NULL;
+        self->lazy = 0;
+        DhiDecoder_stream_reset(self);
     }
     return (PyObject*)self;
 }
 
 static int DhiDecoder_init(DhiDecoderObject *self, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"cls", "cache_strings", "lazy", NULL};
     PyObject *cls;
+    PyObject *cache_strings = Py_None;
+    int lazy = 0;
 
-    if (!PyArg_ParseTuple(args, "O", &cls)) {
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|Op", kwlist, &cls, &cache_strings, &lazy)) {
         return -1;
     }
 
@@ -4232,10 +9565,35 @@ static int DhiDecoder_init(DhiDecoderObject *self, PyObject *args, PyObject *kwd
 
     CompiledModelSpecs *ms = (CompiledModelSpecs*)PyCapsule_GetPointer(capsule, "dhi.compiled_specs");
     if (!ms) return -1;
+    if (lazy && dhi_struct_enable_lazy(type) < 0) return -1;
+
+    // Value cache: None = only Field(cache_strings=True) fields, if any
+    int all_fields = 0, enabled = 0;
+    if (cache_strings == Py_None) {
+        for (Py_ssize_t i = 0; i < ms->n_fields && !enabled; i++) {
+            enabled = ms->specs[i].cache_strings;
+        }
+    } else {
+        int truth = PyObject_IsTrue(cache_strings);
+        if (truth < 0) return -1;
+        enabled = all_fields = truth;
+    }
+    DhiValueCache *cache = NULL;
+    if (enabled) {
+        cache = (DhiValueCache*)calloc(1, sizeof(DhiValueCache));
+        if (!cache) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        cache->all_fields = all_fields;
+    }
 
     Py_INCREF(cls);
-    self->struct_type = type;
+    Py_XSETREF(self->struct_type, type);
     self->specs = ms;
+    dhi_vcache_free(self->cache);
+    self->cache = cache;
+    self->lazy = lazy;
 
     return 0;
 }
@@ -4247,35 +9605,35 @@ static PyObject* DhiDecoder_decode(DhiDecoderObject *self, PyObject *args) {
         return NULL;
     }
 
-    // Get JSON as UTF-8 bytes
-    const char *json;
-    Py_ssize_t len;
-    PyObject *bytes_obj = NULL;
-
-    if (PyBytes_Check(json_data)) {
-        json = PyBytes_AS_STRING(json_data);
-        len = PyBytes_GET_SIZE(json_data);
-    } else if (PyUnicode_Check(json_data)) {
-        bytes_obj = PyUnicode_AsUTF8String(json_data);
-        if (!bytes_obj) return NULL;
-        json = PyBytes_AS_STRING(bytes_obj);
-        len = PyBytes_GET_SIZE(bytes_obj);
-    } else {
-        PyErr_SetString(PyExc_TypeError, "JSON data must be bytes or str");
-        return NULL;
-    }
+    // Borrow the JSON bytes (zero-copy for bytes, ASCII str and buffers)
+    DhiJsonInput input;
+    if (dhi_json_input_get(json_data, &input) < 0) return NULL;
+    const char *json = input.data;
+    Py_ssize_t len = (Py_ssize_t)input.len;
 
     // Allocate struct object
-    DhiStructObject *obj = (DhiStructObject*)self->struct_type->tp_alloc(
-        self->struct_type, self->specs->n_fields);
+    DhiStructObject *obj = DhiStruct_alloc(self->struct_type, self->specs->n_fields);
     if (!obj) {
-        Py_XDECREF(bytes_obj);
+        dhi_json_input_release(&input);
         return NULL;
     }
 
-    // Parse JSON
-    int result = decoder_parse_json_internal(obj, json, len, self->specs);
-    Py_XDECREF(bytes_obj);
+    // Parse JSON (the value cache is shared state, so serialize on it; lazy
+    // fields are decoded later, outside the lock, so they skip the cache)
+    int result;
+    if (self->lazy) {
+        DhiLazySourceObject *src = dhi_lazy_source_new(json_data, json, (size_t)len, input.tmp,
+                                                       DhiStruct_meta(self->struct_type));
+        result = src ? decoder_parse_json_internal(obj, src->data, len, self->specs, NULL, src) : -1;
+        Py_XDECREF(src);
+    } else if (self->cache) {
+        DHI_BEGIN_CRITICAL_SECTION(self);
+        result = decoder_parse_json_internal(obj, json, len, self->specs, self->cache, NULL);
+        DHI_END_CRITICAL_SECTION();
+    } else {
+        result = decoder_parse_json_internal(obj, json, len, self->specs, NULL, NULL);
+    }
+    dhi_json_input_release(&input);
 
     if (result < 0) {
         Py_DECREF(obj);
@@ -4285,9 +9643,245 @@ static PyObject* DhiDecoder_decode(DhiDecoderObject *self, PyObject *args) {
     return (PyObject*)obj;
 }
 
+// Scan data[*pos..len) with the resumable stream state, decoding every object
+// that closes into `out`. Offsets in self state are relative to `data`.
+// Returns 0 when all bytes were scanned, 1 when stopped after a failing object
+// (*pos just past it, exception set), -1 on malformed stream (exception set).
+static int DhiDecoder_stream_scan(DhiDecoderObject *self, const char *data,
+                                  size_t *pos, size_t len, PyObject *out) {
+    size_t i = *pos;
+    for (; i < len; i++) {
+        char c = data[i];
+
+        if (self->depth > 0) {
+            // Inside an object: track strings and nesting only
+            if (self->in_string) {
+                if (self->escape) self->escape = 0;
+                else if (c == '\\') self->escape = 1;
+                else if (c == '"') self->in_string = 0;
+                continue;
+            }
+            if (c == '"') {
+                self->in_string = 1;
+            } else if (c == '{' || c == '[') {
+                self->depth++;
+            } else if ((c == '}' || c == ']') && --self->depth == 0) {
+                // Object closed - decode it now
+                DhiStructObject *obj = DhiStruct_alloc(self->struct_type, self->specs->n_fields);
+                if (!obj) { *pos = i + 1; return -1; }
+                int r = decoder_parse_json_internal(obj, data + self->obj_start,
+                                                    i + 1 - self->obj_start, self->specs,
+                                                    self->cache, NULL);
+                if (r < 0) {
+                    Py_DECREF(obj);
+                    *pos = i + 1;
+                    return 1;
+                }
+                r = PyList_Append(out, (PyObject*)obj);
+                Py_DECREF(obj);
+                if (r < 0) { *pos = i + 1; return -1; }
+            }
+            continue;
+        }
+
+        // Between objects
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r') continue;
+
+        int start_object = 0;
+        switch (self->mode) {
+        case DHI_STREAM_START:
+            if (c == '[') {
+                self->mode = DHI_STREAM_ARRAY;
+                self->expect_value = 1;
+                continue;
+            }
+            if (c == '{') {
+                self->mode = DHI_STREAM_NDJSON;
+                start_object = 1;
+            }
+            break;
+        case DHI_STREAM_ARRAY:
+            if (c == '{' && self->expect_value) {
+                self->expect_value = 0;
+                self->n_items++;
+                start_object = 1;
+            } else if (c == ',' && !self->expect_value) {
+                self->expect_value = 1;
+                continue;
+            } else if (c == ']' && (!self->expect_value || self->n_items == 0)) {
+                self->mode = DHI_STREAM_CLOSED;
+                continue;
+            }
+            break;
+        case DHI_STREAM_NDJSON:
+            if (c == '{') start_object = 1;
+            break;
+        }
+
+        if (!start_object) {
+            PyErr_Format(PyExc_ValueError,
+                self->mode == DHI_STREAM_CLOSED ? "Unexpected data after JSON array" :
+                self->mode == DHI_STREAM_ARRAY ? "Expected ',' or ']' in array" :
+                "Expected JSON object");
+            *pos = i;
+            return -1;
+        }
+        self->obj_start = i;
+        self->depth = 1;
+    }
+    *pos = i;
+    return 0;
+}
+
+// Keep only the unfinished tail of data[0..len) (scanned up to scan_end).
+// data is either stream_buf itself or a caller chunk scanned in place.
+static int DhiDecoder_stream_keep(DhiDecoderObject *self, const char *data,
+                                  size_t scan_end, size_t len) {
+    size_t keep_from = self->depth > 0 ? self->obj_start : scan_end;
+    size_t keep = len - keep_from;
+    if (data != self->stream_buf && keep > self->stream_cap) {
+        char *grown = (char*)realloc(self->stream_buf, keep);
+        if (!grown) { PyErr_NoMemory(); return -1; }
+        self->stream_buf = grown;
+        self->stream_cap = keep;
+    }
+    if (keep) memmove(self->stream_buf, data + keep_from, keep);
+    self->stream_len = keep;
+    self->scan_pos = scan_end - keep_from;
+    if (self->depth > 0) self->obj_start = 0;
+    return 0;
+}
+
+static PyObject* DhiDecoder_take_pending(DhiDecoderObject *self) {
+    PyObject *out = self->pending;
+    self->pending = NULL;
+    return out ? out : PyList_New(0);
+}
+
+// feed(chunk) -> list of Structs for every object completed by this chunk
+static PyObject* DhiDecoder_feed(DhiDecoderObject *self, PyObject *args) {
+    PyObject *json_data;
+
+    if (!PyArg_ParseTuple(args, "O", &json_data)) {
+        return NULL;
+    }
+
+    DhiJsonInput input;
+    if (dhi_json_input_get(json_data, &input) < 0) return NULL;
+    const char *chunk = input.data;
+    Py_ssize_t chunk_len = (Py_ssize_t)input.len;
+
+    PyObject *out = NULL;
+    DHI_BEGIN_CRITICAL_SECTION(self);
+
+    out = DhiDecoder_take_pending(self);
+    if (!out) goto done;
+
+    // Scan the chunk in place when nothing is buffered; otherwise append
+    const char *data = chunk;
+    size_t len = (size_t)chunk_len;
+    size_t pos = 0;
+    if (self->stream_len > 0) {
+        size_t need = self->stream_len + len;
+        if (need > self->stream_cap) {
+            size_t cap = self->stream_cap * 2 > need ? self->stream_cap * 2 : need;
+            char *grown = (char*)realloc(self->stream_buf, cap);
+            if (!grown) { PyErr_NoMemory(); Py_CLEAR(out); goto done; }
+            self->stream_buf = grown;
+            self->stream_cap = cap;
+        }
+        memcpy(self->stream_buf + self->stream_len, chunk, len);
+        self->stream_len = need;
+        data = self->stream_buf;
+        len = need;
+        pos = self->scan_pos;
+    }
+
+    int r = DhiDecoder_stream_scan(self, data, &pos, len, out);
+    if (r < 0) {
+        // Malformed stream - nothing after this point can be trusted
+        DhiDecoder_stream_reset(self);
+        Py_CLEAR(out);
+        goto done;
+    }
+    if (DhiDecoder_stream_keep(self, data, pos, len) < 0) {
+        Py_CLEAR(out);
+        goto done;
+    }
+    if (r == 1) {
+        // Failing object consumed; hand the good ones back on the next call
+        if (PyList_GET_SIZE(out) > 0) self->pending = out;
+        else Py_DECREF(out);
+        out = NULL;
+    }
+
+done:
+    DHI_END_CRITICAL_SECTION();
+    dhi_json_input_release(&input);
+    return out;
+}
+
+// flush() -> remaining Structs; raises if the stream ended mid-object/array
+static PyObject* DhiDecoder_flush(DhiDecoderObject *self, PyObject *Py_UNUSED(ignored)) {
+    PyObject *out = NULL;
+    DHI_BEGIN_CRITICAL_SECTION(self);
+
+    // Bytes left to scan are only there after a failed object
+    PyObject *rest = PyList_New(0);
+    int r = rest ? 0 : -1;
+    if (rest && self->scan_pos < self->stream_len) {
+        char *data = self->stream_buf;
+        size_t pos = self->scan_pos;
+        r = DhiDecoder_stream_scan(self, data, &pos, self->stream_len, rest);
+        self->scan_pos = pos;
+    }
+
+    if (r == 0 && (self->depth > 0 || self->mode == DHI_STREAM_ARRAY)) {
+        PyErr_SetString(PyExc_ValueError,
+            self->depth > 0 ? "Incomplete JSON: stream ended inside an object"
+                            : "Incomplete JSON: top-level array not closed");
+        r = -1;
+    }
+    if (r == 0) {
+        out = DhiDecoder_take_pending(self);
+        if (out && PyList_GET_SIZE(rest) > 0) {
+            PyObject *joined = PySequence_InPlaceConcat(out, rest);
+            Py_DECREF(out);
+            out = joined;
+        }
+    } else {
+        Py_CLEAR(self->pending);
+    }
+    Py_XDECREF(rest);
+    DhiDecoder_stream_reset(self);
+
+    DHI_END_CRITICAL_SECTION();
+    return out;
+}
+
+// cache_info() -> {"hits", "misses", "size", "capacity"} for the value cache
+static PyObject* DhiDecoder_cache_info(DhiDecoderObject *self, PyObject *Py_UNUSED(ignored)) {
+    PyObject *info = NULL;
+    DHI_BEGIN_CRITICAL_SECTION(self);
+    DhiValueCache *cache = self->cache;
+    info = Py_BuildValue("{s:K,s:K,s:n,s:n}",
+        "hits", (unsigned long long)(cache ? cache->hits : 0),
+        "misses", (unsigned long long)(cache ? cache->misses : 0),
+        "size", cache ? cache->used : (Py_ssize_t)0,
+        "capacity", cache ? (Py_ssize_t)DHI_VCACHE_SLOTS : (Py_ssize_t)0);
+    DHI_END_CRITICAL_SECTION();
+    return info;
+}
+
 static PyMethodDef DhiDecoder_methods[] = {
     {"decode", (PyCFunction)DhiDecoder_decode, METH_VARARGS,
      "Decode JSON bytes/str to a Struct instance"},
+    {"feed", (PyCFunction)DhiDecoder_feed, METH_VARARGS,
+     "Feed a chunk of a JSON array / NDJSON stream: (chunk) -> list[Struct] completed so far"},
+    {"flush", (PyCFunction)DhiDecoder_flush, METH_NOARGS,
+     "End the stream: () -> list[Struct]; raises if it stopped mid-object"},
+    {"cache_info", (PyCFunction)DhiDecoder_cache_info, METH_NOARGS,
+     "Value cache statistics: () -> dict(hits, misses, size, capacity)"},
     {NULL, NULL, 0, NULL}
 };
 
@@ -4318,12 +9912,20 @@ static PyMethodDef DhiNativeMethods[] = {
      "Validate email format (str) -> bool"},
     {"validate_batch_direct", py_validate_batch_direct, METH_VARARGS,
      "GENERAL batch validation: (items, field_specs) -> (list[bool], int)"},
+    {"validate_columns", (PyCFunction)(void(*)(void))py_validate_columns, METH_VARARGS | METH_KEYWORDS,
+     "Columnar batch validation over buffers: (columns, field_specs, out=None, bitmap=False) -> (buffer, int)"},
     {"validate_field", py_validate_field, METH_VARARGS,
      "Validate a single field: (value, field_name, constraints) -> validated_value"},
     {"init_model", py_init_model, METH_VARARGS,
      "Batch init: (self, kwargs, field_specs) -> None or errors list"},
     {"compile_model_specs", py_compile_model_specs, METH_VARARGS,
-     "Pre-compile field specs into C structs: (specs_tuple) -> PyCapsule"},
+     "Pre-compile field specs into C structs: (specs_tuple[, name]) -> PyCapsule"},
+    {"set_stats_fallback", py_set_stats_fallback, METH_VARARGS,
+     "Record why a class is off the fast path for stats(): (specs_capsule, reason) -> None"},
+    {"stats", py_stats, METH_NOARGS,
+     "Hot-path counters per class (needs a -DDHI_STATS build): () -> dict"},
+    {"reset_stats", py_reset_stats, METH_NOARGS,
+     "Zero the stats() counters: () -> None"},
     {"init_model_compiled", py_init_model_compiled, METH_VARARGS,
      "Ultra-fast init with pre-compiled specs: (self, kwargs, capsule) -> None or errors"},
     {"init_model_full", (PyCFunction)py_init_model_full, METH_FASTCALL,
@@ -4334,16 +9936,38 @@ static PyMethodDef DhiNativeMethods[] = {
      "Remove C vectorcall construction from a model class: (cls) -> None"},
     {"construct_validated", (PyCFunction)py_construct_validated, METH_FASTCALL,
      "Allocate + validate a model from a dict in one C call: (cls, data) -> instance"},
+    {"construct_or_none", (PyCFunction)py_construct_or_none, METH_FASTCALL,
+     "construct_validated that returns None instead of raising: (cls, data) -> instance | None"},
+    {"from_row", (PyCFunction)py_from_row, METH_FASTCALL,
+     "Build a Struct or fast-construct model from values in field order: (cls, row) -> instance"},
+    {"from_rows", (PyCFunction)py_from_rows, METH_FASTCALL,
+     "from_row over an iterable of rows: (cls, rows) -> list"},
+    {"model_validate_json", (PyCFunction)py_model_validate_json, METH_FASTCALL,
+     "Decode a JSON object straight into a fast-construct model: (cls, data) -> instance | NotImplemented"},
     {"dump_model_compiled", py_dump_model_compiled, METH_VARARGS,
      "Ultra-fast model_dump with pre-compiled specs: (self, capsule) -> dict"},
     {"dump_json_compiled", py_dump_json_compiled, METH_VARARGS,
-     "Ultra-fast JSON dump with pre-compiled specs: (self, capsule) -> JSON string"},
+     "Ultra-fast JSON dump with pre-compiled specs: (self, capsule, include=None, exclude=None, by_alias=False, exclude_unset=False, exclude_none=False, default=None, compact=False) -> JSON string"},
     {"init_struct_class", py_init_struct_class, METH_VARARGS,
      "Initialize a Struct subclass with field specs: (cls, field_specs) -> None"},
     {"struct_from_json", py_struct_from_json, METH_VARARGS,
-     "Parse JSON directly to Struct: (cls, json_bytes) -> Struct instance"},
-    {"struct_from_json_batch", py_struct_from_json_batch, METH_VARARGS,
-     "Parse JSON array to list of Structs: (cls, json_bytes) -> list[Struct]"},
+     "Parse JSON directly to Struct: (cls, json_bytes, lazy=False) -> Struct instance"},
+    {"struct_from_msgpack", py_struct_from_msgpack, METH_VARARGS,
+     "Decode MessagePack (map or positional array) to Struct: (cls, data) -> Struct instance"},
+    {"dump_msgpack", py_dump_msgpack, METH_VARARGS,
+     "Encode Structs, compiled models and plain values as MessagePack: (obj, positional=False) -> bytes"},
+    {"load_msgpack", py_load_msgpack, METH_O,
+     "Decode MessagePack to plain Python objects: (data) -> object"},
+    {"parse_iso", py_parse_iso, METH_VARARGS,
+     "Parse an ISO 8601 date/datetime string: (s, want_time) -> date | datetime | None"},
+    {"compile_pattern", py_compile_pattern, METH_O,
+     "Compile Field(pattern=...) to a native matcher: (pattern) -> Pattern, or None when it needs re"},
+    {"struct_materialize", py_struct_materialize, METH_O,
+     "Decode and validate every lazily decoded field: (obj) -> obj"},
+    {"struct_from_json_batch", (PyCFunction)(void(*)(void))py_struct_from_json_batch, METH_VARARGS | METH_KEYWORDS,
+     "Parse JSON array to list of Structs: (cls, json_bytes, threads=1) -> list[Struct]"},
+    {"struct_from_ndjson", (PyCFunction)(void(*)(void))py_struct_from_ndjson, METH_VARARGS | METH_KEYWORDS,
+     "Parse NDJSON to Structs: (cls, data, on_error='raise'|'skip'|'collect') -> list[Struct] | (list[Struct], list[(line_no, byte_offset, error)])"},
     {NULL, NULL, 0, NULL}
 };
 
@@ -4369,6 +9993,20 @@ PyMODINIT_FUNC PyInit__dhi_native(void) {
     PyUnstable_Module_SetGIL(module, Py_MOD_GIL_NOT_USED);
 #endif
 
+    // date/datetime fields build their values through the C API
+    PyDateTime_IMPORT;
+    if (!PyDateTimeAPI) {
+        Py_DECREF(module);
+        return NULL;
+    }
+
+#if DHI_STATS
+    if (!g_stats_lock && !(g_stats_lock = PyThread_allocate_lock())) {
+        Py_DECREF(module);
+        return PyErr_NoMemory();
+    }
+#endif
+
     // Initialize and register DhiStructType
     if (PyType_Ready(&DhiStructType) < 0) {
         Py_DECREF(module);
@@ -4382,6 +10020,42 @@ PyMODINIT_FUNC PyInit__dhi_native(void) {
         return NULL;
     }
 
+    // StructMeta derives from type; PyType_Ready fills in tp_base
+    DhiStructMetaType.tp_base = &PyType_Type;
+    if (PyType_Ready(&DhiStructMetaType) < 0) {
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    Py_INCREF(&DhiStructMetaType);
+    if (PyModule_AddObject(module, "StructMeta", (PyObject*)&DhiStructMetaType) < 0) {
+        Py_DECREF(&DhiStructMetaType);
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    if (PyType_Ready(&ValidationRecordsType) < 0) {
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    if (PyType_Ready(&DhiLazySourceType) < 0) {
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    if (PyType_Ready(&DhiPatternType) < 0) {
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    Py_INCREF(&DhiPatternType);
+    if (PyModule_AddObject(module, "Pattern", (PyObject*)&DhiPatternType) < 0) {
+        Py_DECREF(&DhiPatternType);
+        Py_DECREF(module);
+        return NULL;
+    }
+
     // Initialize and register DhiDecoderType
     if (PyType_Ready(&DhiDecoderType) < 0) {
         Py_DECREF(module);
@@ -239,8 +239,48 @@ def validate_emails_batch(emails: List[str]) -> BatchValidationResult:
     return BatchValidationResult(results, valid_count, count)
 
 
+def validate_columns(
+    columns: Dict[str, Any],
+    field_specs: Dict[str, Tuple],
+    out: Any = None,
+    bitmap: bool = False,
+) -> Tuple[Any, int]:
+    """
+    Validate column buffers without creating per-row Python objects.
+
+    Each column is either a buffer of int64/float64 values (NumPy array,
+    ``array.array('q')``, ``memoryview.cast('d')``, ...) or an Arrow-style
+    ``(offsets, data)`` pair for strings, where ``offsets`` holds n + 1
+    int32/int64 positions into the UTF-8 ``data`` buffer. Untyped byte
+    buffers (e.g. pyarrow ``Buffer``) are read as int64 values / int32 offsets.
+
+    Args:
+        columns: Mapping of field name to column buffer
+        field_specs: Same ``{name: (validator_type, param1, param2)}`` specs as
+            ``validate_batch_direct``; a field with no column fails every row
+        out: Optional writable buffer for the results (n bytes, or
+            ceil(n / 8) bytes with ``bitmap=True``)
+        bitmap: Write an Arrow-style LSB-first validity bitmap instead of one
+            uint8 per row
+
+    Returns:
+        ``(results, valid_count)`` where ``results`` is ``out`` or a new bytearray
+
+    Example:
+        >>> import numpy as np
+        >>> ages = np.array([25, 17, 40], dtype=np.int64)
+        >>> results, valid = validate_columns({'age': ages}, {'age': ('int', 18, 120)})
+        >>> list(results), valid
+        ([1, 0, 1], 2)
+    """
+    if _dhi_native is None or not hasattr(_dhi_native, 'validate_columns'):
+        raise RuntimeError("validate_columns requires the dhi native extension")
+    return _dhi_native.validate_columns(columns, field_specs, out, bitmap)
+
+
 __all__ = [
     'BatchValidationResult',
+    'validate_columns',
     'validate_users_batch',
     'validate_ints_batch',
     'validate_strings_batch',
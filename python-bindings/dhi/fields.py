@@ -32,7 +32,7 @@ class FieldInfo:
         'to_lower', 'to_upper', 'allow_inf_nan', 'max_digits',
         'decimal_places', 'unique_items', 'exclude', 'include',
         'discriminator', 'json_schema_extra', 'frozen', 'validate_default',
-        'repr', 'init', 'init_var', 'kw_only', 'annotation',
+        'repr', 'init', 'init_var', 'kw_only', 'annotation', 'cache_strings',
     )
 
     def __init__(
@@ -73,6 +73,7 @@ class FieldInfo:
         init_var: Optional[bool] = None,
         kw_only: Optional[bool] = None,
         annotation: Optional[Any] = None,
+        cache_strings: Optional[bool] = None,
     ):
         self.default = default
         self.default_factory = default_factory
@@ -109,6 +110,7 @@ class FieldInfo:
         self.init_var = init_var
         self.kw_only = kw_only
         self.annotation = annotation
+        self.cache_strings = cache_strings
 
     @property
     def is_required(self) -> bool:
@@ -182,6 +184,7 @@ def Field(
     init: Optional[bool] = None,
     init_var: Optional[bool] = None,
     kw_only: Optional[bool] = None,
+    cache_strings: Optional[bool] = None,
 ) -> FieldInfo:
     """Create a FieldInfo with constraints and metadata.
 
@@ -222,6 +225,9 @@ def Field(
         init: If True, include in __init__ (dataclass compat).
         init_var: If True, init-only variable (dataclass compat).
         kw_only: If True, keyword-only argument (dataclass compat).
+        cache_strings: dhi extension. If True, a Decoder shares one object per
+            distinct value of this Struct field (for enum-like strings and
+            small counters) instead of allocating on every decode.
 
     Example:
         from typing import Annotated
@@ -271,6 +277,7 @@ def Field(
         init=init,
         init_var=init_var,
         kw_only=kw_only,
+        cache_strings=cache_strings,
     )
 
 
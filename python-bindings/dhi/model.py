@@ -35,6 +35,7 @@ import copy
 import sys
 import types
 import json as _json
+from datetime import date, datetime, timedelta, timezone
 from typing import (
     Any, Callable, ClassVar, Dict, FrozenSet, Iterator, List, Literal, Mapping,
     Optional, Set, Type, Tuple, TypeVar, Union,
@@ -71,7 +72,63 @@ _T = TypeVar('_T', bound='BaseModel')
 IncEx = Optional[Union[Set[str], Dict[str, Any]]]
 
 # Type code mapping for native validator
-_TYPE_CODES = {int: 1, float: 2, str: 3, bool: 4, bytes: 5}
+_TYPE_CODES = {int: 1, float: 2, str: 3, bool: 4, bytes: 5, date: 9, datetime: 10}
+
+
+# The grammar of the native parser (dhi_iso_parse), for builds without it:
+# YYYY-MM-DD[(T|t| )HH:MM[:SS[(.|,)f{1,6}]][Z|z|(+|-)HH[[:]MM]]]
+_ISO_RE = re.compile(
+    r'(\d{4})-(\d{2})-(\d{2})'
+    r'(?:[Tt ](\d{2}):(\d{2})(?::(\d{2})(?:[.,](\d{1,6}))?)?'
+    r'(?:([Zz])|([+-])(\d{2})(?::?(\d{2}))?)?)?',
+    re.ASCII,
+)
+
+
+def _iso_from_regex(value: str, want_time: bool) -> Any:
+    m = _ISO_RE.fullmatch(value)
+    if m is None:
+        return None
+    y, mo, d, hh, mi, ss, frac, z, sign, oh, om = m.groups()
+    if hh is not None and not want_time:
+        return None
+    try:
+        if not want_time:
+            return date(int(y), int(mo), int(d))
+        tz = None
+        if z is not None:
+            tz = timezone.utc
+        elif sign is not None:
+            oh, om = int(oh), int(om or 0)
+            if oh > 23 or om > 59:
+                return None
+            offset = (oh * 60 + om) * (-1 if sign == '-' else 1)
+            tz = timezone.utc if offset == 0 else timezone(timedelta(minutes=offset))
+        return datetime(int(y), int(mo), int(d), int(hh or 0), int(mi or 0), int(ss or 0),
+                        int((frac or '0').ljust(6, '0')), tz)
+    except ValueError:
+        return None
+
+
+def _parse_iso(field_name: str, check_type: type, value: Any) -> Any:
+    """Coerce an ISO 8601 string for a date/datetime field (Python path).
+
+    Uses the same parser as the native field plans, so a bounded date field
+    accepts exactly the strings a plain one does.
+    """
+    if not isinstance(value, str):
+        raise ValidationError(
+            field_name,
+            f"Expected {check_type.__name__}, got {type(value).__name__}"
+        )
+    want_time = check_type is datetime
+    if _dhi_native is not None:
+        parsed = _dhi_native.parse_iso(value, want_time)
+    else:
+        parsed = _iso_from_regex(value, want_time)
+    if parsed is None:
+        raise ValidationError(field_name, f"Invalid ISO {check_type.__name__} format")
+    return parsed
 
 # Cache for compiled validators per class
 _CLASS_VALIDATORS_CACHE: Dict[type, Dict[str, Any]] = {}
@@ -541,6 +598,12 @@ def _build_validator(field_name: str, base_type: Type, constraints: List[Any], c
                     field_name,
                     f"Expected bool, got {type(value).__name__}"
                 )
+            elif check_type in (date, datetime) and (
+                not isinstance(value, check_type)
+                # datetime subclasses date, but a date field takes no time of day
+                or (check_type is date and isinstance(value, datetime))
+            ):
+                value = _parse_iso(field_name, check_type, value)
             elif check_type in (list, set, frozenset) and not isinstance(value, check_type):
                 raise ValidationError(
                     field_name,
@@ -713,16 +776,18 @@ def _build_validator(field_name: str, base_type: Type, constraints: List[Any], c
 
     # --- NATIVE ACCELERATION PATH ---
     # Use C extension for type check + numeric bounds + string length in one call.
-    # Falls back to Python for: regex patterns, decimal constraints, unique items, nested models.
+    # Falls back to Python for: decimal constraints, unique items, nested models.
     can_use_native = (
         HAS_NATIVE_EXT
-        and compiled_pattern is None
         and max_digits is None
         and decimal_places is None
         and not unique_items
         and nested_model is None
         and not allow_none  # Optional[T]: None handling stays in Python (Issue #56)
         and check_type in _TYPE_CODES
+        # date/datetime bounds compare objects; the native plan only has numeric ones
+        and not (check_type in (date, datetime)
+                 and (gt is not None or ge is not None or lt is not None or le is not None))
     )
 
     if can_use_native:
@@ -734,6 +799,11 @@ def _build_validator(field_name: str, base_type: Type, constraints: List[Any], c
             int(allow_inf_nan), 0,  # format_code=0 (handled by custom validators)
             int(strip_whitespace), int(to_lower), int(to_upper),
         )
+        if compiled_pattern is not None:
+            # cache_strings=0, then the native matcher (re.Pattern when the
+            # syntax is outside what compile_pattern handles)
+            native_pattern = _dhi_native.compile_pattern(pattern_str)
+            native_constraints += (0, native_pattern if native_pattern is not None else compiled_pattern)
 
         if custom_validators:
             # Native for type+bounds, then Python for custom validators
@@ -1038,10 +1108,24 @@ def _compile_model_fields(cls, hints: dict) -> None:
     # Pre-compile into C structs for zero-overhead constraint access
     if can_native_init and native_init_specs:
         cls.__dhi_compiled_specs__ = _dhi_native.compile_model_specs(
-            tuple(native_init_specs))
+            tuple(native_init_specs), cls.__qualname__)
     else:
         cls.__dhi_compiled_specs__ = None
 
+    # Serialization specs for dump_json_compiled: every dumped field in order
+    # (the init specs above can be partial), keyed for by_alias as
+    # serialization_alias > alias. Computed fields need Python, so those
+    # models keep the dict path.
+    if HAS_NATIVE_EXT and not getattr(cls, '__dhi_computed_fields__', None):
+        cls.__dhi_dump_specs__ = _dhi_native.compile_model_specs(tuple(
+            (field_name, fi.serialization_alias or fi.alias, False, None,
+             _NESTED_DUMMY_CONSTRAINTS, None)
+            for field_name, fi in model_fields.items()
+            if not fi.exclude
+        ))
+    else:
+        cls.__dhi_dump_specs__ = None
+
     # Track if we can use full native (no nested/complex fields)
     cls.__dhi_full_native__ = can_native_init and bool(native_init_specs) and not has_nested_or_complex
 
@@ -1050,18 +1134,47 @@ def _compile_model_fields(cls, hints: dict) -> None:
     cls.__dhi_use_ultra_fast__ = cls.__dhi_full_native__ and not has_custom
 
 
+def _native_json_default(value, by_alias, exclude_unset, exclude_none):
+    """Convert a value dump_json_compiled has no native encoding for."""
+    if isinstance(value, BaseModel):
+        return value.model_dump(mode='json', by_alias=by_alias,
+                                exclude_unset=exclude_unset, exclude_none=exclude_none)
+    if hasattr(value, 'isoformat'):  # datetime, date
+        return value.isoformat()
+    return str(value)
+
+
 # Reference to the generic BaseModel.__init__, marked _dhi_managed once BaseModel
 # is defined. Used by the metaclass to decide when it may safely override __init__.
 _GENERIC_INIT = None
 
 
-def _raise_native_validation_errors(pairs):
+def _raise_native_validation_errors(records):
     """Raiser callable handed to the C vectorcall fast path.
 
-    The C side builds the (field, msg) pair list; raising stays in Python so
-    exception classes/messages are identical to the __init__ path.
+    The C side passes its unrendered error records; raising stays in Python so
+    exception classes/messages are identical to the __init__ path, while the
+    messages themselves are only formatted if the exception is inspected.
     """
-    raise ValidationErrors([ValidationError(f, m) for f, m in pairs])
+    raise ValidationErrors._deferred(records)
+
+
+def _fast_construct_blocker(cls):
+    """Why ``cls`` can't use the C vectorcall fast path, or None if it can.
+
+    Reported per class by ``_dhi_native.stats()``.
+    """
+    if cls.__dhi_compiled_specs__ is None:
+        return "no native fields"
+    if not cls.__dhi_full_native__:
+        return "nested or complex fields"
+    if not cls.__dhi_use_ultra_fast__:
+        return "custom validators"
+    if cls.__dhi_needs_post_init__:
+        return "model_post_init"
+    if not getattr(cls.__init__, '_dhi_managed', False) or cls.__new__ is not object.__new__:
+        return "custom __init__ or __new__"
+    return None
 
 
 def _sync_fast_construct(cls) -> None:
@@ -1075,14 +1188,10 @@ def _sync_fast_construct(cls) -> None:
     """
     if _dhi_native is None or not hasattr(_dhi_native, 'enable_fast_construct'):
         return
-    eligible = (
-        cls.__dhi_use_ultra_fast__
-        and not cls.__dhi_needs_post_init__
-        and cls.__dhi_compiled_specs__ is not None
-        and getattr(cls.__init__, '_dhi_managed', False)
-        and cls.__new__ is object.__new__
-    )
-    if eligible:
+    reason = _fast_construct_blocker(cls)
+    if cls.__dhi_compiled_specs__ is not None and hasattr(_dhi_native, 'set_stats_fallback'):
+        _dhi_native.set_stats_fallback(cls.__dhi_compiled_specs__, reason)
+    if reason is None:
         _dhi_native.enable_fast_construct(
             cls, cls.__dhi_compiled_specs__, cls.__dhi_extra_mode_int__,
             _raise_native_validation_errors)
@@ -1116,6 +1225,7 @@ class _ModelMeta(type):
         if name == 'BaseModel':
             # Set default values for the base class
             cls.__dhi_compiled_specs__ = None
+            cls.__dhi_dump_specs__ = None
             cls.__dhi_has_custom_validators__ = False
             cls.__dhi_private_attrs__ = {}
             cls.__dhi_has_post_init__ = False
@@ -1636,6 +1746,49 @@ class BaseModel(metaclass=_ModelMeta):
 
         raise ValidationError('__root__', f"Expected dict or {cls.__name__}, got {type(obj).__name__}")
 
+    @classmethod
+    def from_row(cls: Type[_T], row: Any) -> _T:
+        """Create an instance from values in field declaration order.
+
+        Value k becomes field k, so loading DB cursor or CSV rows needs no
+        kwargs dict. On the native fast path the values are mapped straight
+        onto the compiled field specs; a short row leaves the remaining fields
+        to their defaults.
+
+        Raises:
+            TypeError: If the row has more values than the model has fields.
+        """
+        if '__dhi_fast_construct__' in cls.__dict__:
+            return _dhi_native.from_row(cls, row)
+        row = tuple(row)
+        names = cls.__dhi_field_names__
+        if len(row) > len(names):
+            raise TypeError(f"{cls.__name__}.from_row() takes at most {len(names)} "
+                            f"values ({len(row)} given)")
+        return cls(**dict(zip(names, row)))
+
+    @classmethod
+    def from_rows(cls: Type[_T], rows: Any) -> List[_T]:
+        """Create one instance per row of ``rows`` (see from_row)."""
+        if '__dhi_fast_construct__' in cls.__dict__:
+            return _dhi_native.from_rows(cls, rows)
+        return [cls.from_row(row) for row in rows]
+
+    @classmethod
+    def model_validate_or_none(cls: Type[_T], obj: Any) -> Optional[_T]:
+        """Validate data like model_validate(), returning None if it is invalid.
+
+        For filtering records where the reason for a rejection doesn't matter:
+        on the native fast path validation stops at the first bad field and no
+        error is recorded or raised at all.
+        """
+        if type(obj) is dict and '__dhi_fast_construct__' in cls.__dict__:
+            return _dhi_native.construct_or_none(cls, obj)
+        try:
+            return cls.model_validate(obj)
+        except (ValidationError, ValidationErrors):
+            return None
+
     @classmethod
     def model_validate_json(
         cls: Type[_T],
@@ -1659,8 +1812,19 @@ class BaseModel(metaclass=_ModelMeta):
         Example:
             user = User.model_validate_json('{"name": "Alice", "age": 25}')
         """
-        if isinstance(json_data, bytes):
-            json_data = json_data.decode('utf-8')
+        # FAST PATH: decode the JSON object straight into the instance in C
+        # (same validation as construction; no json.loads, no kwargs dict).
+        # NotImplemented means the root isn't an object or the document needs
+        # json.loads (NaN/Infinity, syntax errors) - take the slow path.
+        # strict/context are only honored by model_validate.
+        if (strict is None and context is None
+                and '__dhi_fast_construct__' in cls.__dict__):
+            result = _dhi_native.model_validate_json(cls, json_data)
+            if result is not NotImplemented:
+                return result
+
+        if isinstance(json_data, (bytes, bytearray, memoryview)):
+            json_data = bytes(json_data).decode('utf-8')
         data = _json.loads(json_data)
         return cls.model_validate(data, strict=strict, context=context)
 
@@ -1729,11 +1893,11 @@ class BaseModel(metaclass=_ModelMeta):
         cls = type(self)
 
         # FAST PATH: Native C dump (handles nested models recursively now)
-        compiled = getattr(cls, '__dhi_compiled_specs__', None)
-        if (compiled is not None and mode == 'python' and not include and not exclude
+        dump_specs = cls.__dict__.get('__dhi_dump_specs__')
+        if (dump_specs is not None and mode == 'python' and not include and not exclude
                 and not by_alias and not exclude_unset and not exclude_defaults
-                and not exclude_none and HAS_NATIVE_EXT):
-            return _dhi_native.dump_model_compiled(self, compiled)
+                and not exclude_none):
+            return _dhi_native.dump_model_compiled(self, dump_specs)
 
         result: Dict[str, Any] = {}
 
@@ -1874,6 +2038,7 @@ class BaseModel(metaclass=_ModelMeta):
         round_trip: bool = False,
         warnings: bool = True,
         serialize_as_any: bool = False,
+        separators: Optional[Tuple[str, str]] = None,
     ) -> str:
         """Convert model to JSON string.
 
@@ -1890,18 +2055,23 @@ class BaseModel(metaclass=_ModelMeta):
             round_trip: Enable round-trip serialization mode.
             warnings: Whether to emit warnings.
             serialize_as_any: Serialize as Any type.
+            separators: (item, key) separators as in json.dumps. Defaults to
+                (', ', ': '); use (',', ':') for compact output.
 
         Returns:
             JSON string representation of the model.
         """
-        # Fast path: native C JSON serialization (only for simple cases)
-        cls = type(self)
-        compiled = getattr(cls, '__dhi_compiled_specs__', None)
-        if (compiled is not None and indent is None and not include and not exclude
-                and not by_alias and not exclude_unset and not exclude_defaults
-                and not exclude_none and HAS_NATIVE_EXT):
+        # Fast path: native C JSON serialization. Handles nested models, masks
+        # and the by_alias/exclude_unset/exclude_none flags; indent and
+        # exclude_defaults still go through model_dump.
+        dump_specs = type(self).__dict__.get('__dhi_dump_specs__')
+        compact = separators is not None and tuple(separators) == (',', ':')
+        if (dump_specs is not None and indent is None and not exclude_defaults
+                and (separators is None or compact or tuple(separators) == (', ', ': '))):
             try:
-                return _dhi_native.dump_json_compiled(self, compiled)
+                return _dhi_native.dump_json_compiled(
+                    self, dump_specs, include or None, exclude or None,
+                    by_alias, exclude_unset, exclude_none, _native_json_default, compact)
             except Exception:
                 pass  # Fall back to Python
 
@@ -1915,7 +2085,42 @@ class BaseModel(metaclass=_ModelMeta):
             exclude_defaults=exclude_defaults,
             exclude_none=exclude_none,
         )
-        return _json.dumps(data, indent=indent, ensure_ascii=False)
+        return _json.dumps(data, indent=indent, separators=separators, ensure_ascii=False)
+
+    def model_dump_msgpack(self) -> bytes:
+        """Convert model to MessagePack bytes (a map of field name -> value).
+
+        Compiled models are written straight from the instance in C; values
+        without a MessagePack encoding (datetime, UUID, ...) fall back to
+        model_dump(mode='json').
+        """
+        if _dhi_native is None:
+            raise NotImplementedError("MessagePack support requires the native extension")
+        if type(self).__dict__.get('__dhi_dump_specs__') is not None:
+            try:
+                return _dhi_native.dump_msgpack(self)
+            except TypeError:
+                pass  # Fall back to Python
+        return _dhi_native.dump_msgpack(self.model_dump(mode='json'))
+
+    @classmethod
+    def model_validate_msgpack(
+        cls: Type[_T],
+        data: bytes,
+        *,
+        strict: Optional[bool] = None,
+        context: Optional[Dict[str, Any]] = None,
+    ) -> _T:
+        """Validate MessagePack data (as written by model_dump_msgpack).
+
+        Args:
+            data: MessagePack bytes or buffer-protocol object.
+            strict: If True, enforce strict validation.
+            context: Optional validation context.
+        """
+        if _dhi_native is None:
+            raise NotImplementedError("MessagePack support requires the native extension")
+        return cls.model_validate(_dhi_native.load_msgpack(data), strict=strict, context=context)
 
     @classmethod
     def model_json_schema(
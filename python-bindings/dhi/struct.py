@@ -18,9 +18,12 @@ Usage:
 
 from __future__ import annotations
 
-from typing import Any, ClassVar, get_type_hints, get_origin, get_args
+from typing import Any, ClassVar, Optional, Union, get_type_hints, get_origin, get_args
 from typing import Annotated
+from datetime import date, datetime
+import re
 import sys
+import types
 
 # Import native module
 try:
@@ -60,12 +63,31 @@ def _extract_constraints(annotation) -> dict:
                     constraints['max_length'] = arg.max_length
                 if arg.strict:
                     constraints['strict'] = True
+                if arg.allow_inf_nan is not None:
+                    constraints['allow_inf_nan'] = arg.allow_inf_nan
+                if arg.strip_whitespace:
+                    constraints['strip_whitespace'] = True
+                if arg.to_lower:
+                    constraints['to_lower'] = True
+                if arg.to_upper:
+                    constraints['to_upper'] = True
                 if arg.alias is not None:
                     constraints['alias'] = arg.alias
+                if arg.cache_strings:
+                    constraints['cache_strings'] = True
+                if arg.pattern is not None:
+                    constraints['pattern'] = arg.pattern
 
     return constraints
 
 
+def _compile_pattern(pattern: str):
+    """Native matcher for Field(pattern=...), or re.Pattern if it needs re."""
+    compiled = re.compile(pattern)  # raises on invalid syntax
+    native = _dhi_native.compile_pattern(pattern) if HAS_NATIVE else None
+    return native if native is not None else compiled
+
+
 def _get_type_code(annotation) -> int:
     """Convert Python type annotation to type code."""
     origin = get_origin(annotation)
@@ -87,6 +109,10 @@ def _get_type_code(annotation) -> int:
         return 4
     elif annotation is bytes:
         return 5
+    elif annotation is date:
+        return 9
+    elif annotation is datetime:
+        return 10
 
     return 0  # any
 
@@ -118,10 +144,76 @@ def _get_format_code(annotation) -> int:
     return 0
 
 
-class StructMeta(type):
+def _is_struct_class(tp) -> bool:
+    """True for Struct subclasses that have been through StructMeta."""
+    return isinstance(tp, StructMeta) and '__dhi_fields__' in tp.__dict__
+
+
+def _get_model_spec(annotation):
+    """Classify Struct-typed fields for the native decoder.
+
+    Returns (type_code, model) where model is the extra (6th) field spec
+    element, or None for plain fields:
+      - Struct / Optional[Struct]      -> (6, cls)
+      - List[Struct | Union[Struct..]] -> (7, (cls, ...))
+      - Union[StructA, StructB, ...]   -> (8, (cls, ...))
+    """
+    if get_origin(annotation) is Annotated:
+        annotation = get_args(annotation)[0]
+
+    if _is_struct_class(annotation):
+        return 6, annotation
+
+    origin = get_origin(annotation)
+    args = get_args(annotation)
+    if origin is list and len(args) == 1:
+        item = args[0]
+        if _is_struct_class(item):
+            return 7, (item,)
+        item_args = get_args(item)
+        if _is_union(item) and item_args and all(_is_struct_class(a) for a in item_args):
+            return 7, item_args
+    elif _is_union(annotation):
+        members = tuple(a for a in args if a is not type(None))
+        if members and all(_is_struct_class(a) for a in members):
+            if len(members) == 1:
+                return 6, members[0]
+            return 8, members
+
+    return None, None
+
+
+def _field_default(cls, field_name):
+    """Default of a field, or ... when it is required.
+
+    Initialized Struct classes replace their field attributes with native
+    descriptors, so inherited defaults come from the base's field specs.
+    """
+    for klass in cls.__mro__:
+        if field_name in klass.__dict__ and '__dhi_members__' not in klass.__dict__:
+            return klass.__dict__[field_name]
+        for spec in klass.__dict__.get('__dhi_field_specs__', ()):
+            if spec[0] == field_name:
+                return ... if spec[2] else spec[3]
+    return getattr(cls, field_name, ...)
+
+
+def _is_union(annotation) -> bool:
+    origin = get_origin(annotation)
+    if origin is Union:
+        return True
+    return sys.version_info >= (3, 10) and origin is types.UnionType
+
+
+class StructMeta(_dhi_native.StructMeta if HAS_NATIVE else type):
     """Metaclass for Struct that sets up field validation."""
 
     def __new__(mcs, name: str, bases: tuple, namespace: dict, **kwargs):
+        if HAS_NATIVE:
+            # Fields live in the native value array and only fields can be
+            # set, so skip the per-instance __dict__. This also keeps the
+            # instances eligible for the native freelist.
+            namespace.setdefault('__slots__', ())
         cls = super().__new__(mcs, name, bases, namespace)
 
         # Skip for the base Struct class itself
@@ -145,7 +237,7 @@ class StructMeta(type):
                 continue
 
             # Get default value
-            default = getattr(cls, field_name, ...)
+            default = _field_default(cls, field_name)
             required = default is ...
             if required:
                 default = None
@@ -155,6 +247,9 @@ class StructMeta(type):
 
             # Build constraints tuple
             type_code = _get_type_code(annotation)
+            model_code, model = _get_model_spec(annotation)
+            if model_code is not None:
+                type_code = model_code
             strict = constraints.get('strict', False)
             gt = constraints.get('gt')
             ge = constraints.get('ge')
@@ -168,6 +263,7 @@ class StructMeta(type):
             strip_whitespace = constraints.get('strip_whitespace', False)
             to_lower = constraints.get('to_lower', False)
             to_upper = constraints.get('to_upper', False)
+            pattern = constraints.get('pattern')
 
             constraint_tuple = (
                 type_code,
@@ -184,9 +280,11 @@ class StructMeta(type):
                 1 if strip_whitespace else 0,
                 1 if to_lower else 0,
                 1 if to_upper else 0,
+                1 if constraints.get('cache_strings') else 0,
+                _compile_pattern(pattern) if pattern is not None else None,
             )
 
-            # Field spec: (name, alias, required, default, constraints)
+            # Field spec: (name, alias, required, default, constraints, [model])
             alias = constraints.get('alias', None)
             field_spec = (
                 field_name,
@@ -195,6 +293,8 @@ class StructMeta(type):
                 default,
                 constraint_tuple,
             )
+            if model is not None:
+                field_spec += (model,)
             field_specs.append(field_spec)
 
         # Store field names for reference
@@ -225,47 +325,149 @@ if HAS_NATIVE:
         __slots__ = ()  # Prevent __dict__ creation
 
         @classmethod
-        def from_json(cls, data: bytes | str) -> 'Struct':
+        def from_json(cls, data: bytes | str, lazy: bool = False) -> 'Struct':
             """Parse JSON directly to Struct instance.
 
             This is the FASTEST path for JSON → Struct conversion:
             - SIMD-accelerated JSON parsing in C
             - Direct validation without intermediate dict
-            - Zero-copy string extraction where possible
+            - Zero-copy input: bytes, ASCII str and any contiguous buffer
+              (memoryview, bytearray, mmap) are read in place
 
             Args:
-                data: JSON bytes or string
+                data: JSON bytes, string or buffer-protocol object
+                lazy: Only scan the object and record where each field's
+                    value is; a field is parsed and validated the first time
+                    it is read (see materialize()). Pays off when most fields
+                    of a wide payload are never touched.
 
             Returns:
                 New Struct instance with validated fields
 
             Raises:
-                ValueError: If JSON is invalid or validation fails
+                ValueError: If JSON is invalid or validation fails. With
+                    lazy=True only malformed JSON and missing required fields
+                    fail here; an invalid field raises when it is read.
             """
             # Use native SIMD JSON parser if available
-            return _dhi_native.struct_from_json(cls, data)
+            return _dhi_native.struct_from_json(cls, data, lazy)
 
         @classmethod
-        def from_json_batch(cls, data: bytes | str) -> list:
+        def from_json_batch(cls, data: bytes | str, threads: int = 1,
+                            out: Optional[list] = None) -> list:
             """Parse JSON array of objects to list of Struct instances.
 
             Optimized for bulk parsing using SIMD-accelerated JSON parser.
 
             Args:
-                data: JSON bytes or string containing an array of objects
+                data: JSON bytes, string or buffer containing an array of objects
+                threads: Worker threads to decode with. Only free-threaded
+                    builds (3.13t+) run in parallel; elsewhere this is ignored.
+                out: List to overwrite with the results (and return), so a
+                    long-running consumer can reuse one list across batches.
+                    On error it holds the objects decoded before the failure.
 
             Returns:
                 List of Struct instances
             """
             # Use native SIMD JSON parser if available
-            return _dhi_native.struct_from_json_batch(cls, data)
+            return _dhi_native.struct_from_json_batch(cls, data, threads, out)
+
+        @classmethod
+        def from_ndjson(cls, data: bytes | str, on_error: str = "raise",
+                        out: Optional[list] = None):
+            """Parse newline-delimited JSON (JSON Lines) to Struct instances.
+
+            Each non-blank line is decoded independently, so one bad record
+            never forces a re-parse of the rest.
+
+            Args:
+                data: NDJSON bytes, string or buffer
+                on_error: "raise" (stop at the first bad line), "skip" (drop
+                    bad lines) or "collect" (drop and report them)
+                out: List to overwrite with the structs (and return), as in
+                    from_json_batch
+
+            Returns:
+                List of Struct instances; for "collect" a tuple
+                (structs, rejects) with rejects as (line_no, byte_offset, error)
+            """
+            return _dhi_native.struct_from_ndjson(cls, data, on_error, out)
+
+        @classmethod
+        def from_row(cls, row) -> 'Struct':
+            """Build a Struct from values in field declaration order.
+
+            Value k goes straight to field k with no keyword names built or
+            looked up, which makes this the cheap way to load DB cursor and
+            CSV rows. A short row leaves the remaining fields to their defaults.
+
+            Args:
+                row: Tuple, list or other sequence of field values
+
+            Raises:
+                TypeError: If the row has more values than the class has fields
+                ValueError: If validation fails
+            """
+            return _dhi_native.from_row(cls, row)
+
+        @classmethod
+        def from_rows(cls, rows) -> list:
+            """Build Structs from an iterable of rows (see from_row)."""
+            return _dhi_native.from_rows(cls, rows)
+
+        @classmethod
+        def from_msgpack(cls, data: bytes) -> 'Struct':
+            """Decode MessagePack to a Struct instance.
+
+            Accepts the map form (field name -> value, unknown keys skipped)
+            and the positional array form written by to_msgpack(positional=True).
+            Fields are validated as in keyword construction; nested Structs
+            are decoded in place.
+
+            Args:
+                data: MessagePack bytes or buffer-protocol object
+
+            Raises:
+                ValueError: If the data is malformed or validation fails
+            """
+            return _dhi_native.struct_from_msgpack(cls, data)
+
+        def to_msgpack(self, positional: bool = False) -> bytes:
+            """Encode as MessagePack.
+
+            Args:
+                positional: Write Structs (including nested ones) as arrays
+                    in field order instead of maps - smaller and faster, but
+                    both sides must agree on the field order.
+
+            Raises:
+                TypeError: If a value has no MessagePack encoding
+            """
+            return _dhi_native.dump_msgpack(self, positional)
+
+        def materialize(self) -> 'Struct':
+            """Parse and validate every field still pending from a lazy decode.
+
+            Returns:
+                self
+
+            Raises:
+                ValueError: With the errors of every invalid field
+            """
+            return _dhi_native.struct_materialize(self)
 
         def model_dump(self) -> dict:
-            """Convert to dictionary."""
+            """Convert to dictionary (nested Structs are dumped recursively)."""
             result = {}
             field_names = getattr(type(self), '__dhi_field_names__', ())
             for i, name in enumerate(field_names):
-                result[name] = self.values[i] if hasattr(self, 'values') else getattr(self, name, None)
+                value = self.values[i] if hasattr(self, 'values') else getattr(self, name, None)
+                if isinstance(value, Struct):
+                    value = value.model_dump()
+                elif isinstance(value, list):
+                    value = [v.model_dump() if isinstance(v, Struct) else v for v in value]
+                result[name] = value
             return result
 
         def model_dump_json(self) -> str:
@@ -309,24 +511,87 @@ else:
                     raise ValueError(f"Field '{name}' is required")
 
         @classmethod
-        def from_json(cls, data: bytes | str) -> 'Struct':
-            """Parse JSON to Struct (pure Python fallback)."""
-            if isinstance(data, bytes):
-                data = data.decode('utf-8')
+        def from_json(cls, data: bytes | str, lazy: bool = False) -> 'Struct':
+            """Parse JSON to Struct (pure Python fallback; lazy is ignored)."""
+            if not isinstance(data, str):
+                data = bytes(data).decode('utf-8')
             obj = _json.loads(data)
             if not isinstance(obj, dict):
                 raise ValueError("Expected JSON object")
             return cls(**obj)
 
         @classmethod
-        def from_json_batch(cls, data: bytes | str) -> list:
+        def from_json_batch(cls, data: bytes | str, threads: int = 1,
+                            out: Optional[list] = None) -> list:
             """Parse JSON array to list of Structs (pure Python fallback)."""
-            if isinstance(data, bytes):
-                data = data.decode('utf-8')
+            if out is not None and not isinstance(out, list):
+                raise TypeError("out must be a list")
+            if not isinstance(data, str):
+                data = bytes(data).decode('utf-8')
             items = _json.loads(data)
             if not isinstance(items, list):
                 raise ValueError("Expected JSON array")
-            return [cls(**item) for item in items]
+            result = [cls(**item) for item in items]
+            if out is None:
+                return result
+            out[:] = result
+            return out
+
+        @classmethod
+        def from_ndjson(cls, data: bytes | str, on_error: str = "raise",
+                        out: Optional[list] = None):
+            """Parse NDJSON to Structs (pure Python fallback)."""
+            if on_error not in ("raise", "skip", "collect"):
+                raise ValueError(f"on_error must be 'raise', 'skip' or 'collect', got {on_error!r}")
+            if out is not None and not isinstance(out, list):
+                raise TypeError("out must be a list")
+            if isinstance(data, str):
+                data = data.encode('utf-8')
+            data = bytes(data)
+            result, rejects = [], []
+            offset = 0
+            for line_no, line in enumerate(data.split(b'\n'), 1):
+                start, offset = offset, offset + len(line) + 1
+                if not line.strip():
+                    continue
+                try:
+                    obj = _json.loads(line)
+                    if not isinstance(obj, dict):
+                        raise ValueError("Expected JSON object")
+                    result.append(cls(**obj))
+                except ValueError as e:
+                    if on_error == "raise":
+                        raise ValueError(f"NDJSON line {line_no} (byte {start}): {e}") from e
+                    rejects.append((line_no, start, e))
+            if out is not None:
+                out[:] = result
+                result = out
+            return (result, rejects) if on_error == "collect" else result
+
+        @classmethod
+        def from_row(cls, row) -> 'Struct':
+            """Build a Struct from values in field order (pure Python fallback)."""
+            row = tuple(row)
+            names = cls.__dhi_fields__
+            if len(row) > len(names):
+                raise TypeError(f"{cls.__name__}.from_row() takes at most {len(names)} "
+                                f"values ({len(row)} given)")
+            return cls(**dict(zip(names, row)))
+
+        @classmethod
+        def from_rows(cls, rows) -> list:
+            """Build Structs from an iterable of rows (pure Python fallback)."""
+            return [cls.from_row(row) for row in rows]
+
+        @classmethod
+        def from_msgpack(cls, data: bytes) -> 'Struct':
+            raise NotImplementedError("MessagePack support requires the native extension")
+
+        def to_msgpack(self, positional: bool = False) -> bytes:
+            raise NotImplementedError("MessagePack support requires the native extension")
+
+        def materialize(self) -> 'Struct':
+            return self
 
         def model_dump(self) -> dict:
             return {name: getattr(self, name) for name in self.__dhi_fields__}
@@ -349,31 +614,106 @@ if HAS_NATIVE:
         """
         __slots__ = ('_decoder',)
 
-        def __init__(self, cls: type):
-            """Create a decoder for the given Struct class."""
-            self._decoder = _dhi_native.Decoder(cls)
+        def __init__(self, cls: type, cache_strings: Optional[bool] = None,
+                     lazy: bool = False):
+            """Create a decoder for the given Struct class.
+
+            Args:
+                cls: Struct class to decode into
+                cache_strings: Share one object per repeated string / int
+                    value through a bounded per-decoder table. None (default)
+                    caches only fields declared with Field(cache_strings=True),
+                    True caches every field, False disables the cache.
+                lazy: decode() parses each field on first access, as
+                    Struct.from_json(lazy=True). Lazily decoded fields bypass
+                    the value cache; feed()/flush() always decode eagerly.
+            """
+            self._decoder = _dhi_native.Decoder(cls, cache_strings, lazy)
 
         def decode(self, data: bytes | str) -> Struct:
             """Decode JSON bytes/str to a Struct instance."""
             return self._decoder.decode(data)
+
+        def feed(self, chunk: bytes | str) -> list:
+            """Feed the next chunk of a JSON array or NDJSON stream.
+
+            Parser state is kept across chunk boundaries; only the unfinished
+            tail is buffered, so the document is never held in full.
+
+            Args:
+                chunk: Next slice of the stream (may split objects anywhere)
+
+            Returns:
+                Struct instances for every object completed by this chunk
+
+            Raises:
+                ValueError: If an object fails validation (objects completed
+                    before it are returned by the next feed/flush call) or
+                    the stream is malformed
+            """
+            return self._decoder.feed(chunk)
+
+        def flush(self) -> list:
+            """End the stream and reset the decoder for the next one.
+
+            Returns:
+                Any remaining Struct instances
+
+            Raises:
+                ValueError: If the stream ended inside an object or array
+            """
+            return self._decoder.flush()
+
+        def cache_info(self) -> dict:
+            """Value cache statistics: hits, misses, size and capacity."""
+            return self._decoder.cache_info()
 else:
     import json as _fallback_json
 
     class Decoder:
         """Pure-Python fallback Decoder."""
-        __slots__ = ('_cls',)
+        __slots__ = ('_cls', '_chunks')
 
-        def __init__(self, cls: type):
+        def __init__(self, cls: type, cache_strings: Optional[bool] = None,
+                     lazy: bool = False):
             self._cls = cls
+            self._chunks = []
+
+        def feed(self, chunk: bytes | str) -> list:
+            # Fallback buffers everything and decodes on flush()
+            if isinstance(chunk, str):
+                chunk = chunk.encode('utf-8')
+            self._chunks.append(chunk)
+            return []
+
+        def flush(self) -> list:
+            data = b''.join(self._chunks).decode('utf-8').strip()
+            self._chunks = []
+            if not data:
+                return []
+            if data.startswith('['):
+                items = _fallback_json.loads(data)
+            else:
+                decoder = _fallback_json.JSONDecoder()
+                items, pos = [], 0
+                while pos < len(data):
+                    item, pos = decoder.raw_decode(data, pos)
+                    items.append(item)
+                    while pos < len(data) and data[pos].isspace():
+                        pos += 1
+            return [self._cls(**item) for item in items]
 
         def decode(self, data: bytes | str) -> Struct:
-            if isinstance(data, bytes):
-                data = data.decode('utf-8')
+            if not isinstance(data, str):
+                data = bytes(data).decode('utf-8')
             obj = _fallback_json.loads(data)
             if not isinstance(obj, dict):
                 raise ValueError("Expected JSON object")
             return self._cls(**obj)
 
+        def cache_info(self) -> dict:
+            return {'hits': 0, 'misses': 0, 'size': 0, 'capacity': 0}
+
 
 # Export
 __all__ = ['Struct', 'StructMeta', 'Decoder']
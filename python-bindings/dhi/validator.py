@@ -23,14 +23,66 @@ class ValidationError(Exception):
         self.message = message
         super().__init__(f"{field}: {message}")
 
+    def __reduce__(self):
+        return (type(self), (self.field, self.message))
+
 
 class ValidationErrors(Exception):
-    """Multiple validation errors"""
+    """Multiple validation errors
+
+    The native construction path raises these with the failures still in
+    their C form (see ``_deferred``); ``errors`` and the message are only
+    built when the exception is first inspected.
+    """
+    _records = None
+
     def __init__(self, errors: List[ValidationError]):
         self.errors = errors
         messages = "\n".join(str(e) for e in errors)
         super().__init__(f"Validation failed:\n{messages}")
 
+    @classmethod
+    def _deferred(cls, records) -> "ValidationErrors":
+        """Wrap native ValidationRecords without rendering them."""
+        exc = cls.__new__(cls)
+        exc._records = records
+        return exc
+
+    def _render(self) -> None:
+        records = self._records
+        if records is not None:
+            self._records = None
+            ValidationErrors.__init__(self, [ValidationError(f, m) for f, m in records.pairs()])
+
+    @property
+    def errors(self) -> List[ValidationError]:
+        self._render()
+        return self.__dict__['errors']
+
+    @errors.setter
+    def errors(self, value: List[ValidationError]) -> None:
+        self.__dict__['errors'] = value
+
+    @property
+    def args(self):
+        self._render()
+        return BaseException.args.__get__(self)
+
+    @args.setter
+    def args(self, value) -> None:
+        BaseException.args.__set__(self, value)
+
+    def __str__(self) -> str:
+        self._render()
+        return super().__str__()
+
+    def __repr__(self) -> str:
+        self._render()
+        return super().__repr__()
+
+    def __reduce__(self):
+        return (type(self), (self.errors,))
+
 
 class BoundedInt:
     """Integer with min/max bounds validation"""
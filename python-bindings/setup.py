@@ -43,7 +43,38 @@ try:
             if lib_file:
                 break
     
-    if lib_file and lib_dir:
+    # DHI_STATIC=1: link libdhi_static.a (from `zig build`) into the
+    # extension instead of loading the shared libdhi - direct calls into the
+    # Zig kernels, and nothing to bundle or find through an rpath.
+    static_lib = None
+    if os.environ.get('DHI_STATIC') == '1':
+        static_name = f'{lib_name}_static.lib' if sys.platform == 'win32' else f'lib{lib_name}_static.a'
+        for location in lib_locations:
+            if (location / static_name).exists():
+                static_lib = str(location / static_name)
+                print(f"Found static Zig library: {static_lib}")
+                break
+        else:
+            print(f"⚠️  DHI_STATIC=1 but {static_name} not found - using the shared library")
+
+    # DHI_STATS=1: compile in the hot-path counters behind
+    # _dhi_native.stats(); DHI_STATS=2 also times each validation.
+    define_macros = []
+    if os.environ.get('DHI_STATS') in ('1', '2'):
+        define_macros.append(('DHI_STATS', os.environ['DHI_STATS']))
+
+    if static_lib:
+        native_ext = Extension(
+            'dhi._dhi_native',
+            sources=['dhi/_native.c'],
+            define_macros=define_macros + [('DHI_STATIC_LIBDHI', '1')],
+            extra_objects=[static_lib],
+            # Keep the archive's other symbols out of the module's exports
+            extra_link_args=['-Wl,--exclude-libs,ALL'] if sys.platform.startswith('linux') else [],
+        )
+        ext_modules = [native_ext]
+        print("✅ Building with statically linked Zig extension")
+    elif lib_file and lib_dir:
         # Copy library to package directory for bundling
         package_lib_dir = Path(__file__).parent / "dhi"
         package_lib_dir.mkdir(exist_ok=True)
@@ -60,6 +91,7 @@ try:
             'dhi._dhi_native',
             sources=['dhi/_native.c'],
             include_dirs=[],
+            define_macros=define_macros,
             library_dirs=[lib_dir],
             libraries=[lib_name],
             runtime_library_dirs=[lib_dir] if sys.platform != 'darwin' else [],
@@ -0,0 +1,178 @@
+"""
+Tests for native ISO 8601 parsing of date/datetime fields (Struct init,
+from_json, from_msgpack and BaseModel)
+"""
+
+import pytest
+from datetime import date, datetime, timedelta, timezone
+from typing import Annotated
+from dhi import BaseModel, Struct, Field, AwareDatetime, ValidationErrors
+
+try:
+    from dhi import _dhi_native
+    HAS_NATIVE = True
+except ImportError:
+    HAS_NATIVE = False
+
+pytestmark = pytest.mark.skipif(not HAS_NATIVE, reason="Test requires native library")
+
+
+class Event(Struct):
+    day: date
+    at: datetime
+
+
+class StrictEvent(Struct):
+    at: Annotated[datetime, Field(strict=True)]
+
+
+class TestStructDatetime:
+    """Tests for date/datetime Struct fields"""
+
+    def test_parse(self):
+        """Test ISO strings become datetime objects on init and from_json."""
+        cases = [
+            ("2024-02-29", datetime(2024, 2, 29)),
+            ("2024-01-02T03:04", datetime(2024, 1, 2, 3, 4)),
+            ("2024-01-02 03:04:05", datetime(2024, 1, 2, 3, 4, 5)),
+            ("2024-01-02T03:04:05.5", datetime(2024, 1, 2, 3, 4, 5, 500000)),
+            ("2024-01-02T03:04:05,123456Z", datetime(2024, 1, 2, 3, 4, 5, 123456, timezone.utc)),
+            ("2024-01-02T03:04:05+05:30",
+             datetime(2024, 1, 2, 3, 4, 5, tzinfo=timezone(timedelta(hours=5, minutes=30)))),
+            ("2024-01-02T03:04:05-0100",
+             datetime(2024, 1, 2, 3, 4, 5, tzinfo=timezone(timedelta(hours=-1)))),
+        ]
+        for text, expected in cases:
+            e = Event(day="2024-01-01", at=text)
+            assert e.day == date(2024, 1, 1)
+            assert e.at == expected and e.at.utcoffset() == expected.utcoffset(), text
+            assert Event.from_json(f'{{"day": "2024-01-01", "at": "{text}"}}'.encode()).at == expected
+
+    def test_invalid(self):
+        """Test malformed or out-of-range values are rejected."""
+        for text in ("2023-02-29", "2024-13-01", "0000-01-01", "2024-1-01", "2024-01-01T24:00",
+                     "2024-01-01T10:60", "2024-01-01X10:00", "2024-01-01T10:00:00.",
+                     "2024-01-01T10:00+01:", "2024-01-01T10:00:00.1234567", "2024-01-01T10:00 "):
+            with pytest.raises(ValueError, match="Invalid ISO datetime format"):
+                Event(day="2024-01-01", at=text)
+            with pytest.raises(ValueError, match="Invalid ISO datetime format"):
+                Event.from_json(f'{{"day": "2024-01-01", "at": "{text}"}}'.encode())
+
+    def test_instances_and_types(self):
+        """Test instances pass through; other types and dates for datetime fail."""
+        now = datetime.now()
+        assert Event(day=now.date(), at=now).at is now
+        with pytest.raises(ValueError, match="Expected datetime"):
+            Event(day="2024-01-01", at=date(2024, 1, 1))
+        with pytest.raises(ValueError, match="Expected date"):
+            Event.from_json(b'{"day": 20240101, "at": "2024-01-01"}')
+        with pytest.raises(ValueError, match="Expected datetime"):
+            StrictEvent(at="2024-01-01T00:00")
+
+    def test_datetime_for_date_rejected(self):
+        """Test a datetime is not a date, although it subclasses date."""
+        with pytest.raises(ValueError, match="Expected date, got datetime"):
+            Event(day=datetime(2024, 1, 1), at=datetime(2024, 1, 1))
+        for model, kwargs in ((Meeting, {"at": "2024-01-02T03:04Z"}), (Bounded, {})):
+            with pytest.raises(ValidationErrors, match="Expected date, got datetime"):
+                model(day=datetime(2024, 1, 1, 12), **kwargs)
+
+    def test_escaped_and_msgpack(self):
+        """Test escaped JSON strings and MessagePack strings are parsed too."""
+        e = Event.from_json(b'{"day": "2024-01-01", "at": "2024-01-02T03:04\\u005a"}')
+        assert e.at == datetime(2024, 1, 2, 3, 4, tzinfo=timezone.utc)
+        data = _dhi_native.dump_msgpack({"day": "2024-01-01", "at": "2024-01-02"})
+        assert Event.from_msgpack(data).at == datetime(2024, 1, 2)
+
+    def test_msgpack_round_trip(self):
+        """Test date/datetime fields encode as ISO strings and decode back."""
+        tz = timezone(timedelta(hours=-3, minutes=-30))
+        for at in (datetime(2024, 1, 2, 3, 4, 5), datetime(2024, 1, 2, 3, 4, 5, 600, tz),
+                   datetime(2024, 1, 2, tzinfo=timezone.utc)):
+            e = Event(day=date(2024, 2, 29), at=at)
+            for positional in (False, True):
+                back = Event.from_msgpack(e.to_msgpack(positional=positional))
+                assert (back.day, back.at) == (e.day, e.at)
+                assert back.at.utcoffset() == at.utcoffset()
+        assert _dhi_native.load_msgpack(Event(day="2024-01-01", at="2024-01-02T03:04Z").to_msgpack()) == \
+            {"day": "2024-01-01", "at": "2024-01-02T03:04:00+00:00"}
+
+
+class Meeting(BaseModel):
+    day: date
+    at: AwareDatetime
+    after: Annotated[date, Field(gt=date(2000, 1, 1))] = date(2001, 1, 1)
+
+
+class TestModelDatetime:
+    """Tests for date/datetime BaseModel fields"""
+
+    def test_parse(self):
+        """Test strings are parsed before custom validators run."""
+        m = Meeting(day="2024-01-01", at="2024-01-02T03:04Z", after="2020-05-06")
+        assert m.day == date(2024, 1, 1)
+        assert m.at.tzinfo is timezone.utc
+        assert m.after == date(2020, 5, 6)
+
+    def test_msgpack_round_trip(self):
+        """Test model_dump_msgpack output validates back to an equal model."""
+        m = Meeting(day="2024-01-01", at="2024-01-02T03:04:05.25+01:00", after="2020-05-06")
+        assert Meeting.model_validate_msgpack(m.model_dump_msgpack()) == m
+
+    def test_invalid(self):
+        """Test format, awareness and date bounds are enforced."""
+        with pytest.raises(ValidationErrors, match="Invalid ISO date format"):
+            Meeting(day="2024-02-30", at="2024-01-02T03:04Z")
+        with pytest.raises(ValidationErrors, match="timezone-aware"):
+            Meeting(day="2024-01-01", at="2024-01-02T03:04")
+        with pytest.raises(ValidationErrors, match="after"):
+            Meeting(day="2024-01-01", at="2024-01-02T03:04Z", after="1999-01-01")
+
+
+class Bounded(BaseModel):
+    day: Annotated[date, Field(gt=date(1, 1, 1))] = date(2000, 1, 1)
+    at: Annotated[datetime, Field(gt=datetime(1, 1, 1))] = datetime(2000, 1, 1)
+
+
+class TestIsoGrammarParity:
+    """Tests every path accepts exactly the native ISO grammar"""
+
+    TEXTS = ["20240101", "2024-01-01T10", "2024-01-01T1000", "2024-W01-1",
+             "2024-01-01T10:00:00.1234567", "2024-01-01T10:00:00,5", "2024-01-01t10:00",
+             "2024-01-01T10:00:00+00:00", "2024-01-01T10:00-0130", "2024-01-01T10:00+2400",
+             "2024-02-29", "2023-02-29", "0000-01-01", "2024-01-01T10:00:60",
+             "\uff12024-01-01", "2024-01-01\ud800"]
+
+    def test_fallback_matches_native(self):
+        """Test the pure-Python regex fallback builds the same values."""
+        from dhi.model import _iso_from_regex
+        # Forms only datetime.fromisoformat (3.11+) takes are outside the grammar
+        for text in self.TEXTS[:5]:
+            assert _dhi_native.parse_iso(text, True) is None, text
+        for text in self.TEXTS:
+            for want_time in (False, True):
+                native = _dhi_native.parse_iso(text, want_time)
+                fallback = _iso_from_regex(text, want_time)
+                assert native == fallback, (text, want_time)
+                if native is not None and want_time:
+                    assert native.utcoffset() == fallback.utcoffset(), text
+
+    def test_bounded_fields_match_plain(self):
+        """Test constrained BaseModel fields accept what Struct fields do."""
+        for text in self.TEXTS:
+            day_ok = _dhi_native.parse_iso(text, False) is not None
+            at = _dhi_native.parse_iso(text, True)
+            for model, kwargs, ok in ((Event, {"day": text, "at": "2024-01-01"}, day_ok),
+                                      (Bounded, {"day": text}, day_ok),
+                                      (Event, {"day": "2024-01-01", "at": text}, at is not None)):
+                if ok:
+                    model(**kwargs)
+                else:
+                    with pytest.raises((ValueError, ValidationErrors), match="Invalid ISO"):
+                        model(**kwargs)
+            if at is None or at.tzinfo is None:  # the bound is naive
+                if at is not None:
+                    assert Bounded(at=text).at == at
+                else:
+                    with pytest.raises(ValidationErrors, match="Invalid ISO datetime format"):
+                        Bounded(at=text)
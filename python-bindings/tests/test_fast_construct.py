@@ -134,3 +134,213 @@ class TestFastConstruct:
         assert m.x == 7
         with pytest.raises(ValidationErrors):
             M(x="bad")
+
+    def test_wide_model_fields_set(self):
+        # > 64 fields: the fields-set bitset spans several words (and spills to
+        # the heap past the on-stack capacity at 600 fields)
+        for n_fields in (130, 600):
+            annotations = {f"c{i}": int for i in range(n_fields)}
+            namespace = {"__annotations__": annotations}
+            namespace.update({f"c{i}": 0 for i in range(1, n_fields, 2)})
+            Wide = type("Wide", (BaseModel,), namespace)
+
+            given = {f"c{i}": i for i in range(0, n_fields, 2)}
+            given[f"c{n_fields - 1}"] = -1
+            m = Wide(**given)
+            assert m.model_fields_set == set(given)
+            assert getattr(m, f"c{n_fields - 1}") == -1
+            assert getattr(m, "c1") == 0
+            assert Wide.model_validate(given).model_fields_set == set(given)
+            with pytest.raises(ValidationErrors):
+                Wide(**{k: v for k, v in given.items() if k != f"c{n_fields - 2}"})
+
+    def test_model_validate_json_matches_model_validate(self):
+        from typing import Annotated, List, Optional
+
+        class Address(BaseModel):
+            city: str
+
+        class User(BaseModel):
+            name: Annotated[str, Field(min_length=1)]
+            age: Annotated[int, Field(ge=0)]
+            tags: List[str] = []
+            address: Optional[Address] = None
+
+        payload = ('{"age": 30, "name": "Al\\u00e9", "tags": ["a", "b"],'
+                   ' "address": {"city": "Oslo"}}')
+        for data in (payload, payload.encode(), bytearray(payload.encode())):
+            u = User.model_validate_json(data)
+            assert u.name == "Alé" and u.age == 30 and u.tags == ["a", "b"]
+            assert u.address.city == "Oslo"
+            assert u.model_fields_set == {"name", "age", "tags", "address"}
+
+        u = User.model_validate_json('{"name": "A", "age": 1, "age": 2}')
+        assert u.age == 2  # duplicate keys: last one wins, like json.loads
+        assert u.model_fields_set == {"name", "age"}
+
+        with pytest.raises(ValidationErrors):
+            User.model_validate_json('{"name": "", "age": -1}')
+        with pytest.raises(ValidationErrors):
+            User.model_validate_json('{"age": 1}')
+        with pytest.raises(ValueError):
+            User.model_validate_json('{"name": "A", "age": 1')
+        with pytest.raises(ValueError):
+            User.model_validate_json('{"name": "A", "age": 1} trailing')
+        with pytest.raises((ValidationError, ValidationErrors)):
+            User.model_validate_json('[1, 2]')
+
+    def test_model_validate_json_matches_json_loads(self):
+        import json
+        import math
+        from unittest import mock
+
+        class M(BaseModel):
+            x: float
+            y: int = 0
+
+        # NaN/Infinity literals are accepted, as by json.loads
+        assert math.isnan(M.model_validate_json('{"x": NaN}').x)
+        assert M.model_validate_json('{"x": -Infinity}').x == float("-inf")
+
+        # Syntax errors keep json's exception type and position
+        for bad in ('{"x": 1.0', '{"x": 1.0 "y": 2}', '{"x": 1.0} [',
+                    '{"x": 1.0, "y": 01}', '{"x": -01.5}'):
+            with pytest.raises(json.JSONDecodeError) as exc_info:
+                M.model_validate_json(bad)
+            with pytest.raises(json.JSONDecodeError) as expected:
+                json.loads(bad)
+            assert exc_info.value.pos == expected.value.pos
+        assert M.model_validate_json('{"x": 0, "y": -0}').x == 0.0
+
+        # strict/context go through model_validate
+        with mock.patch.object(M, "model_validate", wraps=M.model_validate) as spy:
+            M.model_validate_json('{"x": 1.5}', strict=True, context={"k": 1})
+        spy.assert_called_once_with({"x": 1.5}, strict=True, context={"k": 1})
+
+    def test_model_validate_json_extra_modes(self):
+        class Forbid(BaseModel):
+            model_config = ConfigDict(extra='forbid')
+            x: int
+
+        class Allow(BaseModel):
+            model_config = ConfigDict(extra='allow')
+            x: int
+
+        with pytest.raises(ValidationErrors):
+            Forbid.model_validate_json('{"x": 1, "y": 2}')
+        a = Allow.model_validate_json('{"x": 1, "y": {"z": [1]}, "y": 3}')
+        assert a.x == 1 and a.model_extra == {"y": 3}
+
+    def test_model_validate_json_many_keys(self):
+        # more keys than the on-stack kwnames buffer
+        namespace = {"__annotations__": {f"f{i}": int for i in range(50)}}
+        Wide = type("Wide", (BaseModel,), namespace)
+        body = ", ".join(f'"f{i}": {i}' for i in reversed(range(50)))
+        w = Wide.model_validate_json("{%s, \"extra\": 1}" % body)
+        assert [getattr(w, f"f{i}") for i in range(50)] == list(range(50))
+
+    @pytest.mark.skipif(_dhi_native is None, reason="native extension not available")
+    def test_error_messages_rendered_on_inspection(self):
+        import pickle
+        from typing import Annotated
+
+        class M(BaseModel):
+            model_config = ConfigDict(extra='forbid')
+            age: Annotated[int, Field(ge=0)]
+            score: Annotated[float, Field(lt=1.5)]
+            name: Annotated[str, Field(max_length=3)]
+            flag: bool
+
+        with pytest.raises(ValidationErrors) as info:
+            M(age=-1, score=2.5, name="abcd", flag="yes", extra=1)
+        exc = info.value
+        expected = [
+            ("age", "Value must be >= 0, got -1"),
+            ("score", "Value must be < 1.5, got 2.5"),
+            ("name", "Length must be <= 3, got 4"),
+            ("flag", "Expected bool, got str"),
+            ("extra", "Extra inputs are not permitted"),
+        ]
+        assert [(e.field, e.message) for e in exc.errors] == expected
+        message = "Validation failed:\n" + "\n".join(f"{f}: {m}" for f, m in expected)
+        assert str(exc) == message
+        assert "age: Value must be >= 0, got -1" in message.splitlines()
+        assert exc.args == (message,)
+
+        with pytest.raises(ValidationErrors) as info:
+            M.model_validate({"score": 0.5, "name": "a", "flag": True})
+        assert str(info.value) == "Validation failed:\nage: Field required"
+
+        restored = pickle.loads(pickle.dumps(info.value))
+        assert [(e.field, e.message) for e in restored.errors] == [("age", "Field required")]
+        assert str(restored) == str(info.value)
+
+    def test_model_validate_or_none(self):
+        from typing import Annotated
+
+        class Inner(BaseModel):
+            v: int
+
+        class M(BaseModel):
+            x: Annotated[int, Field(gt=0)]
+            inner: Inner
+
+        m = M.model_validate_or_none({"x": 1, "inner": {"v": 2}})
+        assert m.x == 1 and m.inner.v == 2
+        assert m.model_fields_set == {"x", "inner"}
+        assert M.model_validate_or_none({"x": 0, "inner": {"v": 2}}) is None
+        assert M.model_validate_or_none({"x": 1, "inner": {"v": "bad"}}) is None
+        assert M.model_validate_or_none({"inner": {"v": 2}}) is None
+        assert M.model_validate_or_none("not a dict") is None
+        assert M.model_validate_or_none(m) is m
+
+    def test_from_row(self):
+        from typing import Annotated
+
+        class M(BaseModel):
+            name: str
+            age: Annotated[int, Field(ge=0)]
+            tag: str = "none"
+
+        m = M.from_row(("Al", 3))
+        assert (m.name, m.age, m.tag) == ("Al", 3, "none")
+        assert m.model_fields_set == {"name", "age"}
+        assert M.from_row(["Al", 3, "x"]) == M(name="Al", age=3, tag="x")
+        with pytest.raises(ValidationErrors):
+            M.from_row(("Al", -1))
+        with pytest.raises(ValidationErrors):
+            M.from_row(("Al",))
+        with pytest.raises(TypeError):
+            M.from_row(("Al", 3, "x", "extra"))
+
+        rows = [(f"u{i}", i) for i in range(50)]
+        assert [m.age for m in M.from_rows(rows)] == list(range(50))
+        assert M.from_rows(iter(rows[:3]))[2].name == "u2"
+        with pytest.raises(ValidationErrors):
+            M.from_rows([("a", 1), ("b", -1)])
+
+    def test_from_row_without_fast_construct(self):
+        class PostInit(BaseModel):
+            x: int
+            y: int = 0
+
+            def model_post_init(self, ctx):
+                self.__dict__['y'] = self.x + 1
+
+        assert PostInit.from_row((3,)).y == 4
+        assert [p.y for p in PostInit.from_rows([(1,), (2,)])] == [2, 3]
+
+    @pytest.mark.skipif(_dhi_native is None, reason="native extension not available")
+    def test_int_bounds_beyond_c_long(self):
+        from typing import Annotated
+
+        class M(BaseModel):
+            n: Annotated[int, Field(ge=0, le=100)]
+            big: Annotated[int, Field(multiple_of=3)] = 0
+
+        with pytest.raises(ValidationErrors, match=f"got {10**30}"):
+            M(n=10**30)
+        with pytest.raises(ValidationErrors, match=f"got {-10**30}"):
+            M.model_validate({"n": -10**30})
+        assert M(n=1, big=3 * 10**30).big == 3 * 10**30
+        assert M.model_validate_or_none({"n": 1, "big": 10**30}) is None
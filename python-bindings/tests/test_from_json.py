@@ -2,8 +2,9 @@
 Tests for Struct.from_json() and Struct.from_json_batch()
 """
 
+import json
 import pytest
-from typing import Annotated
+from typing import Annotated, Optional
 from dhi import Struct, Field
 
 # Check if native module with struct_from_json is available
@@ -88,6 +89,21 @@ class TestFromJson:
 
         assert user.name == "Col1\tCol2"
 
+    def test_surrogate_pair_escape(self):
+        """Test a \\u surrogate pair decodes to one astral character."""
+        json_str = '{"name": "Hi \\ud83d\\ude00!", "email": "test@example.com", "age": 30}'
+        user = UserStruct.from_json(json_str)
+
+        assert user.name == "Hi \U0001F600!"
+
+    def test_surrogate_escapes_match_json_loads(self):
+        """Test escaped pairs combine and lone surrogates decode like json.loads."""
+        for text in ("\\ud83d\\ude00", "\\uD83D\\uDE00x", "\\udbff\\udfff", "\\ud800",
+                     "a\\udc00b", "\\ud83dA", "\\ud83d\\u0041", "\\ude00\\ud83d",
+                     "\\ud83d\\ud83d\\ude00", "\\ud83d\\u00e9"):
+            json_str = '{"name": "%s", "email": "test@example.com", "age": 30}' % text
+            assert UserStruct.from_json(json_str).name == json.loads(json_str)["name"], text
+
     def test_optional_fields_present(self):
         """Test with all optional fields present."""
         json_str = '{"required_field": "hello", "optional_field": "custom", "optional_int": 99}'
@@ -260,6 +276,65 @@ class TestFromJsonBatch:
         assert users[0].name == "User0"
         assert users[999].name == "User999"
 
+    def test_out_list_reused(self):
+        """Test results are written into a caller-supplied list."""
+        out = [object()] * 5
+        one = '[{"name": "A", "email": "a@x.com", "age": 1}]'
+        assert UserStruct.from_json_batch(one, out=out) is out
+        assert [u.name for u in out] == ["A"]
+
+        three = '[' + ', '.join('{"name": "U%d", "email": "u@x.com", "age": %d}' % (i, i)
+                                for i in range(3)) + ']'
+        assert UserStruct.from_json_batch(three, out=out) is out
+        assert [u.age for u in out] == [0, 1, 2]
+        assert UserStruct.from_json_batch('[]', out=out) is out
+        assert out == []
+
+    def test_out_must_be_list(self):
+        """Test out= only accepts a list."""
+        with pytest.raises(TypeError):
+            UserStruct.from_json_batch('[]', out=())
+
+    @requires_native
+    def test_out_keeps_decoded_prefix(self):
+        """Test a failing batch leaves the objects decoded before the error."""
+        out = []
+        bad = ('[{"name": "A", "email": "a@x.com", "age": 1}, '
+               '{"name": "B", "email": "b@x.com", "age": 500}]')
+        with pytest.raises(ValueError):
+            UserStruct.from_json_batch(bad, out=out)
+        assert [u.name for u in out] == ["A"]
+
+
+class TestFromJsonBatchStructural:
+    """Tests for the structural-index batch path"""
+
+    def test_structural_chars_inside_strings(self):
+        """Test braces, commas and escaped quotes inside strings."""
+        long_name = 'x' * 45 + '},{\\"[' + 'y' * 40
+        json_str = (
+            '[{"name": "a\\"},{", "email": "e@x.com", "age": 1},'
+            ' {"unknown": {"nested": ["}", "]"]}, "name": "%s", "email": "f@x.com", "age": 2}]'
+            % long_name
+        )
+        users = UserStruct.from_json_batch(json_str)
+        assert [u.name for u in users] == ['a"},{', long_name.replace('\\"', '"')]
+        assert [u.age for u in users] == [1, 2]
+
+    def test_trailing_comma_rejected(self):
+        """Test a trailing comma in the array is rejected."""
+        with pytest.raises(ValueError):
+            UserStruct.from_json_batch('[{"name": "A", "email": "a@x.com", "age": 1},]')
+
+    def test_trailing_data_rejected(self):
+        """Test only whitespace may follow the closing bracket."""
+        one = '[{"name": "A", "email": "a@x.com", "age": 1}]'
+        for threads in (1, 4):
+            assert len(UserStruct.from_json_batch(one + ' \n', threads=threads)) == 1
+            for data in (one + ' x', one + '[]', '[] x', one + ']'):
+                with pytest.raises(ValueError):
+                    UserStruct.from_json_batch(data, threads=threads)
+
 
 class TestFromJsonBatchErrors:
     """Tests for error handling in from_json_batch()"""
@@ -284,3 +359,695 @@ class TestFromJsonBatchErrors:
 
         with pytest.raises(ValueError):
             UserStruct.from_json_batch(json_str)
+
+
+class AddressStruct(Struct):
+    city: Annotated[str, Field(min_length=1)]
+    zip_code: int
+
+
+class CatStruct(Struct):
+    meows: int
+
+
+class DogStruct(Struct):
+    barks: str
+
+
+class PersonStruct(Struct):
+    name: str
+    address: AddressStruct
+    previous: list[AddressStruct] = []
+    pet: CatStruct | DogStruct | None = None
+    extra: dict = None
+
+
+@requires_native
+class TestFromJsonNested:
+    """Tests for nested objects/arrays decoded straight into Structs"""
+
+    def test_nested_struct(self):
+        """Test nested object becomes a nested Struct instance."""
+        person = PersonStruct.from_json(
+            '{"name": "Ann", "address": {"city": "Oslo", "zip_code": 150}}')
+        assert isinstance(person.address, AddressStruct)
+        assert person.address.city == "Oslo"
+        assert person.address.zip_code == 150
+        assert person.previous == []
+        assert person.pet is None
+
+    def test_list_of_structs(self):
+        """Test array of objects becomes a list of Struct instances."""
+        person = PersonStruct.from_json(
+            '{"name": "Ann", "address": {"city": "Oslo", "zip_code": 1},'
+            ' "previous": [{"city": "Rome", "zip_code": 2}, {"city": "Bern", "zip_code": 3}]}')
+        assert [a.city for a in person.previous] == ["Rome", "Bern"]
+        assert all(isinstance(a, AddressStruct) for a in person.previous)
+
+    def test_union_of_structs(self):
+        """Test union members are tried in order."""
+        base = '{"name": "Ann", "address": {"city": "Oslo", "zip_code": 1}, "pet": %s}'
+        assert isinstance(PersonStruct.from_json(base % '{"meows": 3}').pet, CatStruct)
+        assert isinstance(PersonStruct.from_json(base % '{"barks": "woof"}').pet, DogStruct)
+        assert PersonStruct.from_json(base % 'null').pet is None
+
+    def test_untyped_field_gets_plain_values(self):
+        """Test untyped nested values decode to dict/list."""
+        person = PersonStruct.from_json(
+            '{"name": "Ann", "address": {"city": "Oslo", "zip_code": 1},'
+            ' "extra": {"tags": ["a", "b"], "n": 1.5, "ok": true, "none": null}}')
+        assert person.extra == {"tags": ["a", "b"], "n": 1.5, "ok": True, "none": None}
+
+    def test_nested_validation_error(self):
+        """Test nested errors are reported against the parent field."""
+        with pytest.raises(ValueError, match="address: city"):
+            PersonStruct.from_json('{"name": "Ann", "address": {"city": "", "zip_code": 1}}')
+        with pytest.raises(ValueError, match="previous: Item 1"):
+            PersonStruct.from_json(
+                '{"name": "Ann", "address": {"city": "Oslo", "zip_code": 1},'
+                ' "previous": [{"city": "Rome", "zip_code": 2}, {"city": "Bern", "zip_code": "x"}]}')
+
+    def test_nested_type_mismatch(self):
+        """Test non-object value for a nested Struct field."""
+        with pytest.raises(ValueError, match="address: Expected"):
+            PersonStruct.from_json('{"name": "Ann", "address": [1, 2]}')
+
+    def test_nested_model_dump(self):
+        """Test model_dump recurses into nested Structs."""
+        person = PersonStruct.from_json(
+            '{"name": "Ann", "address": {"city": "Oslo", "zip_code": 1},'
+            ' "previous": [{"city": "Rome", "zip_code": 2}]}')
+        dumped = person.model_dump()
+        assert dumped["address"] == {"city": "Oslo", "zip_code": 1}
+        assert dumped["previous"] == [{"city": "Rome", "zip_code": 2}]
+
+    def test_nested_in_batch(self):
+        """Test nested objects inside from_json_batch."""
+        people = PersonStruct.from_json_batch(
+            '[{"name": "A", "address": {"city": "X", "zip_code": 1}},'
+            ' {"name": "B", "address": {"city": "Y", "zip_code": 2}}]')
+        assert [p.address.city for p in people] == ["X", "Y"]
+
+
+@requires_native
+class TestFromJsonFieldDispatch:
+    """Tests for hashed field-name dispatch on out-of-order keys"""
+
+    @staticmethod
+    def _wide_struct(n):
+        annotations = {f"field_{i}": int for i in range(n)}
+        return type("WideStruct", (Struct,), {"__annotations__": annotations})
+
+    def test_wide_model_shuffled_keys(self):
+        """Test a 100-field model decodes keys in any order."""
+        import json
+        import random
+        Wide = self._wide_struct(100)
+        keys = [f"field_{i}" for i in range(100)]
+        random.Random(7).shuffle(keys)
+        payload = json.dumps({k: int(k.split("_")[1]) for k in keys})
+        obj = Wide.from_json(payload)
+        assert all(getattr(obj, f"field_{i}") == i for i in range(100))
+
+    def test_unknown_and_similar_keys_skipped(self):
+        """Test keys that are not fields (including near-misses) are ignored."""
+        Wide = self._wide_struct(20)
+        body = ", ".join(f'"field_{i}": {i}' for i in reversed(range(20)))
+        obj = Wide.from_json('{"field_": 1, "field_200": 2, "Field_3": 3, %s}' % body)
+        assert obj.field_3 == 3
+        assert obj.field_0 == 0
+
+    def test_reordered_then_in_order(self):
+        """Test ordered matching resumes after an out-of-order key."""
+        obj = UserStruct.from_json('{"email": "a@x.com", "age": 3, "name": "A"}')
+        assert (obj.name, obj.email, obj.age) == ("A", "a@x.com", 3)
+
+    def test_missing_field_with_shuffled_keys(self):
+        """Test a missing field is still reported with shuffled keys."""
+        Wide = self._wide_struct(10)
+        body = ", ".join(f'"field_{i}": {i}' for i in range(9, 0, -1))
+        with pytest.raises(ValueError, match="field_0"):
+            Wide.from_json("{%s}" % body)
+
+
+class TestFromJsonBatchThreads:
+    """Tests for from_json_batch(threads=N)"""
+
+    def _batch(self, n, bad_at=()):
+        items = []
+        for i in range(n):
+            age = 150 + i if i in bad_at else i % 100
+            items.append('{"name": "user%d", "email": "u%d@x.com", "age": %d}' % (i, i, age))
+        return '[' + ', '.join(items) + ']'
+
+    def test_threads_match_sequential(self):
+        """Test threaded decoding returns the same objects in order."""
+        data = self._batch(1000)
+        expected = UserStruct.from_json_batch(data)
+        for threads in (2, 4, 7):
+            got = UserStruct.from_json_batch(data, threads=threads)
+            assert [u.name for u in got] == [u.name for u in expected]
+            assert [u.age for u in got] == [u.age for u in expected]
+
+    def test_threads_small_and_empty(self):
+        """Test tiny arrays with many threads."""
+        assert UserStruct.from_json_batch('[]', threads=8) == []
+        assert len(UserStruct.from_json_batch(self._batch(3), threads=8)) == 3
+
+    @requires_native
+    def test_threads_first_error_wins(self):
+        """Test the error reported is the first failing object's."""
+        data = self._batch(800, bad_at=(350, 700))
+        with pytest.raises(ValueError, match="got 500"):
+            UserStruct.from_json_batch(data, threads=4)
+
+    @requires_native
+    def test_threads_malformed_array(self):
+        """Test separators are still checked when splitting."""
+        data = self._batch(100)[:-1] + ' 1]'
+        with pytest.raises(ValueError):
+            UserStruct.from_json_batch(data, threads=4)
+
+    @requires_native
+    def test_threads_invalid(self):
+        """Test threads must be positive."""
+        with pytest.raises(ValueError):
+            UserStruct.from_json_batch('[]', threads=0)
+
+
+@requires_native
+class TestDecoderStream:
+    """Tests for Decoder.feed() / Decoder.flush()"""
+
+    ARRAY = (b'[{"name": "A", "email": "a@x.com", "age": 1},\n'
+             b' {"name": "B\\"}", "email": "b@x.com", "age": 2, "x": [{"y": "]"}]}]')
+    NDJSON = (b'{"name": "A", "email": "a@x.com", "age": 1}\n'
+              b'{"name": "B", "email": "b@x.com", "age": 2}\n')
+
+    def _feed_all(self, decoder, data, step):
+        out = []
+        for i in range(0, len(data), step):
+            out.extend(decoder.feed(data[i:i + step]))
+        out.extend(decoder.flush())
+        return out
+
+    def test_array_any_chunk_size(self):
+        """Test a top-level array split at every possible boundary."""
+        from dhi import Decoder
+        decoder = Decoder(UserStruct)
+        for step in range(1, len(self.ARRAY) + 1):
+            users = self._feed_all(decoder, self.ARRAY, step)
+            assert [u.name for u in users] == ['A', 'B"}']
+
+    def test_ndjson_chunks(self):
+        """Test NDJSON, returning objects as soon as they close."""
+        from dhi import Decoder
+        decoder = Decoder(UserStruct)
+        first = decoder.feed(self.NDJSON[:50])
+        assert [u.name for u in first] == ['A']
+        rest = decoder.feed(self.NDJSON[50:])
+        assert [u.name for u in rest] == ['B']
+        assert decoder.flush() == []
+
+    def test_failed_object_keeps_earlier_results(self):
+        """Test a failing object raises; earlier objects come back next call."""
+        from dhi import Decoder
+        decoder = Decoder(UserStruct)
+        data = (b'{"name": "A", "email": "a@x.com", "age": 1}\n'
+                b'{"name": "", "email": "b@x.com", "age": 2}\n'
+                b'{"name": "C", "email": "c@x.com", "age": 3}\n')
+        with pytest.raises(ValueError):
+            decoder.feed(data)
+        assert [u.name for u in decoder.flush()] == ['A', 'C']
+
+    def test_incomplete_stream(self):
+        """Test flush() raises when the stream stops mid-object, then resets."""
+        from dhi import Decoder
+        decoder = Decoder(UserStruct)
+        decoder.feed(self.ARRAY[:30])
+        with pytest.raises(ValueError, match="Incomplete"):
+            decoder.flush()
+        assert len(self._feed_all(decoder, self.NDJSON, 7)) == 2
+
+    def test_malformed_stream(self):
+        """Test garbage between objects raises."""
+        from dhi import Decoder
+        decoder = Decoder(UserStruct)
+        with pytest.raises(ValueError):
+            decoder.feed(b'[{"name": "A", "email": "a@x.com", "age": 1} 42]')
+
+
+class EventStruct(Struct):
+    status: Annotated[str, Field(cache_strings=True)]
+    message: str
+    count: int
+
+
+@requires_native
+class TestDecoderValueCache:
+    """Tests for the Decoder's shared str/int value cache"""
+
+    EVENT = b'{"status": "accepted", "message": "hello world", "count": 1234}'
+
+    def test_field_opt_in(self):
+        """Test only Field(cache_strings=True) fields share values by default."""
+        from dhi import Decoder
+        decoder = Decoder(EventStruct)
+        a, b = decoder.decode(self.EVENT), decoder.decode(self.EVENT)
+        assert a.status == "accepted" and a.status is b.status
+        assert a.message == b.message and a.message is not b.message
+        assert a.count == b.count == 1234
+        info = decoder.cache_info()
+        assert (info['hits'], info['misses'], info['size']) == (1, 1, 1)
+        assert info['capacity'] > 0
+
+    def test_all_fields_and_disabled(self):
+        """Test cache_strings=True caches every field and False none."""
+        from dhi import Decoder
+        decoder = Decoder(EventStruct, cache_strings=True)
+        a, b = decoder.decode(self.EVENT), decoder.decode(self.EVENT)
+        assert a.message is b.message and a.count is b.count
+        off = Decoder(EventStruct, cache_strings=False)
+        assert off.decode(self.EVENT).status == "accepted"
+        assert off.cache_info() == {'hits': 0, 'misses': 0, 'size': 0, 'capacity': 0}
+        assert Decoder(UserStruct).cache_info()['capacity'] == 0
+
+    def test_values_stay_correct_past_capacity(self):
+        """Test colliding and uncacheable values decode unchanged."""
+        from dhi import Decoder
+        decoder = Decoder(EventStruct, cache_strings=True)
+        long_status = "s" * 100
+        for i in range(5000):
+            status = "st%d" % (i % 3000)
+            data = ('{"status": "%s", "message": "m\\u00e9%d", "count": %d}'
+                    % (status if i % 7 else long_status, i, i * 1000 - 2500000))
+            event = decoder.decode(data)
+            assert event.status == (status if i % 7 else long_status)
+            assert event.message == "m\u00e9%d" % i
+            assert event.count == i * 1000 - 2500000
+        info = decoder.cache_info()
+        assert 0 < info['size'] <= info['capacity']
+
+    def test_feed_uses_cache(self):
+        """Test streamed objects share values too."""
+        from dhi import Decoder
+        decoder = Decoder(EventStruct)
+        events = decoder.feed(self.EVENT + b'\n' + self.EVENT + b'\n') + decoder.flush()
+        assert len(events) == 2 and events[0].status is events[1].status
+
+
+class NumbersStruct(Struct):
+    values: list
+
+
+@requires_native
+class TestFromJsonNumbers:
+    """Tests for native number decoding against the stdlib json module"""
+
+    CASES = [
+        "0", "-0", "0.0", "-0.0", "1e5", "1E+5", "2.5e-3", "0.1", "0.3", "-3.14",
+        "123456789012345678", "1234567890123456789", "-9223372036854775808",
+        "18446744073709551616", "-123456789012345678901234567890123456789",
+        "9007199254740993", "9007199254740993.0", "1.7976931348623157e308",
+        "1.7976931348623159e308", "1e400", "-1e400", "1e-400", "4.9e-324",
+        "2.2250738585072011e-308", "2.4703282292062328e-324",
+        "3.14159265358979323846264338327950288",
+        "1.00000000000000011102230246251565404236316680908203125",
+        "1.00000000000000011102230246251565404236316680908203124",
+        "0.000000000000000000000000000001e-10", "100000000000000000000000.0",
+    ]
+
+    def _decode(self, items):
+        return NumbersStruct.from_json('{"values": [' + ", ".join(items) + ']}').values
+
+    def test_matches_stdlib(self):
+        """Test ints and floats decode exactly as json.loads does."""
+        import json
+        for text, value in zip(self.CASES, self._decode(self.CASES)):
+            expected = json.loads(text)
+            assert type(value) is type(expected), text
+            assert repr(value) == repr(expected), text
+
+    def test_float_round_trip(self):
+        """Test shortest-repr floats across the exponent range round-trip."""
+        import random
+        import struct
+        rng = random.Random(17)
+        floats = []
+        while len(floats) < 5000:
+            x = struct.unpack('<d', struct.pack('<Q', rng.getrandbits(64)))[0]
+            if x == x and abs(x) != float('inf'):
+                floats.append(x)
+        assert self._decode([repr(x) for x in floats]) == floats
+
+    def test_malformed_numbers_rejected(self):
+        """Test numbers missing fraction or exponent digits are rejected."""
+        for text in ("1.", "1.e5", "1e", "1e+", "-"):
+            with pytest.raises(ValueError):
+                self._decode([text])
+
+
+@requires_native
+class TestFromJsonBufferInput:
+    """Tests for zero-copy buffer-protocol and str inputs"""
+
+    DATA = b'{"name": "John", "email": "john@example.com", "age": 30}'
+
+    def test_memoryview_and_bytearray(self):
+        """Test memoryview / bytearray inputs."""
+        for data in (memoryview(self.DATA), bytearray(self.DATA), memoryview(b'xx' + self.DATA)[2:]):
+            user = UserStruct.from_json(data)
+            assert (user.name, user.age) == ("John", 30)
+
+    def test_mmap_batch(self):
+        """Test decoding an mmapped file in place."""
+        import mmap
+        import tempfile
+        with tempfile.TemporaryFile() as f:
+            f.write(b'[' + b','.join([self.DATA] * 50) + b']')
+            f.flush()
+            with mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as mm:
+                users = UserStruct.from_json_batch(mm)
+        assert len(users) == 50 and users[-1].email == "john@example.com"
+
+    def test_str_ascii_and_non_ascii(self):
+        """Test ASCII and non-ASCII str inputs decode identically to bytes."""
+        assert UserStruct.from_json(self.DATA.decode()).name == "John"
+        user = UserStruct.from_json('{"name": "Zoë 日本", "email": "z@x.com", "age": 1}')
+        assert user.name == "Zoë 日本"
+
+    def test_decoder_accepts_buffers(self):
+        """Test Decoder.decode / feed with buffers."""
+        from dhi import Decoder
+        decoder = Decoder(UserStruct)
+        assert decoder.decode(memoryview(self.DATA)).age == 30
+        assert len(decoder.feed(bytearray(self.DATA + b'\n'))) == 1
+
+    def test_rejects_non_buffer(self):
+        """Test non-buffer input raises TypeError."""
+        with pytest.raises(TypeError):
+            UserStruct.from_json(12345)
+
+
+class TestFromNdjson:
+    """Tests for Struct.from_ndjson()"""
+
+    DATA = (b'{"name": "A", "email": "a@x.com", "age": 1}\n'
+            b'\n'
+            b'{"name": "", "email": "b@x.com", "age": 2}\n'
+            b'{"name": "C", "email": "c@x.com", "age": 3}\r\n'
+            b'{"name": "D", "email": \n'
+            b'{"name": "E", "email": "e@x.com", "age": 5}')
+
+    def test_valid_lines(self):
+        """Test clean NDJSON with blank and CRLF lines."""
+        users = UserStruct.from_ndjson(b'{"name": "A", "email": "a@x.com", "age": 1}\r\n\n'
+                                       b'{"name": "B", "email": "b@x.com", "age": 2}\n')
+        assert [u.name for u in users] == ["A", "B"]
+
+    @requires_native
+    def test_raise_reports_line(self):
+        """Test the default mode raises with the line number and offset."""
+        with pytest.raises(ValueError, match=r"line 3 \(byte 45\)"):
+            UserStruct.from_ndjson(self.DATA)
+
+    @requires_native
+    def test_skip(self):
+        """Test bad lines are dropped."""
+        users = UserStruct.from_ndjson(self.DATA, on_error="skip")
+        assert [u.name for u in users] == ["A", "C", "E"]
+
+    @requires_native
+    def test_collect(self):
+        """Test rejects are returned as (line_no, byte_offset, error)."""
+        users, rejects = UserStruct.from_ndjson(self.DATA.decode(), on_error="collect")
+        assert [u.name for u in users] == ["A", "C", "E"]
+        assert [(line, offset) for line, offset, _ in rejects] == [(3, 45), (5, 133)]
+        assert all(isinstance(err, ValueError) for _, _, err in rejects)
+        assert rejects[0][2].args[0] == "Validation failed"
+
+    def test_invalid_mode(self):
+        """Test unknown on_error values are rejected."""
+        with pytest.raises(ValueError):
+            UserStruct.from_ndjson(b'', on_error="ignore")
+
+    def test_out_list_reused(self):
+        """Test NDJSON results are written into a caller-supplied list."""
+        out = [None] * 10
+        assert UserStruct.from_ndjson(self.DATA, on_error="skip", out=out) is out
+        assert [u.name for u in out] == ["A", "C", "E"]
+        rejects = UserStruct.from_ndjson(self.DATA, on_error="collect", out=out)[1]
+        assert [u.name for u in out] == ["A", "C", "E"]
+        assert len(rejects) == 2
+        with pytest.raises(TypeError):
+            UserStruct.from_ndjson(self.DATA, out={})
+
+
+class TestStructRecycling:
+    """Tests for instance reuse through the per-class freelist"""
+
+    def test_recycled_instances_start_empty(self):
+        """Test a reused instance gets fresh defaults, not the old values."""
+        for i in range(300):
+            s = OptionalFieldsStruct(required_field=f"r{i}", optional_int=i)
+            assert (s.required_field, s.optional_field, s.optional_int) == (f"r{i}", "default_value", i)
+            del s
+            t = OptionalFieldsStruct.from_json(b'{"required_field": "x"}')
+            assert (t.required_field, t.optional_field, t.optional_int) == ("x", "default_value", 42)
+
+    def test_values_released_on_free(self):
+        """Test freeing an instance drops its field references."""
+        import sys
+        marker = "unique-" + "marker" * 3
+        before = sys.getrefcount(marker)
+        items = [OptionalFieldsStruct(required_field=marker) for _ in range(500)]
+        assert sys.getrefcount(marker) == before + 500
+        del items
+        assert sys.getrefcount(marker) == before
+
+    def test_batch_churn_and_gc(self):
+        """Test repeated batch decodes reuse memory safely across gc runs."""
+        import gc
+        data = b'[' + b','.join(
+            b'{"name": "U%d", "email": "u@x.com", "age": %d}' % (i, i % 100)
+            for i in range(1000)) + b']'
+        for _ in range(5):
+            users = UserStruct.from_json_batch(data)
+            assert [u.age for u in users[:3]] == [0, 1, 2]
+            assert users[-1].name == "U999"
+            del users
+            gc.collect()
+
+    def test_subclass_with_finalizer(self):
+        """Test classes with __del__ (not freelist eligible) still work."""
+        freed = []
+
+        class Tracked(Struct):
+            x: int
+
+            def __del__(self):
+                freed.append(self.x)
+
+        for i in range(3):
+            Tracked(x=i)
+        assert freed == [0, 1, 2]
+        assert Tracked(x=5).x == 5
+
+
+class TestStructFromRow:
+    """Tests for positional construction from DB/CSV rows"""
+
+    def test_from_row_tuple_and_list(self):
+        """Test values map onto fields in declaration order."""
+        u = UserStruct.from_row(("Alice", "alice@example.com", 30))
+        assert (u.name, u.email, u.age) == ("Alice", "alice@example.com", 30)
+        assert UserStruct.from_row(["Bob", "bob@example.com", 5]) == \
+            UserStruct(name="Bob", email="bob@example.com", age=5)
+
+    def test_short_row_uses_defaults(self):
+        """Test trailing fields missing from the row fall back to defaults."""
+        s = OptionalFieldsStruct.from_row(("x",))
+        assert (s.required_field, s.optional_field, s.optional_int) == ("x", "default_value", 42)
+        with pytest.raises(ValueError):
+            UserStruct.from_row(("Alice",))
+
+    def test_long_row_rejected(self):
+        """Test a row with more values than fields is a TypeError."""
+        with pytest.raises(TypeError):
+            UserStruct.from_row(("Alice", "a@x.com", 30, "extra"))
+
+    @requires_native
+    def test_from_row_validates(self):
+        """Test constraints apply exactly as for keyword construction."""
+        with pytest.raises(ValueError):
+            UserStruct.from_row(("", "a@x.com", 30))
+        with pytest.raises(ValueError):
+            UserStruct.from_row(("Alice", "a@x.com", 200))
+
+    def test_from_rows(self):
+        """Test bulk construction from any iterable of rows."""
+        rows = [(f"U{i}", f"u{i}@x.com", i) for i in range(100)]
+        users = UserStruct.from_rows(rows)
+        assert [u.age for u in users] == list(range(100))
+        assert UserStruct.from_rows(iter(rows[:2]))[1].name == "U1"
+        assert UserStruct.from_rows([]) == []
+        with pytest.raises(ValueError):
+            UserStruct.from_rows([("A", "a@x.com", 1), ("B", "b@x.com", -1)])
+
+
+class TestStructFieldAccess:
+    """Tests for field attributes backed by native member descriptors"""
+
+    def test_get_set_delete(self):
+        """Test reads, writes and deletes go to the field slots."""
+        s = OptionalFieldsStruct(required_field="a")
+        s.optional_int = 7
+        assert (s.required_field, s.optional_int) == ("a", 7)
+        del s.optional_int
+        with pytest.raises(AttributeError):
+            s.optional_int
+        with pytest.raises(AttributeError):
+            s.not_a_field = 1
+
+    def test_subclass_inherits_fields_and_defaults(self):
+        """Test a subclass keeps the base's defaults and adds its own fields."""
+        class Base(Struct):
+            x: int
+            y: str = "base"
+
+        class Child(Base):
+            z: float = 1.5
+
+        c = Child(x=1)
+        assert (c.x, c.y, c.z) == (1, "base", 1.5)
+        assert Child.from_json(b'{"x": 2, "y": "j"}').y == "j"
+        assert Base(x=3).y == "base"
+
+
+class ConstrainedStruct(Struct):
+    qty: Annotated[int, Field(gt=0, multiple_of=5)]
+    ratio: Annotated[float, Field(le=1.0)]
+    code: Annotated[str, Field(strip_whitespace=True, to_upper=True, max_length=3)]
+    raw: bytes = b""
+
+
+@requires_native
+class TestStructConstraints:
+    """Tests that Struct(), from_row() and from_json() apply the same checks"""
+
+    def test_constructors_agree(self):
+        """Test every construction path enforces the full constraint set."""
+        ok = ConstrainedStruct(qty=10, ratio=0.5, code=" ab ")
+        assert ok.code == "AB"
+        assert ConstrainedStruct.from_row((10, 0.5, " ab ")).code == "AB"
+        assert ConstrainedStruct.from_json(b'{"qty": 10, "ratio": 0.5, "code": " ab "}').code == "AB"
+
+        bad = [dict(qty=7, ratio=0.5, code="ab"),
+               dict(qty=10, ratio=1.5, code="ab"),
+               dict(qty=10, ratio=0.5, code="abcd")]
+        for kwargs in bad:
+            with pytest.raises(ValueError):
+                ConstrainedStruct(**kwargs)
+            with pytest.raises(ValueError):
+                ConstrainedStruct.from_row(tuple(kwargs.values()))
+            with pytest.raises(ValueError):
+                ConstrainedStruct.from_json(json.dumps(kwargs))
+
+    def test_bytes_field_type_checked(self):
+        """Test a bytes field rejects str values."""
+        with pytest.raises(ValueError, match="Expected bytes"):
+            ConstrainedStruct(qty=5, ratio=0.0, code="a", raw="not bytes")
+
+    def test_int_beyond_c_long(self):
+        """Test bounds on ints too large for a C long report the value."""
+        with pytest.raises(ValueError, match=f"got {-10**30}"):
+            ConstrainedStruct(qty=-10**30, ratio=0.0, code="a")
+        assert ConstrainedStruct(qty=10**30, ratio=0.0, code="a").qty == 10**30
+
+
+class LazyStruct(Struct):
+    id: int
+    name: Annotated[str, Field(min_length=1)]
+    score: Annotated[float, Field(ge=0.0)] = 0.0
+    address: Optional[AddressStruct] = None
+
+
+@requires_native
+class TestStructLazy:
+    """Tests for from_json(lazy=True) and Decoder(lazy=True)"""
+
+    def test_fields_decoded_on_access(self):
+        """Test a lazily decoded Struct reads back like an eager one."""
+        data = b'{"id": 1, "name": "Ann", "score": 2.5, "address": {"city": "Oslo", "zip_code": 150}}'
+        obj = LazyStruct.from_json(data, lazy=True)
+        assert obj.id == 1
+        assert obj.name == "Ann"
+        assert obj.address.city == "Oslo"
+        assert obj == LazyStruct.from_json(data)
+        assert obj.materialize() is obj
+        assert repr(obj) == repr(LazyStruct.from_json(data))
+
+    def test_repr_leaves_pending_fields(self):
+        """Test repr shows unread fields as raw JSON without decoding them."""
+        obj = LazyStruct.from_json(
+            b'{"id": 1, "name": "", "score": -1,'
+            b' "address": {"city": "Oslo", "zip_code": 150, "note": "long"}}', lazy=True)
+        assert obj.id == 1
+        assert repr(obj) == (
+            'LazyStruct(id=1, name=<pending "">, score=<pending -1>, '
+            'address=<pending {"city": "Oslo", "zip_code": 150, "note"...>)')
+        with pytest.raises(ValueError, match="name"):
+            obj.name
+        assert repr(LazyStruct.from_json(b'{"id": 2, "name": "\xc3\xa6"}', lazy=True)) == \
+            'LazyStruct(id=<pending 2>, name=<pending "\u00e6">, score=0.0, address=None)'
+
+    def test_invalid_field_raises_on_access(self):
+        """Test validation errors surface when the field is first read."""
+        obj = LazyStruct.from_json(b'{"id": 1, "name": "", "score": -1}', lazy=True)
+        assert obj.id == 1
+        with pytest.raises(ValueError, match="name"):
+            obj.name
+        with pytest.raises(ValueError, match="name"):
+            obj.name
+        with pytest.raises(ValueError) as exc_info:
+            obj.materialize()
+        assert len(exc_info.value.args[1]) == 2
+
+    def test_materialize(self):
+        """Test materialize() decodes every pending field and returns self."""
+        obj = LazyStruct.from_json(b'{"id": 2, "name": "Bo"}', lazy=True)
+        assert obj.materialize() is obj
+        assert (obj.id, obj.name, obj.score, obj.address) == (2, "Bo", 0.0, None)
+
+    def test_structural_errors_at_decode(self):
+        """Test malformed JSON and missing required fields still fail eagerly."""
+        with pytest.raises(ValueError, match="id"):
+            LazyStruct.from_json(b'{"name": "Ann"}', lazy=True)
+        with pytest.raises(ValueError):
+            LazyStruct.from_json(b'{"id": [1, "name": "Ann"}', lazy=True)
+
+    def test_set_and_delete_pending_field(self):
+        """Test assigning or deleting a field that was never read."""
+        obj = LazyStruct.from_json(b'{"id": 1, "name": ""}', lazy=True)
+        obj.name = "Cy"
+        assert obj.name == "Cy"
+        del obj.id
+        with pytest.raises(AttributeError):
+            obj.id
+        assert obj.materialize() is obj
+
+    def test_buffer_input_copied(self):
+        """Test mutating a bytearray after decode does not change pending fields."""
+        buf = bytearray(b'{"id": 7, "name": "Dee"}')
+        obj = LazyStruct.from_json(buf, lazy=True)
+        buf[:] = b' ' * len(buf)
+        assert (obj.id, obj.name) == (7, "Dee")
+
+    def test_decoder_lazy(self):
+        """Test Decoder(lazy=True).decode() defers field decoding."""
+        from dhi import Decoder
+        decoder = Decoder(LazyStruct, lazy=True)
+        obj = decoder.decode(b'{"id": 3, "name": "", "score": 1.0}')
+        assert obj.score == 1.0
+        with pytest.raises(ValueError):
+            obj.name
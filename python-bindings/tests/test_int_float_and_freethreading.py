@@ -103,3 +103,34 @@ def test_import_does_not_reenable_gil():
     assert "GIL_AFTER False" in proc.stdout, (proc.stdout, proc.stderr)
     # And the surprise RuntimeWarning must be gone.
     assert "enabled to load module" not in proc.stderr
+
+
+@pytest.mark.skipif(not HAS_NATIVE_EXT, reason="requires the native extension")
+def test_validate_batch_direct_concurrent_threads():
+    # The per-field UTF-8 cache is per call; concurrent batches over shared,
+    # repeated string objects must give the same answers as a serial run.
+    import threading
+    from dhi import _dhi_native
+
+    shared_uuid = "123e4567-e89b-12d3-a456-426614174000"
+    shared_ip = "10.0.0.1"
+    items = [
+        {"id": shared_uuid if i % 3 else "not-a-uuid", "ip": shared_ip if i % 5 else "999.1.1.1"}
+        for i in range(2000)
+    ]
+    specs = {"id": ("uuid",), "ip": ("ipv4",)}
+    expected = _dhi_native.validate_batch_direct(items, specs)
+
+    results = []
+    def worker():
+        for _ in range(20):
+            results.append(_dhi_native.validate_batch_direct(items, specs))
+
+    threads = [threading.Thread(target=worker) for _ in range(8)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert len(results) == 160
+    assert all(r == expected for r in results)
+    assert expected[1] == sum(1 for i in range(2000) if i % 3 and i % 5)
@@ -0,0 +1,137 @@
+"""
+Tests for MessagePack encode/decode (Struct.to_msgpack / from_msgpack and
+BaseModel.model_dump_msgpack / model_validate_msgpack)
+"""
+
+import json
+import struct
+import pytest
+from typing import Annotated, List, Optional
+from dhi import BaseModel, Struct, Field, ValidationErrors
+
+try:
+    from dhi import _dhi_native
+    HAS_NATIVE_MSGPACK = hasattr(_dhi_native, 'dump_msgpack')
+except ImportError:
+    HAS_NATIVE_MSGPACK = False
+
+pytestmark = pytest.mark.skipif(
+    not HAS_NATIVE_MSGPACK,
+    reason="Test requires native library with MessagePack support"
+)
+
+
+class Point(Struct):
+    x: int
+    y: int = 0
+
+
+class Shape(Struct):
+    name: Annotated[str, Field(min_length=1)]
+    scale: Annotated[float, Field(ge=0.0)]
+    blob: bytes = b""
+    origin: Optional[Point] = None
+    points: List[Point] = []
+    tags: list = []
+
+
+class TestStructMsgpack:
+    """Tests for Struct.to_msgpack() / Struct.from_msgpack()"""
+
+    def test_round_trip(self):
+        """Test map and positional encodings both round-trip."""
+        shape = Shape(name="tri", scale=1.5, blob=b"\x00\xff", origin=Point(x=1, y=-2),
+                      points=[Point(x=3), Point(x=-(2**40), y=2**63)],
+                      tags=["a", 1, None, True, {"k": [1.25]}])
+        for positional in (False, True):
+            data = shape.to_msgpack(positional=positional)
+            assert Shape.from_msgpack(data) == shape
+        assert len(shape.to_msgpack(positional=True)) < len(shape.to_msgpack())
+
+    def test_wire_format(self):
+        """Test the encoding uses the standard compact MessagePack forms."""
+        assert Point(x=1, y=-1).to_msgpack() == b"\x82\xa1x\x01\xa1y\xff"
+        assert Point(x=300, y=-200).to_msgpack(positional=True) == b"\x92\xcd\x01\x2c\xd1\xff\x38"
+        assert _dhi_native.dump_msgpack(1.5) == b"\xcb" + struct.pack(">d", 1.5)
+        assert _dhi_native.dump_msgpack("x" * 40) == b"\xd9\x28" + b"x" * 40
+
+    def test_decode_foreign_encodings(self):
+        """Test wider-than-needed ints, float32 and unknown keys decode."""
+        data = (b"\x83\xa1x\xd3" + struct.pack(">q", 5) +
+                b"\xa5extra\x92\xc0\xc7\x01\x05z" +
+                b"\xa1y\xce" + struct.pack(">I", 7))
+        assert Shape.from_msgpack(b"\x82\xa4name\xa1a\xa5scale\xca" + struct.pack(">f", 0.5)).scale == 0.5
+        p = Point.from_msgpack(data)
+        assert (p.x, p.y) == (5, 7)
+
+    def test_validation(self):
+        """Test field constraints and required fields are enforced."""
+        with pytest.raises(ValueError, match="name"):
+            Shape.from_msgpack(Shape(name="a", scale=1.0).to_msgpack().replace(b"\xa1a", b"\xa0"))
+        with pytest.raises(ValueError, match="scale"):
+            Shape.from_msgpack(_dhi_native.dump_msgpack({"name": "a", "scale": -1.0}))
+        with pytest.raises(ValueError, match="x"):
+            Point.from_msgpack(_dhi_native.dump_msgpack({"y": 1}))
+        with pytest.raises(ValueError, match="origin"):
+            Shape.from_msgpack(_dhi_native.dump_msgpack({"name": "a", "scale": 1.0, "origin": {}}))
+
+    def test_nested_scalar(self):
+        """Test a scalar where a model belongs is a field error, as in from_json."""
+        doc = {"name": "", "scale": 1.0, "origin": 5, "points": [{"x": 1}, 5]}
+        with pytest.raises(ValueError) as exc_info:
+            Shape.from_msgpack(_dhi_native.dump_msgpack(doc))
+        errors = exc_info.value.args[1]
+        assert ("origin", "origin: Expected Point or dict, got int") in errors
+        assert ("points", "points: Item 1: expected object, got int") in errors
+        assert len(errors) == 3
+        with pytest.raises(ValueError) as json_info:
+            Shape.from_json(json.dumps(doc))
+        assert json_info.value.args[1] == errors
+
+    def test_malformed(self):
+        """Test truncated, trailing and oversized input is rejected."""
+        data = Point(x=1).to_msgpack()
+        with pytest.raises(ValueError, match="Truncated"):
+            Point.from_msgpack(data[:-1])
+        with pytest.raises(ValueError, match="Extra data"):
+            Point.from_msgpack(data + b"\xc0")
+        with pytest.raises(ValueError, match="fields"):
+            Point.from_msgpack(b"\x93\x01\x02\x03")
+        with pytest.raises(ValueError, match="Truncated"):
+            _dhi_native.load_msgpack(b"\xdd\xff\xff\xff\xff")
+        with pytest.raises(TypeError):
+            Point.from_msgpack("not bytes")
+
+    def test_unsupported_values(self):
+        """Test values without a MessagePack encoding raise."""
+        with pytest.raises(TypeError, match="cannot serialize"):
+            _dhi_native.dump_msgpack(object())
+        with pytest.raises(OverflowError):
+            _dhi_native.dump_msgpack(2**64)
+
+
+class Item(BaseModel):
+    name: str
+    qty: Annotated[int, Field(ge=0)]
+
+
+class Order(BaseModel):
+    id: int
+    items: List[Item]
+
+
+class TestModelMsgpack:
+    """Tests for BaseModel.model_dump_msgpack() / model_validate_msgpack()"""
+
+    def test_round_trip(self):
+        """Test a nested model round-trips and matches model_dump()."""
+        order = Order(id=7, items=[Item(name="a", qty=1), Item(name="b", qty=2)])
+        data = order.model_dump_msgpack()
+        assert _dhi_native.load_msgpack(data) == order.model_dump()
+        assert Order.model_validate_msgpack(data) == order
+
+    def test_validation(self):
+        """Test model_validate_msgpack validates like model_validate."""
+        data = _dhi_native.dump_msgpack({"id": 1, "items": [{"name": "a", "qty": -1}]})
+        with pytest.raises(ValidationErrors):
+            Order.model_validate_msgpack(data)
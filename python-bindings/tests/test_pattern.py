@@ -0,0 +1,103 @@
+"""
+Tests for native Field(pattern=...) matching (compile_pattern) on Struct
+and BaseModel, including the re fallback for unsupported syntax
+"""
+
+import random
+import re
+import pytest
+from typing import Annotated
+from dhi import BaseModel, Struct, Field, ValidationErrors
+
+try:
+    from dhi import _dhi_native
+    HAS_NATIVE_PATTERN = hasattr(_dhi_native, 'compile_pattern')
+except ImportError:
+    HAS_NATIVE_PATTERN = False
+
+pytestmark = pytest.mark.skipif(
+    not HAS_NATIVE_PATTERN,
+    reason="Test requires native library with pattern support"
+)
+
+PATTERNS = [
+    r"^[a-z]+$", r"[A-Z]{2,3}-\d{4}", r"abc", r"^abc$", r"(foo|bar)+baz?",
+    r"\w+@\w+\.(com|org)$", r"a.c", r"\bfoo\b", r"x*", r"", r"[^\d\s]+",
+    r"(?:ab){2,}$", r"(?P<year>\d{4})-(?P<month>\d\d)", r"a{,2}b", r"[\]a-]+",
+    r"\x41é+", r"^\s*$", r"colou?r\Z", r"\Bb", r"a|b|", r"a{", r"a{1,}?b",
+    r"^(a|ab)(c|bcd)(d*)$", r"(a*)*b", r"\d+\.?\d*$",
+]
+
+
+class TestCompilePattern:
+    """Tests for _dhi_native.compile_pattern()"""
+
+    def test_matches_like_re(self):
+        """Test match() agrees with re.match on random and targeted strings."""
+        rng = random.Random(7)
+        alphabet = "abcdxyzABZ019_-.@ é\n١"
+        samples = ["foobaz", "foobarba", "colour", "color\n", "AB-1234", "a@b.com",
+                   "abab", "aab", "abcd", "12.50", "2024-01x", "Aéé", "١"]
+        samples += ["".join(rng.choice(alphabet) for _ in range(rng.randint(0, 8)))
+                    for _ in range(2000)]
+        for pattern in PATTERNS:
+            native = _dhi_native.compile_pattern(pattern)
+            assert native is not None, pattern
+            assert native.pattern == pattern
+            compiled = re.compile(pattern)
+            for s in samples:
+                assert native.match(s) == (compiled.match(s) is not None), (pattern, s)
+
+    def test_large_program(self):
+        """Test counted repeats that expand past the on-stack VM buffers."""
+        native = _dhi_native.compile_pattern(r"(\d|x){300}$")
+        assert native.match("1" * 299 + "x")
+        assert not native.match("1" * 299)
+        assert not native.match("1" * 301)
+
+    def test_unsupported_returns_none(self):
+        """Test syntax outside the native subset is left to re."""
+        for pattern in (r"(a)\1", r"(?=a)", r"(?i)a", r"a++", r"a{2000}", r"[[:alpha:]]"):
+            assert _dhi_native.compile_pattern(pattern) is None, pattern
+
+
+class Code(Struct):
+    code: Annotated[str, Field(pattern=r"^[A-Z]{3}-\d+$")]
+    ref: Annotated[str, Field(pattern=r"(\w)\1")] = "aa"
+
+
+class TestStructPattern:
+    """Tests for pattern constraints on Struct fields"""
+
+    def test_valid(self):
+        """Test matching values pass on every construction path."""
+        assert Code(code="ABC-1").code == "ABC-1"
+        assert Code.from_json(b'{"code": "XYZ-42"}').code == "XYZ-42"
+        assert Code.from_row(("DEF-7", "bb")).ref == "bb"
+
+    def test_invalid(self):
+        """Test mismatches raise with the pattern in the message."""
+        with pytest.raises(ValueError, match="does not match pattern"):
+            Code(code="abc-1")
+        with pytest.raises(ValueError, match="code"):
+            Code.from_json(b'{"code": "ABC-"}')
+
+    def test_re_fallback(self):
+        """Test an unsupported pattern is still enforced through re."""
+        assert Code(code="ABC-1", ref="xxy").ref == "xxy"
+        with pytest.raises(ValueError, match="ref"):
+            Code(code="ABC-1", ref="xy")
+
+
+class Sku(BaseModel):
+    sku: Annotated[str, Field(pattern=r"^SKU-\d{6}$")]
+
+
+class TestModelPattern:
+    """Tests for pattern constraints on BaseModel fields"""
+
+    def test_native_spec(self):
+        """Test the pattern rides on the native constraints."""
+        assert Sku(sku="SKU-000123").sku == "SKU-000123"
+        with pytest.raises(ValidationErrors, match="does not match pattern"):
+            Sku(sku="SKU-12")
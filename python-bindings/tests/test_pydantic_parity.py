@@ -8,7 +8,7 @@ network types, datetime types, and special types.
 import math
 import uuid
 import json
-from typing import Annotated, List, Set
+from typing import Annotated, List, Optional, Set
 from datetime import date, datetime, timezone, timedelta
 
 import pytest
@@ -19,7 +19,7 @@ sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..'))
 
 from dhi import (
     # Core
-    BaseModel, Field, ValidationError, ValidationErrors,
+    BaseModel, Field, ValidationError, ValidationErrors, ConfigDict, computed_field,
     # Constraints
     Gt, Ge, Lt, Le, MultipleOf,
     MinLength, MaxLength, Pattern,
@@ -519,6 +519,110 @@ class TestBaseModel:
         j = m.model_dump_json()
         assert json.loads(j) == {"x": 1, "y": "hello"}
 
+    def test_model_dump_json_matches_json_dumps(self):
+        class M(BaseModel):
+            s: str
+            n: int
+            f: float
+            b: bool
+            o: Optional[str] = None
+
+        cases = [
+            "plain ascii",
+            'quote " backslash \\ slash /',
+            "ctrl \x00\x01\x1f \b\f\n\r\t end",
+            "x" * 40 + '"' + "y" * 40 + "\n",   # escapes past the vector chunks
+            "caf\u00e9 \u2603 \U0001F600",
+            "a" * 1000,
+            "",
+        ]
+        for text in cases:
+            m = M(s=text, n=-(2 ** 62), f=0.1, b=True)
+            expected = json.dumps(m.model_dump(), ensure_ascii=False)
+            assert m.model_dump_json() == expected
+            assert json.loads(m.model_dump_json())["s"] == text
+
+    def test_model_dump_json_options_match_model_dump(self):
+        class Tag(BaseModel):
+            label: str
+            weight: Optional[float] = None
+
+        class Item(BaseModel):
+            name: Annotated[str, Field(alias="itemName")]
+            tag: Optional[Tag] = None
+            tags: List[Tag] = []
+            words: List[str] = []
+            when: Optional[datetime] = None
+            secret: Annotated[str, Field(exclude=True)] = "hidden"
+            note: Annotated[Optional[str], Field(serialization_alias="n")] = None
+
+        class Open(BaseModel):
+            name: str
+            count: int = 0
+            model_config = ConfigDict(extra="allow")
+
+        items = [
+            Item(itemName="a"),
+            Item(itemName="b", tag=Tag(label="t"), tags=[Tag(label="x", weight=1.5)],
+                 words=["w", "caf\u00e9"], when=datetime(2024, 1, 2, 3, 4, 5), note="hi"),
+            Open(name="o", extra_key={"k": [1, 2]}, gone=None),
+        ]
+        option_sets = [
+            {},
+            {"by_alias": True},
+            {"exclude_none": True},
+            {"exclude_unset": True},
+            {"include": {"name", "tags", "extra_key"}},
+            {"include": {"name", "tags", "extra_key"}, "exclude": ["name"]},
+            {"exclude": {"tag": True, "when": ...}},
+            {"by_alias": True, "exclude_none": True, "exclude_unset": True},
+        ]
+        for m in items:
+            for options in option_sets:
+                expected = json.dumps(m.model_dump(mode="json", **options), ensure_ascii=False)
+                assert m.model_dump_json(**options) == expected, options
+
+    def test_model_dump_json_separators(self):
+        class Inner(BaseModel):
+            v: List[int] = []
+
+        class M(BaseModel):
+            café: int
+            quoted: Annotated[str, Field(alias='a"b')]
+            inner: Optional[Inner] = None
+
+        m = M(**{"caf\u00e9": 1, 'a"b': "x"}, inner=Inner(v=[1, 2]))
+        for separators in [None, (", ", ": "), (",", ":"), (" ,", " = ")]:
+            for by_alias in (False, True):
+                expected = json.dumps(m.model_dump(mode="json", by_alias=by_alias),
+                                      separators=separators, ensure_ascii=False)
+                assert m.model_dump_json(separators=separators, by_alias=by_alias) == expected
+        assert m.model_dump_json(separators=(",", ":")) == \
+            '{"caf\u00e9":1,"quoted":"x","inner":{"v":[1,2]}}'
+
+    def test_model_dump_covers_fields_outside_native_init(self):
+        # Mutable defaults and Optional fields skip the native init specs;
+        # the dumps must still include them
+        class M(BaseModel):
+            x: int
+            tags: List[str] = []
+            o: Optional[str] = None
+
+        m = M(x=1, tags=["a"])
+        assert m.model_dump() == {"x": 1, "tags": ["a"], "o": None}
+        assert json.loads(m.model_dump_json()) == {"x": 1, "tags": ["a"], "o": None}
+
+    def test_model_dump_json_computed_fields(self):
+        class M(BaseModel):
+            x: int
+
+            @computed_field
+            @property
+            def double(self) -> int:
+                return self.x * 2
+
+        assert json.loads(M(x=2).model_dump_json()) == {"x": 2, "double": 4}
+
     def test_type_coercion(self):
         class M(BaseModel):
             v: float
@@ -147,3 +147,82 @@ class TestIntRangeBatchDirect:
         assert result.results == [True, True, True, False]
         assert result.valid_count == 3
         assert result.invalid_count == 1
+
+
+def _string_column(values, offset_code="i"):
+    import array
+    data = bytearray()
+    offsets = array.array(offset_code, [0])
+    for v in values:
+        data += v.encode("utf-8")
+        offsets.append(len(data))
+    return offsets, bytes(data)
+
+
+class TestValidateColumns:
+    """Columnar validation over buffers must agree with validate_batch_direct."""
+
+    def test_matches_row_path(self):
+        import array
+        users = generate_users(1000)
+        users[3]["age"] = -1
+        users[10]["email"] = "no-at-sign"
+        users[500]["name"] = ""
+        users[999]["website"] = "nope"
+        columns = {
+            "name": _string_column([u["name"] for u in users]),
+            "email": _string_column([u["email"] for u in users], "q"),
+            "age": array.array("q", [u["age"] for u in users]),
+            "website": _string_column([u["website"] for u in users]),
+        }
+        rows, row_valid = _dhi_native.validate_batch_direct(users, FIELD_SPECS)
+        out, valid = _dhi_native.validate_columns(columns, FIELD_SPECS)
+        assert isinstance(out, bytearray)
+        assert [bool(b) for b in out] == rows
+        assert valid == row_valid == 996
+
+    def test_int_range_and_float_column(self):
+        import array
+        specs = {"age": ("int", 18, 90), "score": ("int_gte", 0)}
+        columns = {
+            "age": array.array("q", [18, 17, 90, 91, 40]),
+            "score": array.array("d", [0.0, 1.5, -0.5, 2.0, float("nan")]),
+        }
+        out, valid = _dhi_native.validate_columns(columns, specs)
+        assert list(out) == [1, 0, 0, 0, 0]
+        assert valid == 1
+
+    def test_bitmap_and_out_buffer(self):
+        import array
+        values = array.array("q", range(20))
+        out = bytearray(3)
+        result, valid = _dhi_native.validate_columns(
+            {"n": values}, {"n": ("int_multiple_of", 2)}, out=out, bitmap=True
+        )
+        assert result is out
+        assert valid == 10
+        assert bytes(out) == bytes([0b01010101, 0b01010101, 0b0101])
+        with pytest.raises(ValueError):
+            _dhi_native.validate_columns({"n": values}, {"n": ("int", 0, 1)}, out=bytearray(5))
+
+    def test_untyped_buffers_and_missing_column(self):
+        import array
+        ages = memoryview(array.array("q", [1, 50]).tobytes())
+        out, valid = _dhi_native.validate_columns(
+            {"age": ages}, {"age": ("int", 18, 90), "name": ("string", 1, 5)}
+        )
+        assert list(out) == [0, 0]
+        assert valid == 0
+
+    def test_errors(self):
+        import array
+        with pytest.raises(TypeError):
+            _dhi_native.validate_columns({"a": array.array("q", [1])}, {"a": ("email",)})
+        with pytest.raises(ValueError):
+            _dhi_native.validate_columns(
+                {"a": array.array("q", [1]), "b": array.array("q", [1, 2])},
+                {"a": ("int", 0, 9), "b": ("int", 0, 9)},
+            )
+        offsets = array.array("i", [0, 50])
+        with pytest.raises(ValueError):
+            _dhi_native.validate_columns({"s": (offsets, b"short")}, {"s": ("string", 0, 9)})
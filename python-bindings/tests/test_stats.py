@@ -0,0 +1,90 @@
+"""
+Tests for the hot-path counters (_dhi_native.stats() / reset_stats()); the
+counting tests only run on a -DDHI_STATS build
+"""
+
+import pytest
+from typing import Annotated
+from dhi import BaseModel, Struct, Field, ValidationErrors
+
+try:
+    from dhi import _dhi_native
+    HAS_NATIVE_STATS = hasattr(_dhi_native, 'stats')
+except ImportError:
+    HAS_NATIVE_STATS = False
+
+pytestmark = pytest.mark.skipif(
+    not HAS_NATIVE_STATS,
+    reason="Test requires native library with stats support"
+)
+
+STATS_ENABLED = HAS_NATIVE_STATS and _dhi_native.stats()["enabled"]
+
+
+class StatsPoint(Struct):
+    x: int
+    y: Annotated[int, Field(ge=0)] = 0
+
+
+class StatsUser(BaseModel):
+    name: str
+    age: Annotated[int, Field(ge=0)]
+
+
+class StatsAudited(BaseModel):
+    name: str
+
+    def model_post_init(self, __context):
+        pass
+
+
+class TestStatsApi:
+    """Tests that hold with or without DHI_STATS"""
+
+    def test_shape(self):
+        """Test stats() always reports the same top-level keys."""
+        stats = _dhi_native.stats()
+        assert set(stats) == {"enabled", "clock", "vectorcall_fallbacks", "classes"}
+        assert _dhi_native.reset_stats() is None
+        if not stats["enabled"]:
+            assert stats["classes"] == {} and stats["clock"] is None
+
+
+@pytest.mark.skipif(not STATS_ENABLED, reason="Test requires a DHI_STATS build")
+class TestStatsCounters:
+    """Tests for the per-class counters"""
+
+    def test_struct_counters(self):
+        """Test init, JSON key order, unknown keys and errors are counted."""
+        _dhi_native.reset_stats()
+        StatsPoint(x=1)
+        StatsPoint.from_json(b'{"x": 1, "y": 2}')
+        StatsPoint.from_json(b'{"y": 2, "x": 1, "z": 3}')
+        with pytest.raises(ValueError):
+            StatsPoint(x=1, y=-1)
+        c = _dhi_native.stats()["classes"]["StatsPoint"]
+        assert c["validations"] == 4
+        assert c["json_decodes"] == 2
+        assert c["key_order_misses"] == 2
+        assert c["unknown_keys"] == 1
+        assert c["errors"] == 1
+
+    def test_model_fast_path_and_fallback(self):
+        """Test fast-path hits and the reason a model is off the fast path."""
+        _dhi_native.reset_stats()
+        StatsUser.model_validate({"name": "a", "age": 1})
+        with pytest.raises(ValidationErrors):
+            StatsUser.model_validate({"name": "a", "age": -1})
+        classes = _dhi_native.stats()["classes"]
+        user = classes["StatsUser"]
+        assert user["validations"] == user["fast_path"] == 2
+        assert user["errors"] == 1
+        assert user["fallback"] is None
+        assert classes["StatsAudited"]["fallback"] == "model_post_init"
+
+    def test_reset(self):
+        """Test reset_stats() zeroes the counters but keeps the classes."""
+        StatsPoint(x=1)
+        _dhi_native.reset_stats()
+        c = _dhi_native.stats()["classes"]["StatsPoint"]
+        assert all(v == 0 for k, v in c.items() if k != "fallback")
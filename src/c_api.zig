@@ -512,3 +512,20 @@ export fn dhi_skip_json_value(
     };
     return @intFromEnum(JsonParseResult.success);
 }
+
+/// Find the next newline at or after start (len if none) - NDJSON splitting
+export fn dhi_find_newline(json: [*]const u8, len: usize, start: usize) usize {
+    return simd_json.findNewline(json[0..len], start);
+}
+
+/// Build (or resume) a stage-1 structural index over a JSON buffer.
+/// See simd_json.buildStructuralIndex; returns the number of entries written.
+export fn dhi_json_structural_index(
+    json: [*]const u8,
+    len: usize,
+    state: *simd_json.StructuralIndexState,
+    out: [*]u32,
+    out_cap: usize,
+) usize {
+    return simd_json.buildStructuralIndex(json[0..len], state, out[0..out_cap]);
+}
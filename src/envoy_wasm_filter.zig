@@ -1,42 +1,64 @@
 const std = @import("std");
+const builtin = @import("builtin");
 const validators = @import("validators_comprehensive.zig");
 
 // =============================================================================
 // Proxy-WASM ABI: Host imports (provided by Envoy)
 // =============================================================================
 
-extern fn proxy_log(level: u32, msg_ptr: [*]const u8, msg_size: usize) u32;
-extern fn proxy_get_buffer_bytes(
-    buffer_type: u32,
-    start: usize,
-    length: usize,
-    return_value_ptr: *usize,
-    return_value_size: *usize,
-) u32;
-extern fn proxy_get_header_map_value(
-    map_type: u32,
-    key_ptr: [*]const u8,
-    key_size: usize,
-    return_value_ptr: *usize,
-    return_value_size: *usize,
-) u32;
-extern fn proxy_set_header_map_value(
-    map_type: u32,
-    key_ptr: [*]const u8,
-    key_size: usize,
-    value_ptr: [*]const u8,
-    value_size: usize,
-) u32;
-extern fn proxy_send_local_response(
-    status_code: u32,
-    status_code_details_ptr: [*]const u8,
-    status_code_details_size: usize,
-    body_ptr: [*]const u8,
-    body_size: usize,
-    headers_ptr: [*]const u8,
-    headers_size: usize,
-    grpc_status: u32,
-) u32;
+// Native test builds have no proxy-wasm host; there the imports are inert
+// stubs, so the scanner and config tests link without one.
+const host = if (builtin.is_test) TestHost else struct {
+    extern fn proxy_log(level: u32, msg_ptr: [*]const u8, msg_size: usize) u32;
+    extern fn proxy_get_buffer_bytes(
+        buffer_type: u32,
+        start: usize,
+        length: usize,
+        return_value_ptr: *usize,
+        return_value_size: *usize,
+    ) u32;
+    extern fn proxy_get_header_map_value(
+        map_type: u32,
+        key_ptr: [*]const u8,
+        key_size: usize,
+        return_value_ptr: *usize,
+        return_value_size: *usize,
+    ) u32;
+    extern fn proxy_set_header_map_value(
+        map_type: u32,
+        key_ptr: [*]const u8,
+        key_size: usize,
+        value_ptr: [*]const u8,
+        value_size: usize,
+    ) u32;
+    extern fn proxy_send_local_response(
+        status_code: u32,
+        status_code_details_ptr: [*]const u8,
+        status_code_details_size: usize,
+        body_ptr: [*]const u8,
+        body_size: usize,
+        headers_ptr: [*]const u8,
+        headers_size: usize,
+        grpc_status: u32,
+    ) u32;
+};
+
+const TestHost = struct {
+    const PROXY_RESULT_NOT_FOUND: u32 = 1;
+
+    fn proxy_log(_: u32, _: [*]const u8, _: usize) u32 {
+        return PROXY_RESULT_OK;
+    }
+    fn proxy_get_buffer_bytes(_: u32, _: usize, _: usize, _: *usize, _: *usize) u32 {
+        return PROXY_RESULT_NOT_FOUND;
+    }
+    fn proxy_get_header_map_value(_: u32, _: [*]const u8, _: usize, _: *usize, _: *usize) u32 {
+        return PROXY_RESULT_NOT_FOUND;
+    }
+    fn proxy_send_local_response(_: u32, _: [*]const u8, _: usize, _: [*]const u8, _: usize, _: [*]const u8, _: usize, _: u32) u32 {
+        return PROXY_RESULT_OK;
+    }
+};
 
 // =============================================================================
 // Constants
@@ -71,6 +93,20 @@ const MAX_RULES: usize = 512;
 const MAX_STREAMS: usize = 1024;
 const MAX_HOST_ALLOC_BYTES: usize = 64 * 1024;
 
+// Body chunks are pulled from the host in windows of at most this size, so a
+// chunk never needs more than one window of host_alloc_storage.
+const BODY_WINDOW_BYTES: usize = 16 * 1024;
+// Longest string value kept for a format validator (email/uuid/ipv4/url);
+// longer values fail it. Length-only rules need no copy and have no limit.
+// The buffer is only allocated for streams on routes with such a validator.
+const MAX_VALUE_BYTES: usize = 1024;
+const MAX_NUMBER_BYTES: usize = 24;
+// Key hash -> field slot tables: one power of two >= 2 * slots per route.
+const SLOT_TABLE_SIZE: usize = 4 * MAX_RULES + 2 * MAX_ROUTES;
+
+const FNV_OFFSET: u64 = 14695981039346656037;
+const FNV_PRIME: u64 = 1099511628211;
+
 // =============================================================================
 // Configuration types
 // =============================================================================
@@ -99,6 +135,21 @@ const RouteRule = struct {
     body_required: bool,
     rules_start: usize,
     rules_len: usize,
+    // Compiled plan (compileRoutePlan): one slot per distinct field, holding
+    // that field's run of plan_rules, and an open-addressing table from key
+    // hash to slot. Built once per configuration, shared by every stream.
+    slots_start: usize = 0,
+    slots_len: usize = 0,
+    table_start: usize = 0,
+    table_mask: usize = 0,
+    needs_bytes: bool = false, // some slot has a format validator
+};
+
+const FieldSlot = struct {
+    field_hash: u64,
+    rules_start: usize, // into plan_rules
+    rules_len: usize,
+    needs_bytes: bool, // a format validator reads the raw value
 };
 
 const RouteHeader = struct {
@@ -111,18 +162,61 @@ const FilterConfig = struct {
     routes: []const RouteRule,
 };
 
+const ScanState = enum(u8) {
+    scan, // between tokens
+    string, // inside a string (a key if it is at depth 1 and a ':' follows)
+    string_escape,
+    after_string, // a depth-1 string ended; waiting for ':'
+    before_value, // after a depth-1 key's ':'
+    value_string, // inside the value of a field with rules
+    value_string_escape,
+    value_number,
+};
+
+const ValueKind = enum { string, number, other };
+
+// Per-stream state of the incremental body scan. It survives across body
+// chunks, so a key or value split between two chunks needs no re-read. All
+// defaults are zero, keeping request_states out of the data segment.
+const BodyScanner = struct {
+    state: ScanState = .scan,
+    depth: u32 = 0,
+    key_hash: u64 = 0,
+    slot: ?usize = null, // slot of the key just read (route-relative)
+    capture: bool = false,
+    overflow: bool = false,
+    value_len: usize = 0,
+    number_len: usize = 0,
+    body_bytes: usize = 0,
+    value: ?*[MAX_VALUE_BYTES]u8 = null, // the stream's value buffer (streamValueBuffer)
+    number: [MAX_NUMBER_BYTES]u8 = [_]u8{0} ** MAX_NUMBER_BYTES,
+    seen: RuleSet = RuleSet.initEmpty(), // slots whose first value was read
+    present: RuleSet = RuleSet.initEmpty(), // route rules given a value of their type
+};
+
+const RuleSet = std.StaticBitSet(MAX_RULES);
+
 const RequestState = struct {
     active: bool = false,
     context_id: u32 = 0,
     has_route: bool = false,
     route_index: usize = 0,
     is_json: bool = false,
+    rejected: bool = false,
+    scanner: BodyScanner = .{},
 };
 
 var config_storage: [MAX_CONFIG_BYTES]u8 = undefined;
 var route_rules: [MAX_ROUTES]RouteRule = undefined;
 var field_rules: [MAX_RULES]FieldRule = undefined;
+var plan_rules: [MAX_RULES]FieldRule = undefined;
+var field_slots: [MAX_RULES]FieldSlot = undefined;
+var slot_table: [SLOT_TABLE_SIZE]u16 = undefined;
 var request_states: [MAX_STREAMS]RequestState = [_]RequestState{.{}} ** MAX_STREAMS;
+// Value buffers per request_states slot, allocated the first time a stream in
+// that slot needs one and reused by the slot's later streams.
+var value_buffers: [MAX_STREAMS]?*[MAX_VALUE_BYTES]u8 = [_]?*[MAX_VALUE_BYTES]u8{null} ** MAX_STREAMS;
+const value_allocator = if (builtin.cpu.arch.isWasm()) std.heap.wasm_allocator else std.heap.page_allocator;
 var host_alloc_storage: [MAX_HOST_ALLOC_BYTES]u8 align(8) = undefined;
 var host_alloc_offset: usize = 0;
 var config: FilterConfig = .{ .routes = &.{} };
@@ -145,98 +239,184 @@ export fn malloc(memory_size: usize) usize {
 }
 
 fn log(level: u32, msg: []const u8) void {
-    _ = proxy_log(level, msg.ptr, msg.len);
+    _ = host.proxy_log(level, msg.ptr, msg.len);
 }
 
 // =============================================================================
-// Simple JSON field extraction (no allocator, no recursion, u64 hashes)
+// Streaming JSON scanner (no allocator, no recursion, u64 hashes)
+//
+// Bytes are fed chunk by chunk as the body arrives. Only top-level keys are
+// looked up: each one is hashed as it streams past and resolved through the
+// route's slot table, and the first value of a field with rules is checked
+// the moment it ends - the first violation rejects the request without
+// waiting for the rest of the body.
 // =============================================================================
 
 fn hashFieldName(name: []const u8) u64 {
-    var h: u64 = 14695981039346656037;
+    var h: u64 = FNV_OFFSET;
     for (name) |c| {
         h ^= @as(u64, c);
-        h *%= 1099511628211;
+        h *%= FNV_PRIME;
     }
     return h;
 }
 
-fn skipQuotedString(json: []const u8, start: usize) ?usize {
-    var i = start + 1;
-    while (i < json.len) : (i += 1) {
-        if (json[i] == '\\') {
-            i += 1;
-            continue;
-        }
-        if (json[i] == '"') return i + 1;
+fn isJsonSpace(c: u8) bool {
+    return c == ' ' or c == '\t' or c == '\r' or c == '\n';
+}
+
+fn slotHome(field_hash: u64) usize {
+    return @as(usize, @truncate(field_hash ^ (field_hash >> 32)));
+}
+
+fn routeSlot(route: RouteRule, field_hash: u64) ?usize {
+    if (route.slots_len == 0) return null;
+    const table = slot_table[route.table_start .. route.table_start + route.table_mask + 1];
+    var i = slotHome(field_hash) & route.table_mask;
+    while (table[i] != 0) : (i = (i + 1) & route.table_mask) {
+        const slot_index = @as(usize, table[i]) - 1;
+        if (field_slots[route.slots_start + slot_index].field_hash == field_hash) return slot_index;
     }
     return null;
 }
 
-fn findFieldValueStart(json: []const u8, field_hash: u64) ?usize {
-    var i: usize = 0;
-    var depth: usize = 0;
+fn appendValue(scanner: *BodyScanner, bytes: []const u8) void {
+    if (scanner.capture) {
+        const value = scanner.value orelse {
+            scanner.overflow = true; // no buffer could be allocated
+            scanner.value_len += bytes.len;
+            return;
+        };
+        if (scanner.value_len + bytes.len <= value.len) {
+            @memcpy(value[scanner.value_len .. scanner.value_len + bytes.len], bytes);
+        } else {
+            scanner.overflow = true;
+        }
+    }
+    scanner.value_len += bytes.len;
+}
 
-    while (i < json.len) {
-        switch (json[i]) {
-            '{', '[' => {
-                depth += 1;
+/// Advance the scan over one body chunk. Returns false on the first rule
+/// violation; required fields that never appeared are left to finishBody.
+fn scanBody(scanner: *BodyScanner, route: RouteRule, chunk: []const u8) bool {
+    var i: usize = 0;
+    while (i < chunk.len) {
+        switch (scanner.state) {
+            .scan => {
+                switch (chunk[i]) {
+                    '{', '[' => scanner.depth += 1,
+                    '}', ']' => {
+                        if (scanner.depth > 0) scanner.depth -= 1;
+                    },
+                    '"' => {
+                        scanner.state = .string;
+                        scanner.key_hash = FNV_OFFSET;
+                    },
+                    else => {},
+                }
+                i += 1;
+            },
+            .string => {
+                // Nested strings can't be keys: skip straight to the next quote or escape
+                if (scanner.depth != 1) {
+                    const n = std.mem.indexOfAny(u8, chunk[i..], "\"\\") orelse {
+                        i = chunk.len;
+                        continue;
+                    };
+                    i += n;
+                }
+                const c = chunk[i];
+                if (c == '"') {
+                    scanner.state = if (scanner.depth == 1) .after_string else .scan;
+                } else {
+                    scanner.key_hash ^= @as(u64, c);
+                    scanner.key_hash *%= FNV_PRIME;
+                    if (c == '\\') scanner.state = .string_escape;
+                }
+                i += 1;
+            },
+            .string_escape => {
+                scanner.key_hash ^= @as(u64, chunk[i]);
+                scanner.key_hash *%= FNV_PRIME;
+                scanner.state = .string;
                 i += 1;
             },
-            '}', ']' => {
-                if (depth > 0) depth -= 1;
+            .after_string => {
+                const c = chunk[i];
+                if (isJsonSpace(c)) {
+                    i += 1;
+                } else if (c == ':') {
+                    scanner.slot = routeSlot(route, scanner.key_hash);
+                    scanner.state = .before_value;
+                    i += 1;
+                } else {
+                    scanner.state = .scan; // a string value, not a key
+                }
+            },
+            .before_value => {
+                const c = chunk[i];
+                if (isJsonSpace(c)) {
+                    i += 1;
+                    continue;
+                }
+                scanner.state = .scan;
+                // Fields without rules, and repeated keys, are just scanned past
+                const slot_index = scanner.slot orelse continue;
+                if (scanner.seen.isSet(slot_index)) continue;
+                scanner.seen.set(slot_index);
+
+                scanner.overflow = false;
+                if (c == '"') {
+                    scanner.capture = field_slots[route.slots_start + slot_index].needs_bytes;
+                    scanner.value_len = 0;
+                    scanner.state = .value_string;
+                    i += 1;
+                } else if (c == '-' or std.ascii.isDigit(c)) {
+                    scanner.number_len = 0;
+                    scanner.state = .value_number;
+                } else if (!finishValue(scanner, route, .other)) {
+                    return false;
+                }
+            },
+            .value_string => {
+                const rest = chunk[i..];
+                const n = std.mem.indexOfAny(u8, rest, "\"\\") orelse rest.len;
+                appendValue(scanner, rest[0..n]);
+                i += n;
+                if (i == chunk.len) continue;
+                if (chunk[i] == '\\') {
+                    appendValue(scanner, chunk[i .. i + 1]);
+                    scanner.state = .value_string_escape;
+                    i += 1;
+                } else {
+                    scanner.state = .scan;
+                    i += 1;
+                    if (!finishValue(scanner, route, .string)) return false;
+                }
+            },
+            .value_string_escape => {
+                appendValue(scanner, chunk[i .. i + 1]);
+                scanner.state = .value_string;
                 i += 1;
             },
-            '"' => {
-                const after_key = skipQuotedString(json, i) orelse return null;
-
-                if (depth == 1) {
-                    const key = json[i + 1 .. after_key - 1];
-                    var value_start = after_key;
-                    while (value_start < json.len and (json[value_start] == ' ' or json[value_start] == '\t' or json[value_start] == '\r' or json[value_start] == '\n')) value_start += 1;
-
-                    if (value_start < json.len and json[value_start] == ':') {
-                        value_start += 1;
-                        while (value_start < json.len and (json[value_start] == ' ' or json[value_start] == '\t' or json[value_start] == '\r' or json[value_start] == '\n')) value_start += 1;
-                        if (value_start < json.len and hashFieldName(key) == field_hash) return value_start;
+            .value_number => {
+                const c = chunk[i];
+                if (std.ascii.isDigit(c) or (c == '-' and scanner.number_len == 0)) {
+                    if (scanner.number_len < scanner.number.len) {
+                        scanner.number[scanner.number_len] = c;
+                        scanner.number_len += 1;
+                    } else {
+                        scanner.overflow = true;
                     }
+                    i += 1;
+                } else {
+                    scanner.state = .scan;
+                    if (!finishValue(scanner, route, .number)) return false;
                 }
-
-                i = after_key;
             },
-            else => i += 1,
         }
     }
-
-    return null;
-}
-
-fn extractStringField(json: []const u8, field_hash: u64) ?[]const u8 {
-    var i = findFieldValueStart(json, field_hash) orelse return null;
-    if (json[i] != '"') return null;
-
-    const val_start = i + 1;
-    i += 1;
-    while (i < json.len and json[i] != '"') {
-        if (json[i] == '\\') i += 1;
-        i += 1;
-    }
-    if (i >= json.len) return null;
-    return json[val_start..i];
-}
-
-fn extractIntField(json: []const u8, field_hash: u64) ?i64 {
-    var i = findFieldValueStart(json, field_hash) orelse return null;
-    if (!(json[i] == '-' or (json[i] >= '0' and json[i] <= '9'))) return null;
-
-    const val_start = i;
-    if (json[i] == '-') i += 1;
-    while (i < json.len and json[i] >= '0' and json[i] <= '9') i += 1;
-    return std.fmt.parseInt(i64, json[val_start..i], 10) catch null;
-}
-
-fn fieldExists(json: []const u8, field_hash: u64) bool {
-    return findFieldValueStart(json, field_hash) != null;
+    return true;
 }
 
 // =============================================================================
@@ -246,7 +426,7 @@ fn fieldExists(json: []const u8, field_hash: u64) bool {
 fn getHostBuffer(buffer_type: u32, start: usize, length: usize) []const u8 {
     var value_ptr: usize = 0;
     var value_size: usize = 0;
-    const result = proxy_get_buffer_bytes(buffer_type, start, length, &value_ptr, &value_size);
+    const result = host.proxy_get_buffer_bytes(buffer_type, start, length, &value_ptr, &value_size);
     if (result != PROXY_RESULT_OK or value_ptr == 0 or value_size == 0) return "";
 
     const value = @as([*]const u8, @ptrFromInt(value_ptr));
@@ -258,7 +438,7 @@ fn getHeader(key: []const u8, out: []u8) []const u8 {
 
     var value_ptr: usize = 0;
     var value_size: usize = 0;
-    const result = proxy_get_header_map_value(
+    const result = host.proxy_get_header_map_value(
         MAP_REQUEST_HEADERS,
         key.ptr,
         key.len,
@@ -287,7 +467,7 @@ fn requestRouteIndexFromHeaders() ?usize {
 }
 
 fn routeRules(route: RouteRule) []const FieldRule {
-    return field_rules[route.rules_start .. route.rules_start + route.rules_len];
+    return plan_rules[route.rules_start .. route.rules_start + route.rules_len];
 }
 
 fn selectRouteIndex(method: []const u8, path: []const u8) ?usize {
@@ -350,18 +530,19 @@ fn isJsonContentType(content_type: []const u8) bool {
 // Validation logic
 // =============================================================================
 
+fn lengthInRange(len: usize, rule: FieldRule) bool {
+    const min = @as(usize, @intCast(@max(rule.min, 0)));
+    const max = @as(usize, @intCast(@max(rule.max, 0)));
+    return len >= min and len <= max;
+}
+
 fn validateFieldValue(value: []const u8, rule: FieldRule) bool {
     return switch (rule.field_type) {
         .email => validators.validateEmail(value),
         .uuid => validators.validateUuid(value),
         .ipv4 => validators.validateIpv4(value),
         .url => validators.validateUrl(value),
-        .string_length => {
-            const len = value.len;
-            const min = @as(usize, @intCast(@max(rule.min, 0)));
-            const max = @as(usize, @intCast(@max(rule.max, 0)));
-            return len >= min and len <= max;
-        },
+        .string_length => lengthInRange(value.len, rule),
         .int_range => {
             const val = std.fmt.parseInt(i64, value, 10) catch return false;
             return val >= rule.min and val <= rule.max;
@@ -370,40 +551,57 @@ fn validateFieldValue(value: []const u8, rule: FieldRule) bool {
     };
 }
 
-fn validateBodyWithRules(body: []const u8, rules: []const FieldRule) bool {
-    for (rules) |rule| {
+/// Check the value just scanned against its field's rules. A value of the
+/// wrong type counts as absent for int/str rules (only presence is noted).
+fn finishValue(scanner: *BodyScanner, route: RouteRule, kind: ValueKind) bool {
+    const slot = field_slots[route.slots_start + scanner.slot.?];
+    const rules = plan_rules[slot.rules_start .. slot.rules_start + slot.rules_len];
+    const int_value: ?i64 = if (kind == .number and !scanner.overflow)
+        std.fmt.parseInt(i64, scanner.number[0..scanner.number_len], 10) catch null
+    else
+        null;
+
+    for (rules, slot.rules_start - route.rules_start..) |rule, rule_index| {
         switch (rule.field_type) {
+            .required_present => scanner.present.set(rule_index),
             .int_range => {
-                const val = extractIntField(body, rule.field_hash) orelse {
-                    if (rule.required) return false;
-                    continue;
-                };
+                const val = int_value orelse continue;
+                scanner.present.set(rule_index);
                 if (val < rule.min or val > rule.max) return false;
             },
             .string_length => {
-                const val = extractStringField(body, rule.field_hash) orelse {
-                    if (rule.required) return false;
-                    continue;
-                };
-                const min = @as(usize, @intCast(@max(rule.min, 0)));
-                const max = @as(usize, @intCast(@max(rule.max, 0)));
-                if (val.len < min or val.len > max) return false;
-            },
-            .required_present => {
-                if (!fieldExists(body, rule.field_hash)) return false;
+                if (kind != .string) continue;
+                scanner.present.set(rule_index);
+                if (!lengthInRange(scanner.value_len, rule)) return false;
             },
             .email, .uuid, .ipv4, .url => {
-                const val = extractStringField(body, rule.field_hash) orelse {
-                    if (rule.required) return false;
-                    continue;
-                };
-                if (!validateFieldValue(val, rule)) return false;
+                if (kind != .string) continue;
+                scanner.present.set(rule_index);
+                const value = scanner.value orelse return false;
+                if (scanner.overflow or !validateFieldValue(value[0..scanner.value_len], rule)) return false;
             },
         }
     }
     return true;
 }
 
+/// End of body: settle a value cut off by the end, then require every
+/// required rule to have seen its field.
+fn finishBody(scanner: *BodyScanner, route: RouteRule) bool {
+    switch (scanner.state) {
+        .value_number => if (!finishValue(scanner, route, .number)) return false,
+        .value_string, .value_string_escape => if (!finishValue(scanner, route, .other)) return false,
+        else => {},
+    }
+    scanner.state = .scan;
+
+    for (routeRules(route), 0..) |rule, rule_index| {
+        const required = rule.required or rule.field_type == .required_present;
+        if (required and !scanner.present.isSet(rule_index)) return false;
+    }
+    return true;
+}
+
 // =============================================================================
 // Config parsing
 //
@@ -500,10 +698,67 @@ fn parseRouteHeader(header: []const u8) RouteHeader {
     return .{ .method = "", .path = trimmed, .body_required = true };
 }
 
+/// Compile a parsed route into its flat plan: the route's rules regrouped in
+/// plan_rules so each field's checks are one contiguous run, a slot per
+/// distinct field, and the key hash -> slot table the scanner probes.
+fn compileRoutePlan(route: *RouteRule, slot_count: *usize, table_count: *usize) void {
+    const rules = field_rules[route.rules_start .. route.rules_start + route.rules_len];
+    route.slots_start = slot_count.*;
+    route.slots_len = 0;
+
+    for (rules) |rule| {
+        const slots = field_slots[route.slots_start .. route.slots_start + route.slots_len];
+        const known = for (slots) |slot| {
+            if (slot.field_hash == rule.field_hash) break true;
+        } else false;
+        if (known) continue;
+        field_slots[route.slots_start + route.slots_len] = .{
+            .field_hash = rule.field_hash,
+            .rules_start = 0,
+            .rules_len = 0,
+            .needs_bytes = false,
+        };
+        route.slots_len += 1;
+    }
+
+    var next = route.rules_start;
+    for (field_slots[route.slots_start .. route.slots_start + route.slots_len]) |*slot| {
+        slot.rules_start = next;
+        for (rules) |rule| {
+            if (rule.field_hash != slot.field_hash) continue;
+            plan_rules[next] = rule;
+            next += 1;
+            switch (rule.field_type) {
+                .email, .uuid, .ipv4, .url => slot.needs_bytes = true,
+                else => {},
+            }
+        }
+        slot.rules_len = next - slot.rules_start;
+        if (slot.needs_bytes) route.needs_bytes = true;
+    }
+
+    var size: usize = 2;
+    while (size < route.slots_len * 2) size *= 2;
+    route.table_start = table_count.*;
+    route.table_mask = size - 1;
+    const table = slot_table[route.table_start .. route.table_start + size];
+    @memset(table, 0);
+    for (field_slots[route.slots_start .. route.slots_start + route.slots_len], 0..) |slot, slot_index| {
+        var i = slotHome(slot.field_hash) & route.table_mask;
+        while (table[i] != 0) i = (i + 1) & route.table_mask;
+        table[i] = @intCast(slot_index + 1);
+    }
+
+    slot_count.* += route.slots_len;
+    table_count.* += size;
+}
+
 fn parseConfig(config_data: []const u8) FilterConfig {
     const stored = copyConfig(config_data);
     var route_count: usize = 0;
     var rule_count: usize = 0;
+    var slot_count: usize = 0;
+    var table_count: usize = 0;
 
     if (stored.len == 0) return .{ .routes = route_rules[0..0] };
 
@@ -518,6 +773,7 @@ fn parseConfig(config_data: []const u8) FilterConfig {
             .rules_start = rules_start,
             .rules_len = rule_count - rules_start,
         };
+        compileRoutePlan(&route_rules[0], &slot_count, &table_count);
         return .{ .routes = route_rules[0..1] };
     }
 
@@ -542,6 +798,7 @@ fn parseConfig(config_data: []const u8) FilterConfig {
             .rules_start = rules_start,
             .rules_len = rule_count - rules_start,
         };
+        compileRoutePlan(&route_rules[route_count], &slot_count, &table_count);
         route_count += 1;
     }
 
@@ -593,6 +850,17 @@ fn requestState(context_id: u32) *RequestState {
     return &request_states[index];
 }
 
+fn streamValueBuffer(state: *RequestState) ?*[MAX_VALUE_BYTES]u8 {
+    const index = (@intFromPtr(state) - @intFromPtr(&request_states[0])) / @sizeOf(RequestState);
+    if (value_buffers[index] == null) {
+        value_buffers[index] = value_allocator.create([MAX_VALUE_BYTES]u8) catch blk: {
+            log(LOG_WARN, "dhi envoy value buffer allocation failed");
+            break :blk null;
+        };
+    }
+    return value_buffers[index];
+}
+
 fn clearRequestState(context_id: u32) void {
     for (&request_states) |*state| {
         if (state.active and state.context_id == context_id) {
@@ -602,6 +870,23 @@ fn clearRequestState(context_id: u32) void {
     }
 }
 
+fn rejectRequest(state: *RequestState, resp_body: []const u8) u32 {
+    state.rejected = true;
+    const resp_details = "dhi_validation";
+    const resp_hdrs = "";
+    _ = host.proxy_send_local_response(
+        HTTP_STATUS_BAD_REQUEST,
+        resp_details.ptr,
+        resp_details.len,
+        resp_body.ptr,
+        resp_body.len,
+        resp_hdrs.ptr,
+        resp_hdrs.len,
+        0,
+    );
+    return ACTION_PAUSE;
+}
+
 export fn proxy_on_request_headers(context_id: u32, num_headers: u32, end_of_stream: u32) u32 {
     _ = num_headers;
 
@@ -609,6 +894,8 @@ export fn proxy_on_request_headers(context_id: u32, num_headers: u32, end_of_str
     state.has_route = false;
     state.route_index = 0;
     state.is_json = false;
+    state.rejected = false;
+    state.scanner = .{};
 
     var ct_value: [128]u8 = undefined;
     const ct = getHeader("content-type", &ct_value);
@@ -625,24 +912,17 @@ export fn proxy_on_request_headers(context_id: u32, num_headers: u32, end_of_str
     const rules = routeRules(route);
     if (rules.len == 0 or !route.body_required) return ACTION_CONTINUE;
 
-    const resp_body = "{\"error\":\"request body required\",\"valid\":false}";
-    const resp_details = "dhi_validation";
-    const resp_hdrs = "";
-    _ = proxy_send_local_response(
-        HTTP_STATUS_BAD_REQUEST,
-        resp_details.ptr,
-        resp_details.len,
-        resp_body.ptr,
-        resp_body.len,
-        resp_hdrs.ptr,
-        resp_hdrs.len,
-        0,
-    );
-    return ACTION_PAUSE;
+    return rejectRequest(state, "{\"error\":\"request body required\",\"valid\":false}");
 }
 
+// Each chunk is scanned as it arrives and, if nothing failed yet, passed on
+// rather than buffered: the filter holds no body, only its scan state. A
+// violation in any chunk sends the 400 at once; required fields are settled
+// on the last chunk, which is held until then, so the upstream never gets a
+// complete invalid request.
 export fn proxy_on_request_body(context_id: u32, body_size: u32, end_of_stream: u32) u32 {
     const state = requestState(context_id);
+    if (state.rejected) return ACTION_PAUSE;
     if (!state.is_json) return ACTION_CONTINUE;
     if (!state.has_route or state.route_index >= config.routes.len) {
         log(LOG_WARN, "dhi envoy no matching route");
@@ -656,55 +936,113 @@ export fn proxy_on_request_body(context_id: u32, body_size: u32, end_of_stream:
         return ACTION_CONTINUE;
     }
 
-    if (end_of_stream == 0) {
-        // Need more data
-        return ACTION_PAUSE;
+    const scanner = &state.scanner;
+    if (route.needs_bytes and scanner.value == null) scanner.value = streamValueBuffer(state);
+    var offset: usize = 0;
+    while (offset < body_size) {
+        const window = getHostBuffer(BUFFER_REQUEST_BODY, offset, @min(body_size - offset, BODY_WINDOW_BYTES));
+        if (window.len == 0) break;
+        offset += window.len;
+        if (!scanBody(scanner, route, window)) {
+            return rejectRequest(state, "{\"error\":\"validation failed\",\"valid\":false}");
+        }
     }
+    scanner.body_bytes += offset;
 
-    const body = if (body_size > 0)
-        getHostBuffer(BUFFER_REQUEST_BODY, 0, body_size)
-    else
-        "";
+    if (end_of_stream == 0) return ACTION_CONTINUE;
 
-    if (body.len == 0) {
+    if (scanner.body_bytes == 0) {
         if (!route.body_required) return ACTION_CONTINUE;
-
-        const resp_body = "{\"error\":\"empty request body\",\"valid\":false}";
-        const resp_details = "dhi_validation";
-        const resp_hdrs = "";
-        _ = proxy_send_local_response(
-            HTTP_STATUS_BAD_REQUEST,
-            resp_details.ptr,
-            resp_details.len,
-            resp_body.ptr,
-            resp_body.len,
-            resp_hdrs.ptr,
-            resp_hdrs.len,
-            0,
-        );
-        return ACTION_PAUSE;
-    }
-
-    if (validateBodyWithRules(body, rules)) {
-        return ACTION_CONTINUE;
+        return rejectRequest(state, "{\"error\":\"empty request body\",\"valid\":false}");
     }
 
-    const resp_body = "{\"error\":\"validation failed\",\"valid\":false}";
-    const resp_details = "dhi_validation";
-    const resp_hdrs = "";
-    _ = proxy_send_local_response(
-        HTTP_STATUS_BAD_REQUEST,
-        resp_details.ptr,
-        resp_details.len,
-        resp_body.ptr,
-        resp_body.len,
-        resp_hdrs.ptr,
-        resp_hdrs.len,
-        0,
-    );
-    return ACTION_PAUSE;
+    if (!finishBody(scanner, route)) {
+        return rejectRequest(state, "{\"error\":\"validation failed\",\"valid\":false}");
+    }
+    return ACTION_CONTINUE;
 }
 
 export fn proxy_on_log(context_id: u32) void {
     clearRequestState(context_id);
 }
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+fn testRoute(config_text: []const u8) RouteRule {
+    config = parseConfig(config_text);
+    return config.routes[0];
+}
+
+/// Scan body in two chunks split at `split`, then settle it.
+fn scanSplit(route: RouteRule, body: []const u8, split: usize) bool {
+    var value: [MAX_VALUE_BYTES]u8 = undefined;
+    var scanner: BodyScanner = .{ .value = &value };
+    if (!scanBody(&scanner, route, body[0..split])) return false;
+    if (!scanBody(&scanner, route, body[split..])) return false;
+    return finishBody(&scanner, route);
+}
+
+/// The verdict must not depend on where the body is cut: every two-chunk
+/// split, and one byte per chunk.
+fn expectAtEveryBoundary(config_text: []const u8, body: []const u8, expected: bool) !void {
+    const route = testRoute(config_text);
+    for (0..body.len + 1) |split| {
+        std.testing.expectEqual(expected, scanSplit(route, body, split)) catch |err| {
+            std.debug.print("split at {d}: {s}\n", .{ split, body });
+            return err;
+        };
+    }
+
+    var value: [MAX_VALUE_BYTES]u8 = undefined;
+    var scanner: BodyScanner = .{ .value = &value };
+    var ok = true;
+    for (0..body.len) |i| {
+        if (!scanBody(&scanner, route, body[i .. i + 1])) {
+            ok = false;
+            break;
+        }
+    }
+    if (ok) ok = finishBody(&scanner, route);
+    try std.testing.expectEqual(expected, ok);
+}
+
+const test_rules = "email:email,name:str_len:1:10,age:int:0:150";
+
+test "keys and values split across chunks" {
+    try expectAtEveryBoundary(test_rules, "{\"email\":\"ann@example.com\",\"name\":\"Ann\",\"age\":42}", true);
+    try expectAtEveryBoundary(test_rules, "{ \"age\" : -7 , \"name\" : \"Ann\" , \"email\" : \"ann@example.com\" }", false);
+    try expectAtEveryBoundary(test_rules, "{\"email\":\"not-an-email\",\"name\":\"Ann\",\"age\":42}", false);
+    try expectAtEveryBoundary(test_rules, "{\"email\":\"ann@example.com\",\"name\":\"\",\"age\":42}", false);
+    try expectAtEveryBoundary(test_rules, "{\"email\":\"ann@example.com\",\"name\":\"Ann\",\"age\":151}", false);
+}
+
+test "escape sequences across a chunk edge" {
+    // The escaped quote must not end the string: raw length 5
+    try expectAtEveryBoundary("name:str_len:5:5", "{\"name\":\"a\\\"bc\"}", true);
+    // Escaped quotes and backslashes in other strings don't derail key matching
+    try expectAtEveryBoundary("name:str_len:5:5", "{\"x\":\"\\\"\",\"o\":{\"k\":\"\\\\\"},\"name\":\"abcde\"}", true);
+    try expectAtEveryBoundary("name:str_len:5:5", "{\"na\\\"me\":\"abcde\"}", false);
+}
+
+test "repeated keys: the first occurrence wins" {
+    try expectAtEveryBoundary("age:int:0:150", "{\"age\":5,\"age\":500}", true);
+    try expectAtEveryBoundary("age:int:0:150", "{\"age\":500,\"age\":5}", false);
+}
+
+test "required field arriving at the end of the body" {
+    try expectAtEveryBoundary("age:int:0:150", "{\"other\":[1,{\"age\":900}],\"pad\":\"xxxxxxxx\",\"age\":7}", true);
+    try expectAtEveryBoundary("age:int:0:150", "{\"other\":[1,{\"age\":9}],\"pad\":\"age\"}", false);
+    try expectAtEveryBoundary("age:int:0:150", "{\"pad\":1,\"age\":12", true);
+    try expectAtEveryBoundary("age:?int:0:150", "{\"pad\":1}", true);
+}
+
+test "values longer than MAX_VALUE_BYTES" {
+    const at_limit = "a" ** (MAX_VALUE_BYTES - "@b.co".len) ++ "@b.co";
+    const over_limit = "a" ++ at_limit;
+    try expectAtEveryBoundary("email:email", "{\"email\":\"" ++ at_limit ++ "\"}", true);
+    try expectAtEveryBoundary("email:email", "{\"email\":\"" ++ over_limit ++ "\"}", false);
+    // Length-only rules need no copy, so they have no limit
+    try expectAtEveryBoundary("name:str_len:1:5000", "{\"name\":\"" ++ over_limit ++ "\"}", true);
+}
@@ -804,6 +804,134 @@ pub fn processEscapes(input: []const u8, allocator: std.mem.Allocator) ![]u8 {
     return try result.toOwnedSlice(allocator);
 }
 
+// ============================================================================
+// SIMD Newline Scan (NDJSON record splitting)
+// ============================================================================
+
+/// Find the next '\n' at or after `start`, 32 bytes at a time.
+/// Returns json.len when there is none.
+pub fn findNewline(json: []const u8, start: usize) usize {
+    var i = start;
+
+    const Block32 = @Vector(32, u8);
+    const newline: Block32 = @splat('\n');
+
+    while (i + 32 <= json.len) {
+        const chunk: Block32 = json[i..][0..32].*;
+        const mask: u32 = @bitCast(chunk == newline);
+        if (mask != 0) return i + @ctz(mask);
+        i += 32;
+    }
+
+    while (i < json.len) : (i += 1) {
+        if (json[i] == '\n') return i;
+    }
+    return json.len;
+}
+
+// ============================================================================
+// Stage-1 Structural Index (simdjson-style)
+// ============================================================================
+
+/// Set on a closing-quote index entry when the string contains a backslash.
+pub const structural_escape_flag: u32 = 0x8000_0000;
+
+/// Resumable stage-1 scan state (C ABI, mirrored in _native.c).
+pub const StructuralIndexState = extern struct {
+    /// Next byte to classify (advances in 32-byte chunks).
+    offset: usize = 0,
+    /// 1 while the scan is inside a string.
+    in_string: u32 = 0,
+    /// 1 if the previous chunk ended in an unescaped backslash.
+    escape_carry: u32 = 0,
+    /// 1 if the currently open string has seen a backslash.
+    string_escaped: u32 = 0,
+};
+
+/// Classify json[state.offset..] 32 bytes at a time and append the offset of
+/// every structural character outside strings ({ } [ ] : ,) plus the opening
+/// and closing quote of every string. Closing quotes of strings that contain
+/// escapes carry `structural_escape_flag`, so consumers know both string
+/// bounds and whether to unescape without rescanning the bytes.
+///
+/// Stops early when fewer than 32 free slots remain; call again with the same
+/// state to resume. Offsets must fit in 31 bits. Returns entries written.
+pub fn buildStructuralIndex(json: []const u8, state: *StructuralIndexState, out: []u32) usize {
+    var n: usize = 0;
+    var i = state.offset;
+    var tail: [32]u8 = undefined;
+
+    while (i < json.len and out.len - n >= 32) {
+        const chunk: *const [32]u8 = if (json.len - i >= 32) json[i..][0..32] else blk: {
+            @memset(&tail, ' ');
+            @memcpy(tail[0 .. json.len - i], json[i..]);
+            break :blk &tail;
+        };
+        const mask = classifyChunk32(chunk);
+        const quotes: u32 = @truncate(mask.quotes);
+        const backslashes: u32 = @truncate(mask.backslashes);
+        const structural: u32 = @truncate(mask.colons | mask.commas |
+            mask.open_braces | mask.close_braces | mask.open_brackets | mask.close_brackets);
+
+        // Bytes escaped by a preceding backslash (escapes are rare - scalar walk)
+        var escaped: u32 = 0;
+        if (backslashes != 0 or state.escape_carry != 0) {
+            var carry = state.escape_carry != 0;
+            var b: u5 = 0;
+            while (true) : (b += 1) {
+                const bit = @as(u32, 1) << b;
+                if (carry) {
+                    escaped |= bit;
+                    carry = false;
+                } else if (backslashes & bit != 0) {
+                    carry = true;
+                }
+                if (b == 31) break;
+            }
+            state.escape_carry = @intFromBool(carry);
+        }
+
+        const real_quotes = quotes & ~escaped;
+        // Lowest bit of the currently open string's bytes in this chunk
+        var string_from: u64 = 1;
+        var bits = real_quotes | structural;
+        while (bits != 0) {
+            const b: u5 = @intCast(@ctz(bits));
+            const bit = @as(u32, 1) << b;
+            bits &= bits - 1;
+            const offset: u32 = @intCast(i + b);
+
+            if (real_quotes & bit != 0) {
+                if (state.in_string != 0) {
+                    const inside: u64 = (@as(u64, bit) - 1) & ~(string_from -% 1);
+                    const had_escape = state.string_escaped != 0 or (backslashes & inside) != 0;
+                    out[n] = if (had_escape) offset | structural_escape_flag else offset;
+                    state.in_string = 0;
+                    state.string_escaped = 0;
+                } else {
+                    out[n] = offset;
+                    state.in_string = 1;
+                    string_from = @as(u64, bit) << 1;
+                }
+                n += 1;
+            } else if (state.in_string == 0) {
+                out[n] = offset;
+                n += 1;
+            }
+        }
+
+        // String still open at the chunk end: remember any escape seen so far
+        if (state.in_string != 0 and (backslashes & ~(string_from -% 1)) != 0) {
+            state.string_escaped = 1;
+        }
+
+        i += 32;
+    }
+
+    state.offset = @min(i, json.len);
+    return n;
+}
+
 // ============================================================================
 // Tests
 // ============================================================================
@@ -897,3 +1025,24 @@ test "processEscapes" {
     defer allocator.free(result3);
     try std.testing.expectEqualStrings("quote\"here", result3);
 }
+
+test "buildStructuralIndex" {
+    const json = "{\"a\": [1, \"x,}\"], \"b\\\"c\": {}}";
+    var state = StructuralIndexState{};
+    var out: [64]u32 = undefined;
+    const n = buildStructuralIndex(json, &state, &out);
+
+    // { " " : [ , " " ] , " "(escaped) : { } }
+    const expected = [_]u32{ 0, 1, 3, 4, 6, 8, 10, 14, 15, 16, 18, 23 | structural_escape_flag, 24, 26, 27, 28 };
+    try std.testing.expectEqualSlices(u32, &expected, out[0..n]);
+    try std.testing.expectEqual(@as(u32, 0), state.in_string);
+    try std.testing.expectEqual(json.len, state.offset);
+}
+
+test "findNewline" {
+    try std.testing.expectEqual(@as(usize, 3), findNewline("abc\ndef", 0));
+    try std.testing.expectEqual(@as(usize, 7), findNewline("abc\ndef", 4));
+    const long = "x" ** 40 ++ "\n" ++ "y";
+    try std.testing.expectEqual(@as(usize, 40), findNewline(long, 0));
+    try std.testing.expectEqual(long.len, findNewline(long, 41));
+}